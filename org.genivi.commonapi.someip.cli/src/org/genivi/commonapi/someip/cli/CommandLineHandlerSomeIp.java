@@ -111,6 +111,70 @@ public class CommandLineHandlerSomeIp extends AbstractCommandLineHandler impleme
 				if(parsedArguments.hasOption("nsc")) {
 					cliTool.disableSyncCalls();
 				}
+				// Generate serialized size functions
+				if(parsedArguments.hasOption("sz")) {
+					cliTool.enableSerializedSize();
+				}
+				// Generate bit packing functions
+				if(parsedArguments.hasOption("bp")) {
+					cliTool.enableBitPacking();
+				}
+				// Generate serialization benchmarks
+				if(parsedArguments.hasOption("bm")) {
+					cliTool.enableBenchmark();
+				}
+				// Generate instrumentation hooks and metrics
+				if(parsedArguments.hasOption("in")) {
+					cliTool.enableInstrumentation();
+				}
+				// Generate static tracepoints
+				if(parsedArguments.hasOption("tp")) {
+					cliTool.enableTracepoints();
+				}
+				// Generate message capture taps
+				if(parsedArguments.hasOption("cp")) {
+					cliTool.enableCapture();
+				}
+				// Generate load generators
+				if(parsedArguments.hasOption("lg")) {
+					cliTool.enableLoadGenerator();
+				}
+				// Create proxy members on first access
+				if(parsedArguments.hasOption("lm")) {
+					cliTool.enableLazyMembers();
+				}
+				// Generate views over received structs and unions
+				if(parsedArguments.hasOption("vw")) {
+					cliTool.enableViews();
+				}
+				// Generate cancellable calls and deadline based load shedding
+				if(parsedArguments.hasOption("dl")) {
+					cliTool.enableDeadlines();
+				}
+				// Decode arrays of polymorphic structs into pooled blocks
+				if(parsedArguments.hasOption("pp")) {
+					cliTool.enablePooledPolymorph();
+				}
+				// Report the widths of length and type fields that can be reduced
+				if(parsedArguments.hasOption("ws")) {
+					cliTool.enableWireSize();
+				}
+				// Serialize arrays of integers and floating point values in bulk
+				if(parsedArguments.hasOption("ba")) {
+					cliTool.enableBulkArrays();
+				}
+				// Transcode UTF-16 deployed strings in the generated code
+				if(parsedArguments.hasOption("ut")) {
+					cliTool.enableUtf16Strings();
+				}
+				// Don't cache resolved deployment properties
+				if(parsedArguments.hasOption("ndc")) {
+					cliTool.disableDeploymentCache();
+				}
+				// Write a report of the generator run
+				if(parsedArguments.hasOption("st")) {
+					cliTool.setStatisticsFile(parsedArguments.getOptionValue("st"));
+				}
 				// Switch off code generation at all
 				if(parsedArguments.hasOption("ng")) {
 					cliTool.disableCodeGeneration();
@@ -5,6 +5,10 @@
 package org.genivi.commonapi.someip.cli;
 
 import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -24,6 +28,7 @@ import org.genivi.commonapi.console.ConsoleLogger;
 import org.genivi.commonapi.core.generator.GeneratorFileSystemAccess;
 import org.genivi.commonapi.core.verification.CommandlineValidator;
 import org.genivi.commonapi.someip.generator.FrancaSomeIPGenerator;
+import org.genivi.commonapi.someip.generator.SomeIPGeneratorStatistics;
 import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP;
 import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP;
 
@@ -40,6 +45,7 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 	protected Injector injector;
 	protected IGenerator francaGenerator;
 	protected String scope = "SomeIP validation: ";
+	protected String statisticsFile = null;
 
 	private ValidationMessageAcceptor cliMessageAcceptor = new AbstractValidationMessageAcceptor() {
 
@@ -105,6 +111,10 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 		ConsoleLogger.printLog("Using Franca Version " + getFrancaVersion());
 		int error_state = NO_ERROR_STATE;
 
+		if (statisticsFile != null) {
+			SomeIPGeneratorStatistics.enable();
+		}
+
 		// Create absolute paths
 		List<String> fileList = new ArrayList<String>();
 		for (String path : _fileList) {
@@ -114,6 +124,7 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 
 		for (String file : fileList) {
 			if (file.endsWith(FDEPL_EXTENSION)) {
+				SomeIPGeneratorStatistics.beginFile(file);
 				URI uri = URI.createFileURI(file);
 				Resource resource = null;
 				try {
@@ -123,11 +134,14 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 							.printErrorLog("Failed to create a resource from "
 									+ file + "\n" + ise.getMessage());
 					error_state = ERROR_STATE;
+					SomeIPGeneratorStatistics.endFile();
 					continue;
 				}
 				hasValidationError = false;
 				if (isValidation) {
+					long start = SomeIPGeneratorStatistics.start();
 					validateSomeIP(resource);
+					SomeIPGeneratorStatistics.stop("validation", start);
 				}
 
 				if (hasValidationError) {
@@ -151,7 +165,9 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 							fsa.setOutputConfigurations(FPreferencesSomeIP.getInstance()
 								.getOutputpathConfiguration(subdir));
 							}
+						long start = SomeIPGeneratorStatistics.start();
 						francaGenerator.doGenerate(resource, fsa);
+						SomeIPGeneratorStatistics.stop("generation", start);
 					} catch (Exception e) {
 						System.err.println("Failed to generate code for "
 								+ file + " due to " + e.getMessage());
@@ -164,6 +180,7 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 					resource.unload();
 					rsset.getResources().clear();
 				}
+				SomeIPGeneratorStatistics.endFile();
 			} else {
 				ConsoleLogger
 						.printLog("Cannot generate code for the following file, because it does not have the "
@@ -176,9 +193,23 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 		}
 		fsa.clearFileList();
 		dumpGeneratedFiles = false;
+		if (statisticsFile != null) {
+			writeStatistics();
+		}
 		return error_state;
 	}
 
+	private void writeStatistics() {
+		try {
+			Files.write(Paths.get(statisticsFile),
+					SomeIPGeneratorStatistics.toJson().getBytes(StandardCharsets.UTF_8));
+			ConsoleLogger.printLog("Generator statistics written to " + statisticsFile);
+		} catch (IOException e) {
+			ConsoleLogger.printErrorLog("Failed to write the generator statistics to "
+					+ statisticsFile + ": " + e.getMessage());
+		}
+	}
+
 	/**
 	 * Validate the resource (fdepl file)
 	 *
@@ -337,4 +368,147 @@ public class SomeIPCommandlineToolMain extends CommandlineTool {
 						PreferenceConstantsSomeIP.P_GENERATE_SYNC_CALLS_SOMEIP,
 						"false");
 	}
+
+	/**
+	 * Set a preference value to enable the generation of serialized size functions
+	 */
+	public void enableSerializedSize() {
+		ConsoleLogger.printLog("Code generation for serialized sizes is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_SERIALIZED_SIZE_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to enable the generation of bit packing functions
+	 */
+	public void enableBitPacking() {
+		ConsoleLogger.printLog("Code generation for bit packing is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_BIT_PACKING_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to enable the generation of serialization benchmarks
+	 */
+	public void enableBenchmark() {
+		ConsoleLogger.printLog("Code generation for serialization benchmarks is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_BENCHMARK_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to disable the caching of resolved deployment properties
+	 */
+	public void disableDeploymentCache() {
+		ConsoleLogger.printLog("Caching of deployment properties is off");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_CACHE_DEPLOYMENT_SOMEIP, "false");
+	}
+
+	/**
+	 * Set the file the statistics of the generator run are written to
+	 */
+	public void setStatisticsFile(String _file) {
+		ConsoleLogger.printLog("Generator statistics: " + _file);
+		statisticsFile = _file;
+	}
+
+	/**
+	 * Set a preference value to enable the generation of instrumentation hooks and metrics
+	 */
+	public void enableInstrumentation() {
+		ConsoleLogger.printLog("Code generation for instrumentation hooks is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_INSTRUMENTATION_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to enable the generation of static tracepoints
+	 */
+	public void enableTracepoints() {
+		ConsoleLogger.printLog("Code generation for static tracepoints is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_TRACEPOINTS_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to enable the generation of message capture taps
+	 */
+	public void enableCapture() {
+		ConsoleLogger.printLog("Code generation for message capture is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_CAPTURE_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to enable the generation of load generators
+	 */
+	public void enableLoadGenerator() {
+		ConsoleLogger.printLog("Code generation for load generators is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_LOAD_GENERATOR_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to create the attribute and broadcast members of proxies on first access
+	 */
+	public void enableLazyMembers() {
+		ConsoleLogger.printLog("Lazy creation of proxy members is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_LAZY_MEMBERS_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to generate read-only views over received structs and unions
+	 */
+	public void enableViews() {
+		ConsoleLogger.printLog("Generation of views is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_VIEWS_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to generate cancellable calls and deadline based load shedding
+	 */
+	public void enableDeadlines() {
+		ConsoleLogger.printLog("Generation of deadlines is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_GENERATE_DEADLINES_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to decode arrays of polymorphic structs into pooled blocks
+	 */
+	public void enablePooledPolymorph() {
+		ConsoleLogger.printLog("Pooled decoding of polymorphic arrays is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_POOLED_POLYMORPH_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to write the wire size report and fdepl of each interface
+	 */
+	public void enableWireSize() {
+		ConsoleLogger.printLog("Wire size report is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_WIRE_SIZE_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to serialize arrays of integers and floating point values in bulk
+	 */
+	public void enableBulkArrays() {
+		ConsoleLogger.printLog("Bulk serialization of arrays is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_BULK_ARRAYS_SOMEIP, "true");
+	}
+
+	/**
+	 * Set a preference value to transcode UTF-16 deployed strings in the generated code
+	 */
+	public void enableUtf16Strings() {
+		ConsoleLogger.printLog("Generated transcoding of UTF-16 strings is on");
+		someIpPref.setPreference(
+				PreferenceConstantsSomeIP.P_UTF16_STRINGS_SOMEIP, "true");
+	}
 }
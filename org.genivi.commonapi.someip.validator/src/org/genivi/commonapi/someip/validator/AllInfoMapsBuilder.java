@@ -5,10 +5,14 @@
 package org.genivi.commonapi.someip.validator;
 
 import org.franca.core.franca.impl.FModelImpl;
+import java.io.BufferedReader;
+import java.io.BufferedWriter;
 import java.io.File;
 import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
 import java.util.*;
-import java.util.Map.Entry;
 
 import org.eclipse.emf.common.util.URI;
 import org.eclipse.emf.ecore.EObject;
@@ -16,152 +20,318 @@ import org.eclipse.emf.ecore.resource.Resource;
 import org.eclipse.emf.ecore.resource.ResourceSet;
 import org.eclipse.emf.ecore.resource.impl.ResourceSetImpl;
 import org.franca.core.franca.FInterface;
-import org.franca.core.franca.FModel;
 import org.franca.core.franca.FTypeCollection;
 
+/**
+ * Index of the packages, type collections and interfaces of all .fidl files below a
+ * directory. The index is updated file by file and is kept on disk between sessions,
+ * so that only files which were modified since the last run have to be parsed again.
+ */
 public class AllInfoMapsBuilder {
 
+    private static final String CACHE_HEADER = "# CommonAPI SomeIP validator index 1";
+    // time stamp of entries which were taken from an editor and not from the file
+    private static final long NOT_SAVED = 0L;
+
     private String path = "";
     public Map<String, Triple<String, ArrayList<String>, ArrayList<String>>> allInfo = new HashMap<String, Triple<String, ArrayList<String>, ArrayList<String>>>();
-    private Triple<String, ArrayList<String>, ArrayList<String>> infoTriple;
     private ResourceSet resourceSet = null;
-    public Map<String, HashMap<String, HashSet<String>>> fastAllInfo = new HashMap<String, HashMap<String, HashSet<String>>>();
+    // name -> package -> files
+    public final Map<String, HashMap<String, HashSet<String>>> fastAllInfo = new HashMap<String, HashMap<String, HashSet<String>>>();
+    // package and all of its parent packages -> files
+    private Map<String, HashSet<String>> packageInfo = new HashMap<String, HashSet<String>>();
+    // file -> last modification time of the file when it was indexed
+    private Map<String, Long> timeStamps = new HashMap<String, Long>();
+    private File cacheDirectory = null;
+
+    /**
+     * Sets the directory the index is persisted to. Without a cache directory the
+     * index is rebuilt from the files at every start.
+     */
+    public synchronized void setCacheDirectory(File cacheDirectory) {
+        this.cacheDirectory = cacheDirectory;
+    }
 
-    public boolean buildAllInfos(String path) {
+    public synchronized boolean buildAllInfos(String path) {
         if (this.path.equals(path)) {
             return false;
         }
         resourceSet = new ResourceSetImpl();
         this.path = path;
-        allInfo.clear();
-        buildAllInfo(path);
-        fastAllInfo.clear();
-        buildFastAllInfo();
+        clear();
+        Map<String, Triple<String, ArrayList<String>, ArrayList<String>>> cachedInfo = new HashMap<String, Triple<String, ArrayList<String>, ArrayList<String>>>();
+        Map<String, Long> cachedTimeStamps = new HashMap<String, Long>();
+        loadCache(cachedInfo, cachedTimeStamps);
+        buildAllInfo(path, cachedInfo, cachedTimeStamps);
+        saveCache();
+        resourceSet = null;
         return true;
-
-    }
-
-    public void buildAllInfo(Set<EObject> resourceSet) {
-        allInfo.clear();
-        buildAllInfos(resourceSet);
-        fastAllInfo.clear();
-        buildFastAllInfo();
     }
 
-    private void buildAllInfos(Set<EObject> ressourceSet) {
-        for (EObject model : ressourceSet) {
+    public synchronized void buildAllInfo(Set<EObject> resourceSet) {
+        // the index does not describe a directory anymore
+        path = "";
+        clear();
+        for (EObject model : resourceSet) {
             if (model != null) {
                 Resource resource = model.eResource();
                 if (resource != null) {
-                    ArrayList<String> typeCollectionList = new ArrayList<String>();
-                    ArrayList<String> interfaceList = new ArrayList<String>();
-                    for (EObject e : model.eContents()) {
-                        if (e instanceof FTypeCollection
-                                && !(e instanceof FInterface)) {
-                            typeCollectionList.add(((FTypeCollection) e).getName());
-                        }
-                        if (e instanceof FInterface) {
-                            interfaceList.add(((FInterface) e).getName());
-                        }
-                    }
-                    infoTriple = new Triple<String, ArrayList<String>, ArrayList<String>>(
-                            ((FModelImpl) model).getName(), typeCollectionList,
-                            interfaceList);
-                    allInfo.put(((FModel) model).eResource().getURI().toString(),
-                            infoTriple);
+                    addInfo(resource.getURI().toString(), createInfo(model), NOT_SAVED);
                 }
             }
         }
     }
 
-    private void buildFastAllInfo() {
+    public synchronized void updateAllInfo(EObject model, String absolutPath) {
+        if (model == null) {
+            return;
+        }
+        Triple<String, ArrayList<String>, ArrayList<String>> info = createInfo(model);
+        if (isSameInfo(allInfo.get(absolutPath), info)) {
+            return;
+        }
+        // the editor content may differ from the file, parse it again at the next start
+        addInfo(absolutPath, info, NOT_SAVED);
+        saveCache();
+    }
 
-        for (Entry<String, Triple<String, ArrayList<String>, ArrayList<String>>> entry : allInfo
-                .entrySet()) {
-            addNames(entry, entry.getValue().interfaceList);
-            addNames(entry, entry.getValue().typeCollectionList);
+    /**
+     * Returns the files whose package is the given package or one of its sub packages.
+     */
+    public synchronized Set<String> getFilesOfPackage(String packageName) {
+        HashSet<String> files = packageInfo.get(packageName);
+        if (files == null) {
+            return Collections.emptySet();
         }
+        return new HashSet<String>(files);
     }
 
-    private void addNames(
-            Entry<String, Triple<String, ArrayList<String>, ArrayList<String>>> entry,
-            ArrayList<String> arrayList) {
-        for (String name : arrayList) {
-            HashMap<String, HashSet<String>> hilfMap = new HashMap<String, HashSet<String>>();
-            HashSet<String> hilfSet = new HashSet<String>();
-            if (fastAllInfo.containsKey(name)) {
-                hilfMap = fastAllInfo.get(name);
-                if (hilfMap.containsKey(entry.getValue().packageName)) {
-                    hilfSet = hilfMap.get(entry.getValue().packageName);
-                    hilfSet.add(entry.getKey());
-                    hilfMap.put(entry.getValue().packageName, hilfSet);
-                    fastAllInfo.put(name, hilfMap);
+    private void clear() {
+        allInfo.clear();
+        fastAllInfo.clear();
+        packageInfo.clear();
+        timeStamps.clear();
+    }
+
+    private Triple<String, ArrayList<String>, ArrayList<String>> createInfo(EObject model) {
+        ArrayList<String> typeCollectionList = new ArrayList<String>();
+        ArrayList<String> interfaceList = new ArrayList<String>();
+        for (EObject e : model.eContents()) {
+            if (e instanceof FTypeCollection && !(e instanceof FInterface)) {
+                typeCollectionList.add(((FTypeCollection) e).getName());
+            }
+            if (e instanceof FInterface) {
+                interfaceList.add(((FInterface) e).getName());
+            }
+        }
+        return new Triple<String, ArrayList<String>, ArrayList<String>>(
+                ((FModelImpl) model).getName(), typeCollectionList, interfaceList);
+    }
+
+    private static boolean isSameInfo(Triple<String, ArrayList<String>, ArrayList<String>> oldInfo,
+            Triple<String, ArrayList<String>, ArrayList<String>> newInfo) {
+        return oldInfo != null
+                && Objects.equals(oldInfo.packageName, newInfo.packageName)
+                && oldInfo.typeCollectionList.equals(newInfo.typeCollectionList)
+                && oldInfo.interfaceList.equals(newInfo.interfaceList);
+    }
+
+    private void addInfo(String file, Triple<String, ArrayList<String>, ArrayList<String>> info, long timeStamp) {
+        removeInfo(file);
+        allInfo.put(file, info);
+        timeStamps.put(file, timeStamp);
+        addNames(file, info.packageName, info.interfaceList);
+        addNames(file, info.packageName, info.typeCollectionList);
+        if (info.packageName != null) {
+            for (String packageName : getPackages(info.packageName)) {
+                HashSet<String> files = packageInfo.get(packageName);
+                if (files == null) {
+                    files = new HashSet<String>();
+                    packageInfo.put(packageName, files);
                 }
+                files.add(file);
             }
-            hilfSet.add(entry.getKey());
-            hilfMap.put(entry.getValue().packageName, hilfSet);
-            fastAllInfo.put(name, hilfMap);
         }
     }
 
-    public void updateAllInfo(EObject model, String absolutPath) {
-        ArrayList<String> typeCollectionList = new ArrayList<String>();
-        ArrayList<String> interfaceList = new ArrayList<String>();
-        if (model != null) {
-            for (EObject e : model.eContents()) {
-                if (e instanceof FTypeCollection && !(e instanceof FInterface)) {
-                    typeCollectionList.add(((FTypeCollection) e).getName());
+    private void removeInfo(String file) {
+        Triple<String, ArrayList<String>, ArrayList<String>> info = allInfo.remove(file);
+        timeStamps.remove(file);
+        if (info == null) {
+            return;
+        }
+        removeNames(file, info.packageName, info.interfaceList);
+        removeNames(file, info.packageName, info.typeCollectionList);
+        if (info.packageName != null) {
+            for (String packageName : getPackages(info.packageName)) {
+                HashSet<String> files = packageInfo.get(packageName);
+                if (files != null) {
+                    files.remove(file);
+                    if (files.isEmpty()) {
+                        packageInfo.remove(packageName);
+                    }
                 }
-                if (e instanceof FInterface) {
-                    interfaceList.add(((FInterface) e).getName());
+            }
+        }
+    }
+
+    private void addNames(String file, String packageName, ArrayList<String> names) {
+        for (String name : names) {
+            HashMap<String, HashSet<String>> packages = fastAllInfo.get(name);
+            if (packages == null) {
+                packages = new HashMap<String, HashSet<String>>();
+                fastAllInfo.put(name, packages);
+            }
+            HashSet<String> files = packages.get(packageName);
+            if (files == null) {
+                files = new HashSet<String>();
+                packages.put(packageName, files);
+            }
+            files.add(file);
+        }
+    }
+
+    private void removeNames(String file, String packageName, ArrayList<String> names) {
+        for (String name : names) {
+            HashMap<String, HashSet<String>> packages = fastAllInfo.get(name);
+            if (packages == null) {
+                continue;
+            }
+            HashSet<String> files = packages.get(packageName);
+            if (files != null) {
+                files.remove(file);
+                if (files.isEmpty()) {
+                    packages.remove(packageName);
                 }
             }
-            infoTriple = new Triple<String, ArrayList<String>, ArrayList<String>>(
-                    ((FModelImpl) model).getName(), typeCollectionList,
-                    interfaceList);
-            allInfo.put(absolutPath, infoTriple);
+            if (packages.isEmpty()) {
+                fastAllInfo.remove(name);
+            }
         }
-        fastAllInfo.clear();
-        buildFastAllInfo();
     }
 
-    private void buildAllInfo(String path) {
+    // "a.b.c" -> "a", "a.b", "a.b.c"
+    private static List<String> getPackages(String packageName) {
+        List<String> packages = new ArrayList<String>();
+        int index = packageName.indexOf('.');
+        while (index >= 0) {
+            packages.add(packageName.substring(0, index));
+            index = packageName.indexOf('.', index + 1);
+        }
+        packages.add(packageName);
+        return packages;
+    }
+
+    private void buildAllInfo(String path,
+            Map<String, Triple<String, ArrayList<String>, ArrayList<String>>> cachedInfo,
+            Map<String, Long> cachedTimeStamps) {
 
         File folder = new File(path);
-        for (File file : folder.listFiles()) {
+        File[] files = folder.listFiles();
+        if (files == null) {
+            return;
+        }
+        for (File file : files) {
             if (file.isDirectory()) {
                 String directoryName = file.getName();
                 if (!(directoryName.equals("bin") || directoryName.equals(".settings")))
-                    buildAllInfo(path + "/" + directoryName);
+                    buildAllInfo(path + "/" + directoryName, cachedInfo, cachedTimeStamps);
             }
             if (file.isFile()) {
                 if (file.getName().endsWith(".fidl")) {
+                    String absolutPath = file.getAbsolutePath().replace("\\", "/");
+                    long lastModified = file.lastModified();
+                    Long cachedTimeStamp = cachedTimeStamps.get(absolutPath);
+                    if (cachedTimeStamp != null && cachedTimeStamp.longValue() == lastModified) {
+                        addInfo(absolutPath, cachedInfo.get(absolutPath), lastModified);
+                        continue;
+                    }
                     String cwd = "file:/" + path;
                     EObject model = buildResource(file.getName(), cwd);
-                    ArrayList<String> typeCollectionList = new ArrayList<String>();
-                    ArrayList<String> interfaceList = new ArrayList<String>();
                     if (model != null) {
-                        for (EObject e : model.eContents()) {
-                            if (e instanceof FTypeCollection
-                                    && !(e instanceof FInterface)) {
-                                typeCollectionList.add(((FTypeCollection) e)
-                                        .getName());
-                            }
-                            if (e instanceof FInterface) {
-                                interfaceList.add(((FInterface) e).getName());
-                            }
-                        }
-                        infoTriple = new Triple<String, ArrayList<String>, ArrayList<String>>(
-                                ((FModelImpl) model).getName(),
-                                typeCollectionList, interfaceList);
-                        allInfo.put(file.getAbsolutePath().replace("\\", "/"),
-                                infoTriple);
+                        addInfo(absolutPath, createInfo(model), lastModified);
                     }
                 }
             }
         }
     }
 
+    private File getCacheFile() {
+        if (cacheDirectory == null || path.isEmpty()) {
+            return null;
+        }
+        return new File(cacheDirectory, "someip-index-" + Integer.toHexString(path.hashCode()) + ".txt");
+    }
+
+    // Cache format: header line, root directory, then one line per file:
+    // <file> TAB <time stamp> TAB <package> TAB <type collections> TAB <interfaces>
+    private void loadCache(Map<String, Triple<String, ArrayList<String>, ArrayList<String>>> cachedInfo,
+            Map<String, Long> cachedTimeStamps) {
+        File cacheFile = getCacheFile();
+        if (cacheFile == null || !cacheFile.isFile()) {
+            return;
+        }
+        try (BufferedReader reader = Files.newBufferedReader(cacheFile.toPath(), StandardCharsets.UTF_8)) {
+            if (!CACHE_HEADER.equals(reader.readLine()) || !path.equals(reader.readLine())) {
+                return;
+            }
+            String line;
+            while ((line = reader.readLine()) != null) {
+                String[] fields = line.split("\t", -1);
+                if (fields.length != 5) {
+                    continue;
+                }
+                try {
+                    cachedTimeStamps.put(fields[0], Long.parseLong(fields[1]));
+                } catch (NumberFormatException e) {
+                    continue;
+                }
+                cachedInfo.put(fields[0], new Triple<String, ArrayList<String>, ArrayList<String>>(
+                        fields[2].isEmpty() ? null : fields[2], splitNames(fields[3]), splitNames(fields[4])));
+            }
+        } catch (IOException e) {
+            cachedInfo.clear();
+            cachedTimeStamps.clear();
+        }
+    }
+
+    private void saveCache() {
+        File cacheFile = getCacheFile();
+        if (cacheFile == null) {
+            return;
+        }
+        File tempFile = new File(cacheFile.getPath() + ".tmp");
+        try {
+            cacheFile.getParentFile().mkdirs();
+            try (BufferedWriter writer = Files.newBufferedWriter(tempFile.toPath(), StandardCharsets.UTF_8)) {
+                writer.write(CACHE_HEADER);
+                writer.newLine();
+                writer.write(path);
+                writer.newLine();
+                for (Map.Entry<String, Triple<String, ArrayList<String>, ArrayList<String>>> entry : allInfo.entrySet()) {
+                    Triple<String, ArrayList<String>, ArrayList<String>> info = entry.getValue();
+                    writer.write(entry.getKey() + "\t" + timeStamps.get(entry.getKey()) + "\t"
+                            + (info.packageName == null ? "" : info.packageName) + "\t"
+                            + String.join(",", info.typeCollectionList) + "\t"
+                            + String.join(",", info.interfaceList));
+                    writer.newLine();
+                }
+            }
+            Files.move(tempFile.toPath(), cacheFile.toPath(), StandardCopyOption.REPLACE_EXISTING);
+        } catch (IOException e) {
+            // the index still works without its cache
+            tempFile.delete();
+        }
+    }
+
+    private static ArrayList<String> splitNames(String names) {
+        ArrayList<String> list = new ArrayList<String>();
+        if (!names.isEmpty()) {
+            list.addAll(Arrays.asList(names.split(",")));
+        }
+        return list;
+    }
+
     private EObject buildResource(String filename, String cwd) {
 
         URI fileURI = normalizeURI(URI.createURI(filename));
@@ -179,6 +349,8 @@ public class AllInfoMapsBuilder {
             resource.load(Collections.EMPTY_MAP);
         } catch (IOException e) {
             return null;
+        } catch (RuntimeException e) {
+            return null;
         }
         try {
             return resource.getContents().get(0);
@@ -4,6 +4,7 @@
    file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 package org.genivi.commonapi.someip.validator;
 
+import java.io.File;
 import java.io.IOException;
 import java.util.ArrayList;
 import java.util.Collections;
@@ -55,7 +56,7 @@ public class ValidatorSomeIP implements IFrancaExternalValidator
     private FTypeCycleDetector                            cycleDetector;
     private HashMap<String, HashSet<String>>              importList   = new HashMap<String, HashSet<String>>();
     private AllInfoMapsBuilder                            aimBuilder   = new AllInfoMapsBuilder();
-    private Map<String, HashMap<String, HashSet<String>>> fastAllInfo  = new HashMap<String, HashMap<String, HashSet<String>>>();
+    private Map<String, HashMap<String, HashSet<String>>> fastAllInfo  = aimBuilder.fastAllInfo;
     private Boolean                                       hasChanged   = false;
     private ResourceSet                                   resourceSet;
     private Set<EObject>                                  resourceList = new HashSet<EObject>();
@@ -118,15 +119,11 @@ public class ValidatorSomeIP implements IFrancaExternalValidator
                 String cwd = filePath.removeLastSegments(segCount).toString();
                 if (isWholeWorkspaceCheckActive())
                 {
-                    if (aimBuilder.buildAllInfos(cwd))
-                    {
-                        fastAllInfo = aimBuilder.fastAllInfo;
-                    }
-                    else
+                    aimBuilder.setCacheDirectory(getIndexCacheDirectory());
+                    if (!aimBuilder.buildAllInfos(cwd))
                     {
                         if (!uri.segment(2).toString().equals("bin"))
                             aimBuilder.updateAllInfo(model, filePath.toString());
-                        fastAllInfo = aimBuilder.fastAllInfo;
                     }
                 }
                 else
@@ -347,34 +344,35 @@ public class ValidatorSomeIP implements IFrancaExternalValidator
         String type = "typeCollection name";
         if (fTypeCollection instanceof FInterface)
             type = "interface name";
-        for (Entry<String, Triple<String, ArrayList<String>, ArrayList<String>>> entry : aimBuilder.allInfo.entrySet())
+        String filePath = cwd + "/" + fileName;
+        HashSet<String> importPaths = importList.get(filePath);
+        if (importPaths == null)
+        {
+            return;
+        }
+        String packageName = model.getName() + "." + fTypeCollection.getName();
+        for (String otherFilePath : aimBuilder.getFilesOfPackage(packageName))
         {
-            if (!entry.getKey().equals(cwd + "/" + fileName))
+            if (!otherFilePath.equals(filePath))
             {
-                Triple<String, ArrayList<String>, ArrayList<String>> entryValue = entry.getValue();
-                if (entryValue.packageName != null)
+                Triple<String, ArrayList<String>, ArrayList<String>> otherInfo = aimBuilder.allInfo.get(otherFilePath);
+                if (otherInfo == null)
                 {
-                    if (entryValue.packageName.startsWith(model.getName() + "." + fTypeCollection.getName()))
-                    {
-                        HashSet<String> importPaths = importList.get(cwd + "/" + fileName);
-                        if (importPaths != null)
-                        {
-                            if (importPaths.contains(entry.getKey()))
-                            {
-                                acceptError(
-                                        "Imported file's package " + entryValue.packageName + " may not start with package "
-                                                + model.getName() + " + " + type + " " + fTypeCollection.getName(), fTypeCollection,
-                                        FrancaPackage.Literals.FMODEL_ELEMENT__NAME, -1, messageAcceptor);
-                            }
-                            else
-                            {
-                                acceptWarning(
-                                        "File's package " + entryValue.packageName + " starts with package "
-                                                + model.getName() + " + " + type + " " + fTypeCollection.getName(), fTypeCollection, null, -1,
-                                        messageAcceptor);
-                            }
-                        }
-                    }
+                    continue;
+                }
+                if (importPaths.contains(otherFilePath))
+                {
+                    acceptError(
+                            "Imported file's package " + otherInfo.packageName + " may not start with package "
+                                    + model.getName() + " + " + type + " " + fTypeCollection.getName(), fTypeCollection,
+                            FrancaPackage.Literals.FMODEL_ELEMENT__NAME, -1, messageAcceptor);
+                }
+                else
+                {
+                    acceptWarning(
+                            "File's package " + otherInfo.packageName + " starts with package "
+                                    + model.getName() + " + " + type + " " + fTypeCollection.getName(), fTypeCollection, null, -1,
+                            messageAcceptor);
                 }
             }
         }
@@ -501,6 +499,24 @@ public class ValidatorSomeIP implements IFrancaExternalValidator
         return accepted;
     }
 
+    // the workspace index is kept in the state location of the plugin
+    private File getIndexCacheDirectory()
+    {
+        CommonApiSomeIPUiPlugin plugin = CommonApiSomeIPUiPlugin.getDefault();
+        if (plugin == null)
+        {
+            return null;
+        }
+        try
+        {
+            return plugin.getStateLocation().toFile();
+        }
+        catch (IllegalStateException e)
+        {
+            return null;
+        }
+    }
+
     private boolean isWholeWorkspaceCheckActive()
     {
         return CommonApiSomeIPUiPlugin.getValidatorPreferences().getBoolean(ValidatorSomeIPPreferencesPage.ENABLED_WORKSPACE_CHECK);
@@ -0,0 +1,79 @@
+#!/bin/sh
+# Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# Generates the glue code of the verification fdepl files with and without
+# the deployment cache, prints the run times and the cache hits and misses of
+# the cached run and checks that both runs produce the same files.
+#
+# usage: measure-deployment-cache.sh <someip generator> [runs]
+#
+# The fdepl files are created from fidl/conf by running cmake once.
+
+GENERATOR=$1
+RUNS=${2:-3}
+DIR=$(cd "$(dirname "$0")" && pwd)
+
+if [ -z "$GENERATOR" ]; then
+    echo "usage: $0 <someip generator> [runs]"
+    exit 1
+fi
+
+FDEPL_FILES=$(ls "$DIR"/fidl/*.fdepl 2>/dev/null | grep -v ti_datatypes_deployment.fdepl)
+if [ -z "$FDEPL_FILES" ]; then
+    echo "No fdepl files found in $DIR/fidl, run cmake first"
+    exit 1
+fi
+
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+now() {
+    date +%s%N
+}
+
+measure() {
+    NAME=$1
+    shift
+    TOTAL=0
+    i=0
+    while [ $i -lt $RUNS ]; do
+        rm -rf "$OUT/$NAME"
+        START=$(now)
+        "$GENERATOR" -nv -ll quiet "$@" --dest "$OUT/$NAME" $FDEPL_FILES > /dev/null || exit 1
+        END=$(now)
+        TOTAL=$((TOTAL + (END - START) / 1000000))
+        i=$((i + 1))
+    done
+    echo "$NAME: $((TOTAL / RUNS)) ms per run ($RUNS runs)"
+}
+
+# Prints a counter of the total record, which is the first record of the
+# statistics file
+counter() {
+    grep -o "\"$1\": *[0-9]*" "$OUT/stats.json" | head -n 1 | sed 's/.*: *//'
+}
+
+measure uncached --no-deployment-cache
+measure cached
+
+"$GENERATOR" -nv -ll quiet --stats "$OUT/stats.json" --dest "$OUT/stats" $FDEPL_FILES > /dev/null || exit 1
+HITS=$(counter deploymentCacheHits)
+MISSES=$(counter deploymentCacheMisses)
+HITS=${HITS:-0}
+MISSES=${MISSES:-0}
+LOOKUPS=$((HITS + MISSES))
+if [ $LOOKUPS -gt 0 ]; then
+    echo "deployment cache: $HITS hits, $MISSES misses ($((100 * HITS / LOOKUPS))% hit rate)"
+else
+    echo "deployment cache: no lookups"
+fi
+
+if diff -r "$OUT/uncached" "$OUT/cached" > /dev/null; then
+    echo "generated files are identical"
+else
+    echo "generated files differ"
+    exit 1
+fi
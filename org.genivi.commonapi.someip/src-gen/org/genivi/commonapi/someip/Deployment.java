@@ -60,6 +60,10 @@ public class Deployment {
 			zero, one, four
 		}
 
+		public enum SomeIpSetterExecution {
+			Inline, Pool, Dedicated
+		}
+
 		public enum SomeIpMethodEndianess {
 			le, be
 		}
@@ -72,6 +76,10 @@ public class Deployment {
 			Header
 		}
 
+		public enum SomeIpMethodExecution {
+			Inline, Pool, Dedicated
+		}
+
 		public enum SomeIpBroadcastEndianess {
 			le, be
 		}
@@ -204,6 +212,16 @@ public class Deployment {
 			return null;
 		}
 
+		public static SomeIpSetterExecution convertSomeIpSetterExecution(String val) {
+			if (val.equals("Inline"))
+				return SomeIpSetterExecution.Inline; else
+			if (val.equals("Pool"))
+				return SomeIpSetterExecution.Pool; else
+			if (val.equals("Dedicated"))
+				return SomeIpSetterExecution.Dedicated;
+			return null;
+		}
+
 		public static SomeIpMethodEndianess convertSomeIpMethodEndianess(String val) {
 			if (val.equals("le"))
 				return SomeIpMethodEndianess.le; else
@@ -228,6 +246,16 @@ public class Deployment {
 			return null;
 		}
 
+		public static SomeIpMethodExecution convertSomeIpMethodExecution(String val) {
+			if (val.equals("Inline"))
+				return SomeIpMethodExecution.Inline; else
+			if (val.equals("Pool"))
+				return SomeIpMethodExecution.Pool; else
+			if (val.equals("Dedicated"))
+				return SomeIpMethodExecution.Dedicated;
+			return null;
+		}
+
 		public static SomeIpBroadcastEndianess convertSomeIpBroadcastEndianess(String val) {
 			if (val.equals("le"))
 				return SomeIpBroadcastEndianess.le; else
@@ -424,6 +452,12 @@ public class Deployment {
 		public List<Integer> getSomeIpEventGroups(FInterface obj) {
 			return target.getIntegerArray(obj, "SomeIpEventGroups");
 		}
+		public List<Integer> getSomeIpBatchEventGroups(FInterface obj) {
+			return target.getIntegerArray(obj, "SomeIpBatchEventGroups");
+		}
+		public List<Integer> getSomeIpBatchEventIDs(FInterface obj) {
+			return target.getIntegerArray(obj, "SomeIpBatchEventIDs");
+		}
 
 		// host 'attributes'
 		public Boolean getSomeIpAttributeReliable(FAttribute obj) {
@@ -502,6 +536,20 @@ public class Deployment {
 			if (e==null) return null;
 			return DataPropertyAccessorHelper.convertSomeIpAttributeCRCWidth(e);
 		}
+		public SomeIpSetterExecution getSomeIpSetterExecution(FAttribute obj) {
+			String e = target.getEnum(obj, "SomeIpSetterExecution");
+			if (e==null) return null;
+			return DataPropertyAccessorHelper.convertSomeIpSetterExecution(e);
+		}
+		public Integer getSomeIpNotifierDeltaID(FAttribute obj) {
+			return target.getInteger(obj, "SomeIpNotifierDeltaID");
+		}
+		public Integer getSomeIpNotifierDeltaResyncID(FAttribute obj) {
+			return target.getInteger(obj, "SomeIpNotifierDeltaResyncID");
+		}
+		public Boolean getSomeIpGetterCoalescing(FAttribute obj) {
+			return target.getBoolean(obj, "SomeIpGetterCoalescing");
+		}
 
 		// host 'methods'
 		public Boolean getSomeIpReliable(FMethod obj) {
@@ -549,6 +597,17 @@ public class Deployment {
 			if (e==null) return null;
 			return DataPropertyAccessorHelper.convertSomeIpErrorCoding(e);
 		}
+		public SomeIpMethodExecution getSomeIpMethodExecution(FMethod obj) {
+			String e = target.getEnum(obj, "SomeIpMethodExecution");
+			if (e==null) return null;
+			return DataPropertyAccessorHelper.convertSomeIpMethodExecution(e);
+		}
+		public Integer getSomeIpMethodMaxInFlight(FMethod obj) {
+			return target.getInteger(obj, "SomeIpMethodMaxInFlight");
+		}
+		public Integer getSomeIpMethodQueueDepth(FMethod obj) {
+			return target.getInteger(obj, "SomeIpMethodQueueDepth");
+		}
 
 		// host 'broadcasts'
 		public Boolean getSomeIpReliable(FBroadcast obj) {
@@ -715,6 +774,12 @@ public class Deployment {
 		public Integer getSomeIpAttrMapLengthWidth(FAttribute obj) {
 			return target.getInteger(obj, "SomeIpAttrMapLengthWidth");
 		}
+		public Integer getSomeIpAttrCompressionThreshold(FAttribute obj) {
+			return target.getInteger(obj, "SomeIpAttrCompressionThreshold");
+		}
+		public Integer getSomeIpAttrSharedMemoryThreshold(FAttribute obj) {
+			return target.getInteger(obj, "SomeIpAttrSharedMemoryThreshold");
+		}
 
 		// host 'arguments'
 		public Integer getSomeIpArgMapMinLength(FArgument obj) {
@@ -726,6 +791,12 @@ public class Deployment {
 		public Integer getSomeIpArgMapLengthWidth(FArgument obj) {
 			return target.getInteger(obj, "SomeIpArgMapLengthWidth");
 		}
+		public Integer getSomeIpArgCompressionThreshold(FArgument obj) {
+			return target.getInteger(obj, "SomeIpArgCompressionThreshold");
+		}
+		public Integer getSomeIpArgSharedMemoryThreshold(FArgument obj) {
+			return target.getInteger(obj, "SomeIpArgSharedMemoryThreshold");
+		}
 
 
 		/**
@@ -0,0 +1,153 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.deployment;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.function.Supplier;
+
+import org.eclipse.emf.ecore.EObject;
+import org.franca.deploymodel.core.FDeployedInterface;
+import org.franca.deploymodel.core.FDeployedTypeCollection;
+import org.franca.deploymodel.dsl.fDeploy.FDInterface;
+import org.franca.deploymodel.dsl.fDeploy.FDTypes;
+
+/**
+ * Memoizes the property lookups of a deployed interface or type collection.
+ *
+ * The property accessors of Core and SOME/IP, including their overwrite accessors,
+ * read every property through the generic accessor of the deployed interface or
+ * type collection. Caching its lookups by element and property name therefore
+ * covers all deployment properties at one place. Null results are cached as well.
+ * The cache lives as long as the deployed element, which is created per generator
+ * run; the deployment model must not change meanwhile.
+ */
+public class DeploymentCache
+{
+	private static final Object NO_VALUE = new Object();
+	private static final AtomicLong hits_ = new AtomicLong();
+	private static final AtomicLong misses_ = new AtomicLong();
+
+	private final Map<List<Object>, Object> values_ = new HashMap<List<Object>, Object>();
+
+	public static FDeployedInterface createDeployedInterface(FDInterface _interface, boolean _isCached) {
+		if (_isCached)
+			return new CachedInterface(_interface);
+		return new FDeployedInterface(_interface);
+	}
+
+	public static FDeployedTypeCollection createDeployedTypeCollection(FDTypes _types, boolean _isCached) {
+		if (_isCached)
+			return new CachedTypeCollection(_types);
+		return new FDeployedTypeCollection(_types);
+	}
+
+	// The counters are shared by all caches and reset at the start of a generator run
+	public static void resetCounters() {
+		hits_.set(0);
+		misses_.set(0);
+	}
+
+	public static long getHits() {
+		return hits_.get();
+	}
+
+	public static long getMisses() {
+		return misses_.get();
+	}
+
+	@SuppressWarnings("unchecked")
+	synchronized <T> T get(String _kind, EObject _object, String _property, Supplier<T> _lookup) {
+		List<Object> key = Arrays.<Object>asList(_kind, _object, _property);
+		Object value = values_.get(key);
+		if (value != null) {
+			hits_.incrementAndGet();
+			return (value == NO_VALUE ? null : (T)value);
+		}
+		misses_.incrementAndGet();
+		T result = _lookup.get();
+		values_.put(key, result == null ? NO_VALUE : result);
+		return result;
+	}
+
+	private static class CachedInterface extends FDeployedInterface {
+		private final DeploymentCache cache_ = new DeploymentCache();
+
+		CachedInterface(FDInterface _interface) {
+			super(_interface);
+		}
+
+		@Override
+		public Boolean getBoolean(EObject obj, String property) {
+			return cache_.get("Boolean", obj, property, () -> super.getBoolean(obj, property));
+		}
+
+		@Override
+		public Integer getInteger(EObject obj, String property) {
+			return cache_.get("Integer", obj, property, () -> super.getInteger(obj, property));
+		}
+
+		@Override
+		public String getString(EObject obj, String property) {
+			return cache_.get("String", obj, property, () -> super.getString(obj, property));
+		}
+
+		@Override
+		public String getEnum(EObject obj, String property) {
+			return cache_.get("Enum", obj, property, () -> super.getEnum(obj, property));
+		}
+
+		@Override
+		public List<Integer> getIntegerArray(EObject obj, String property) {
+			return cache_.get("IntegerArray", obj, property, () -> super.getIntegerArray(obj, property));
+		}
+
+		@Override
+		public List<String> getStringArray(EObject obj, String property) {
+			return cache_.get("StringArray", obj, property, () -> super.getStringArray(obj, property));
+		}
+	}
+
+	private static class CachedTypeCollection extends FDeployedTypeCollection {
+		private final DeploymentCache cache_ = new DeploymentCache();
+
+		CachedTypeCollection(FDTypes _types) {
+			super(_types);
+		}
+
+		@Override
+		public Boolean getBoolean(EObject obj, String property) {
+			return cache_.get("Boolean", obj, property, () -> super.getBoolean(obj, property));
+		}
+
+		@Override
+		public Integer getInteger(EObject obj, String property) {
+			return cache_.get("Integer", obj, property, () -> super.getInteger(obj, property));
+		}
+
+		@Override
+		public String getString(EObject obj, String property) {
+			return cache_.get("String", obj, property, () -> super.getString(obj, property));
+		}
+
+		@Override
+		public String getEnum(EObject obj, String property) {
+			return cache_.get("Enum", obj, property, () -> super.getEnum(obj, property));
+		}
+
+		@Override
+		public List<Integer> getIntegerArray(EObject obj, String property) {
+			return cache_.get("IntegerArray", obj, property, () -> super.getIntegerArray(obj, property));
+		}
+
+		@Override
+		public List<String> getStringArray(EObject obj, String property) {
+			return cache_.get("StringArray", obj, property, () -> super.getStringArray(obj, property));
+		}
+	}
+}
@@ -29,6 +29,10 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		utf8, utf16le, utf16be
 	}
 
+	public enum SomeIpExecution {
+		Inline, Pool, Dedicated
+	}
+
 	Deployment.IDataPropertyAccessor someipDataAccessor_;
 	Deployment.ProviderPropertyAccessor someipProvider_;
 
@@ -215,6 +219,28 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		return null;
 	}
 
+	public List<Integer> getSomeIpBatchEventGroups (FInterface obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				Deployment.InterfacePropertyAccessor ipa = (Deployment.InterfacePropertyAccessor) someipDataAccessor_;
+				return ipa.getSomeIpBatchEventGroups(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public List<Integer> getSomeIpBatchEventIDs (FInterface obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				Deployment.InterfacePropertyAccessor ipa = (Deployment.InterfacePropertyAccessor) someipDataAccessor_;
+				return ipa.getSomeIpBatchEventIDs(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
 	public Integer getSomeIpGetterID (FAttribute obj) {
 		try {
 			if (type_ == DeploymentType.INTERFACE) {
@@ -303,6 +329,42 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		return "false";
 	}
 
+	public SomeIpExecution getSomeIpSetterExecution (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return from(((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpSetterExecution(obj));
+		}
+		catch (java.lang.NullPointerException e) {}
+		return SomeIpExecution.Inline;
+	}
+
+	public Integer getSomeIpNotifierDeltaID (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpNotifierDeltaID(obj);
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public Integer getSomeIpNotifierDeltaResyncID (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpNotifierDeltaResyncID(obj);
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public Boolean getSomeIpGetterCoalescing (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpGetterCoalescing(obj);
+		}
+		catch (java.lang.NullPointerException e) {}
+		return false;
+	}
+
 	public Integer getSomeIpMethodID (FMethod obj) {
 		try {
 			if (type_ == DeploymentType.INTERFACE) {
@@ -332,6 +394,33 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		return "false";
 	}
 
+	public SomeIpExecution getSomeIpMethodExecution (FMethod obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return from(((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpMethodExecution(obj));
+		}
+		catch (java.lang.NullPointerException e) {}
+		return SomeIpExecution.Inline;
+	}
+
+	public Integer getSomeIpMethodMaxInFlight (FMethod obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpMethodMaxInFlight(obj);
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public Integer getSomeIpMethodQueueDepth (FMethod obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE)
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpMethodQueueDepth(obj);
+		}
+		catch (java.lang.NullPointerException e) {}
+		return 0;
+	}
+
 	public Integer getSomeIpEventID (FBroadcast obj) {
 		try {
 			if (type_ == DeploymentType.INTERFACE)
@@ -658,6 +747,32 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		return null;
 	}
 
+	public Integer getSomeIpArgCompressionThreshold (FArgument obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpArgCompressionThreshold(obj);
+			}
+			if (type_ == DeploymentType.OVERWRITE) {
+				return parent_.getSomeIpArgCompressionThreshold(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public Integer getSomeIpArgSharedMemoryThreshold (FArgument obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpArgSharedMemoryThreshold(obj);
+			}
+			if (type_ == DeploymentType.OVERWRITE) {
+				return parent_.getSomeIpArgSharedMemoryThreshold(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
 	public Integer getSomeIpAttrMapMinLength (FAttribute obj) {
 		try {
 			if (type_ == DeploymentType.INTERFACE) {
@@ -697,6 +812,32 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		return null;
 	}
 
+	public Integer getSomeIpAttrCompressionThreshold (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpAttrCompressionThreshold(obj);
+			}
+			if (type_ == DeploymentType.OVERWRITE) {
+				return parent_.getSomeIpAttrCompressionThreshold(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
+	public Integer getSomeIpAttrSharedMemoryThreshold (FAttribute obj) {
+		try {
+			if (type_ == DeploymentType.INTERFACE) {
+				return ((Deployment.InterfacePropertyAccessor) someipDataAccessor_).getSomeIpAttrSharedMemoryThreshold(obj);
+			}
+			if (type_ == DeploymentType.OVERWRITE) {
+				return parent_.getSomeIpAttrSharedMemoryThreshold(obj);
+			}
+		}
+		catch (java.lang.NullPointerException e) {}
+		return null;
+	}
+
 	public Integer getSomeIpInstanceID (FDExtensionElement obj) {
 		try {
 			if (type_ == DeploymentType.PROVIDER)
@@ -764,4 +905,32 @@ public class PropertyAccessor extends org.genivi.commonapi.core.deployment.Prope
 		}
 		return SomeIpStringEncoding.utf8;
 	}
+
+	private SomeIpExecution from(Deployment.Enums.SomeIpMethodExecution _source) {
+		if (_source != null) {
+			switch (_source) {
+			case Pool:
+				return SomeIpExecution.Pool;
+			case Dedicated:
+				return SomeIpExecution.Dedicated;
+			default:
+				return SomeIpExecution.Inline;
+			}
+		}
+		return SomeIpExecution.Inline;
+	}
+
+	private SomeIpExecution from(Deployment.Enums.SomeIpSetterExecution _source) {
+		if (_source != null) {
+			switch (_source) {
+			case Pool:
+				return SomeIpExecution.Pool;
+			case Dedicated:
+				return SomeIpExecution.Dedicated;
+			default:
+				return SomeIpExecution.Inline;
+			}
+		}
+		return SomeIpExecution.Inline;
+	}
 }
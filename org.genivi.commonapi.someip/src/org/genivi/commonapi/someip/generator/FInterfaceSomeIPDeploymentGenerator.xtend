@@ -22,6 +22,11 @@ class FInterfaceSomeIPDeploymentGenerator extends FTypeCollectionSomeIPDeploymen
 	@Inject extension FrancaGeneratorExtensions
 	@Inject extension FrancaSomeIPGeneratorExtensions
 	@Inject extension FrancaSomeIPDeploymentAccessorHelper
+	@Inject extension SomeIPCompressionGenerator
+	@Inject extension SomeIPUtf16Generator
+	@Inject extension SomeIPSharedMemoryGenerator
+	@Inject extension SomeIPBulkGenerator
+	@Inject extension SomeIPPolymorphGenerator
 
     def generateDeployment(FInterface fInterface, IFileSystemAccess fileSystemAccess,
         PropertyAccessor deploymentAccessor, IResource modelid) {
@@ -31,6 +36,21 @@ class FInterfaceSomeIPDeploymentGenerator extends FTypeCollectionSomeIPDeploymen
                 fInterface.generateDeploymentHeader(deploymentAccessor, modelid))
             fileSystemAccess.generateFile(fInterface.someipDeploymentSourcePath, IFileSystemAccess.DEFAULT_OUTPUT,
                 fInterface.generateDeploymentSource(deploymentAccessor, modelid))
+            if (fInterface.hasCompressedElements) {
+                generateCompression(fileSystemAccess)
+            }
+            if (fInterface.hasUtf16Elements) {
+                generateUtf16(fileSystemAccess)
+            }
+            if (fInterface.hasSharedMemoryElements) {
+                generateSharedMemory(fileSystemAccess)
+            }
+            if (fInterface.hasBulkElements) {
+                generateBulk(fileSystemAccess)
+            }
+            if (fInterface.hasPooledPolymorphicElements) {
+                generatePolymorph(fileSystemAccess)
+            }
         }
         else {
             // feature: suppress code generation
@@ -0,0 +1,660 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.List
+import org.eclipse.core.resources.IResource
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FArgument
+import org.franca.core.franca.FAttribute
+import org.franca.core.franca.FInterface
+import org.franca.core.franca.FMethod
+import org.franca.core.franca.FStructType
+import org.franca.core.franca.FTypeRef
+import org.franca.deploymodel.dsl.fDeploy.FDExtensionRoot
+import org.franca.deploymodel.ext.providers.FDeployedProvider
+import org.franca.deploymodel.ext.providers.ProviderUtils
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates a load generator for an interface. It either synthesizes method calls,
+ * attribute accesses and subscriptions with random values within the bounds of the
+ * deployment, or replays the requests of a message capture. Throughput and latency
+ * percentiles are reported on stdout and optionally as JSON.
+ *
+ * Synthesized load is sent through the generated proxy. Replayed requests are sent
+ * with vsomeip directly, because the proxy does not accept serialized payloads.
+ * Methods and attributes with polymorphic arguments are not synthesized.
+ */
+class FInterfaceSomeIPLoadGeneratorGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension SomeIPRandomValueGenerator
+
+    def generateLoadGenerator(FInterface _interface, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, List<FDExtensionRoot> _providers, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_LOAD_GENERATOR_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (_interface.getSomeIpServiceID == "UNDEFINED_SERVICE_ID") {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_interface.someipLoadGeneratorSourcePath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _interface.generateLoadGeneratorSource(_accessor, _providers))
+        }
+        else {
+            _fileSystemAccess.generateFile(_interface.someipLoadGeneratorSourcePath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateLoadGeneratorSource(FInterface _interface, PropertyAccessor _accessor, List<FDExtensionRoot> _providers) '''
+        «val methods = _interface.methods.filter[isGeneratable]»
+        «val attributes = _interface.attributes.filter[isGeneratable]»
+        «val types = (methods.map[inArgs].flatten.map[type] + attributes.map[type]).toList.fillableTypeRefs»
+        «generateCommonApiSomeIPLicenseHeader()»
+        #include <algorithm>
+        #include <atomic>
+        #include <chrono>
+        #include <condition_variable>
+        #include <cstdint>
+        #include <cstdlib>
+        #include <fstream>
+        #include <functional>
+        #include <iomanip>
+        #include <iostream>
+        #include <map>
+        #include <memory>
+        #include <mutex>
+        #include <random>
+        #include <set>
+        #include <sstream>
+        #include <string>
+        #include <thread>
+        #include <type_traits>
+        #include <vector>
+
+        #include <CommonAPI/CommonAPI.hpp>
+        #include <vsomeip/vsomeip.hpp>
+
+        #include <«_interface.proxyHeaderPath»>
+        #if defined(__has_include)
+        #if __has_include(<«_interface.stubDefaultHeaderPath»>)
+        #include <«_interface.stubDefaultHeaderPath»>
+        #define COMMONAPI_SOMEIP_LOAD_GENERATOR_SERVE
+        #endif
+        #endif
+        #include <«someipCaptureHeaderPath»>
+
+        «_interface.generateVersionNamespaceBegin»
+        «_interface.model.generateNamespaceBeginDeclaration»
+
+        namespace {
+
+        «generateRandomHelpers»
+
+        «types.generateFillFunctions»
+        typedef «_interface.elementName»Proxy<> Proxy;
+
+        const uint16_t SERVICE_ID = «_interface.getSomeIpServiceID»;
+
+        struct Options {
+            std::string domain = "local";
+            std::string instance = "«_interface.getDefaultInstance(_providers)»";
+            std::string connection = "client-sample";
+            std::string serviceConnection = "service-sample";
+            std::string replay;
+            std::string json;
+            std::set<std::string> operations;
+            double rate = 100.0;
+            std::size_t concurrency = 1;
+            double duration = 5.0;
+            double speed = 1.0;
+            int32_t timeout = 5000;
+            uint64_t seed = 42;
+            bool serve = false;
+            bool subscribe = true;
+        };
+
+        // An operation that is synthesized, returns whether it succeeded
+        struct Operation {
+            std::string name;
+            std::function<bool (Proxy &, std::mt19937_64 &, const CommonAPI::CallInfo &)> run;
+        };
+
+        // Latencies and errors of one operation
+        struct Statistics {
+            std::vector<int64_t> latencies;
+            uint64_t errors = 0;
+
+            void add(int64_t _latency, bool _isSuccess) {
+                latencies.push_back(_latency);
+                if (!_isSuccess)
+                    errors++;
+            }
+
+            void merge(const Statistics &_other) {
+                latencies.insert(latencies.end(), _other.latencies.begin(), _other.latencies.end());
+                errors += _other.errors;
+            }
+
+            // Latency in microseconds below which _percent of the operations finished
+            double percentile(double _percent) const {
+                if (latencies.empty())
+                    return 0.0;
+                std::size_t itsIndex = std::size_t(_percent / 100.0 * double(latencies.size()) + 0.5);
+                itsIndex = (itsIndex == 0 ? 0 : std::min(itsIndex, latencies.size()) - 1);
+                return double(latencies[itsIndex]) / 1000.0;
+            }
+        };
+
+        std::vector<Operation> getOperations() {
+            std::vector<Operation> itsOperations;
+            «FOR m : methods»
+                itsOperations.push_back({ "«m.elementName»",
+                    [](Proxy &_proxy, std::mt19937_64 &_rng, const CommonAPI::CallInfo &_info) {
+                        «FOR a : m.inArgs»
+                            «a.getTypeName(m, true)» in_«a.name»;
+                            «a.generateArgumentFill(_accessor.getOverwriteAccessor(a))»
+                        «ENDFOR»
+                        «IF m.inArgs.empty»
+                            (void)_rng;
+                        «ENDIF»
+                        «IF m.isFireAndForget»
+                            (void)_info;
+                            CommonAPI::CallStatus itsCallStatus;
+                            _proxy.«m.elementName»(«FOR a : m.inArgs»in_«a.name», «ENDFOR»itsCallStatus);
+                            return itsCallStatus == CommonAPI::CallStatus::SUCCESS;
+                        «ELSE»
+                            return _proxy.«m.elementName»Async(«FOR a : m.inArgs»in_«a.name», «ENDFOR»nullptr, &_info).get()
+                                == CommonAPI::CallStatus::SUCCESS;
+                        «ENDIF»
+                    } });
+            «ENDFOR»
+            «FOR a : attributes»
+                itsOperations.push_back({ "get«a.elementName.toFirstUpper»",
+                    [](Proxy &_proxy, std::mt19937_64 &, const CommonAPI::CallInfo &_info) {
+                        CommonAPI::CallStatus itsCallStatus;
+                        «a.getTypeName(_interface, true)» itsValue;
+                        _proxy.get«a.className»().getValue(itsCallStatus, itsValue, &_info);
+                        return itsCallStatus == CommonAPI::CallStatus::SUCCESS;
+                    } });
+                «IF !a.isReadonly»
+                    itsOperations.push_back({ "set«a.elementName.toFirstUpper»",
+                        [](Proxy &_proxy, std::mt19937_64 &_rng, const CommonAPI::CallInfo &_info) {
+                            CommonAPI::CallStatus itsCallStatus;
+                            «a.getTypeName(_interface, true)» itsValue, itsResponse;
+                            «a.generateAttributeFill(_accessor)»
+                            _proxy.get«a.className»().setValue(itsValue, itsCallStatus, itsResponse, &_info);
+                            return itsCallStatus == CommonAPI::CallStatus::SUCCESS;
+                        } });
+                «ENDIF»
+            «ENDFOR»
+            return itsOperations;
+        }
+
+        // Subscribes to all broadcasts and attribute notifications, counts the received events
+        void subscribe(Proxy &_proxy, std::atomic<uint64_t> &_events) {
+            «FOR b : _interface.broadcasts.filter[!isErrorType(_accessor)]»
+                _proxy.get«b.className»().subscribe([&_events](«b.outArgs.map['const ' + getTypeName(b, true) + ' &'].join(', ')») {
+                    _events++;
+                });
+            «ENDFOR»
+            «FOR a : _interface.attributes.filter[isObservable]»
+                _proxy.get«a.className»().getChangedEvent().subscribe([&_events](const «a.getTypeName(_interface, true)» &) {
+                    _events++;
+                });
+            «ENDFOR»
+            (void)_proxy;
+            (void)_events;
+        }
+
+        // Names of the method IDs, used to report replayed requests
+        std::string getMethodName(uint16_t _method) {
+            switch (_method) {
+            «FOR entry : _interface.getSomeIpMethodNames(_accessor, false).entrySet»
+                case «entry.key»: return "«entry.value»";
+            «ENDFOR»
+            default: {
+                std::ostringstream itsName;
+                itsName << "0x" << std::hex << std::setw(4) << std::setfill('0') << _method;
+                return itsName.str();
+            }
+            }
+        }
+
+        // Prints and writes the results, returns the number of failed operations
+        uint64_t report(const Options &_options, const char *_mode, double _seconds,
+                    std::map<std::string, Statistics> &_statistics, uint64_t _events) {
+            Statistics itsTotal;
+            for (auto &itsEntry : _statistics) {
+                std::sort(itsEntry.second.latencies.begin(), itsEntry.second.latencies.end());
+                itsTotal.merge(itsEntry.second);
+            }
+            std::sort(itsTotal.latencies.begin(), itsTotal.latencies.end());
+            _statistics["total"] = itsTotal;
+
+            std::cout << "«_interface.fullyQualifiedNameWithVersion» (" << _mode << "), "
+                      << _seconds << " s, " << _events << " events" << std::endl
+                      << std::left << std::setw(32) << "operation" << std::right
+                      << std::setw(10) << "ops" << std::setw(8) << "errors" << std::setw(12) << "ops/s"
+                      << std::setw(12) << "p50 [us]" << std::setw(12) << "p90 [us]"
+                      << std::setw(12) << "p99 [us]" << std::setw(12) << "max [us]" << std::endl;
+            for (auto &itsEntry : _statistics) {
+                const Statistics &itsStatistics = itsEntry.second;
+                std::cout << std::left << std::setw(32) << itsEntry.first << std::right
+                          << std::setw(10) << itsStatistics.latencies.size() << std::setw(8) << itsStatistics.errors
+                          << std::setw(12) << std::fixed << std::setprecision(1) << double(itsStatistics.latencies.size()) / _seconds
+                          << std::setw(12) << itsStatistics.percentile(50) << std::setw(12) << itsStatistics.percentile(90)
+                          << std::setw(12) << itsStatistics.percentile(99) << std::setw(12) << itsStatistics.percentile(100)
+                          << std::endl;
+            }
+
+            if (!_options.json.empty()) {
+                std::ofstream itsJson(_options.json);
+                itsJson << "{" << std::endl
+                        << "  \"interface\": \"«_interface.fullyQualifiedNameWithVersion»\"," << std::endl
+                        << "  \"mode\": \"" << _mode << "\"," << std::endl
+                        << "  \"seconds\": " << _seconds << "," << std::endl
+                        << "  \"events\": " << _events << "," << std::endl
+                        << "  \"operations\": [";
+                bool isFirst(true);
+                for (auto &itsEntry : _statistics) {
+                    const Statistics &itsStatistics = itsEntry.second;
+                    itsJson << (isFirst ? "" : ",") << std::endl
+                            << "    { \"name\": \"" << itsEntry.first << "\", \"ops\": " << itsStatistics.latencies.size()
+                            << ", \"errors\": " << itsStatistics.errors
+                            << ", \"opsPerSec\": " << double(itsStatistics.latencies.size()) / _seconds
+                            << ", \"p50Us\": " << itsStatistics.percentile(50) << ", \"p90Us\": " << itsStatistics.percentile(90)
+                            << ", \"p99Us\": " << itsStatistics.percentile(99) << ", \"maxUs\": " << itsStatistics.percentile(100) << " }";
+                    isFirst = false;
+                }
+                itsJson << std::endl << "  ]" << std::endl << "}" << std::endl;
+            }
+            return itsTotal.errors;
+        }
+
+        int synthesize(const Options &_options) {
+            std::vector<Operation> itsOperations;
+            for (auto &itsOperation : getOperations()) {
+                if (_options.operations.empty() || _options.operations.count(itsOperation.name))
+                    itsOperations.push_back(itsOperation);
+            }
+            if (itsOperations.empty()) {
+                std::cerr << "No operations to synthesize" << std::endl;
+                return 1;
+            }
+
+            std::shared_ptr<Proxy> itsProxy = CommonAPI::Runtime::get()->buildProxy<«_interface.elementName»Proxy>(
+                    _options.domain, _options.instance, _options.connection);
+            if (!itsProxy) {
+                std::cerr << "Proxy for " << _options.domain << ":" << _options.instance << " could not be built" << std::endl;
+                return 1;
+            }
+            for (int i = 0; !itsProxy->isAvailable() && i < 1000; i++)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            if (!itsProxy->isAvailable()) {
+                std::cerr << "Service " << _options.domain << ":" << _options.instance << " is not available" << std::endl;
+                return 1;
+            }
+
+            std::atomic<uint64_t> itsEvents(0);
+            if (_options.subscribe)
+                subscribe(*itsProxy, itsEvents);
+
+            // Every worker issues its share of the rate, one operation at a time
+            const std::size_t itsConcurrency = std::max(_options.concurrency, std::size_t(1));
+            const std::chrono::nanoseconds itsInterval(_options.rate > 0.0
+                    ? int64_t(1.0e9 * double(itsConcurrency) / _options.rate) : 0);
+            const std::chrono::steady_clock::time_point itsStart = std::chrono::steady_clock::now();
+            const std::chrono::steady_clock::time_point itsEnd = itsStart
+                    + std::chrono::nanoseconds(int64_t(_options.duration * 1.0e9));
+            std::vector<std::vector<Statistics>> itsStatistics(itsConcurrency, std::vector<Statistics>(itsOperations.size()));
+            std::vector<std::thread> itsWorkers;
+            for (std::size_t w = 0; w < itsConcurrency; w++) {
+                itsWorkers.push_back(std::thread([&, w]() {
+                    std::mt19937_64 itsRng(_options.seed + w);
+                    const CommonAPI::CallInfo itsInfo(_options.timeout);
+                    std::chrono::steady_clock::time_point itsNext = itsStart
+                            + itsInterval * int64_t(w) / int64_t(itsConcurrency);
+                    while (itsNext < itsEnd) {
+                        std::this_thread::sleep_until(itsNext);
+                        const std::size_t itsIndex = std::uniform_int_distribution<std::size_t>(0, itsOperations.size() - 1)(itsRng);
+                        const std::chrono::steady_clock::time_point itsCallStart = std::chrono::steady_clock::now();
+                        const bool isSuccess = itsOperations[itsIndex].run(*itsProxy, itsRng, itsInfo);
+                        const std::chrono::steady_clock::time_point itsCallEnd = std::chrono::steady_clock::now();
+                        itsStatistics[w][itsIndex].add(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(itsCallEnd - itsCallStart).count(), isSuccess);
+                        itsNext = (itsInterval.count() > 0 ? itsNext + itsInterval : itsCallEnd);
+                    }
+                }));
+            }
+            for (auto &itsWorker : itsWorkers)
+                itsWorker.join();
+            const double itsSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - itsStart).count();
+
+            std::map<std::string, Statistics> itsResults;
+            for (auto &itsWorkerStatistics : itsStatistics) {
+                for (std::size_t i = 0; i < itsOperations.size(); i++)
+                    itsResults[itsOperations[i].name].merge(itsWorkerStatistics[i]);
+            }
+            return (report(_options, "synthesize", itsSeconds, itsResults, itsEvents) == 0 ? 0 : 3);
+        }
+
+        int replay(const Options &_options) {
+            std::vector<CommonAPI::SomeIP::Capture::Record> itsRecords;
+            for (auto &itsFile : CommonAPI::SomeIP::Capture::Reader::getFiles(_options.replay)) {
+                CommonAPI::SomeIP::Capture::Reader itsReader;
+                if (!itsReader.open(itsFile)) {
+                    std::cerr << "Capture file " << itsFile << " could not be read" << std::endl;
+                    return 1;
+                }
+                CommonAPI::SomeIP::Capture::Record itsRecord;
+                while (itsReader.next(itsRecord)) {
+                    if (itsRecord.direction == CommonAPI::SomeIP::Capture::Direction::REQUEST
+                            && itsRecord.header.service == SERVICE_ID
+                            && (_options.operations.empty() || _options.operations.count(getMethodName(itsRecord.header.method))))
+                        itsRecords.push_back(itsRecord);
+                }
+            }
+            if (itsRecords.empty()) {
+                std::cerr << "No requests of service " << SERVICE_ID << " found in " << _options.replay << std::endl;
+                return 1;
+            }
+
+            std::shared_ptr<vsomeip::application> itsApplication
+                = vsomeip::runtime::get()->create_application(_options.connection);
+            if (!itsApplication || !itsApplication->init()) {
+                std::cerr << "vsomeip application " << _options.connection << " could not be initialized" << std::endl;
+                return 1;
+            }
+
+            struct Pending {
+                std::string name;
+                std::chrono::steady_clock::time_point sent;
+            };
+            std::mutex itsMutex;
+            std::condition_variable itsCondition;
+            std::set<vsomeip::instance_t> itsAvailable;
+            std::map<vsomeip::session_t, Pending> itsPending;
+            // Replies that arrived before their request was registered as pending
+            std::map<vsomeip::session_t, std::pair<std::chrono::steady_clock::time_point, bool>> itsEarly;
+            std::map<std::string, Statistics> itsResults;
+
+            itsApplication->register_availability_handler(SERVICE_ID, vsomeip::ANY_INSTANCE,
+                [&](vsomeip::service_t, vsomeip::instance_t _instance, bool _isAvailable) {
+                    std::lock_guard<std::mutex> itsLock(itsMutex);
+                    if (_isAvailable)
+                        itsAvailable.insert(_instance);
+                    else
+                        itsAvailable.erase(_instance);
+                    itsCondition.notify_all();
+                });
+            itsApplication->register_message_handler(SERVICE_ID, vsomeip::ANY_INSTANCE, vsomeip::ANY_METHOD,
+                [&](const std::shared_ptr<vsomeip::message> &_reply) {
+                    if (_reply->get_message_type() != vsomeip::message_type_e::MT_RESPONSE
+                            && _reply->get_message_type() != vsomeip::message_type_e::MT_ERROR)
+                        return;
+                    const std::chrono::steady_clock::time_point itsNow = std::chrono::steady_clock::now();
+                    const bool isSuccess = (_reply->get_message_type() == vsomeip::message_type_e::MT_RESPONSE
+                            && _reply->get_return_code() == vsomeip::return_code_e::E_OK);
+                    std::lock_guard<std::mutex> itsLock(itsMutex);
+                    auto itsRequest = itsPending.find(_reply->get_session());
+                    if (itsRequest == itsPending.end()) {
+                        itsEarly[_reply->get_session()] = std::make_pair(itsNow, isSuccess);
+                        return;
+                    }
+                    itsResults[itsRequest->second.name].add(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(itsNow - itsRequest->second.sent).count(), isSuccess);
+                    itsPending.erase(itsRequest);
+                    itsCondition.notify_all();
+                });
+
+            std::set<vsomeip::instance_t> itsInstances;
+            for (auto &itsRecord : itsRecords) {
+                if (itsInstances.insert(itsRecord.instance).second)
+                    itsApplication->request_service(SERVICE_ID, itsRecord.instance,
+                                                    itsRecord.header.interfaceVersion, vsomeip::ANY_MINOR);
+            }
+            std::thread itsDispatcher([itsApplication]() { itsApplication->start(); });
+
+            bool isAvailable(false);
+            {
+                std::unique_lock<std::mutex> itsLock(itsMutex);
+                isAvailable = itsCondition.wait_for(itsLock, std::chrono::seconds(10),
+                    [&]() { return itsAvailable.size() == itsInstances.size(); });
+            }
+
+            uint64_t itsSent(0);
+            const std::chrono::steady_clock::time_point itsStart = std::chrono::steady_clock::now();
+            if (isAvailable) {
+                const int64_t itsFirst = itsRecords.front().timestamp;
+                for (auto &itsRecord : itsRecords) {
+                    if (_options.speed > 0.0)
+                        std::this_thread::sleep_until(itsStart + std::chrono::nanoseconds(
+                            int64_t(double(itsRecord.timestamp - itsFirst) / _options.speed)));
+
+                    const bool isFireAndForget
+                        = (itsRecord.header.messageType == CommonAPI::SomeIP::Capture::MT_REQUEST_NO_RETURN);
+                    std::shared_ptr<vsomeip::message> itsRequest = vsomeip::runtime::get()->create_request();
+                    itsRequest->set_service(SERVICE_ID);
+                    itsRequest->set_instance(itsRecord.instance);
+                    itsRequest->set_method(itsRecord.header.method);
+                    itsRequest->set_interface_version(itsRecord.header.interfaceVersion);
+                    itsRequest->set_message_type(isFireAndForget
+                        ? vsomeip::message_type_e::MT_REQUEST_NO_RETURN : vsomeip::message_type_e::MT_REQUEST);
+                    itsRequest->set_payload(vsomeip::runtime::get()->create_payload(itsRecord.payload));
+
+                    const std::string itsName = getMethodName(itsRecord.header.method);
+                    const std::chrono::steady_clock::time_point itsSendTime = std::chrono::steady_clock::now();
+                    itsApplication->send(itsRequest);
+                    itsSent++;
+
+                    std::lock_guard<std::mutex> itsLock(itsMutex);
+                    if (isFireAndForget) {
+                        itsResults[itsName].add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - itsSendTime).count(), true);
+                        continue;
+                    }
+                    auto itsReply = itsEarly.find(itsRequest->get_session());
+                    if (itsReply != itsEarly.end()) {
+                        itsResults[itsName].add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            itsReply->second.first - itsSendTime).count(), itsReply->second.second);
+                        itsEarly.erase(itsReply);
+                    } else {
+                        itsPending[itsRequest->get_session()] = Pending { itsName, itsSendTime };
+                    }
+                }
+
+                // Requests without reply within the timeout are counted as errors
+                std::unique_lock<std::mutex> itsLock(itsMutex);
+                itsCondition.wait_for(itsLock, std::chrono::milliseconds(_options.timeout),
+                    [&]() { return itsPending.empty(); });
+                for (auto &itsRequest : itsPending)
+                    itsResults[itsRequest.second.name].errors++;
+                itsPending.clear();
+            } else {
+                std::cerr << "Service " << SERVICE_ID << " is not available" << std::endl;
+            }
+            const double itsSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - itsStart).count();
+
+            itsApplication->clear_all_handler();
+            itsApplication->stop();
+            itsDispatcher.join();
+            if (!isAvailable)
+                return 1;
+
+            std::cout << itsSent << " of " << itsRecords.size() << " recorded requests replayed" << std::endl;
+            return (report(_options, "replay", itsSeconds, itsResults, 0) == 0 ? 0 : 3);
+        }
+
+        void usage(const char *_name) {
+            std::cerr << "Usage: " << _name << " [options]" << std::endl
+                      << "  --domain <domain>           domain of the service (local)" << std::endl
+                      << "  --instance <instance>       instance of the service («_interface.getDefaultInstance(_providers)»)" << std::endl
+                      << "  --connection <name>         connection/vsomeip application of the client (client-sample)" << std::endl
+                      << "  --serve                     offer a default stub in this process" << std::endl
+                      << "  --service-connection <name> connection of the offered stub (service-sample)" << std::endl
+                      << "  --rate <ops/s>              synthesized operations per second, 0 = unlimited (100)" << std::endl
+                      << "  --concurrency <n>           number of concurrent operations (1)" << std::endl
+                      << "  --duration <s>              duration of the synthesized load (5)" << std::endl
+                      << "  --operations <a,b,...>      only issue the given operations" << std::endl
+                      << "  --no-subscribe              do not subscribe to broadcasts and attributes" << std::endl
+                      << "  --seed <n>                  seed of the random values (42)" << std::endl
+                      << "  --timeout <ms>              timeout of a call (5000)" << std::endl
+                      << "  --replay <capture>          replay the requests of a message capture" << std::endl
+                      << "  --speed <factor>            replay speed, 0 = as fast as possible (1)" << std::endl
+                      << "  --json <file>               write the results as JSON" << std::endl
+                      << "The exit status is 3 if operations failed or timed out." << std::endl;
+        }
+
+        bool parse(int _argc, char **_argv, Options &_options) {
+            for (int i = 1; i < _argc; i++) {
+                const std::string itsOption(_argv[i]);
+                if (itsOption == "--serve") {
+                    _options.serve = true;
+                    continue;
+                }
+                if (itsOption == "--no-subscribe") {
+                    _options.subscribe = false;
+                    continue;
+                }
+                if (i + 1 >= _argc)
+                    return false;
+                const std::string itsValue(_argv[++i]);
+                if (itsOption == "--domain") {
+                    _options.domain = itsValue;
+                } else if (itsOption == "--instance") {
+                    _options.instance = itsValue;
+                } else if (itsOption == "--connection") {
+                    _options.connection = itsValue;
+                } else if (itsOption == "--service-connection") {
+                    _options.serviceConnection = itsValue;
+                } else if (itsOption == "--rate") {
+                    _options.rate = std::strtod(itsValue.c_str(), nullptr);
+                } else if (itsOption == "--concurrency") {
+                    _options.concurrency = std::strtoul(itsValue.c_str(), nullptr, 10);
+                } else if (itsOption == "--duration") {
+                    _options.duration = std::strtod(itsValue.c_str(), nullptr);
+                } else if (itsOption == "--operations") {
+                    std::istringstream itsNames(itsValue);
+                    std::string itsName;
+                    while (std::getline(itsNames, itsName, ','))
+                        _options.operations.insert(itsName);
+                } else if (itsOption == "--seed") {
+                    _options.seed = std::strtoull(itsValue.c_str(), nullptr, 10);
+                } else if (itsOption == "--timeout") {
+                    _options.timeout = int32_t(std::strtol(itsValue.c_str(), nullptr, 10));
+                } else if (itsOption == "--replay") {
+                    _options.replay = itsValue;
+                } else if (itsOption == "--speed") {
+                    _options.speed = std::strtod(itsValue.c_str(), nullptr);
+                } else if (itsOption == "--json") {
+                    _options.json = itsValue;
+                } else {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        } // namespace
+
+        int run«_interface.elementName»LoadGenerator(int _argc, char **_argv) {
+            Options itsOptions;
+            if (!parse(_argc, _argv, itsOptions)) {
+                usage(_argv[0]);
+                return 2;
+            }
+
+        #ifdef COMMONAPI_SOMEIP_LOAD_GENERATOR_SERVE
+            std::shared_ptr<«_interface.elementName»StubDefault> itsStub;
+            if (itsOptions.serve) {
+                itsStub = std::make_shared<«_interface.elementName»StubDefault>();
+                if (!CommonAPI::Runtime::get()->registerService(itsOptions.domain, itsOptions.instance,
+                                                                itsStub, itsOptions.serviceConnection)) {
+                    std::cerr << "Stub could not be registered" << std::endl;
+                    return 1;
+                }
+            }
+        #else
+            if (itsOptions.serve) {
+                std::cerr << "--serve needs the default stub («_interface.stubDefaultHeaderPath»)" << std::endl;
+                return 1;
+            }
+        #endif
+
+            const int itsResult = (itsOptions.replay.empty() ? synthesize(itsOptions) : replay(itsOptions));
+
+        #ifdef COMMONAPI_SOMEIP_LOAD_GENERATOR_SERVE
+            if (itsStub) {
+                CommonAPI::Runtime::get()->unregisterService(itsOptions.domain,
+                    «_interface.elementName»StubDefault::StubInterface::getInterface(), itsOptions.instance);
+            }
+        #endif
+            return itsResult;
+        }
+
+        «_interface.model.generateNamespaceEndDeclaration»
+        «_interface.generateVersionNamespaceEnd»
+
+        int main(int argc, char **argv) {
+            return «_interface.namespaceName»::run«_interface.elementName»LoadGenerator(argc, argv);
+        }
+    '''
+
+    def private String generateArgumentFill(FArgument _argument, PropertyAccessor _accessor) {
+        if (_argument.array)
+            return _argument.type.generateArrayFill(_argument, _accessor, "in_" + _argument.name, 0)
+        return _argument.type.generateFill(_argument, _accessor, "in_" + _argument.name, 0)
+    }
+
+    def private String generateAttributeFill(FAttribute _attribute, PropertyAccessor _accessor) {
+        if (_attribute.array)
+            return _attribute.type.generateArrayFill(_attribute, _accessor, "itsValue", 0)
+        return _attribute.type.generateFill(_attribute, _accessor, "itsValue", 0)
+    }
+
+    def private String getDefaultInstance(FInterface _interface, List<FDExtensionRoot> _providers) {
+        for (p : _providers) {
+            val PropertyAccessor providerAccessor = new PropertyAccessor(new FDeployedProvider(p))
+            for (i : ProviderUtils.getInstances(p).filter[target == _interface])
+                return providerAccessor.getInstanceId(i)
+        }
+        return _interface.fullyQualifiedName
+    }
+
+    // Polymorphic arguments are shared pointers that the load generator cannot fill
+    def private boolean isGeneratable(FMethod _method) {
+        return _method.inArgs.forall[type.isGeneratable]
+    }
+
+    def private boolean isGeneratable(FAttribute _attribute) {
+        return _attribute.type.isGeneratable
+    }
+
+    def private boolean isGeneratable(FTypeRef _typeRef) {
+        return !(_typeRef.derived instanceof FStructType && (_typeRef.derived as FStructType).isPolymorphicHierarchy)
+    }
+
+    // Namespace of the interface, including the version
+    def private String getNamespaceName(FInterface _interface) {
+        return _interface.fullName.substring(0, _interface.fullName.length - _interface.elementName.length - 2)
+    }
+
+    def private String getProxyHeaderPath(FInterface _interface) {
+        return _interface.versionPathPrefix + _interface.model.directoryPath + '/' + _interface.elementName + "Proxy.hpp"
+    }
+
+    def private String getStubDefaultHeaderPath(FInterface _interface) {
+        return _interface.versionPathPrefix + _interface.model.directoryPath + '/' + _interface.elementName + "StubDefault.hpp"
+    }
+}
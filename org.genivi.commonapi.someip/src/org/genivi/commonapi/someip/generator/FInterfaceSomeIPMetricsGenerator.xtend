@@ -0,0 +1,518 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.LinkedHashMap
+import java.util.Map
+import org.eclipse.core.resources.IResource
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FInterface
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the metrics of an interface that are fed by the instrumentation hooks
+ * of the proxy and the stub adapter. The hooks are only compiled if
+ * COMMONAPI_SOMEIP_METRICS is defined, otherwise they expand to nothing.
+ */
+class FInterfaceSomeIPMetricsGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateMetrics(FInterface _interface, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_INSTRUMENTATION_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_interface.someipMetricsHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _interface.generateMetricsHeader(_accessor))
+        }
+        else {
+            _fileSystemAccess.generateFile(_interface.someipMetricsHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateMetricsHeader(FInterface _interface, PropertyAccessor _accessor) '''
+        «val methods = _interface.getSomeIpMethodNames(_accessor, false)»
+        «val events = _interface.getMetricEvents(_accessor)»
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef «_interface.defineName.toUpperCase»_SOMEIP_METRICS_HPP_
+        #define «_interface.defineName.toUpperCase»_SOMEIP_METRICS_HPP_
+
+        #include <atomic>
+        #include <chrono>
+        #include <cstddef>
+        #include <cstdint>
+        #include <functional>
+        #include <future>
+        #include <utility>
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/CallInfo.hpp>
+        #include <CommonAPI/Types.hpp>
+        #include <CommonAPI/SomeIP/Message.hpp>
+        #include <CommonAPI/SomeIP/Types.hpp>
+
+        «endInternalCompilation»
+
+        // The hooks in the generated proxies and stub adapters only call the metrics
+        // if COMMONAPI_SOMEIP_METRICS is defined. Otherwise they compile to nothing.
+        // The define changes the classes of the proxy members, it must be the same for
+        // all translation units that include the proxy or the stub adapter.
+        #ifndef COMMONAPI_SOMEIP_METRICS_HOOK
+        #ifdef COMMONAPI_SOMEIP_METRICS
+        #define COMMONAPI_SOMEIP_METRICS_HOOK(...) __VA_ARGS__
+        #else
+        #define COMMONAPI_SOMEIP_METRICS_HOOK(...)
+        #endif
+        #endif
+
+        «_interface.generateVersionNamespaceBegin»
+        «_interface.model.generateNamespaceBeginDeclaration»
+
+        /**
+         * Call counts and latencies of the methods, attribute getters and setters and
+         * events of «_interface.elementName», separately for the proxy and the stub side of the process.
+         *
+         * Proxy methods, getters and setters: "send" is the time until the request was
+         * handed to the connection (asynchronous and fire&forget calls, it includes the
+         * serialization of the request), "duration" the time until the reply arrived and
+         * "handler" the time spent in the callback of an asynchronous call.
+         *
+         * Stub methods: "deserialization" is the time to decode the arguments, "handler"
+         * the time until the stub method returned, "serialization" the time to encode the
+         * reply and "duration" the time from receiving the request until the reply was
+         * sent, also if the stub replies later. Methods with error replies and attribute
+         * getters and setters are dispatched by the runtime; for them only the dispatch
+         * time is counted as "duration", including deserialization and handler.
+         *
+         * Events: on the stub side "duration" is the time to serialize and send, on the
+         * proxy side the time to deserialize and call the listeners of a broadcast.
+         *
+         * IDs that do not belong to «_interface.elementName», e.g. inherited ones dispatched by a derived
+         * stub adapter, share one additional metric.
+         */
+        class «_interface.someipMetricsClassName» {
+        public:
+            // Durations are counted in buckets of powers of two nanoseconds,
+            // the last bucket takes everything from 2^31 ns on.
+            static const std::size_t BUCKETS = 32;
+
+            enum class Side { PROXY, STUB };
+
+            struct Timing {
+                uint64_t count;
+                uint64_t totalNs;
+                uint64_t histogram[BUCKETS];
+
+                uint64_t averageNs() const {
+                    return (count == 0 ? 0 : totalNs / count);
+                }
+
+                // Upper bound of the bucket that contains the given percentile (0..100)
+                uint64_t percentileNs(double _percentile) const {
+                    const double rank = double(count) * _percentile / 100.0;
+                    uint64_t seen(0);
+                    for (std::size_t i = 0; i < BUCKETS; ++i) {
+                        seen += histogram[i];
+                        if (histogram[i] > 0 && double(seen) >= rank)
+                            return uint64_t(1) << (i + 1);
+                    }
+                    return 0;
+                }
+            };
+
+            struct Snapshot {
+                uint64_t calls;
+                uint64_t errors;
+                uint64_t inFlight;
+                Timing send;
+                Timing deserialization;
+                Timing handler;
+                Timing serialization;
+                Timing duration;
+            };
+
+            /**
+             * Counters of one method or event. Each thread writes to its own shard
+             * with relaxed atomic operations, the shards are added up when read.
+             */
+            class Metric {
+            public:
+                typedef std::chrono::steady_clock::time_point TimePoint;
+
+                static TimePoint now() {
+                    return std::chrono::steady_clock::now();
+                }
+
+                TimePoint start() {
+                    add(shard().calls, 1);
+                    return now();
+                }
+
+                void sent(const TimePoint &_start) {
+                    record(shard().send, _start);
+                }
+
+                void deserialized(const TimePoint &_start) {
+                    record(shard().deserialization, _start);
+                }
+
+                void handled(const TimePoint &_start) {
+                    record(shard().handler, _start);
+                }
+
+                void serialized(const TimePoint &_start) {
+                    record(shard().serialization, _start);
+                }
+
+                void finished(const TimePoint &_start, bool _success) {
+                    Shard &itsShard = shard();
+                    record(itsShard.duration, _start);
+                    if (!_success)
+                        add(itsShard.errors, 1);
+                    add(itsShard.finished, 1);
+                }
+
+                Snapshot snapshot() const {
+                    Snapshot itsSnapshot = Snapshot();
+                    // read the finished calls first, so that a call finishing meanwhile
+                    // is not counted as finished but not started
+                    uint64_t itsFinished(0);
+                    for (std::size_t i = 0; i < SHARDS; ++i)
+                        itsFinished += shards_[i].finished.load(std::memory_order_relaxed);
+                    for (std::size_t i = 0; i < SHARDS; ++i) {
+                        itsSnapshot.calls += shards_[i].calls.load(std::memory_order_relaxed);
+                        itsSnapshot.errors += shards_[i].errors.load(std::memory_order_relaxed);
+                        read(shards_[i].send, itsSnapshot.send);
+                        read(shards_[i].deserialization, itsSnapshot.deserialization);
+                        read(shards_[i].handler, itsSnapshot.handler);
+                        read(shards_[i].serialization, itsSnapshot.serialization);
+                        read(shards_[i].duration, itsSnapshot.duration);
+                    }
+                    itsSnapshot.inFlight = (itsSnapshot.calls > itsFinished ? itsSnapshot.calls - itsFinished : 0);
+                    return itsSnapshot;
+                }
+
+                void reset() {
+                    for (std::size_t i = 0; i < SHARDS; ++i) {
+                        shards_[i].calls.store(0, std::memory_order_relaxed);
+                        shards_[i].finished.store(0, std::memory_order_relaxed);
+                        shards_[i].errors.store(0, std::memory_order_relaxed);
+                        clear(shards_[i].send);
+                        clear(shards_[i].deserialization);
+                        clear(shards_[i].handler);
+                        clear(shards_[i].serialization);
+                        clear(shards_[i].duration);
+                    }
+                }
+
+            private:
+                static const std::size_t SHARDS = 8;
+
+                struct Counters {
+                    std::atomic<uint64_t> totalNs;
+                    std::atomic<uint64_t> histogram[BUCKETS];
+                };
+
+                struct alignas(64) Shard {
+                    std::atomic<uint64_t> calls;
+                    std::atomic<uint64_t> finished;
+                    std::atomic<uint64_t> errors;
+                    Counters send;
+                    Counters deserialization;
+                    Counters handler;
+                    Counters serialization;
+                    Counters duration;
+                };
+
+                Shard &shard() {
+                    static std::atomic<std::size_t> next(0);
+                    static thread_local std::size_t index(next.fetch_add(1, std::memory_order_relaxed) % SHARDS);
+                    return shards_[index];
+                }
+
+                static void add(std::atomic<uint64_t> &_counter, uint64_t _value) {
+                    _counter.fetch_add(_value, std::memory_order_relaxed);
+                }
+
+                static std::size_t bucket(uint64_t _ns) {
+        #ifdef __GNUC__
+                    const std::size_t itsBucket = (_ns < 2 ? 0 : std::size_t(63 - __builtin_clzll(_ns)));
+                    return (itsBucket < BUCKETS ? itsBucket : BUCKETS - 1);
+        #else
+                    std::size_t itsBucket(0);
+                    while (_ns > 1 && itsBucket < BUCKETS - 1) {
+                        _ns >>= 1;
+                        ++itsBucket;
+                    }
+                    return itsBucket;
+        #endif
+                }
+
+                static void record(Counters &_counters, const TimePoint &_start) {
+                    const uint64_t itsNs = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        now() - _start).count());
+                    add(_counters.totalNs, itsNs);
+                    add(_counters.histogram[bucket(itsNs)], 1);
+                }
+
+                static void read(const Counters &_counters, Timing &_timing) {
+                    _timing.totalNs += _counters.totalNs.load(std::memory_order_relaxed);
+                    for (std::size_t i = 0; i < BUCKETS; ++i) {
+                        const uint64_t itsCount = _counters.histogram[i].load(std::memory_order_relaxed);
+                        _timing.histogram[i] += itsCount;
+                        _timing.count += itsCount;
+                    }
+                }
+
+                static void clear(Counters &_counters) {
+                    _counters.totalNs.store(0, std::memory_order_relaxed);
+                    for (std::size_t i = 0; i < BUCKETS; ++i)
+                        _counters.histogram[i].store(0, std::memory_order_relaxed);
+                }
+
+                Shard shards_[SHARDS];
+            };
+
+            /**
+             * Proxy side attribute that counts the calls of its getter. Base_ is the class
+             * the proxy would use for the attribute otherwise.
+             */
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_>
+            class MeasuredReadonlyAttribute : public Base_ {
+            public:
+                typedef typename Base_::ValueType ValueType;
+                typedef typename Base_::AttributeAsyncCallback AttributeAsyncCallback;
+
+                template<typename... Arguments_>
+                MeasuredReadonlyAttribute(Arguments_ &&... _arguments)
+                    : Base_(std::forward<Arguments_>(_arguments)...) {
+                }
+
+                virtual void getValue(CommonAPI::CallStatus &_status, ValueType &_value,
+                                      const CommonAPI::CallInfo *_info = nullptr) const {
+                    Metric &itsMetric = method(Side::PROXY, Getter_);
+                    const Metric::TimePoint itsStart = itsMetric.start();
+                    Base_::getValue(_status, _value, _info);
+                    itsMetric.finished(itsStart, _status == CommonAPI::CallStatus::SUCCESS);
+                }
+
+                virtual std::future<CommonAPI::CallStatus> getValueAsync(AttributeAsyncCallback _callback,
+                                                                         const CommonAPI::CallInfo *_info = nullptr) {
+                    Metric &itsMetric = method(Side::PROXY, Getter_);
+                    const Metric::TimePoint itsStart = itsMetric.start();
+                    std::future<CommonAPI::CallStatus> itsFuture
+                        = Base_::getValueAsync(measure(itsMetric, itsStart, _callback), _info);
+                    itsMetric.sent(itsStart);
+                    return itsFuture;
+                }
+
+            protected:
+                static AttributeAsyncCallback measure(Metric &_metric, const Metric::TimePoint &_start,
+                                                      AttributeAsyncCallback _callback) {
+                    Metric *itsMetric = &_metric;
+                    return [itsMetric, _start, _callback](const CommonAPI::CallStatus &_status, ValueType _value) {
+                        itsMetric->finished(_start, _status == CommonAPI::CallStatus::SUCCESS);
+                        if (_callback) {
+                            const Metric::TimePoint itsHandlerStart = Metric::now();
+                            _callback(_status, std::move(_value));
+                            itsMetric->handled(itsHandlerStart);
+                        }
+                    };
+                }
+            };
+
+            // Proxy side attribute that counts the calls of its getter and its setter
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_, CommonAPI::SomeIP::method_id_t Setter_>
+            class MeasuredAttribute : public MeasuredReadonlyAttribute<Base_, Getter_> {
+            public:
+                typedef MeasuredReadonlyAttribute<Base_, Getter_> Readonly;
+                typedef typename Readonly::ValueType ValueType;
+                typedef typename Readonly::AttributeAsyncCallback AttributeAsyncCallback;
+
+                template<typename... Arguments_>
+                MeasuredAttribute(Arguments_ &&... _arguments)
+                    : Readonly(std::forward<Arguments_>(_arguments)...) {
+                }
+
+                virtual void setValue(const ValueType &_request, CommonAPI::CallStatus &_status, ValueType &_response,
+                                      const CommonAPI::CallInfo *_info = nullptr) {
+                    Metric &itsMetric = method(Side::PROXY, Setter_);
+                    const Metric::TimePoint itsStart = itsMetric.start();
+                    Base_::setValue(_request, _status, _response, _info);
+                    itsMetric.finished(itsStart, _status == CommonAPI::CallStatus::SUCCESS);
+                }
+
+                virtual std::future<CommonAPI::CallStatus> setValueAsync(const ValueType &_request,
+                                                                         AttributeAsyncCallback _callback = nullptr,
+                                                                         const CommonAPI::CallInfo *_info = nullptr) {
+                    Metric &itsMetric = method(Side::PROXY, Setter_);
+                    const Metric::TimePoint itsStart = itsMetric.start();
+                    std::future<CommonAPI::CallStatus> itsFuture
+                        = Base_::setValueAsync(_request, Readonly::measure(itsMetric, itsStart, _callback), _info);
+                    itsMetric.sent(itsStart);
+                    return itsFuture;
+                }
+            };
+
+            // Proxy side broadcast that counts the received events
+            template<typename Base_, CommonAPI::SomeIP::event_id_t Event_>
+            class MeasuredEvent : public Base_ {
+            public:
+                template<typename... Arguments_>
+                MeasuredEvent(Arguments_ &&... _arguments)
+                    : Base_(std::forward<Arguments_>(_arguments)...) {
+                }
+
+                virtual void onEventMessage(const CommonAPI::SomeIP::Message &_message) {
+                    Metric &itsMetric = event(Side::PROXY, Event_);
+                    const Metric::TimePoint itsStart = itsMetric.start();
+                    Base_::onEventMessage(_message);
+                    itsMetric.finished(itsStart, true);
+                }
+            };
+
+        #ifdef COMMONAPI_SOMEIP_METRICS
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_>
+            using ProxyReadonlyAttribute = MeasuredReadonlyAttribute<Base_, Getter_>;
+
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_, CommonAPI::SomeIP::method_id_t Setter_>
+            using ProxyAttribute = MeasuredAttribute<Base_, Getter_, Setter_>;
+
+            template<typename Base_, CommonAPI::SomeIP::event_id_t Event_>
+            using ProxyEvent = MeasuredEvent<Base_, Event_>;
+        #else
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_>
+            using ProxyReadonlyAttribute = Base_;
+
+            template<typename Base_, CommonAPI::SomeIP::method_id_t Getter_, CommonAPI::SomeIP::method_id_t Setter_>
+            using ProxyAttribute = Base_;
+
+            template<typename Base_, CommonAPI::SomeIP::event_id_t Event_>
+            using ProxyEvent = Base_;
+        #endif
+
+            typedef std::function<void (Side, CommonAPI::SomeIP::method_id_t, const char *, const Snapshot &)> MethodVisitor;
+            typedef std::function<void (Side, CommonAPI::SomeIP::event_id_t, const char *, const Snapshot &)> EventVisitor;
+
+            static Metric &method(Side _side, CommonAPI::SomeIP::method_id_t _method) {
+                return methods(_side)[methodIndex(_method)];
+            }
+
+            static Metric &event(Side _side, CommonAPI::SomeIP::event_id_t _event) {
+                return events(_side)[eventIndex(_event)];
+            }
+
+            // Calls _visitor for every method, getter and setter on both sides
+            static void forEachMethod(const MethodVisitor &_visitor) {
+                «IF methods.empty»
+                    (void)_visitor;
+                «ELSE»
+                    for (Side itsSide : { Side::PROXY, Side::STUB }) {
+                        «FOR id : methods.keySet»
+                            _visitor(itsSide, CommonAPI::SomeIP::method_id_t(0x«Integer.toHexString(id)»), "«methods.get(id)»", method(itsSide, CommonAPI::SomeIP::method_id_t(0x«Integer.toHexString(id)»)).snapshot());
+                        «ENDFOR»
+                    }
+                «ENDIF»
+            }
+
+            static void forEachEvent(const EventVisitor &_visitor) {
+                «IF events.empty»
+                    (void)_visitor;
+                «ELSE»
+                    for (Side itsSide : { Side::PROXY, Side::STUB }) {
+                        «FOR id : events.keySet»
+                            _visitor(itsSide, CommonAPI::SomeIP::event_id_t(0x«Integer.toHexString(id)»), "«events.get(id)»", event(itsSide, CommonAPI::SomeIP::event_id_t(0x«Integer.toHexString(id)»)).snapshot());
+                        «ENDFOR»
+                    }
+                «ENDIF»
+            }
+
+            static void reset() {
+                for (Side itsSide : { Side::PROXY, Side::STUB }) {
+                    for (std::size_t i = 0; i <= METHODS; ++i)
+                        methods(itsSide)[i].reset();
+                    for (std::size_t i = 0; i <= EVENTS; ++i)
+                        events(itsSide)[i].reset();
+                }
+            }
+
+        private:
+            static const std::size_t METHODS = «methods.size»;
+            static const std::size_t EVENTS = «events.size»;
+
+            static std::size_t methodIndex(CommonAPI::SomeIP::method_id_t _method) {
+                switch (_method) {
+                «val methodIds = methods.keySet.toList»
+                «FOR id : methodIds»
+                    case 0x«Integer.toHexString(id)»: return «methodIds.indexOf(id)»;
+                «ENDFOR»
+                default: return METHODS;
+                }
+            }
+
+            static std::size_t eventIndex(CommonAPI::SomeIP::event_id_t _event) {
+                switch (_event) {
+                «val eventIds = events.keySet.toList»
+                «FOR id : eventIds»
+                    case 0x«Integer.toHexString(id)»: return «eventIds.indexOf(id)»;
+                «ENDFOR»
+                default: return EVENTS;
+                }
+            }
+
+            // The metrics are zero-initialized and only touched when used
+            static Metric *methods(Side _side) {
+                static Metric itsProxyMethods[METHODS + 1];
+                static Metric itsStubMethods[METHODS + 1];
+                return (_side == Side::PROXY ? itsProxyMethods : itsStubMethods);
+            }
+
+            static Metric *events(Side _side) {
+                static Metric itsProxyEvents[EVENTS + 1];
+                static Metric itsStubEvents[EVENTS + 1];
+                return (_side == Side::PROXY ? itsProxyEvents : itsStubEvents);
+            }
+        };
+
+        «_interface.model.generateNamespaceEndDeclaration»
+        «_interface.generateVersionNamespaceEnd»
+
+        #endif // «_interface.defineName.toUpperCase»_SOMEIP_METRICS_HPP_
+    '''
+
+    // Event IDs of the broadcasts and the notifiers of observable attributes, the delta
+    // event replaces the notifier of a delta attribute and the batch event the notifiers
+    // of the attributes of its event group
+    def private Map<Integer, String> getMetricEvents(FInterface _interface, PropertyAccessor _accessor) {
+        val Map<Integer, String> events = new LinkedHashMap<Integer, String>()
+        for (broadcast : _interface.broadcasts) {
+            val Integer id = _accessor.getSomeIpEventID(broadcast)
+            if (id !== null && !broadcast.isErrorType(_accessor) && !events.containsKey(id))
+                events.put(id, broadcast.elementName)
+        }
+        for (group : _interface.getBatchEventGroups(_accessor)) {
+            val Integer id = _interface.getBatchEventID(group, _accessor)
+            if (!events.containsKey(id))
+                events.put(id, group.batchName)
+        }
+        for (attribute : _interface.attributes.filter[isObservable && !isBatchAttribute(_interface, _accessor)]) {
+            val Integer id = if (attribute.isDeltaAttribute(_accessor)) _accessor.getSomeIpNotifierDeltaID(attribute)
+                             else _accessor.getSomeIpNotifierID(attribute)
+            if (id !== null && !events.containsKey(id))
+                events.put(id, attribute.elementName)
+        }
+        return events
+    }
+}
@@ -4,6 +4,7 @@
    file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 package org.genivi.commonapi.someip.generator
 
+import java.util.LinkedList
 import java.util.List
 import javax.inject.Inject
 import org.eclipse.core.resources.IResource
@@ -28,18 +29,66 @@ import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
 class FInterfaceSomeIPProxyGenerator {
     @Inject extension FrancaGeneratorExtensions
     @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension SomeIPDeltaGenerator
+    @Inject extension SomeIPCompressionGenerator
+    @Inject extension SomeIPUtf16Generator
+    @Inject extension SomeIPSharedMemoryGenerator
+    @Inject extension SomeIPBulkGenerator
+    @Inject extension SomeIPPolymorphGenerator
+    @Inject extension SomeIPBatchGenerator
+    @Inject extension SomeIPCoalescingGenerator
+    @Inject extension SomeIPDeadlineGenerator
+    @Inject extension SomeIPBackpressureGenerator
 
     var boolean generateSyncCalls = true
+    var boolean generateInstrumentation = false
+    var boolean generateTracepoints = false
+    var boolean generateLazyMembers = false
+    var boolean generateDeadlines = false
 
     def generateProxy(FInterface fInterface, IFileSystemAccess fileSystemAccess, PropertyAccessor deploymentAccessor,
         List<FDExtensionRoot> providers, IResource modelid) {
 
         if(FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
             generateSyncCalls = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_SYNC_CALLS_SOMEIP, "true").equals("true")
+            generateInstrumentation = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_INSTRUMENTATION_SOMEIP, "false").equals("true")
+            generateTracepoints = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_TRACEPOINTS_SOMEIP, "false").equals("true")
+            generateLazyMembers = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_LAZY_MEMBERS_SOMEIP, "false").equals("true")
+            generateDeadlines = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_DEADLINES_SOMEIP, "false").equals("true")
             fileSystemAccess.generateFile(fInterface.someipProxyHeaderPath, PreferenceConstantsSomeIP.P_OUTPUT_PROXIES_SOMEIP,
                 fInterface.generateProxyHeader(deploymentAccessor, modelid))
             fileSystemAccess.generateFile(fInterface.someipProxySourcePath, PreferenceConstantsSomeIP.P_OUTPUT_PROXIES_SOMEIP,
                 fInterface.generateProxySource(deploymentAccessor, providers, modelid))
+            if (fInterface.hasDeltaAttributes(deploymentAccessor)) {
+                generateDelta(fileSystemAccess)
+            }
+            if (fInterface.hasCompressedElements) {
+                generateCompression(fileSystemAccess)
+            }
+            if (fInterface.hasUtf16Elements) {
+                generateUtf16(fileSystemAccess)
+            }
+            if (fInterface.hasSharedMemoryElements) {
+                generateSharedMemory(fileSystemAccess)
+            }
+            if (fInterface.hasBulkElements) {
+                generateBulk(fileSystemAccess)
+            }
+            if (fInterface.hasPooledPolymorphicElements) {
+                generatePolymorph(fileSystemAccess)
+            }
+            if (fInterface.hasBatchEventGroups(deploymentAccessor)) {
+                generateBatch(fileSystemAccess)
+            }
+            if (fInterface.hasCoalescedGetters(deploymentAccessor)) {
+                generateCoalescing(fileSystemAccess)
+            }
+            if (fInterface.hasCancellableCalls) {
+                generateDeadline(fileSystemAccess)
+            }
+            if (fInterface.hasLimitedMethods(deploymentAccessor)) {
+                generateBackpressure(fileSystemAccess)
+            }
         }
         else {
             // feature: suppress code generation
@@ -80,9 +129,45 @@ class FInterfaceSomeIPProxyGenerator {
         «IF !_interface.managedInterfaces.empty»
             #include <CommonAPI/SomeIP/ProxyManager.hpp>
         «ENDIF»
+        «IF _interface.hasDeltaAttributes(_accessor) || _interface.hasBatchEventGroups(_accessor)»
+            «IF !_interface.hasBroadcasts»
+                #include <CommonAPI/SomeIP/Event.hpp>
+            «ENDIF»
+        «ENDIF»
 
         «endInternalCompilation»
 
+        «IF _interface.hasDeltaAttributes(_accessor)»
+            #include <«someipDeltaHeaderPath»>
+
+            #include <atomic>
+            #include <memory>
+        «ENDIF»
+        «IF _interface.hasBatchEventGroups(_accessor)»
+            #include <«someipBatchHeaderPath»>
+
+            #include <vector>
+        «ENDIF»
+        «IF _interface.hasCoalescedGetters(_accessor)»
+            #include <«someipCoalescingHeaderPath»>
+
+            #include <future>
+        «ENDIF»
+        «IF _interface.hasCancellableCalls»
+            #include <«someipDeadlineHeaderPath»>
+        «ENDIF»
+        «IF _interface.hasLimitedMethods(_accessor)»
+            #include <«someipBackpressureHeaderPath»>
+
+            #include <map>
+        «ENDIF»
+        «IF generateLazyMembers && (_interface.hasAttributes || _interface.hasBroadcasts)»
+            #include <memory>
+            #include <mutex>
+        «ENDIF»
+        «IF generateInstrumentation»
+            #include <«_interface.someipMetricsHeaderPath»>
+        «ENDIF»
         #include <string>
 
         # if defined(_MSC_VER)
@@ -110,6 +195,11 @@ class FInterfaceSomeIPProxyGenerator {
 
             virtual ~«_interface.someipProxyClassName»();
 
+            «FOR group : _interface.getBatchEventGroups(_accessor)»
+                «_interface.generateBatchStruct(group, _accessor)»
+                virtual CommonAPI::Event< «group.batchName»> &«group.batchEventGetterName»();
+
+            «ENDFOR»
             «FOR attribute : _interface.attributes»
                 virtual «attribute.generateGetMethodDefinition»;
 
@@ -136,8 +226,19 @@ class FInterfaceSomeIPProxyGenerator {
             virtual void getOwnVersion(uint16_t &_major, uint16_t &_minor) const;
 
             virtual std::future<void> getCompletionFuture();
+            «IF _interface.hasLimitedMethods(_accessor)»
+
+                // The windows of the methods with SomeIpMethodMaxInFlight, they count the calls that were not sent
+                const CommonAPI::SomeIP::Backpressure::Window &get«_interface.elementName»Window(CommonAPI::SomeIP::method_id_t _method) const {
+                    return *backpressureWindows_.at(_method);
+                }
+            «ENDIF»
 
         private:
+            «FOR group : _interface.getBatchEventGroups(_accessor)»
+                «_interface.generateBatchEventClass(group, _accessor)»
+
+            «ENDFOR»
             «FOR attribute : _interface.attributes»
                 «IF attribute.supportsTypeValidation»
                     class SomeIP«attribute.someipClassVariableName»Attribute : public «attribute.someipClassName(_interface, _accessor)» {
@@ -196,18 +297,29 @@ class FInterfaceSomeIPProxyGenerator {
                             }
                         «ENDIF»
                     };
-                    SomeIP«attribute.someipClassVariableName»Attribute «attribute.someipClassVariableName»;
+                «ENDIF»
+                «IF attribute.isDeltaAttribute(_accessor)»
+                    «attribute.generateDeltaAttributeClass(_interface, _accessor)»
+                «ELSEIF attribute.isBatchAttribute(_interface, _accessor)»
+                    «attribute.generateBatchAttributeClass(_interface, _accessor)»
+                «ENDIF»
+                «IF attribute.isCoalescedGetter(_accessor)»
+                    «attribute.generateCoalescingAttributeClass(_interface, _accessor)»
+                «ENDIF»
+                «generateMemberDeclaration(attribute.someipMeasuredClassName(_interface, _accessor), attribute.someipClassVariableName)»
+                «IF attribute.supportsTypeValidation || attribute.isDeltaAttribute(_accessor) || attribute.isBatchAttribute(_interface, _accessor) || attribute.isCoalescedGetter(_accessor)»
 
-                «ELSE»
-                    «attribute.someipClassName(_interface, _accessor)» «attribute.someipClassVariableName»;
                 «ENDIF»
             «ENDFOR»
             «FOR broadcast : _interface.broadcasts»
-                «broadcast.someipClassName(_interface, _accessor)» «broadcast.someipClassVariableName»;
+                «generateMemberDeclaration(broadcast.someipMeasuredClassName(_interface, _accessor), broadcast.someipClassVariableName)»
             «ENDFOR»
             «FOR managed : _interface.managedInterfaces»
                  CommonAPI::SomeIP::ProxyManager «managed.proxyManagerMemberName»;
             «ENDFOR»
+            «IF _interface.hasLimitedMethods(_accessor)»
+                std::map<CommonAPI::SomeIP::method_id_t, std::shared_ptr<CommonAPI::SomeIP::Backpressure::Window>> backpressureWindows_;
+            «ENDIF»
 
         };
 
@@ -221,6 +333,10 @@ class FInterfaceSomeIPProxyGenerator {
         «generateCommonApiSomeIPLicenseHeader»
         «FTypeGenerator::generateComments(_interface, false)»
         #include <«_interface.someipProxyHeaderPath»>
+        «IF generateTracepoints»
+
+            «generateTracepointDefinitions»
+        «ENDIF»
         
         «startInternalCompilation»
         
@@ -255,38 +371,63 @@ class FInterfaceSomeIPProxyGenerator {
             CommonAPI::SomeIP::Factory::get()->registerInterface(initialize«_interface.someipProxyClassName»);
         }
 
-        «val hasAttribute = _interface.attributes.length > 0»
-        «val hasBroadcast = _interface.broadcasts.length > 0»
+        «val batchGroups = _interface.getBatchEventGroups(_accessor)»
+        «val hasBatch = batchGroups.length > 0»
+        «val hasAttribute = !generateLazyMembers && _interface.attributes.length > 0»
+        «val hasBroadcast = !generateLazyMembers && _interface.broadcasts.length > 0»
         «val hasManaged = _interface.managedInterfaces.length > 0»
         «_interface.someipProxyClassName»::«_interface.someipProxyClassName»(
             const CommonAPI::SomeIP::Address &_address,
             const std::shared_ptr<CommonAPI::SomeIP::ProxyConnection> &_connection)
-                : CommonAPI::SomeIP::Proxy(_address, _connection)«IF _interface.base !== null || hasAttribute || hasBroadcast || hasManaged»,«ENDIF»
-                  «IF _interface.base !== null»«_interface.generateSomeIPBaseInstantiations»«IF hasAttribute || hasBroadcast || hasManaged»,«ENDIF»«ENDIF»
+                : CommonAPI::SomeIP::Proxy(_address, _connection)«IF _interface.base !== null || hasBatch || hasAttribute || hasBroadcast || hasManaged»,«ENDIF»
+                  «IF _interface.base !== null»«_interface.generateSomeIPBaseInstantiations»«IF hasBatch || hasAttribute || hasBroadcast || hasManaged»,«ENDIF»«ENDIF»
+                  «FOR group : batchGroups»
+                  «group.batchEventMemberName»(*this)«IF group != batchGroups.last || hasAttribute || hasBroadcast || hasManaged»,«ENDIF»
+                  «ENDFOR»
+                  «IF hasAttribute»
                   «FOR attribute : _interface.attributes»
-                  «attribute.generateVariableInit(_accessor, _interface)»«IF attribute != _interface.attributes.last || hasBroadcast || hasManaged»,«ENDIF»
+                  «attribute.someipClassVariableName»(«attribute.generateVariableArguments(_accessor, _interface)»)«IF attribute != _interface.attributes.last || hasBroadcast || hasManaged»,«ENDIF»
                   «ENDFOR»
+                  «ENDIF»
+                  «IF hasBroadcast»
                   «FOR broadcast : _interface.broadcasts»
-                  «broadcast.someipClassVariableName»(*this, «broadcast.getEventGroups(_accessor).head», «broadcast.getEventIdentifier(_accessor)»,«IF broadcast.selective» CommonAPI::SomeIP::event_type_e::ET_SELECTIVE_EVENT«ELSE» CommonAPI::SomeIP::event_type_e::ET_EVENT «ENDIF», «broadcast.getReliabilityType(_accessor)», «broadcast.getEndianess(_accessor)», «broadcast.getDeployments(_interface, _accessor)»)«IF broadcast != _interface.broadcasts.last || hasManaged»,«ENDIF»
+                  «broadcast.someipClassVariableName»(«broadcast.generateVariableArguments(_accessor, _interface)»)«IF broadcast != _interface.broadcasts.last || hasManaged»,«ENDIF»
                   «ENDFOR»
+                  «ENDIF»
                   «FOR managed : _interface.managedInterfaces»
                   «managed.proxyManagerMemberName»(*this, "«managed.fullyQualifiedNameWithVersion»", «getSomeIpServiceIDForInterface(providers, managed)»)«IF managed != _interface.managedInterfaces.last»,«ENDIF»
                   «ENDFOR»
         {
+            «FOR method : _interface.methods.filter[isLimitedMethod(_accessor)]»
+                backpressureWindows_[«method.getMethodIdentifier(_accessor)»] = std::make_shared<CommonAPI::SomeIP::Backpressure::Window>(«method.getMaxInFlight(_accessor) + method.getQueueDepth(_accessor)»);
+            «ENDFOR»
         }
 
         «_interface.someipProxyClassName»::~«_interface.someipProxyClassName»() {
         }
         
+        «FOR group : _interface.getBatchEventGroups(_accessor)»
+            CommonAPI::Event< «_interface.someipProxyClassName»::«group.batchName»> &«_interface.someipProxyClassName»::«group.batchEventGetterName»() {
+                return «group.batchEventMemberName»;
+            }
+        «ENDFOR»
         «FOR attribute : _interface.attributes»
             «attribute.generateGetMethodDefinitionWithin(_interface.someipProxyClassName)» {
-                return «attribute.someipClassVariableName»;
+                «IF generateLazyMembers»
+                    «generateLazyMemberInit(attribute.someipMeasuredClassName(_interface, _accessor), attribute.someipClassVariableName, attribute.generateVariableArguments(_accessor, _interface))»
+                «ELSE»
+                    return «attribute.someipClassVariableName»;
+                «ENDIF»
             }
         «ENDFOR»
         
         «FOR broadcast : _interface.broadcasts»
            «broadcast.generateGetMethodDefinitionWithin(_interface.someipProxyClassName)» {
-               return «broadcast.someipClassVariableName»;
+               «IF generateLazyMembers»
+                   «generateLazyMemberInit(broadcast.someipMeasuredClassName(_interface, _accessor), broadcast.someipClassVariableName, broadcast.generateVariableArguments(_accessor, _interface))»
+               «ELSE»
+                   return «broadcast.someipClassVariableName»;
+               «ENDIF»
            }
         «ENDFOR»
         
@@ -297,7 +438,20 @@ class FInterfaceSomeIPProxyGenerator {
             «FTypeGenerator::generateComments(method, false)»
             «IF generateSyncCalls || method.isFireAndForget»
             «method.generateDefinitionWithin(_interface.someipProxyClassName, false)» {
+                «IF method.isLimitedMethod(_accessor) && !method.isFireAndForget»
+                    CommonAPI::SomeIP::Backpressure::Window::Slot itsSlot(*backpressureWindows_.at(«method.getMethodIdentifier(_accessor)»));
+                    if (!itsSlot) {
+                        _internalCallStatus = CommonAPI::CallStatus::REMOTE_ERROR;
+                        return;
+                    }
+                «ENDIF»
                 «method.generateProxyHelperDeployments(_interface, false, _accessor)»
+                «IF generateInstrumentation»
+                    «method.generateMetricStart(_interface, _accessor)»
+                «ENDIF»
+                «IF generateTracepoints»
+                    COMMONAPI_SOMEIP_PROBE(request_send, getSomeIpAddress().getService(), getSomeIpAddress().getInstance(), «method.getMethodIdentifier(_accessor)», «method.inArgs.tracePayloadSize»);
+                «ENDIF»
                 «IF method.isFireAndForget»
                     «method.generateProxyHelperClass(_interface, _accessor)»::callMethod(
                 «ELSE»
@@ -315,6 +469,15 @@ class FInterfaceSomeIPProxyGenerator {
                     _internalCallStatus«IF method.hasError»,
                     deploy_error«ENDIF»«IF outParams != ""»,
                     «outParams»«ENDIF»);
+                «IF generateInstrumentation»
+                    «IF method.isFireAndForget»
+                        COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.sent(itsMetricStart);)
+                    «ENDIF»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, _internalCallStatus == CommonAPI::CallStatus::SUCCESS);)
+                «ENDIF»
+                «IF generateTracepoints && !method.isFireAndForget»
+                    COMMONAPI_SOMEIP_PROBE(reply_receive, getSomeIpAddress().getService(), getSomeIpAddress().getInstance(), «method.getMethodIdentifier(_accessor)», «method.replyPayloadSize»);
+                «ENDIF»
                 «method.generateOutParamsValue(_accessor)»
             }
 
@@ -324,8 +487,30 @@ class FInterfaceSomeIPProxyGenerator {
                     «IF timeout != 0»
                         static CommonAPI::CallInfo info(«timeout»);
                     «ENDIF»
+                    «IF generateDeadlines»
+                        // Calls made with a cancelled token are not sent
+                        auto itsCall = CommonAPI::SomeIP::Deadline::Call< «method.cancellableCallTypes» >::create(_callback);
+                        if (itsCall->isDone())
+                            return itsCall->getFuture();
+                    «ENDIF»
+                    «IF method.isLimitedMethod(_accessor)»
+                        std::shared_ptr<CommonAPI::SomeIP::Backpressure::Window> itsWindow(backpressureWindows_.at(«method.getMethodIdentifier(_accessor)»));
+                        if (!itsWindow->tryAcquire())
+                            return CommonAPI::SomeIP::Backpressure::reject< «method.callbackValueTypes.join(", ")» >(_callback);
+                    «ENDIF»
                     «method.generateProxyHelperDeployments(_interface, true, _accessor)»
-                    return «method.generateProxyHelperClass(_interface, _accessor)»::callMethodAsync(
+                    «IF generateTracepoints»
+                        COMMONAPI_SOMEIP_PROBE_HOOK(const CommonAPI::SomeIP::Address itsTraceAddress(getSomeIpAddress());)
+                        COMMONAPI_SOMEIP_PROBE(request_send, getSomeIpAddress().getService(), getSomeIpAddress().getInstance(), «method.getMethodIdentifier(_accessor)», «method.inArgs.tracePayloadSize»);
+                    «ENDIF»
+                    «IF generateInstrumentation»
+                        «method.generateMetricStart(_interface, _accessor)»
+                    «ENDIF»
+                    «IF generateInstrumentation || generateDeadlines»
+                        auto itsFuture = «method.generateProxyHelperClass(_interface, _accessor)»::callMethodAsync(
+                    «ELSE»
+                        return «method.generateProxyHelperClass(_interface, _accessor)»::callMethodAsync(
+                    «ENDIF»
                         *this,
                         «method.getMethodIdentifier(_accessor)»,
                         «method.isReliable(_accessor)»,
@@ -333,6 +518,16 @@ class FInterfaceSomeIPProxyGenerator {
                         (_info ? _info : «IF timeout != 0»&info«ELSE»&CommonAPI::SomeIP::defaultCallInfo«ENDIF»),
                         «IF inParams != ""»«inParams»,«ENDIF»
                         «method.generateCallback(_interface, _accessor)»);
+                    «IF generateInstrumentation»
+                        COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.sent(itsMetricStart);)
+                    «ENDIF»
+                    «IF generateDeadlines»
+                        // The future of the call is also ready when the call is cancelled
+                        (void)itsFuture;
+                        return itsCall->getFuture();
+                    «ELSEIF generateInstrumentation»
+                        return itsFuture;
+                    «ENDIF»
                 }
 
             «ENDIF»
@@ -414,6 +609,18 @@ class FInterfaceSomeIPProxyGenerator {
         «ENDFOR»
     '''
 
+    // Payload size of the reply if it does not depend on the values, otherwise -1
+    def private String getReplyPayloadSize(FMethod _method) {
+        if (_method.hasError)
+            return "-1"
+        return _method.outArgs.tracePayloadSize
+    }
+
+    def private generateMetricStart(FMethod _method, FInterface _interface, PropertyAccessor _accessor) '''
+        COMMONAPI_SOMEIP_METRICS_HOOK(«_interface.someipMetricsClassName»::Metric &itsMetric = «_interface.someipMetricsClassName»::method(«_interface.someipMetricsClassName»::Side::PROXY, «_method.getMethodIdentifier(_accessor)»);
+                                      const auto itsMetricStart = itsMetric.start();)
+    '''
+
     def private generateProxyHelperClass(FMethod _method, FInterface _interface, PropertyAccessor _accessor) '''
     CommonAPI::SomeIP::ProxyHelper<
         CommonAPI::SomeIP::SerializableArguments<
@@ -461,10 +668,10 @@ class FInterfaceSomeIPProxyGenerator {
     def private generateOutParamsValue(FMethod _method, PropertyAccessor _accessor) {
         var String outParamsValue = ""
         if (_method.hasError) {
-            outParamsValue += "_error = deploy_error.getValue();\n"
+            outParamsValue += "_error = std::move(deploy_error.getValue());\n"
         }
         for (a : _method.outArgs) {
-            outParamsValue += "_" + a.name + " = deploy_" + a.name + ".getValue();\n"
+            outParamsValue += "_" + a.name + " = std::move(deploy_" + a.name + ".getValue());\n"
         }
         return outParamsValue
     }
@@ -476,15 +683,42 @@ class FInterfaceSomeIPProxyGenerator {
             error = "deploy_error"
         }
 
-        var String callback = "[_callback] (" + generateCallbackParameter(_method, _interface, _accessor) + ") {\n"
-        callback += "    if (_callback)\n"
-        callback += "        _callback(_internalCallStatus"
-        if(_method.hasError) callback += ", _deploy_error.getValue()"
+        var String captures = if (generateDeadlines) "itsCall" else "_callback"
+        if (_method.isLimitedMethod(_accessor))
+            captures += ", itsWindow"
+        if (generateInstrumentation)
+            captures += " COMMONAPI_SOMEIP_METRICS_HOOK(, itsMetricStart)"
+        if (generateTracepoints)
+            captures += " COMMONAPI_SOMEIP_PROBE_HOOK(, itsTraceAddress)"
+        var String callback = "[" + captures + "] (" + generateCallbackParameter(_method, _interface, _accessor) + ") {\n"
+        if (_method.isLimitedMethod(_accessor))
+            callback += "    itsWindow->release();\n"
+        val String metrics = _interface.someipMetricsClassName
+        if (generateInstrumentation) {
+            callback += "    COMMONAPI_SOMEIP_METRICS_HOOK(" + metrics + "::Metric &itsMetric = " + metrics + "::method(" + metrics + "::Side::PROXY, "
+                + _method.getMethodIdentifier(_accessor) + ");\n"
+            callback += "                                  itsMetric.finished(itsMetricStart, _internalCallStatus == CommonAPI::CallStatus::SUCCESS);)\n"
+        }
+        if (generateTracepoints) {
+            callback += "    COMMONAPI_SOMEIP_PROBE(reply_receive, itsTraceAddress.getService(), itsTraceAddress.getInstance(), "
+                + _method.getMethodIdentifier(_accessor) + ", " + _method.replyPayloadSize + ");\n"
+        }
+        if (generateInstrumentation)
+            callback += "    COMMONAPI_SOMEIP_METRICS_HOOK(const auto itsHandlerStart = " + metrics + "::Metric::now();)\n"
+        if (generateDeadlines) {
+            callback += "    itsCall->complete(_internalCallStatus"
+        } else {
+            callback += "    if (_callback)\n"
+            callback += "        _callback(_internalCallStatus"
+        }
+        if(_method.hasError) callback += ", std::move(_deploy_error.getValue())"
         for (a : _method.outArgs) {
-            callback += ", _" + a.name
-            callback += ".getValue()"
+            callback += ", std::move(_" + a.name
+            callback += ".getValue())"
         }
         callback += ");\n"
+        if (generateInstrumentation)
+            callback += "    COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.handled(itsHandlerStart);)\n"
         callback += "},\n"
 
         var String out = generateOutParams(_method, _accessor, true)
@@ -493,6 +727,24 @@ class FInterfaceSomeIPProxyGenerator {
         return callback
     }
 
+    // The types of the values the callback is called with after the status
+    def private List<String> callbackValueTypes(FMethod _method) {
+        val List<String> types = new LinkedList<String>()
+        if (_method.hasError)
+            types.add(_method.errorType)
+        for (a : _method.outArgs)
+            types.add(a.getTypeName(_method, true))
+        return types
+    }
+
+    def private String cancellableCallTypes(FMethod _method) {
+        return (#["decltype(_callback)"] + _method.callbackValueTypes).join(", ")
+    }
+
+    def private boolean hasCancellableCalls(FInterface _interface) {
+        return generateDeadlines && _interface.methods.exists[!isFireAndForget]
+    }
+
     def private generateCallbackParameter(FMethod _method, FInterface _interface, PropertyAccessor _accessor) {
         var String declaration = "CommonAPI::CallStatus _internalCallStatus"
         if (_method.hasError)
@@ -506,6 +758,249 @@ class FInterfaceSomeIPProxyGenerator {
         return declaration
     }
 
+    // Attribute whose changed event follows the delta event instead of the notifier. The
+    // changes are applied to a local copy, gaps are recovered by the resync request, which
+    // returns the value the next changes are based on and its sequence number.
+    def private generateDeltaAttributeClass(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «val String baseClassName = if (_attribute.supportsTypeValidation) "SomeIP" + _attribute.someipClassVariableName + "Attribute" else _attribute.someipClassName(_interface, _accessor)»
+        «val String className = "SomeIP" + _attribute.someipClassVariableName + "DeltaAttribute"»
+        «val String typeName = _attribute.getTypeName(_interface, true)»
+        «val List<String> types = _attribute.getDeltaTypes(_interface)»
+        «val List<String> deployables = _attribute.getDeltaDeployables(_interface)»
+        «val List<String> deployments = _attribute.getDeltaDeploymentRefs("changesDeployment_", "keysDeployment_")»
+        «val String deployment = _attribute.getDeploymentRef(_attribute.array, null, _interface, _accessor.getOverwriteAccessor(_attribute))»
+        «val String valueDeployable = "CommonAPI::Deployable< " + typeName + ", " + _attribute.getDeploymentType(_interface, true) + ">"»
+        «val String sequenceDeployable = "CommonAPI::Deployable< CommonAPI::SomeIP::Delta::Sequence, CommonAPI::EmptyDeployment>"»
+        class «className» : public «baseClassName» {
+        public:
+            template <typename... _A>
+                «className»(«_interface.someipProxyClassName» &_proxy,
+                    _A ... arguments) : «baseClassName»(_proxy, arguments...),
+                                        deltaChangedEvent_(_proxy) {}
+
+            ChangedEvent &getChangedEvent() {
+                return deltaChangedEvent_;
+            }
+
+        private:
+            class DeltaChangedEvent : public ChangedEvent {
+            public:
+                DeltaChangedEvent(«_interface.someipProxyClassName» &_proxy)
+                    : proxy_(_proxy),
+                      guard_(std::make_shared<CommonAPI::SomeIP::Delta::Guard<DeltaChangedEvent>>(this)),
+                      isResyncing_(std::make_shared<std::atomic<bool>>(false)),
+                      subscription_(0),
+                      changesDeployment_(CommonAPI::SomeIP::Delta::getChangesDeployment(«deployment»)),
+                      «IF _attribute.isDeltaMap»
+                          keysDeployment_(CommonAPI::SomeIP::Delta::getKeysDeployment< «_attribute.getDeltaKeyDeploymentType(_interface)»>(«deployment»)),
+                      «ENDIF»
+                      deltaEvent_(_proxy, «_attribute.getNotifierEventGroups(_accessor).head», «_attribute.getDeltaIdentifier(_accessor)», CommonAPI::SomeIP::event_type_e::ET_EVENT, «_attribute.getNotifierReliabilityType(_accessor)», «_attribute.getEndianess(_accessor)»,
+                                  std::make_tuple(«(0 ..< deployables.size).map[deployables.get(it) + "(" + deployments.get(it) + ")"].join(", ")»)) {}
+
+                ~DeltaChangedEvent() {
+                    guard_->reset();
+                }
+
+            protected:
+                void onFirstListenerAdded(const Listener &_listener) {
+                    (void)_listener;
+                    subscription_ = deltaEvent_.subscribe(
+                        [this](«(0 ..< types.size).map["const " + types.get(it) + " &_" + it].join(", ")») {
+                            if (replica_.receive(«(0 ..< types.size).map["_" + it].join(", ")»,
+                                    [this](const «typeName» &_value) { this->notifyListeners(_value); })
+                                        == CommonAPI::SomeIP::Delta::Result::RESYNC) {
+                                resync();
+                            }
+                        });
+                    resync();
+                }
+
+                void onListenerAdded(const Listener &_listener, const Subscription _subscription) {
+                    (void)_listener;
+                    replica_.read([this, _subscription](const «typeName» &_value) {
+                        this->notifySpecificListener(_subscription, _value);
+                    });
+                }
+
+                void onLastListenerRemoved(const Listener &_listener) {
+                    (void)_listener;
+                    deltaEvent_.unsubscribe(subscription_);
+                    replica_.reset();
+                }
+
+            private:
+                // Sends the resync request unless it is already sent and applies the
+                // returned value with its sequence number to the copy
+                void resync() {
+                    if (!isResyncing_->exchange(true)) {
+                        std::weak_ptr<CommonAPI::SomeIP::Delta::Guard<DeltaChangedEvent>> itsGuard(guard_);
+                        std::shared_ptr<std::atomic<bool>> itsResyncing(isResyncing_);
+                        CommonAPI::SomeIP::ProxyHelper<
+                            CommonAPI::SomeIP::SerializableArguments<>,
+                            CommonAPI::SomeIP::SerializableArguments< «valueDeployable», «sequenceDeployable»>
+                        >::callMethodAsync(
+                            proxy_,
+                            «_attribute.getDeltaResyncIdentifier(_accessor)»,
+                            «_attribute.isGetterReliable(_accessor)»,
+                            «_attribute.getEndianess(_accessor)»,
+                            &CommonAPI::SomeIP::defaultCallInfo,
+                            [itsGuard, itsResyncing](CommonAPI::CallStatus _status, «valueDeployable» _value, «sequenceDeployable» _sequence) {
+                                std::shared_ptr<CommonAPI::SomeIP::Delta::Guard<DeltaChangedEvent>> itsOwner(itsGuard.lock());
+                                if (itsOwner && _status == CommonAPI::CallStatus::SUCCESS) {
+                                    itsOwner->call([&_value, &_sequence](DeltaChangedEvent &_event) {
+                                        _event.replica_.resync(_sequence.getValue(), _value.getValue(),
+                                            [&_event](const «typeName» &_copy) { _event.notifyListeners(_copy); });
+                                    });
+                                }
+                                *itsResyncing = false;
+                            },
+                            std::make_tuple(«valueDeployable»(«deployment»),
+                                            «sequenceDeployable»(static_cast< CommonAPI::EmptyDeployment * >(nullptr))));
+                    }
+                }
+
+                «_interface.someipProxyClassName» &proxy_;
+                std::shared_ptr<CommonAPI::SomeIP::Delta::Guard<DeltaChangedEvent>> guard_;
+                std::shared_ptr<std::atomic<bool>> isResyncing_;
+                CommonAPI::SomeIP::Delta::«IF _attribute.isDeltaMap»Map«ELSE»Array«ENDIF»Replica< «typeName»> replica_;
+                Subscription subscription_;
+                std::shared_ptr< «_attribute.getDeploymentType(_interface, true)»> changesDeployment_;
+                «IF _attribute.isDeltaMap»
+                    std::shared_ptr< CommonAPI::SomeIP::ArrayDeployment< «_attribute.getDeltaKeyDeploymentType(_interface)»>> keysDeployment_;
+                «ENDIF»
+                CommonAPI::SomeIP::Event<CommonAPI::Event< «types.join(", ")»>, «deployables.join(", ")»> deltaEvent_;
+            };
+
+            DeltaChangedEvent deltaChangedEvent_;
+        };
+    '''
+
+    // Values of the attributes of a batch event group and whether they were changed or
+    // received for the first time. Unchanged attributes keep the last received value.
+    def private generateBatchStruct(FInterface _interface, Integer _group, PropertyAccessor _accessor) '''
+        struct «_group.batchName» {
+            «FOR attribute : _interface.getBatchAttributes(_group, _accessor)»
+                «attribute.getTypeName(_interface, true)» «attribute.elementName»;
+                bool «attribute.batchChangedName»;
+            «ENDFOR»
+        };
+    '''
+
+    // Event of a batch event group. The last batch is kept for listeners that subscribe
+    // later, as the changed events of the attributes follow this event.
+    def private generateBatchEventClass(FInterface _interface, Integer _group, PropertyAccessor _accessor) '''
+        «val String className = "SomeIP" + _group.batchName + "Event"»
+        «val attributes = _interface.getBatchAttributes(_group, _accessor)»
+        «val List<String> types = _interface.getBatchTypes(_group, _accessor)»
+        «val List<String> deployables = _interface.getBatchDeployables(_group, _accessor)»
+        «val List<String> deployments = _interface.getBatchDeploymentRefs(_group, _accessor)»
+        class «className» : public CommonAPI::Event< «_group.batchName»> {
+        public:
+            «className»(«_interface.someipProxyClassName» &_proxy)
+                : subscription_(0),
+                  event_(_proxy, «_group.batchEventGroup», «_interface.getBatchIdentifier(_group, _accessor)», CommonAPI::SomeIP::event_type_e::ET_FIELD, «attributes.head.getNotifierReliabilityType(_accessor)», «attributes.head.getEndianess(_accessor)»,
+                         std::make_tuple(«(0 ..< deployables.size).map[deployables.get(it) + "(" + deployments.get(it) + ")"].join(", ")»)) {}
+
+        protected:
+            void onFirstListenerAdded(const Listener &_listener) {
+                (void)_listener;
+                subscription_ = event_.subscribe(
+                    [this](«(0 ..< types.size).map["const " + types.get(it) + " &_" + it].join(", ")») {
+                        cache_.write([&](«_group.batchName» &_last, «_group.batchName» &_known) {
+                            «FOR i : 0 ..< attributes.size»
+                                «val String name = attributes.get(i).elementName»
+                                «val String changed = attributes.get(i).batchChangedName»
+                                _last.«changed» = (_«i».state_ == CommonAPI::SomeIP::Batch::State::CHANGED ||
+                                    (_«i».state_ == CommonAPI::SomeIP::Batch::State::PRESENT && !_known.«changed»));
+                                if (_«i».state_ != CommonAPI::SomeIP::Batch::State::ABSENT) {
+                                    _last.«name» = _«i».value_;
+                                    _known.«name» = _«i».value_;
+                                    _known.«changed» = true;
+                                }
+                            «ENDFOR»
+                        }, [this](const «_group.batchName» &_batch) { this->notifyListeners(_batch); });
+                    });
+            }
+
+            void onListenerAdded(const Listener &_listener, const Subscription _subscription) {
+                (void)_listener;
+                cache_.read([this, _subscription](const «_group.batchName» &_batch) {
+                    this->notifySpecificListener(_subscription, _batch);
+                });
+            }
+
+            void onLastListenerRemoved(const Listener &_listener) {
+                (void)_listener;
+                event_.unsubscribe(subscription_);
+                cache_.reset();
+            }
+
+        private:
+            CommonAPI::SomeIP::Batch::Cache< «_group.batchName»> cache_;
+            Subscription subscription_;
+            CommonAPI::SomeIP::Event<CommonAPI::Event< «types.join(", ")»>, «deployables.join(", ")»> event_;
+        };
+        «className» «_group.batchEventMemberName»;
+    '''
+
+    // Attribute whose changed event follows the batch event of its event group
+    def private generateBatchAttributeClass(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «val String baseClassName = if (_attribute.supportsTypeValidation) "SomeIP" + _attribute.someipClassVariableName + "Attribute" else _attribute.someipClassName(_interface, _accessor)»
+        «val String className = "SomeIP" + _attribute.someipClassVariableName + "BatchAttribute"»
+        «val Integer group = _attribute.getBatchEventGroup(_interface, _accessor)»
+        class «className» : public «baseClassName» {
+        public:
+            template <typename... _A>
+                «className»(«_interface.someipProxyClassName» &_proxy,
+                    _A ... arguments) : «baseClassName»(_proxy, arguments...),
+                                        batchChangedEvent_(_proxy.«group.batchEventMemberName»,
+                                                           &«group.batchName»::«_attribute.elementName»,
+                                                           &«group.batchName»::«_attribute.batchChangedName») {}
+
+            ChangedEvent &getChangedEvent() {
+                return batchChangedEvent_;
+            }
+
+        private:
+            CommonAPI::SomeIP::Batch::ChangedEvent< «_attribute.getTypeName(_interface, true)», «group.batchName»> batchChangedEvent_;
+        };
+    '''
+
+    // Attribute whose concurrent asynchronous getter calls share one getter request
+    def private generateCoalescingAttributeClass(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «val String baseClassName = _attribute.someipCoalescedClassName(_interface, _accessor)»
+        «val String className = "SomeIP" + _attribute.someipClassVariableName + "CoalescingAttribute"»
+        class «className» : public «baseClassName» {
+        public:
+            template <typename... _A>
+                «className»(«_interface.someipProxyClassName» &_proxy,
+                    _A ... arguments) : «baseClassName»(_proxy, arguments...) {}
+
+            std::future<CommonAPI::CallStatus> getValueAsync(AttributeAsyncCallback _callback,
+                                                             const CommonAPI::CallInfo *_info = nullptr) {
+                return getter_.getValueAsync(_callback, _info,
+                    [this](AttributeAsyncCallback _reply, const CommonAPI::CallInfo *_requestInfo) {
+                        return «baseClassName»::getValueAsync(_reply, _requestInfo);
+                    });
+            }
+
+        private:
+            CommonAPI::SomeIP::Coalescing::Getter< «_attribute.getTypeName(_interface, true)»> getter_;
+        };
+    '''
+
+    def private String batchChangedName(FAttribute _attribute) {
+        return "is" + _attribute.elementName.toFirstUpper + "Changed"
+    }
+
+    def private String batchEventMemberName(Integer _group) {
+        return _group.batchName.toFirstLower + "Event_"
+    }
+
+    def private String batchEventGetterName(Integer _group) {
+        return "get" + _group.batchName + "Event"
+    }
+
     def private someipClassName(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
         var type = "CommonAPI::SomeIP::"
 
@@ -523,8 +1018,62 @@ class FInterfaceSomeIPProxyGenerator {
         return type
     }
 
-    def private generateVariableInit(FAttribute _attribute, PropertyAccessor _accessor, FInterface _interface) {
-        var init = _attribute.someipClassVariableName + "(*this"
+    // Class of the member of an attribute, including the classes generated for type
+    // validation, delta, batch and coalescing attributes
+    def private someipMemberClassName(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
+        if (_attribute.isCoalescedGetter(_accessor))
+            return "SomeIP" + _attribute.someipClassVariableName + "CoalescingAttribute"
+        return _attribute.someipCoalescedClassName(_interface, _accessor)
+    }
+
+    // Class of the member of an attribute with -in: the metrics count its getter and setter
+    // calls if COMMONAPI_SOMEIP_METRICS is defined, otherwise it is the member class
+    def private someipMeasuredClassName(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
+        val String className = _attribute.someipMemberClassName(_interface, _accessor)
+        if (!generateInstrumentation)
+            return className
+        if (_attribute.isReadonly)
+            return _interface.someipMetricsClassName + "::ProxyReadonlyAttribute< " + className + ", " +
+                _attribute.getGetterIdentifier(_accessor) + ">"
+        return _interface.someipMetricsClassName + "::ProxyAttribute< " + className + ", " +
+            _attribute.getGetterIdentifier(_accessor) + ", " + _attribute.getSetterIdentifier(_accessor) + ">"
+    }
+
+    // Class the coalescing attribute class derives from
+    def private someipCoalescedClassName(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
+        if (_attribute.isDeltaAttribute(_accessor))
+            return "SomeIP" + _attribute.someipClassVariableName + "DeltaAttribute"
+        if (_attribute.isBatchAttribute(_interface, _accessor))
+            return "SomeIP" + _attribute.someipClassVariableName + "BatchAttribute"
+        if (_attribute.supportsTypeValidation)
+            return "SomeIP" + _attribute.someipClassVariableName + "Attribute"
+        return _attribute.someipClassName(_interface, _accessor)
+    }
+
+    // With lazy members, a member is created by its getter on first access. The once flag
+    // makes concurrent first accesses wait for the member instead of creating it twice.
+    def private generateMemberDeclaration(String _className, String _variableName) '''
+        «IF generateLazyMembers»
+            std::once_flag «_variableName.lazyOnceFlagName»;
+            std::unique_ptr< «_className»> «_variableName»;
+        «ELSE»
+            «_className» «_variableName»;
+        «ENDIF»
+    '''
+
+    def private generateLazyMemberInit(String _className, String _variableName, String _arguments) '''
+        std::call_once(«_variableName.lazyOnceFlagName», [this]() {
+            «_variableName».reset(new «_className»(«_arguments»));
+        });
+        return *«_variableName»;
+    '''
+
+    def private String lazyOnceFlagName(String _variableName) {
+        return _variableName.substring(0, _variableName.length - 1) + "Once_"
+    }
+
+    def private generateVariableArguments(FAttribute _attribute, PropertyAccessor _accessor, FInterface _interface) {
+        var init = "*this"
 
         if (_attribute.isObservable) {
             init += ", " + _attribute.getNotifierEventGroups(_accessor).head + ", " +
@@ -545,11 +1094,25 @@ class FInterfaceSomeIPProxyGenerator {
         if (deployment != "")
             init += ", " + deployment
 
-        init += ")"
-
         return init
     }
 
+    def private generateVariableArguments(FBroadcast _broadcast, PropertyAccessor _accessor, FInterface _interface) {
+        return "*this, " + _broadcast.getEventGroups(_accessor).head + ", " + _broadcast.getEventIdentifier(_accessor) + ", " +
+            (if (_broadcast.selective) "CommonAPI::SomeIP::event_type_e::ET_SELECTIVE_EVENT" else "CommonAPI::SomeIP::event_type_e::ET_EVENT") + ", " +
+            _broadcast.getReliabilityType(_accessor) + ", " + _broadcast.getEndianess(_accessor) + ", " + _broadcast.getDeployments(_interface, _accessor)
+    }
+
+    // Class of the member of a broadcast with -in: the metrics count the received events if
+    // COMMONAPI_SOMEIP_METRICS is defined, otherwise it is the event class
+    def private someipMeasuredClassName(FBroadcast _broadcast, FInterface _interface, PropertyAccessor _accessor) {
+        val String className = _broadcast.someipClassName(_interface, _accessor)
+        if (!generateInstrumentation)
+            return className
+        return _interface.someipMetricsClassName + "::ProxyEvent< " + className + ", " +
+            _broadcast.getEventIdentifier(_accessor) + ">"
+    }
+
     def private someipClassName(FBroadcast _broadcast, FInterface _interface, PropertyAccessor _accessor) {
         var eventDeclaration = "CommonAPI::SomeIP::"
 
@@ -14,6 +14,7 @@ import org.franca.core.franca.FAttribute
 import org.franca.core.franca.FBroadcast
 import org.franca.core.franca.FInterface
 import org.franca.core.franca.FMethod
+import org.franca.core.franca.FTypeCollection
 import org.franca.deploymodel.dsl.fDeploy.FDExtensionRoot
 import org.franca.deploymodel.ext.providers.FDeployedProvider
 import org.franca.deploymodel.ext.providers.ProviderUtils
@@ -28,13 +29,65 @@ class FInterfaceSomeIPStubAdapterGenerator {
     @Inject extension FrancaGeneratorExtensions
     @Inject extension FrancaSomeIPGeneratorExtensions
     @Inject extension FrancaSomeIPDeploymentAccessorHelper
+    @Inject extension SomeIPExecutionGenerator
+    @Inject extension SomeIPDeltaGenerator
+    @Inject extension SomeIPCompressionGenerator
+    @Inject extension SomeIPUtf16Generator
+    @Inject extension SomeIPSharedMemoryGenerator
+    @Inject extension SomeIPBulkGenerator
+    @Inject extension SomeIPPolymorphGenerator
+    @Inject extension SomeIPBatchGenerator
+    @Inject extension SomeIPDeadlineGenerator
+    @Inject extension SomeIPBackpressureGenerator
+    @Inject extension FTypeCollectionSomeIPViewGenerator
+
+    var boolean generateInstrumentation = false
+    var boolean generateTracepoints = false
+    var boolean generateCapture = false
+    var boolean generateViews = false
+    var boolean generateDeadlines = false
 
     def generateStubAdapter(FInterface fInterface, IFileSystemAccess fileSystemAccess, PropertyAccessor deploymentAccessor, List<FDExtensionRoot> providers, IResource modelid) {
         if(FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            generateInstrumentation = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_INSTRUMENTATION_SOMEIP, "false").equals("true")
+            generateTracepoints = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_TRACEPOINTS_SOMEIP, "false").equals("true")
+            generateCapture = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CAPTURE_SOMEIP, "false").equals("true")
+            generateViews = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_VIEWS_SOMEIP, "false").equals("true")
+            generateDeadlines = FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_DEADLINES_SOMEIP, "false").equals("true")
             fileSystemAccess.generateFile(fInterface.someipStubAdapterHeaderPath, PreferenceConstantsSomeIP.P_OUTPUT_STUBS_SOMEIP,
                 fInterface.generateStubAdapterHeader(deploymentAccessor, modelid))
             fileSystemAccess.generateFile(fInterface.someipStubAdapterSourcePath, PreferenceConstantsSomeIP.P_OUTPUT_STUBS_SOMEIP,
                 fInterface.generateStubAdapterSource(deploymentAccessor, providers, modelid))
+            if (fInterface.hasOffloadedDispatch(deploymentAccessor)) {
+                generateExecution(fileSystemAccess)
+                if (generateDeadlines) {
+                    generateDeadline(fileSystemAccess)
+                }
+            }
+            if (fInterface.hasLimitedMethods(deploymentAccessor)) {
+                generateBackpressure(fileSystemAccess)
+            }
+            if (fInterface.hasDeltaAttributes(deploymentAccessor)) {
+                generateDelta(fileSystemAccess)
+            }
+            if (fInterface.hasCompressedElements) {
+                generateCompression(fileSystemAccess)
+            }
+            if (fInterface.hasUtf16Elements) {
+                generateUtf16(fileSystemAccess)
+            }
+            if (fInterface.hasSharedMemoryElements) {
+                generateSharedMemory(fileSystemAccess)
+            }
+            if (fInterface.hasBulkElements) {
+                generateBulk(fileSystemAccess)
+            }
+            if (fInterface.hasPooledPolymorphicElements) {
+                generatePolymorph(fileSystemAccess)
+            }
+            if (fInterface.hasBatchEventGroups(deploymentAccessor)) {
+                generateBatch(fileSystemAccess)
+            }
         }
         else {
             fileSystemAccess.generateFile(fInterface.someipStubAdapterHeaderPath, PreferenceConstantsSomeIP.P_OUTPUT_STUBS_SOMEIP,
@@ -67,10 +120,54 @@ class FInterfaceSomeIPStubAdapterGenerator {
         #include <CommonAPI/SomeIP/Constants.hpp>
 
         «endInternalCompilation»
+        «IF generateInstrumentation»
+
+            #include <«_interface.someipMetricsHeaderPath»>
+        «ENDIF»
+        «IF generateCapture»
+
+            #include <«someipCaptureHeaderPath»>
+        «ENDIF»
+        «IF _interface.hasOffloadedDispatch(_accessor)»
+
+            «IF !_interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Dedicated).empty || _interface.hasLimitedMethods(_accessor)»
+                #include <map>
+            «ENDIF»
+            #include <«someipExecutionHeaderPath»>
+            «IF _interface.hasLimitedMethods(_accessor)»
+                #include <«someipBackpressureHeaderPath»>
+            «ENDIF»
+            «IF generateDeadlines»
+                #include <«someipDeadlineHeaderPath»>
+            «ENDIF»
+        «ENDIF»
+        «IF _interface.hasDeltaAttributes(_accessor)»
+
+            #include <«someipDeltaHeaderPath»>
+        «ENDIF»
+        «IF _interface.hasBatchEventGroups(_accessor)»
+
+            #include <«someipBatchHeaderPath»>
+        «ENDIF»
+        «IF !_interface.getViewMethods(_accessor).empty»
+
+            #include <«someipViewHeaderPath»>
+            «FOR include : _interface.getViewIncludes(_accessor)»
+                #include <«include»>
+            «ENDFOR»
+        «ENDIF»
+        «IF generateTracepoints»
+
+            «generateTracepointDefinitions»
+        «ENDIF»
 
         «_interface.generateVersionNamespaceBegin»
         «_interface.model.generateNamespaceBeginDeclaration»
 
+        «IF !_interface.getViewMethods(_accessor).empty»
+            «_interface.generateViewStub(_accessor)»
+
+        «ENDIF»
         template <typename _Stub = «_interface.stubFullClassName», typename... _Stubs>
         class «_interface.someipStubAdapterClassNameInternal»
             : public virtual «_interface.stubAdapterClassName»,
@@ -94,6 +191,13 @@ class FInterfaceSomeIPStubAdapterGenerator {
                     
                 «ENDIF»
             «ENDFOR»
+            «FOR group : _interface.getBatchEventGroups(_accessor)»
+                // Opens a flush window of event group «group»: the changes of its attributes, made by
+                // any thread, are collected until the last open scope is destroyed and then sent as
+                // one event. Batches may be nested.
+                CommonAPI::SomeIP::Batch::Scope «group.batchBeginMethodName»();
+
+            «ENDFOR»
             «FOR broadcast: _interface.broadcasts»
                 «FTypeGenerator::generateComments(broadcast, false)»
                 «IF broadcast.selective»
@@ -148,10 +252,39 @@ class FInterfaceSomeIPStubAdapterGenerator {
                     return «_interface.someipStubAdapterHelperClassName»::deinit();
                 }
 
+            «ENDIF»
+            «IF _interface.hasOffloadedDispatch(_accessor)»
+                «_interface.generateOffloadedDispatch(_accessor)»
+
+            «ELSEIF _interface.base !== null»
                 virtual bool onInterfaceMessage(const CommonAPI::SomeIP::Message &_message) {
-                    return «_interface.someipStubAdapterHelperClassName»::onInterfaceMessage(_message);
+                    «IF generateInstrumentation || generateTracepoints || generateCapture || _interface.hasDeltaAttributes(_accessor) || !_interface.getViewMethods(_accessor).empty»
+                        «_interface.generateDispatchBody(_accessor)»
+                    «ELSE»
+                        return «_interface.someipStubAdapterHelperClassName»::onInterfaceMessage(_message);
+                    «ENDIF»
                 }
                 
+            «ELSEIF generateCapture || _interface.hasDeltaAttributes(_accessor) || !_interface.getViewMethods(_accessor).empty»
+                virtual bool onInterfaceMessage(const CommonAPI::SomeIP::Message &_message) {
+                    «_interface.generateDispatchBody(_accessor)»
+                }
+
+            «ELSEIF generateInstrumentation || generateTracepoints»
+                #if «IF generateInstrumentation»defined(COMMONAPI_SOMEIP_METRICS)«ENDIF»«IF generateInstrumentation && generateTracepoints» || «ENDIF»«IF generateTracepoints»defined(COMMONAPI_SOMEIP_PROBES)«ENDIF»
+                virtual bool onInterfaceMessage(const CommonAPI::SomeIP::Message &_message) {
+                    «_interface.generateDispatchBody(_accessor)»
+                }
+                #endif
+
+            «ENDIF»
+            «IF !_interface.getOwnDispatchMethods(_accessor).empty»
+                «_interface.generateOwnDispatch(_accessor)»
+
+            «ENDIF»
+            «IF _interface.hasDeltaAttributes(_accessor)»
+                «_interface.generateResyncDispatch(_accessor)»
+
             «ENDIF»
             CommonAPI::SomeIP::GetAttributeStubDispatcher<
                 «_interface.stubFullClassName»,
@@ -192,6 +325,15 @@ class FInterfaceSomeIPStubAdapterGenerator {
                 «_interface.generateAttributeDispatcherTableContent»
                 «_interface.generateMethodDispatcherTableContent(counterMap, methodNumberMap)»
                 «_interface.generateStubAttributeTableInitializer(_accessor)»
+                «FOR id : _interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Dedicated)»
+                    «_interface.dedicatedThreadsName»[«id»] = std::make_shared<CommonAPI::SomeIP::Execution::DedicatedThread>();
+                «ENDFOR»
+                «FOR method : _interface.methods.filter[isLimitedMethod(_accessor)]»
+                    «_interface.limitersName»[«method.getMethodIdentifier(_accessor)»] = std::make_shared<CommonAPI::SomeIP::Backpressure::Limiter>(«method.getMaxInFlight(_accessor)», «method.getQueueDepth(_accessor)»);
+                «ENDFOR»
+                «IF !_interface.getViewMethods(_accessor).empty»
+                    «_interface.viewStubName» = dynamic_cast< «_interface.viewStubClassName» *>(_stub.get());
+                «ENDIF»
                 «IF (!_interface.attributes.filter[isObservable()].empty)»
                     std::shared_ptr<CommonAPI::SomeIP::ClientId> itsClient = std::make_shared<CommonAPI::SomeIP::ClientId>();
 
@@ -212,14 +354,27 @@ class FInterfaceSomeIPStubAdapterGenerator {
                         }
                     «ENDIF»
                 «ENDFOR»
+                «FOR group : _interface.getBatchEventGroups(_accessor)»
+                    {
+                        std::set<CommonAPI::SomeIP::eventgroup_id_t> itsEventGroups;
+                        itsEventGroups.insert(«group.batchEventGroup»);
+                        CommonAPI::SomeIP::StubAdapter::registerEvent(«_interface.getBatchIdentifier(group, _accessor)», itsEventGroups, CommonAPI::SomeIP::event_type_e::ET_FIELD, «_interface.getBatchAttributes(group, _accessor).head.getNotifierReliabilityType(_accessor)»);
+                    }
+                «ENDFOR»
                 «FOR attribute : _interface.attributes»
                     «IF attribute.observable»
                         if (_stub->hasElement(«_interface.getElementPosition(attribute)»)) {
-                            std::set<CommonAPI::SomeIP::eventgroup_id_t> itsEventGroups;
-                            «FOR eventgroup : attribute.getNotifierEventGroups(_accessor)»
-                            itsEventGroups.insert(CommonAPI::SomeIP::eventgroup_id_t(«eventgroup»));
-                            «ENDFOR»
-                            CommonAPI::SomeIP::StubAdapter::registerEvent(«attribute.getNotifierIdentifier(_accessor)», itsEventGroups, CommonAPI::SomeIP::event_type_e::ET_FIELD, «attribute.getNotifierReliabilityType(_accessor)»);
+                            «IF !attribute.isBatchAttribute(_interface, _accessor)»
+                                std::set<CommonAPI::SomeIP::eventgroup_id_t> itsEventGroups;
+                                «FOR eventgroup : attribute.getNotifierEventGroups(_accessor)»
+                                itsEventGroups.insert(CommonAPI::SomeIP::eventgroup_id_t(«eventgroup»));
+                                «ENDFOR»
+                                «IF attribute.isDeltaAttribute(_accessor)»
+                                    CommonAPI::SomeIP::StubAdapter::registerEvent(«attribute.getDeltaIdentifier(_accessor)», itsEventGroups, CommonAPI::SomeIP::event_type_e::ET_EVENT, «attribute.getNotifierReliabilityType(_accessor)»);
+                                «ELSE»
+                                    CommonAPI::SomeIP::StubAdapter::registerEvent(«attribute.getNotifierIdentifier(_accessor)», itsEventGroups, CommonAPI::SomeIP::event_type_e::ET_FIELD, «attribute.getNotifierReliabilityType(_accessor)»);
+                                «ENDIF»
+                            «ENDIF»
                             «attribute.stubAdapterClassFireChangedMethodName»(std::dynamic_pointer_cast< «_interface.stubFullClassName»>(_stub)->«attribute.getMethodName»(itsClient));
                         }
 
@@ -231,7 +386,7 @@ class FInterfaceSomeIPStubAdapterGenerator {
             void registerSelectiveEventHandlers();
             void unregisterSelectiveEventHandlers();
 
-        «IF _interface.hasSelectiveBroadcasts || _interface.managedInterfaces.size > 0»
+        «IF _interface.hasSelectiveBroadcasts || _interface.managedInterfaces.size > 0 || _interface.hasDeltaAttributes(_accessor) || _interface.hasBatchEventGroups(_accessor) || !_interface.getSharedMemoryEventGroups(_accessor).empty»
         private:
             «FOR broadcast: _interface.broadcasts»
                 «IF broadcast.selective»
@@ -243,6 +398,26 @@ class FInterfaceSomeIPStubAdapterGenerator {
             «FOR managed: _interface.managedInterfaces»
                 std::set<std::string> «managed.stubManagedSetName»;
             «ENDFOR»
+            «FOR attribute : _interface.attributes.filter[isDeltaAttribute(_accessor)]»
+                void «attribute.deltaSendMethodName»(«attribute.generateDeltaSendSignature(_interface)»);
+                CommonAPI::SomeIP::Delta::«IF attribute.isDeltaMap»Map«ELSE»Array«ENDIF»Sender< «attribute.getTypeName(_interface, true)»> «attribute.deltaSenderName»;
+            «ENDFOR»
+            «FOR group : _interface.getBatchEventGroups(_accessor)»
+                void «group.batchCommitMethodName»();
+                void «group.batchSendMethodName»();
+                void «group.batchHandlerName»(CommonAPI::SomeIP::client_id_t _client, const CommonAPI::SomeIP::sec_client_t *_sec_client, const std::string &_env, bool _subscribe, const CommonAPI::SomeIP::SubscriptionAcceptedHandler_t& _acceptedHandler);
+                CommonAPI::SomeIP::Batch::Sender «group.batchSenderName»;
+                «FOR attribute : _interface.getBatchAttributes(group, _accessor)»
+                    «attribute.getTypeName(_interface, true)» «attribute.batchValueName»{};
+                «ENDFOR»
+            «ENDFOR»
+            «IF !_interface.getSharedMemoryEventGroups(_accessor).empty»
+                void sharedMemoryHandler(CommonAPI::SomeIP::eventgroup_id_t _eventgroup, CommonAPI::SomeIP::client_id_t _client, const CommonAPI::SomeIP::sec_client_t *_sec_client, const std::string &_env, bool _subscribe, const CommonAPI::SomeIP::SubscriptionAcceptedHandler_t& _acceptedHandler);
+                CommonAPI::SomeIP::SharedMemory::Subscribers sharedMemorySubscribers_;
+                «FOR attribute : _interface.getSharedMemoryAttributes(_accessor)»
+                    CommonAPI::SomeIP::SharedMemory::Field «attribute.sharedMemoryFieldName»;
+                «ENDFOR»
+            «ENDIF»
         «ENDIF»
         };
 
@@ -253,7 +428,84 @@ class FInterfaceSomeIPStubAdapterGenerator {
                 «attribute.generateFireChangedMethodBody(_interface, _accessor)»
             }
 
+            «IF attribute.isDeltaAttribute(_accessor)»
+                template <typename _Stub, typename... _Stubs>
+                void «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::«attribute.deltaSendMethodName»(«attribute.generateDeltaSendSignature(_interface)») {
+                    «attribute.generateDeltaSendMethodBody(_interface, _accessor)»
+                }
+
+            «ENDIF»
+        «ENDFOR»
+        «FOR group : _interface.getBatchEventGroups(_accessor)»
+            template <typename _Stub, typename... _Stubs>
+            CommonAPI::SomeIP::Batch::Scope «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::«group.batchBeginMethodName»() {
+                {
+                    std::lock_guard<std::mutex> itsLock(«group.batchSenderName».getMutex());
+                    «group.batchSenderName».begin();
+                }
+                return CommonAPI::SomeIP::Batch::Scope([this]() { «group.batchCommitMethodName»(); });
+            }
+
+            template <typename _Stub, typename... _Stubs>
+            void «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::«group.batchCommitMethodName»() {
+                std::lock_guard<std::mutex> itsLock(«group.batchSenderName».getMutex());
+                if («group.batchSenderName».commit()) {
+                    «group.batchSendMethodName»();
+                }
+            }
+
+            // A new subscriber gets the field value cached by the middleware, the next event
+            // contains all attributes to complete it
+            template <typename _Stub, typename... _Stubs>
+            void «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::«group.batchHandlerName»(CommonAPI::SomeIP::client_id_t _client, const CommonAPI::SomeIP::sec_client_t *_sec_client, const std::string &_env, bool _subscribe, const CommonAPI::SomeIP::SubscriptionAcceptedHandler_t& _acceptedHandler) {
+                (void)_client;
+                (void)_sec_client;
+                (void)_env;
+                _acceptedHandler(true);
+                if (_subscribe) {
+                    std::lock_guard<std::mutex> itsLock(«group.batchSenderName».getMutex());
+                    if («group.batchSenderName».refresh()) {
+                        «group.batchSendMethodName»();
+                    }
+                }
+            }
+
+            // Sends the changed attributes of the event group, and all attributes after a
+            // subscription. The mutex of the sender must be held.
+            template <typename _Stub, typename... _Stubs>
+            void «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::«group.batchSendMethodName»() {
+                «_interface.generateBatchSendMethodBody(group, _accessor)»
+            }
+
         «ENDFOR»
+        «IF !_interface.getSharedMemoryEventGroups(_accessor).empty»
+            // A new local subscriber gets the field value cached by the middleware and releases
+            // a reference to it. A remote subscriber cannot read shared memory, the fields are
+            // sent again inline before it gets the cached value.
+            template <typename _Stub, typename... _Stubs>
+            void «_interface.someipStubAdapterClassNameInternal»<_Stub, _Stubs...>::sharedMemoryHandler(CommonAPI::SomeIP::eventgroup_id_t _eventgroup, CommonAPI::SomeIP::client_id_t _client, const CommonAPI::SomeIP::sec_client_t *_sec_client, const std::string &_env, bool _subscribe, const CommonAPI::SomeIP::SubscriptionAcceptedHandler_t& _acceptedHandler) {
+                (void)_env;
+                const bool isLocal = sharedMemorySubscribers_.update(_eventgroup, _client, _sec_client, _subscribe);
+                «IF !_interface.getSharedMemoryAttributes(_accessor).empty»
+                    if (_subscribe) {
+                        std::shared_ptr<CommonAPI::SomeIP::ClientId> itsClient = std::make_shared<CommonAPI::SomeIP::ClientId>();
+                        «FOR attribute : _interface.getSharedMemoryAttributes(_accessor)»
+                            if («_accessor.getSomeIpEventGroups(attribute).map["_eventgroup == " + batchEventGroup].join(" || ")») {
+                                if (isLocal) {
+                                    «attribute.sharedMemoryFieldName».retain();
+                                } else if («attribute.sharedMemoryFieldName».isShared()) {
+                                    «attribute.stubAdapterClassFireChangedMethodName»(std::dynamic_pointer_cast< «_interface.stubFullClassName»>(«_interface.someipStubAdapterHelperClassName»::stub_)->«attribute.getMethodName»(itsClient));
+                                }
+                            }
+                        «ENDFOR»
+                    }
+                «ELSE»
+                    (void)isLocal;
+                «ENDIF»
+                _acceptedHandler(true);
+            }
+
+        «ENDIF»
         «FOR broadcast: _interface.broadcasts»
             «FTypeGenerator::generateComments(broadcast, false)»
             «IF broadcast.selective»
@@ -268,6 +520,12 @@ class FInterfaceSomeIPStubAdapterGenerator {
                          «ENDIF»
                     «ENDFOR»
                     if (client) {
+                        «IF generateInstrumentation»
+                            «_interface.generateEventMetricStart(broadcast.getEventIdentifier(_accessor))»
+                        «ENDIF»
+                        «IF generateTracepoints»
+                            «broadcast.getEventIdentifier(_accessor).generateEventProbe(broadcast.outArgs.tracePayloadSize)»
+                        «ENDIF»
                         CommonAPI::SomeIP::StubEventHelper<CommonAPI::SomeIP::SerializableArguments< «broadcast.outArgs.map[getDeployedTypeName(_interface, _accessor.getOverwriteAccessor(it))].join(', ')»>>
                           ::sendEvent(
                               client->getClientId(),
@@ -276,6 +534,9 @@ class FInterfaceSomeIPStubAdapterGenerator {
                               «broadcast.getEndianess(_accessor)»«IF broadcast.outArgs.size > 0»,«ENDIF»
                               «broadcast.outArgs.map[getDeployedElementName(_interface, _accessor.getOverwriteAccessor(it))].join(', ')»
                           );
+                        «IF generateInstrumentation»
+                            COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, true);)
+                        «ENDIF»
                    }
                 }
 
@@ -365,6 +626,15 @@ class FInterfaceSomeIPStubAdapterGenerator {
                                 CommonAPI::Deployable< «arg.getTypeName(arg, true)», «deploymentType»> deployed_«arg.name»(_«arg.name», «IF deployment != ""»«deployment»«ELSE»nullptr«ENDIF»);
                             «ENDIF»
                         «ENDFOR»
+                        «IF generateInstrumentation»
+                            «_interface.generateEventMetricStart(broadcast.getEventIdentifier(_accessor))»
+                        «ENDIF»
+                        «IF generateTracepoints»
+                            «broadcast.getEventIdentifier(_accessor).generateEventProbe(broadcast.outArgs.tracePayloadSize)»
+                        «ENDIF»
+                        «IF _interface.getSharedMemoryBroadcasts(_accessor).contains(broadcast)»
+                            CommonAPI::SomeIP::SharedMemory::Destination itsDestination(«_interface.getSharedMemoryReaders(_accessor.getSomeIpEventGroups(broadcast))»);
+                        «ENDIF»
                         CommonAPI::SomeIP::StubEventHelper<CommonAPI::SomeIP::SerializableArguments< «broadcast.outArgs.map[getDeployedTypeName(_interface, _accessor.getOverwriteAccessor(it))].join(', ')»>>
                             ::sendEvent(
                                 *this,
@@ -372,6 +642,9 @@ class FInterfaceSomeIPStubAdapterGenerator {
                                 «broadcast.getEndianess(_accessor)»«IF broadcast.outArgs.size > 0»,«ENDIF»
                                 «broadcast.outArgs.map[getDeployedElementName(_interface, _accessor.getOverwriteAccessor(it))].join(', ')»
                         );
+                        «IF generateInstrumentation»
+                            COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, true);)
+                        «ENDIF»
                     }
 
                 «ENDIF»
@@ -391,6 +664,22 @@ class FInterfaceSomeIPStubAdapterGenerator {
 
                 «ENDIF»
             «ENDFOR»
+            «FOR group : _interface.getBatchEventGroups(_accessor).filter[!_interface.isSelectiveEventGroup(it, _accessor)]»
+                CommonAPI::SomeIP::AsyncSubscriptionHandler_t «group.batchName.toFirstLower»SubscribeHandler =
+                    std::bind(&«_interface.someipStubAdapterClassNameInternal»::«group.batchHandlerName»,
+                    std::dynamic_pointer_cast<«_interface.someipStubAdapterClassNameInternal»>(this->shared_from_this()),
+                    std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5);
+                CommonAPI::SomeIP::StubAdapter::connection_->registerSubscriptionHandler(CommonAPI::SomeIP::StubAdapter::getSomeIpAddress(), «group.batchEventGroup», «group.batchName.toFirstLower»SubscribeHandler);
+
+            «ENDFOR»
+            «FOR group : _interface.getSharedMemoryEventGroups(_accessor)»
+                CommonAPI::SomeIP::AsyncSubscriptionHandler_t sharedMemory«group»SubscribeHandler =
+                    std::bind(&«_interface.someipStubAdapterClassNameInternal»::sharedMemoryHandler,
+                    std::dynamic_pointer_cast<«_interface.someipStubAdapterClassNameInternal»>(this->shared_from_this()), «group.batchEventGroup»,
+                    std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5);
+                CommonAPI::SomeIP::StubAdapter::connection_->registerSubscriptionHandler(CommonAPI::SomeIP::StubAdapter::getSomeIpAddress(), «group.batchEventGroup», sharedMemory«group»SubscribeHandler);
+
+            «ENDFOR»
 
             «IF _interface.base !== null»
                 «_interface.base.getTypeCollectionName(_interface)»SomeIPStubAdapterInternal<_Stub, _Stubs...>::registerSelectiveEventHandlers();
@@ -404,6 +693,12 @@ class FInterfaceSomeIPStubAdapterGenerator {
                     CommonAPI::SomeIP::StubAdapter::connection_->unregisterSubscriptionHandler(CommonAPI::SomeIP::StubAdapter::getSomeIpAddress(), «broadcast.getEventGroups(_accessor).head»);
                 «ENDIF»
             «ENDFOR»
+            «FOR group : _interface.getBatchEventGroups(_accessor).filter[!_interface.isSelectiveEventGroup(it, _accessor)]»
+                CommonAPI::SomeIP::StubAdapter::connection_->unregisterSubscriptionHandler(CommonAPI::SomeIP::StubAdapter::getSomeIpAddress(), «group.batchEventGroup»);
+            «ENDFOR»
+            «FOR group : _interface.getSharedMemoryEventGroups(_accessor)»
+                CommonAPI::SomeIP::StubAdapter::connection_->unregisterSubscriptionHandler(CommonAPI::SomeIP::StubAdapter::getSomeIpAddress(), «group.batchEventGroup»);
+            «ENDFOR»
 
             «IF _interface.base !== null»
                 «_interface.base.getTypeCollectionName(_interface)»SomeIPStubAdapterInternal<_Stub, _Stubs...>::unregisterSelectiveEventHandlers();
@@ -759,11 +1054,33 @@ class FInterfaceSomeIPStubAdapterGenerator {
     }
 
     def private generateFireChangedMethodBody(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «IF _attribute.isDeltaAttribute(_accessor)»
+            «_attribute.generateDeltaFireChangedMethodBody(_interface)»
+        «ELSEIF _attribute.isBatchAttribute(_interface, _accessor)»
+            «_attribute.generateBatchFireChangedMethodBody(_interface, _accessor)»
+        «ELSE»
+            «_attribute.generateNotifierFireChangedMethodBody(_interface, _accessor)»
+        «ENDIF»
+    '''
+
+    def private generateNotifierFireChangedMethodBody(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
         «val String deploymentType = _attribute.getDeploymentType(_interface, true)»
         «val String deployment = _attribute.getDeploymentRef(_attribute.array, null, _interface, _accessor.getOverwriteAccessor(_attribute))»
         «IF deploymentType != "CommonAPI::EmptyDeployment" && deploymentType != ""»
             CommonAPI::Deployable< «_attribute.getTypeName(_interface, true)», «deploymentType»> deployedValue(_value, «IF deployment != ""»«deployment»«ELSE»nullptr«ENDIF»);
         «ENDIF»
+        «IF generateInstrumentation»
+            «_interface.generateEventMetricStart(_attribute.getNotifierIdentifier(_accessor))»
+        «ENDIF»
+        «IF generateTracepoints»
+            «_attribute.getNotifierIdentifier(_accessor).generateEventProbe(#[_attribute].tracePayloadSize)»
+        «ENDIF»
+        «val boolean isShared = _interface.getSharedMemoryAttributes(_accessor).contains(_attribute)»
+        «IF isShared»
+            // The field keeps a reference for the subscribers to come
+            const uint32_t itsReaders = «_interface.getSharedMemoryReaders(_accessor.getSomeIpEventGroups(_attribute))»;
+            CommonAPI::SomeIP::SharedMemory::Destination itsDestination(itsReaders > 0 ? itsReaders + 1 : 0);
+        «ENDIF»
         CommonAPI::SomeIP::StubEventHelper<
             CommonAPI::SomeIP::SerializableArguments<
                 «IF deploymentType != "CommonAPI::EmptyDeployment" && deploymentType != ""»
@@ -781,6 +1098,740 @@ class FInterfaceSomeIPStubAdapterGenerator {
             «_attribute.getEndianess(_accessor)»,
             «IF deploymentType != "CommonAPI::EmptyDeployment" && deploymentType != ""»deployedValue«ELSE»_value«ENDIF»
         );
+        «IF isShared»
+            «_attribute.sharedMemoryFieldName».update(itsDestination.getFrames());
+        «ENDIF»
+        «IF generateInstrumentation»
+            COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, true);)
+        «ENDIF»
+    '''
+
+    // The sender lock keeps the events in the order of their sequence numbers
+    def private generateDeltaFireChangedMethodBody(FAttribute _attribute, FInterface _interface) '''
+        «val types = _attribute.getDeltaTypes(_interface)»
+        std::lock_guard<std::mutex> itsLock(«_attribute.deltaSenderName».getMutex());
+        CommonAPI::SomeIP::Delta::Sequence itsSequence;
+        «IF _attribute.isDeltaMap»
+            «types.get(2)» itsUpserts;
+            «types.get(3)» itsRemoved;
+            const bool isFull = «_attribute.deltaSenderName».update(_value, itsSequence, itsUpserts, itsRemoved);
+            «_attribute.deltaSendMethodName»(itsSequence, isFull, (isFull ? _value : itsUpserts), itsRemoved);
+        «ELSE»
+            «types.get(3)» itsIndexes;
+            «types.get(4)» itsValues;
+            const bool isFull = «_attribute.deltaSenderName».update(_value, itsSequence, itsIndexes, itsValues);
+            «_attribute.deltaSendMethodName»(itsSequence, isFull, static_cast<uint32_t>(_value.size()), itsIndexes, (isFull ? _value : itsValues));
+        «ENDIF»
+    '''
+
+    def private generateDeltaSendMethodBody(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «val deployables = _attribute.getDeltaDeployables(_interface)»
+        «val deployments = _attribute.getDeltaDeploymentRefs("itsChangesDeployment", "itsKeysDeployment")»
+        «val names = _attribute.deltaArgumentNames»
+        «val deployment = _attribute.getDeploymentRef(_attribute.array, null, _interface, _accessor.getOverwriteAccessor(_attribute))»
+        static const auto itsChangesDeployment = CommonAPI::SomeIP::Delta::getChangesDeployment(«deployment»);
+        «IF _attribute.isDeltaMap»
+            static const auto itsKeysDeployment = CommonAPI::SomeIP::Delta::getKeysDeployment< «_attribute.getDeltaKeyDeploymentType(_interface)»>(«deployment»);
+        «ENDIF»
+        «FOR i : 0 ..< deployables.size»
+            «deployables.get(i)» deployed«names.get(i)»(_«names.get(i).toFirstLower», «deployments.get(i)»);
+        «ENDFOR»
+        «IF generateInstrumentation»
+            «_interface.generateEventMetricStart(_attribute.getDeltaIdentifier(_accessor))»
+        «ENDIF»
+        «IF generateTracepoints»
+            «_attribute.getDeltaIdentifier(_accessor).generateEventProbe(#[_attribute].tracePayloadSize)»
+        «ENDIF»
+        CommonAPI::SomeIP::StubEventHelper<CommonAPI::SomeIP::SerializableArguments< «deployables.join(', ')»>>
+            ::sendEvent(
+                *this,
+                «_attribute.getDeltaIdentifier(_accessor)»,
+                «_attribute.getEndianess(_accessor)»,
+                «names.map["deployed" + it].join(', ')»
+        );
+        «IF generateInstrumentation»
+            COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, true);)
+        «ENDIF»
+    '''
+
+    def private String generateDeltaSendSignature(FAttribute _attribute, FInterface _interface) {
+        val types = _attribute.getDeltaTypes(_interface)
+        val names = _attribute.deltaArgumentNames
+        var List<String> parameters = new LinkedList<String>()
+        for (i : 0 ..< types.size) {
+            if (i == 0)
+                parameters.add("CommonAPI::SomeIP::Delta::Sequence _sequence")
+            else if (i == 1)
+                parameters.add("bool _isFull")
+            else
+                parameters.add("const " + types.get(i) + " &_" + names.get(i).toFirstLower)
+        }
+        return parameters.join(", ")
+    }
+
+    def private List<String> getDeltaArgumentNames(FAttribute _attribute) {
+        if (_attribute.isDeltaMap)
+            return #["Sequence", "IsFull", "Upserts", "Removed"]
+        return #["Sequence", "IsFull", "Length", "Indexes", "Values"]
+    }
+
+    def private String deltaSenderName(FAttribute _attribute) {
+        return _attribute.elementName.toFirstLower + "DeltaSender_"
+    }
+
+    def private String deltaSendMethodName(FAttribute _attribute) {
+        return "send" + _attribute.elementName.toFirstUpper + "Delta"
+    }
+
+    // The dispatchers that are tried before the stub dispatchers
+    def private String generateDispatchChain(FInterface _interface, PropertyAccessor _accessor) {
+        var String chain = ""
+        if (_interface.hasDeltaAttributes(_accessor))
+            chain += "dispatch" + _interface.elementName + "ResyncMessage(_message) || "
+        if (!_interface.getOwnDispatchMethods(_accessor).empty)
+            chain += "dispatch" + _interface.ownCallClassName + "(_message, itsCall) || "
+        return chain + _interface.someipStubAdapterHelperClassName + "::onInterfaceMessage(_message)"
+    }
+
+    // Answers the resync request of a delta attribute with the value the following changes
+    // are based on and its sequence number, so that the proxy continues with the next change
+    // without a keyframe on the delta event. The getter is left to its stub dispatcher.
+    def private generateResyncDispatch(FInterface _interface, PropertyAccessor _accessor) '''
+        bool dispatch«_interface.elementName»ResyncMessage(const CommonAPI::SomeIP::Message &_message) {
+            if (!«_interface.someipStubAdapterHelperClassName»::stub_)
+                return false;
+
+            switch (_message.getMethodId()) {
+            «FOR attribute : _interface.attributes.filter[isDeltaAttribute(_accessor)]»
+                «val typeName = attribute.getTypeName(_interface, true)»
+                case «attribute.getDeltaResyncIdentifier(_accessor)»: {
+                    std::shared_ptr<CommonAPI::SomeIP::ClientId> itsClient
+                        = std::make_shared<CommonAPI::SomeIP::ClientId>(_message.getClientId(), _message.getSecClient(), _message.getEnv());
+                    «_interface.someipStubAdapterHelperClassName»::stub_->«attribute.stubClassLockMethodName»(true);
+                    const «typeName» itsCurrent = «_interface.someipStubAdapterHelperClassName»::stub_->«attribute.stubClassGetMethodName»(itsClient);
+                    «_interface.someipStubAdapterHelperClassName»::stub_->«attribute.stubClassLockMethodName»(false);
+
+                    CommonAPI::SomeIP::Message itsReturn = _message.createMethodReturn();
+                    CommonAPI::SomeIP::OutputStream itsOutput(itsReturn, «attribute.getEndianess(_accessor)»);
+                    {
+                        std::lock_guard<std::mutex> itsLock(«attribute.deltaSenderName».getMutex());
+                        CommonAPI::SomeIP::Delta::Sequence itsSequence;
+                        const CommonAPI::Deployable< «typeName», «attribute.getDeploymentType(_interface, true)»> itsValue(
+                            «attribute.deltaSenderName».getKeyframe(itsCurrent, itsSequence), «attribute.getDeploymentRef(attribute.array, null, _interface, _accessor.getOverwriteAccessor(attribute))»);
+                        itsOutput << itsValue;
+                        itsOutput << itsSequence;
+                    }
+                    if (itsOutput.hasError())
+                        return false;
+                    itsOutput.flush();
+                    this->getConnection()->sendMessage(itsReturn);
+                    return true;
+                }
+            «ENDFOR»
+            default:
+                return false;
+            }
+        }
+    '''
+
+    // A change outside of a batch is sent as a batch of one attribute
+    def private generateBatchFireChangedMethodBody(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) '''
+        «val Integer group = _attribute.getBatchEventGroup(_interface, _accessor)»
+        std::lock_guard<std::mutex> itsLock(«group.batchSenderName».getMutex());
+        «_attribute.batchValueName» = _value;
+        if («group.batchSenderName».change(«_interface.getBatchAttributes(group, _accessor).indexOf(_attribute)»)) {
+            «group.batchSendMethodName»();
+        }
+    '''
+
+    def private generateBatchSendMethodBody(FInterface _interface, Integer _group, PropertyAccessor _accessor) '''
+        «val attributes = _interface.getBatchAttributes(_group, _accessor)»
+        «val deployables = _interface.getBatchDeployables(_group, _accessor)»
+        «val deployments = _interface.getBatchDeploymentRefs(_group, _accessor)»
+        «val String identifier = _interface.getBatchIdentifier(_group, _accessor)»
+        «val List<String> types = _interface.getBatchTypes(_group, _accessor)»
+        const std::vector<CommonAPI::SomeIP::Batch::State> itsStates = «_group.batchSenderName».take(«attributes.size»);
+        «FOR i : 0 ..< attributes.size»
+            «deployables.get(i)» deployed«attributes.get(i).elementName.toFirstUpper»(«types.get(i)»(itsStates[«i»], «attributes.get(i).batchValueName»), «deployments.get(i)»);
+        «ENDFOR»
+        «IF generateInstrumentation»
+            «_interface.generateEventMetricStart(identifier)»
+        «ENDIF»
+        «IF generateTracepoints»
+            «identifier.generateEventProbe("-1")»
+        «ENDIF»
+        CommonAPI::SomeIP::StubEventHelper<CommonAPI::SomeIP::SerializableArguments< «deployables.join(', ')»>>
+            ::sendEvent(
+                *this,
+                «identifier»,
+                «attributes.head.getEndianess(_accessor)»,
+                «attributes.map["deployed" + elementName.toFirstUpper].join(', ')»
+        );
+        «IF generateInstrumentation»
+            COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, true);)
+        «ENDIF»
+    '''
+
+    def private String batchSenderName(Integer _group) {
+        return _group.batchName.toFirstLower + "_"
+    }
+
+    def private String batchBeginMethodName(Integer _group) {
+        return "begin" + _group.batchName
+    }
+
+    def private String batchCommitMethodName(Integer _group) {
+        return "commit" + _group.batchName
+    }
+
+    def private String batchSendMethodName(Integer _group) {
+        return "send" + _group.batchName
+    }
+
+    def private String batchHandlerName(Integer _group) {
+        return _group.batchName.toFirstLower + "Handler"
+    }
+
+    // Event groups with a selective broadcast have its subscription handler
+    def private boolean isSelectiveEventGroup(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return _interface.broadcasts.exists[selective && getEventGroups(_accessor).head == "0x" + _group.toHexString]
+    }
+
+    def private String batchValueName(FAttribute _attribute) {
+        return _attribute.elementName.toFirstLower + "BatchValue_"
+    }
+
+    // Attributes and broadcasts with a shared memory threshold send their values in shared
+    // memory if all subscribers of their event groups are local. Event groups with the
+    // subscription handler of a selective broadcast or a batch do not track subscribers,
+    // elements in them are always sent inline.
+    def private boolean isSharedMemoryEventGroups(FInterface _interface, List<Integer> _groups, PropertyAccessor _accessor) {
+        return _groups !== null && !_groups.empty && !_groups.exists[
+            _interface.getBatchEventGroups(_accessor).contains(it) || _interface.isSelectiveEventGroup(it, _accessor)
+        ]
+    }
+
+    def private List<FAttribute> getSharedMemoryAttributes(FInterface _interface, PropertyAccessor _accessor) {
+        return _interface.attributes.filter[
+            isObservable && getSharedMemoryThreshold !== null && !isBatchAttribute(_interface, _accessor)
+                && _interface.isSharedMemoryEventGroups(_accessor.getSomeIpEventGroups(it), _accessor)
+        ].toList
+    }
+
+    def private List<FBroadcast> getSharedMemoryBroadcasts(FInterface _interface, PropertyAccessor _accessor) {
+        return _interface.broadcasts.filter[
+            !selective && !isErrorType(_accessor) && outArgs.exists[getSharedMemoryThreshold !== null]
+                && _interface.isSharedMemoryEventGroups(_accessor.getSomeIpEventGroups(it), _accessor)
+        ].toList
+    }
+
+    def private List<Integer> getSharedMemoryEventGroups(FInterface _interface, PropertyAccessor _accessor) {
+        return (_interface.getSharedMemoryAttributes(_accessor).map[_accessor.getSomeIpEventGroups(it)]
+            + _interface.getSharedMemoryBroadcasts(_accessor).map[_accessor.getSomeIpEventGroups(it)]).flatten.toSet.toList
+    }
+
+    def private String getSharedMemoryReaders(FInterface _interface, List<Integer> _groups) {
+        return "sharedMemorySubscribers_.getReaders({ " + _groups.map[batchEventGroup].join(", ") + " })"
+    }
+
+    def private String sharedMemoryFieldName(FAttribute _attribute) {
+        return _attribute.elementName.toFirstLower + "SharedMemory_"
+    }
+
+    def private generateEventMetricStart(FInterface _interface, String _event) '''
+        COMMONAPI_SOMEIP_METRICS_HOOK(«_interface.someipMetricsClassName»::Metric &itsMetric = «_interface.someipMetricsClassName»::event(«_interface.someipMetricsClassName»::Side::STUB, «_event»);
+                                      const auto itsMetricStart = itsMetric.start();)
+    '''
+
+    def private generateEventProbe(String _event, String _size) '''
+        COMMONAPI_SOMEIP_PROBE(event_fire, this->getSomeIpAddress().getService(), this->getSomeIpAddress().getInstance(), «_event», «_size»);
+    '''
+
+    // Body of onInterfaceMessage if metrics, tracepoints, the capture tap, views or delta
+    // attributes are generated.
+    def private generateDispatchBody(FInterface _interface, PropertyAccessor _accessor) '''
+        «IF generateCapture»
+            «val fireAndForget = _interface.methods.filter[isFireAndForget].map["_message.getMethodId() == " + getMethodIdentifier(_accessor)]»
+            CommonAPI::SomeIP::Capture::captureRequest(this->getSomeIpAddress().getService(), this->getSomeIpAddress().getInstance(),
+                _message.getMethodId(), _message.getClientId(), _message.getSessionId(), «_interface.someIpMajorVersion»,
+                «IF fireAndForget.empty»false«ELSE»(«fireAndForget.join(" || ")»)«ENDIF», _message.getBodyData(), _message.getBodyLength());
+        «ENDIF»
+        «IF generateInstrumentation»
+            COMMONAPI_SOMEIP_METRICS_HOOK(«_interface.someipMetricsClassName»::Metric &itsMetric = «_interface.someipMetricsClassName»::method(«_interface.someipMetricsClassName»::Side::STUB, _message.getMethodId());
+                                          const auto itsMetricStart = itsMetric.start();)
+        «ENDIF»
+        «IF !_interface.getOwnDispatchMethods(_accessor).empty»
+            «_interface.ownCallClassName» itsCall«IF generateInstrumentation» COMMONAPI_SOMEIP_METRICS_HOOK((itsMetric, itsMetricStart))«ENDIF»;
+        «ENDIF»
+        «IF generateTracepoints»
+            COMMONAPI_SOMEIP_PROBE(dispatch_entry, this->getSomeIpAddress().getService(), this->getSomeIpAddress().getInstance(), _message.getMethodId(), _message.getBodyLength());
+        «ENDIF»
+        const bool itsResult = «_interface.generateDispatchChain(_accessor)»;
+        «IF generateTracepoints»
+            COMMONAPI_SOMEIP_PROBE(dispatch_exit, this->getSomeIpAddress().getService(), this->getSomeIpAddress().getInstance(), _message.getMethodId(), _message.getBodyLength());
+        «ENDIF»
+        «IF generateInstrumentation»
+            «IF _interface.getOwnDispatchMethods(_accessor).empty»
+                COMMONAPI_SOMEIP_METRICS_HOOK(itsMetric.finished(itsMetricStart, itsResult);)
+            «ELSE»
+                // calls dispatched by the stub adapter finish their metric when the reply is sent
+                COMMONAPI_SOMEIP_METRICS_HOOK(if (!itsCall.isDispatched()) itsMetric.finished(itsMetricStart, itsResult);)
+            «ENDIF»
+        «ENDIF»
+        return itsResult;
+    '''
+
+    // Method IDs of the methods and attribute setters that are deployed with the given execution
+    def private List<String> getExecutionIdentifiers(FInterface _interface, PropertyAccessor _accessor, PropertyAccessor.SomeIpExecution _execution) {
+        val List<String> identifiers = new LinkedList<String>()
+        for (method : _interface.methods) {
+            if (_accessor.getSomeIpMethodExecution(method) == _execution)
+                identifiers.add(method.getMethodIdentifier(_accessor))
+        }
+        for (attribute : _interface.attributes) {
+            if (!attribute.isReadonly && _accessor.getSomeIpSetterExecution(attribute) == _execution)
+                identifiers.add(attribute.getSetterIdentifier(_accessor))
+        }
+        return identifiers
+    }
+
+    // Methods with limits are dispatched through their limiter, even if they run inline
+    def private boolean hasOffloadedDispatch(FInterface _interface, PropertyAccessor _accessor) {
+        return !_interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Pool).empty ||
+               !_interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Dedicated).empty ||
+               _interface.hasLimitedMethods(_accessor)
+    }
+
+    def private String limitersName(FInterface _interface) {
+        return _interface.elementName.toFirstLower + "Limiters_"
+    }
+
+    // Runs the task that the limiter of the method passes on its executor
+    def private String generateLimitedExecutor(FMethod _method, FInterface _interface, PropertyAccessor _accessor) {
+        switch (_accessor.getSomeIpMethodExecution(_method)) {
+            case PropertyAccessor.SomeIpExecution.Pool:
+                return "[](CommonAPI::SomeIP::Backpressure::Task _task) { CommonAPI::SomeIP::Execution::Pool::get().post(_task); }"
+            case PropertyAccessor.SomeIpExecution.Dedicated:
+                return "[this](CommonAPI::SomeIP::Backpressure::Task _task) { " + _interface.dedicatedThreadsName + ".at(" +
+                    _method.getMethodIdentifier(_accessor) + ")->post(_task); }"
+            default:
+                return "[](CommonAPI::SomeIP::Backpressure::Task _task) { _task(); }"
+        }
+    }
+
+    def private String dedicatedThreadsName(FInterface _interface) {
+        return _interface.elementName.toFirstLower + "DedicatedThreads_"
+    }
+
+    def private String shedderName(FInterface _interface) {
+        return _interface.elementName.toFirstLower + "Shedder_"
+    }
+
+    // The time after which the caller of an offloaded method or setter has given up: the
+    // deployed timeout of the method or the default timeout of CommonAPI. SOME/IP does not
+    // transport the timeout of the caller.
+    def private String getDeadline(FInterface _interface, PropertyAccessor _accessor, String _id) {
+        val FMethod method = _interface.methods.findFirst[getMethodIdentifier(_accessor) == _id]
+        if (method !== null && method.getTimeout(_accessor) > 0)
+            return "std::chrono::milliseconds(" + method.getTimeout(_accessor) + ")"
+        return "CommonAPI::SomeIP::Deadline::Shedder::getDefaultDeadline()"
+    }
+
+    // The task that dispatches the message later, with -dl it is dropped when the
+    // message has expired before it runs
+    def private String generateLaterTask(FInterface _interface, PropertyAccessor _accessor, String _id) {
+        if (generateDeadlines)
+            return _interface.shedderName + ".guard(" + _id + ", " + _interface.getDeadline(_accessor, _id) +
+                ", dispatch" + _interface.elementName + "MessageLater(_message))"
+        return "dispatch" + _interface.elementName + "MessageLater(_message)"
+    }
+
+    // Hands the messages of offloaded methods and setters to their executor. The reply
+    // is sent by the reply function of the stub dispatcher on the executing thread.
+    // Messages of methods with limits pass the limiter of the method first, messages
+    // beyond the limits are rejected. Their calls are in flight until the reply is sent,
+    // calls of methods with error replies until the dispatch returns. Methods of base
+    // interfaces are dispatched inline.
+    def private generateOffloadedDispatch(FInterface _interface, PropertyAccessor _accessor) '''
+        «val limitedMethods = _interface.methods.filter[isLimitedMethod(_accessor)].toList»
+        «val limitedIds = limitedMethods.map[getMethodIdentifier(_accessor)]»
+        «val poolIds = _interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Pool).filter[!limitedIds.contains(it)].toList»
+        «val dedicatedIds = _interface.getExecutionIdentifiers(_accessor, PropertyAccessor.SomeIpExecution.Dedicated)»
+        virtual bool onInterfaceMessage(const CommonAPI::SomeIP::Message &_message) {
+            switch (_message.getMethodId()) {
+            «FOR method : limitedMethods»
+                «val id = method.getMethodIdentifier(_accessor)»
+                case «id»:
+                    «IF method.isFireAndForget»
+                        (void)«_interface.limitersName».at(«id»)->submit(«_interface.generateLaterTask(_accessor, id)»,
+                            «method.generateLimitedExecutor(_interface, _accessor)»);
+                    «ELSE»
+                        if (!«_interface.limitersName».at(«id»)->submit(«_interface.generateLaterTask(_accessor, id)»,
+                                «method.generateLimitedExecutor(_interface, _accessor)»)) {
+                            reject«_interface.elementName»Message(_message);
+                        }
+                    «ENDIF»
+                    return true;
+            «ENDFOR»
+            «IF generateDeadlines»
+                «FOR id : poolIds»
+                    case «id»:
+                        CommonAPI::SomeIP::Execution::Pool::get().post(«_interface.generateLaterTask(_accessor, id)»);
+                        return true;
+                «ENDFOR»
+            «ELSE»
+                «FOR id : poolIds»
+                    case «id»:
+                «ENDFOR»
+                «IF !poolIds.empty»
+                        CommonAPI::SomeIP::Execution::Pool::get().post(«_interface.generateLaterTask(_accessor, "")»);
+                        return true;
+                «ENDIF»
+            «ENDIF»
+            «FOR id : dedicatedIds.filter[!limitedIds.contains(it)]»
+                case «id»:
+                    «_interface.dedicatedThreadsName».at(«id»)->post(«_interface.generateLaterTask(_accessor, id)»);
+                    return true;
+            «ENDFOR»
+            default:
+                return dispatch«_interface.elementName»Message(_message);
+            }
+        }
+
+        bool dispatch«_interface.elementName»Message(const CommonAPI::SomeIP::Message &_message) {
+            «IF generateInstrumentation || generateTracepoints || generateCapture || _interface.hasDeltaAttributes(_accessor) || !_interface.getOwnDispatchMethods(_accessor).empty»
+                «_interface.generateDispatchBody(_accessor)»
+            «ELSE»
+                return «_interface.someipStubAdapterHelperClassName»::onInterfaceMessage(_message);
+            «ENDIF»
+        }
+
+        // The task keeps the stub adapter alive until the message is dispatched
+        CommonAPI::SomeIP::Execution::Task dispatch«_interface.elementName»MessageLater(const CommonAPI::SomeIP::Message &_message) {
+            auto itsAdapter = this->shared_from_this();
+            return [itsAdapter, this, _message]() {
+                dispatch«_interface.elementName»Message(_message);
+            };
+        }
+        «IF generateDeadlines»
+
+            // Counts the offloaded messages that expired before they were dispatched
+            const CommonAPI::SomeIP::Deadline::Shedder &get«_interface.elementName»Shedder() const {
+                return «_interface.shedderName»;
+            }
+
+            CommonAPI::SomeIP::Deadline::Shedder «_interface.shedderName»;
+        «ENDIF»
+        «IF !limitedMethods.empty»
+
+            // Answers a call beyond the limits of its method at once with an error reply
+            void reject«_interface.elementName»Message(const CommonAPI::SomeIP::Message &_message) {
+                this->getConnection()->sendMessage(_message.createErrorResponseMessage(
+                    static_cast<CommonAPI::SomeIP::return_code_e>(CommonAPI::SomeIP::Backpressure::RETURN_CODE_OVERLOADED)));
+            }
+
+            // The limiters of the methods with SomeIpMethodMaxInFlight
+            const CommonAPI::SomeIP::Backpressure::Limiter &get«_interface.elementName»Limiter(CommonAPI::SomeIP::method_id_t _method) const {
+                return *«_interface.limitersName».at(_method);
+            }
+        «ENDIF»
+        «IF !dedicatedIds.empty»
+
+            std::map<CommonAPI::SomeIP::method_id_t, std::shared_ptr<CommonAPI::SomeIP::Execution::DedicatedThread>> «_interface.dedicatedThreadsName»;
+        «ENDIF»
+        «IF !limitedMethods.empty»
+
+            std::map<CommonAPI::SomeIP::method_id_t, std::shared_ptr<CommonAPI::SomeIP::Backpressure::Limiter>> «_interface.limitersName»;
+        «ENDIF»
+    '''
+
+    // Methods that are dispatched to the view stub: the struct and union arguments are
+    // not deserialized but passed as views over the message. Arguments with a specific
+    // deployment, compression or a layout without view are deserialized as usual.
+    def private List<FMethod> getViewMethods(FInterface _interface, PropertyAccessor _accessor) {
+        if (!generateViews)
+            return new LinkedList<FMethod>()
+        return _interface.methods.filter[isViewMethod(_interface, _accessor)].toList
+    }
+
+    def private boolean isViewMethod(FMethod _method, FInterface _interface, PropertyAccessor _accessor) {
+        if (_method.hasError || _interface.broadcasts.exists[isErrorType(_method, _accessor)])
+            return false
+        return _method.inArgs.exists[isViewClass] && _method.inArgs.forall[
+            val PropertyAccessor itsAccessor = _accessor.getOverwriteAccessor(it)
+            getCompressionThreshold === null &&
+            (type.derived === null || !itsAccessor.hasSpecificDeployment(it)) &&
+            isViewable(itsAccessor)
+        ]
+    }
+
+    def private List<String> getViewIncludes(FInterface _interface, PropertyAccessor _accessor) {
+        val List<String> includes = new LinkedList<String>()
+        for (method : _interface.getViewMethods(_accessor)) {
+            for (arg : method.inArgs.filter[type.derived !== null]) {
+                val String include = (arg.type.derived.eContainer as FTypeCollection).someipViewsHeaderPath
+                if (!includes.contains(include))
+                    includes.add(include)
+            }
+        }
+        return includes.sort
+    }
+
+    def private String viewStubClassName(FInterface _interface) {
+        return _interface.elementName + "SomeIPViewStub"
+    }
+
+    def private String viewStubName(FInterface _interface) {
+        return _interface.elementName.toFirstLower + "ViewStub_"
+    }
+
+    def private generateViewStub(FInterface _interface, PropertyAccessor _accessor) '''
+        // A stub that additionally implements «_interface.viewStubClassName» receives the calls of
+        // these methods with views over the message instead of deserialized arguments. The views
+        // are valid until the method returns, materialize() creates a value that outlives it.
+        class «_interface.viewStubClassName» {
+        public:
+            virtual ~«_interface.viewStubClassName»() {}
+
+            «FOR method : _interface.getViewMethods(_accessor)»
+                virtual void «method.elementName»(const std::shared_ptr<CommonAPI::ClientId> _client«FOR arg : method.inArgs», const «arg.getViewValueType(_accessor.getOverwriteAccessor(arg))» &_«arg.elementName»«ENDFOR»«IF !method.isFireAndForget», «_interface.stubClassName»::«method.elementName»Reply_t _reply«ENDIF») = 0;
+            «ENDFOR»
+        };
+    '''
+
+    // Methods with limits whose reply the stub adapter sends itself, so that their calls
+    // are in flight until the reply is sent. Methods with error replies are left to their
+    // dispatchers.
+    def private List<FMethod> getLimitedReplyMethods(FInterface _interface, PropertyAccessor _accessor) {
+        return _interface.methods.filter[
+            isLimitedMethod(_accessor) && !isFireAndForget && !hasError &&
+            !_interface.broadcasts.exists[b | b.isErrorType(it, _accessor)]
+        ].toList
+    }
+
+    // Methods that the stub adapter dispatches itself: view methods, methods with limits
+    // and, with -in, all methods whose steps are timed separately. Methods with error
+    // replies are left to their dispatchers.
+    def private List<FMethod> getOwnDispatchMethods(FInterface _interface, PropertyAccessor _accessor) {
+        val List<FMethod> views = _interface.getViewMethods(_accessor)
+        val List<FMethod> limited = _interface.getLimitedReplyMethods(_accessor)
+        return _interface.methods.filter[
+            !hasError && !_interface.broadcasts.exists[b | b.isErrorType(it, _accessor)] &&
+            (generateInstrumentation || views.contains(it) || limited.contains(it))
+        ].toList
+    }
+
+    def private String ownCallClassName(FInterface _interface) {
+        return _interface.elementName + "Call"
+    }
+
+    def private String ownReplyMethodName(FMethod _method) {
+        return "create" + _method.elementName.toFirstUpper + "Reply"
+    }
+
+    // The dispatch of the methods in getOwnDispatchMethods. Each call decodes its arguments,
+    // as views if the stub implements the view stub, calls the stub and encodes the reply
+    // like the stub dispatchers. The call object hooks into these steps: it times them and
+    // holds the permit of a method with limits until the reply is sent. Returns false for
+    // other messages, for calls that are only timed if COMMONAPI_SOMEIP_METRICS is not
+    // defined and for malformed arguments, the stub dispatchers then handle them.
+    def private generateOwnDispatch(FInterface _interface, PropertyAccessor _accessor) '''
+        «val call = _interface.ownCallClassName»
+        «val views = _interface.getViewMethods(_accessor)»
+        «val limited = _interface.getLimitedReplyMethods(_accessor)»
+        «_interface.generateOwnCall(_accessor)»
+
+        bool dispatch«call»(const CommonAPI::SomeIP::Message &_message, «call» &_call) {
+            if (!«_interface.someipStubAdapterHelperClassName»::stub_)
+                return false;
+
+            switch (_message.getMethodId()) {
+            «FOR method : _interface.getOwnDispatchMethods(_accessor)»
+                case «method.getMethodIdentifier(_accessor)»: {
+                    «IF views.contains(method)»
+                        if («_interface.viewStubName») {
+                            CommonAPI::SomeIP::View::Reader itsReader(_message.getBodyData(), _message.getBodyLength(), «method.isLittleEndian(_accessor)»);
+                            «FOR arg : method.inArgs»
+                                «val codec = arg.getViewCodec(_accessor.getOverwriteAccessor(arg))»
+                                «codec»::Value _«arg.elementName»;
+                                if (!«codec»::read(itsReader, _«arg.elementName»))
+                                    return false;
+                            «ENDFOR»
+                            «method.generateOwnStubCall(_interface, _accessor, _interface.viewStubName, method.inArgs.map["_" + elementName])»
+                            return true;
+                        }
+                    «ENDIF»
+                    «IF !limited.contains(method)»
+                        «IF generateInstrumentation»
+                            if (!_call.isMeasured())
+                                return false;
+                        «ELSE»
+                            return false;
+                        «ENDIF»
+                    «ENDIF»
+                    «IF generateInstrumentation || limited.contains(method)»
+                        «FOR arg : method.inArgs»
+                            CommonAPI::Deployable< «arg.getTypeName(_interface, true)», «arg.getDeploymentType(_interface, true)»> deploy_«arg.name»(«arg.getDeploymentRef(arg.array, method, _interface, _accessor.getOverwriteAccessor(arg))»);
+                        «ENDFOR»
+                        «IF !method.inArgs.empty»
+                            CommonAPI::SomeIP::InputStream itsInput(_message, «method.isLittleEndian(_accessor)»);
+                            if (!CommonAPI::SomeIP::SerializableArguments< «method.inArgs.map["CommonAPI::Deployable< " + getTypeName(_interface, true) + ", " + getDeploymentType(_interface, true) + ">"].join(', ')»>::deserialize(
+                                    itsInput«FOR arg : method.inArgs», deploy_«arg.name»«ENDFOR»))
+                                return false;
+                        «ENDIF»
+                        «method.generateOwnStubCall(_interface, _accessor, _interface.someipStubAdapterHelperClassName + "::stub_", method.inArgs.map["std::move(deploy_" + name + ".getValue())"])»
+                        return true;
+                    «ENDIF»
+                }
+            «ENDFOR»
+            default:
+                return false;
+            }
+        }
+        «FOR method : _interface.getOwnDispatchMethods(_accessor).filter[!isFireAndForget]»
+
+            // Encodes and sends the reply of «method.elementName» like its stub dispatcher and finishes the call
+            «_interface.stubClassName»::«method.elementName»Reply_t «method.ownReplyMethodName»(const CommonAPI::SomeIP::Message &_message, const «call» &_call) {
+                CommonAPI::SomeIP::Message itsReturn = _message.createMethodReturn();
+                auto itsAdapter = this->shared_from_this();
+                «call» itsCall(_call);
+                return [itsAdapter, this, itsReturn, itsCall](«method.outArgs.map[getTypeName(_interface, true) + ' _' + elementName].join(', ')») mutable {
+                    itsCall.serializing();
+                    «FOR arg : method.outArgs»
+                        CommonAPI::Deployable< «arg.getTypeName(_interface, true)», «arg.getDeploymentType(_interface, true)»> deploy_«arg.name»(_«arg.name», «arg.getDeploymentRef(arg.array, method, _interface, _accessor.getOverwriteAccessor(arg))»);
+                    «ENDFOR»
+                    CommonAPI::SomeIP::OutputStream itsOutput(itsReturn, «method.isLittleEndian(_accessor)»);
+                    const bool isSerialized = CommonAPI::SomeIP::SerializableArguments< «method.outArgs.map["CommonAPI::Deployable< " + getTypeName(_interface, true) + ", " + getDeploymentType(_interface, true) + ">"].join(', ')»>::serialize(
+                        itsOutput«FOR arg : method.outArgs», deploy_«arg.name»«ENDFOR»);
+                    if (isSerialized) {
+                        itsOutput.flush();
+                        itsCall.serialized();
+                        this->getConnection()->sendMessage(itsReturn);
+                    }
+                    itsCall.finished(isSerialized);
+                };
+            }
+        «ENDFOR»
+        «IF !views.empty»
+
+            «_interface.viewStubClassName» *«_interface.viewStubName» = nullptr;
+        «ENDIF»
+    '''
+
+    // Calls the stub, or the view stub, with the decoded arguments
+    def private generateOwnStubCall(FMethod _method, FInterface _interface, PropertyAccessor _accessor,
+        String _stub, List<String> _arguments) '''
+        _call.deserialized();
+        std::shared_ptr<CommonAPI::SomeIP::ClientId> itsClient
+            = std::make_shared<CommonAPI::SomeIP::ClientId>(_message.getClientId(), _message.getSecClient(), _message.getEnv());
+        «IF _interface.getLimitedReplyMethods(_accessor).contains(_method)»
+            _call.hold(CommonAPI::SomeIP::Backpressure::Limiter::Permit::take());
+        «ENDIF»
+        _call.handling();
+        «IF _method.isFireAndForget»
+            «_stub»->«_method.elementName»(itsClient«FOR argument : _arguments», «argument»«ENDFOR»);
+            _call.handled();
+            _call.finished(true);
+        «ELSE»
+            «_stub»->«_method.elementName»(itsClient«FOR argument : _arguments», «argument»«ENDFOR», «_method.ownReplyMethodName»(_message, _call));
+            _call.handled();
+        «ENDIF»
+    '''
+
+    // The hooks into the steps of a call that the stub adapter dispatches itself. The reply
+    // function gets a copy, which shares the permit.
+    def private generateOwnCall(FInterface _interface, PropertyAccessor _accessor) '''
+        «val call = _interface.ownCallClassName»
+        «val metrics = _interface.someipMetricsClassName»
+        // A call that the stub adapter dispatches itself. «IF generateInstrumentation»If COMMONAPI_SOMEIP_METRICS is defined
+        // and the call was started with a metric, its steps are timed. «ENDIF»A call of a method
+        // with limits holds the permit of its limiter until the reply is sent.
+        class «call» {
+        public:
+            «call»()
+                : isDispatched_(false)«IF generateInstrumentation» COMMONAPI_SOMEIP_METRICS_HOOK(, metric_(nullptr))«ENDIF» {
+            }
+            «IF generateInstrumentation»
+
+                #ifdef COMMONAPI_SOMEIP_METRICS
+                «call»(«metrics»::Metric &_metric, const «metrics»::Metric::TimePoint &_start)
+                    : isDispatched_(false), metric_(&_metric), start_(_start), step_(_start) {
+                }
+                #endif
+
+                bool isMeasured() const {
+                    #ifdef COMMONAPI_SOMEIP_METRICS
+                    return (metric_ != nullptr);
+                    #else
+                    return false;
+                    #endif
+                }
+            «ENDIF»
+
+            // Whether the stub was called, the call is then finished by the dispatch or the reply
+            bool isDispatched() const {
+                return isDispatched_;
+            }
+            «IF !_interface.getLimitedReplyMethods(_accessor).empty»
+
+                void hold(const std::shared_ptr<CommonAPI::SomeIP::Backpressure::Limiter::Permit> &_permit) {
+                    permit_ = _permit;
+                }
+            «ENDIF»
+
+            void deserialized() {
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) metric_->deserialized(start_);)
+                «ENDIF»
+            }
+
+            void handling() {
+                isDispatched_ = true;
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) step_ = «metrics»::Metric::now();)
+                «ENDIF»
+            }
+
+            void handled() {
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) metric_->handled(step_);)
+                «ENDIF»
+            }
+
+            void serializing() {
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) step_ = «metrics»::Metric::now();)
+                «ENDIF»
+            }
+
+            void serialized() {
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) metric_->serialized(step_);)
+                «ENDIF»
+            }
+
+            void finished(bool _success) {
+                (void)_success;
+                «IF generateInstrumentation»
+                    COMMONAPI_SOMEIP_METRICS_HOOK(if (metric_) metric_->finished(start_, _success);)
+                «ENDIF»
+                «IF !_interface.getLimitedReplyMethods(_accessor).empty»
+                    if (permit_)
+                        permit_->release();
+                «ENDIF»
+            }
+
+        private:
+            bool isDispatched_;
+            «IF generateInstrumentation»
+                COMMONAPI_SOMEIP_METRICS_HOOK(«metrics»::Metric *metric_;
+                                              «metrics»::Metric::TimePoint start_;
+                                              «metrics»::Metric::TimePoint step_;)
+            «ENDIF»
+            «IF !_interface.getLimitedReplyMethods(_accessor).empty»
+                std::shared_ptr<CommonAPI::SomeIP::Backpressure::Limiter::Permit> permit_;
+            «ENDIF»
+        };
     '''
 
     def private generateStubAttributeTableInitializer(FInterface _interface, PropertyAccessor _accessor) '''
@@ -0,0 +1,380 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.ArrayList
+import java.util.HashMap
+import java.util.HashSet
+import java.util.List
+import java.util.Map
+import java.util.Set
+import org.eclipse.core.resources.IResource
+import org.eclipse.emf.ecore.EObject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FArgument
+import org.franca.core.franca.FArrayType
+import org.franca.core.franca.FAttribute
+import org.franca.core.franca.FBasicTypeId
+import org.franca.core.franca.FField
+import org.franca.core.franca.FInterface
+import org.franca.core.franca.FMapType
+import org.franca.core.franca.FStructType
+import org.franca.core.franca.FType
+import org.franca.core.franca.FTypeCollection
+import org.franca.core.franca.FTypeDef
+import org.franca.core.franca.FTypeRef
+import org.franca.core.franca.FTypedElement
+import org.franca.core.franca.FUnionType
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the wire size report of an interface: the length and type fields of its
+ * messages whose deployed width is larger than the bound of the field requires, as JSON,
+ * and an fdepl with the reduced widths to merge into the deployment of the interface.
+ *
+ * The bounds are the maximum serialized sizes of the elements the fields count, the
+ * maximum lengths of arrays, maps and byte buffers and the number of union alternatives.
+ * The bound of a string is the encoded size of SomeIpStringLength characters, which is
+ * not checked at run time; such widths are reported, but commented out in the fdepl.
+ * Fields within array elements and base structs depend on the type-level deployment and
+ * are reported only.
+ */
+class FInterfaceSomeIPWireSizeGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension FrancaSomeIPDeploymentAccessorHelper
+    @Inject extension FTypeCollectionSomeIPSerializedSizeGenerator
+
+    def generateWireSize(FInterface _interface, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_WIRE_SIZE_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            val Map<FTypedElement, SomeIPWireSize> elements = new HashMap<FTypedElement, SomeIPWireSize>()
+            val List<SomeIPWireSize> messages = _interface.getWireSizeMessages(_accessor, elements)
+            _fileSystemAccess.generateFile(_interface.someipWireSizeReportPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                SomeIPWireSize.toJson(_interface.fullyQualifiedName, messages))
+            _fileSystemAccess.generateFile(_interface.someipWireSizeDeploymentPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _interface.generateWireSizeDeployment(elements))
+        }
+        else {
+            _fileSystemAccess.generateFile(_interface.someipWireSizeReportPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+            _fileSystemAccess.generateFile(_interface.someipWireSizeDeploymentPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateWireSizeDeployment(FInterface _interface, Map<FTypedElement, SomeIPWireSize> _elements) '''
+        /* Reduced widths of the length and type fields of «_interface.fullyQualifiedName» (generator option -ws).
+         * Merge the properties into the SOME/IP deployment of the interface. The widths hold the
+         * maximum lengths deployed when this file was generated and must be checked again if
+         * these change. Commented properties hold a bound that is not checked at run time.
+         */
+        import "platform:/plugin/org.genivi.commonapi.someip/deployment/CommonAPI-4-SOMEIP_deployment_spec.fdepl"
+        «IF _interface.eResource !== null»
+            import "«_interface.eResource.URI.lastSegment»"
+        «ENDIF»
+
+        define org.genivi.commonapi.someip.deployment for interface «_interface.fullyQualifiedName» {
+            «FOR attribute : _interface.attributes.filter[_elements.hasOverwrites(it)]»
+                attribute «attribute.elementName» {
+                    «_elements.get(attribute).generateOverwrites»
+                }
+            «ENDFOR»
+            «FOR method : _interface.methods.filter[(inArgs + outArgs).exists[a | _elements.hasOverwrites(a)]]»
+                method «method.elementName»«IF method.selector !== null»:«method.selector»«ENDIF» {
+                    «IF method.inArgs.exists[_elements.hasOverwrites(it)]»
+                        in {
+                            «FOR argument : method.inArgs.filter[_elements.hasOverwrites(it)]»
+                                «argument.elementName» {
+                                    «_elements.get(argument).generateOverwrites»
+                                }
+                            «ENDFOR»
+                        }
+                    «ENDIF»
+                    «IF method.outArgs.exists[_elements.hasOverwrites(it)]»
+                        out {
+                            «FOR argument : method.outArgs.filter[_elements.hasOverwrites(it)]»
+                                «argument.elementName» {
+                                    «_elements.get(argument).generateOverwrites»
+                                }
+                            «ENDFOR»
+                        }
+                    «ENDIF»
+                }
+            «ENDFOR»
+            «FOR broadcast : _interface.broadcasts.filter[outArgs.exists[a | _elements.hasOverwrites(a)]]»
+                broadcast «broadcast.elementName»«IF broadcast.selector !== null»:«broadcast.selector»«ENDIF» {
+                    out {
+                        «FOR argument : broadcast.outArgs.filter[_elements.hasOverwrites(it)]»
+                            «argument.elementName» {
+                                «_elements.get(argument).generateOverwrites»
+                            }
+                        «ENDFOR»
+                    }
+                }
+            «ENDFOR»
+        }
+    '''
+
+    def private String generateOverwrites(SomeIPWireSize _node) '''
+        «FOR width : _node.getWidths(SomeIPWireSize.DIRECT)»
+            «width.generateWidth»
+        «ENDFOR»
+        «IF !_node.getWidths(SomeIPWireSize.PLAIN).empty»
+            # {
+                «FOR width : _node.getWidths(SomeIPWireSize.PLAIN)»
+                    «width.generateWidth»
+                «ENDFOR»
+            }
+        «ENDIF»
+        «IF _node.section !== SomeIPWireSize.DIRECT && (!_node.getWidths(_node.section).empty || !_node.overwrites.empty)»
+            #«_node.section» {
+                «FOR width : _node.getWidths(_node.section)»
+                    «width.generateWidth»
+                «ENDFOR»
+                «FOR child : _node.overwrites»
+                    «child.name» {
+                        «child.generateOverwrites»
+                    }
+                «ENDFOR»
+            }
+        «ENDIF»
+    '''
+
+    def private generateWidth(SomeIPWireSize.Width _width) '''
+        «IF !_width.isChecked»// «ENDIF»«_width.property» = «_width.minimalWidth» // was «_width.width», bound «_width.bound»
+    '''
+
+    def private boolean hasOverwrites(Map<FTypedElement, SomeIPWireSize> _elements, FTypedElement _element) {
+        val SomeIPWireSize element = _elements.get(_element)
+        return element !== null && element.hasOverwrites
+    }
+
+    ///////////////////////////////////
+    // Analysis                      //
+    ///////////////////////////////////
+    def private List<SomeIPWireSize> getWireSizeMessages(FInterface _interface, PropertyAccessor _accessor,
+        Map<FTypedElement, SomeIPWireSize> _elements) {
+
+        val List<SomeIPWireSize> messages = new ArrayList<SomeIPWireSize>()
+        for (attribute : _interface.attributes) {
+            messages.addMessage(attribute.elementName, "attribute", #[attribute], _accessor, _elements)
+        }
+        for (method : _interface.methods) {
+            messages.addMessage(method.elementName, "request", method.inArgs, _accessor, _elements)
+            if (!method.isFireAndForget)
+                messages.addMessage(method.elementName, "response", method.outArgs, _accessor, _elements)
+        }
+        for (broadcast : _interface.broadcasts) {
+            messages.addMessage(broadcast.elementName, "event", broadcast.outArgs, _accessor, _elements)
+        }
+        return messages
+    }
+
+    def private void addMessage(List<SomeIPWireSize> _messages, String _name, String _kind,
+        List<? extends FTypedElement> _arguments, PropertyAccessor _accessor, Map<FTypedElement, SomeIPWireSize> _elements) {
+
+        val SomeIPWireSize message = new SomeIPWireSize(_name, _kind, true)
+        for (argument : _arguments) {
+            val SomeIPWireSize element = argument.getWireSize(_accessor.getOverwriteAccessor(argument), true, new HashSet<FType>())
+            _elements.put(argument, element)
+            message.addChild(element)
+        }
+        if (!message.isEmpty)
+            _messages.add(message)
+    }
+
+    def private SomeIPWireSize getWireSize(FTypedElement _element, PropertyAccessor _accessor,
+        boolean _isOverwritable, Set<FType> _types) {
+
+        val SomeIPWireSize element = new SomeIPWireSize(_element.elementName, null, _isOverwritable)
+        if (_element.array)
+            element.addArray(_element, _element, _element.type, _accessor, _accessor, _types)
+        else
+            element.addType(_element.type, _element, _accessor, _types)
+        return element
+    }
+
+    def private void addType(SomeIPWireSize _node, FTypeRef _typeRef, EObject _source,
+        PropertyAccessor _accessor, Set<FType> _types) {
+
+        if (_typeRef.derived === null) {
+            if (_typeRef.predefined == FBasicTypeId.STRING)
+                _node.addString(_source, _accessor)
+            else if (_typeRef.predefined == FBasicTypeId.BYTE_BUFFER)
+                _node.addByteBuffer(_source, _accessor)
+            return
+        }
+
+        val FType type = _typeRef.derived
+        if (!_types.add(type))
+            return
+        if (type instanceof FTypeDef)
+            _node.addType(type.actualType, _source, _accessor, _types)
+        else if (type instanceof FArrayType)
+            _node.addArray(type, _source, type.elementType, _accessor, _accessor.getOverwriteAccessor(type), _types)
+        else if (type instanceof FMapType)
+            _node.addMap(type, _source, _accessor)
+        else if (type instanceof FStructType)
+            _node.addStruct(type, _accessor, _types)
+        else if (type instanceof FUnionType)
+            _node.addUnion(type, _accessor, _types)
+        _types.remove(type)
+    }
+
+    // The length field of a string counts the encoded bytes: the BOM, the characters and
+    // the terminator, with UTF-16 two bytes per character and terminator
+    def private void addString(SomeIPWireSize _node, EObject _source, PropertyAccessor _accessor) {
+        val int lengthWidth = _accessor.getSomeIpStringLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val int length = _accessor.getSomeIpStringLength(_source) ?: SOMEIP_DEFAULT_STRING_LENGTH
+        val PropertyAccessor.SomeIpStringEncoding encoding = _accessor.getSomeIpStringEncoding(_source) ?: SOMEIP_DEFAULT_STRING_ENCODING
+        val long bound = if (encoding == PropertyAccessor.SomeIpStringEncoding.utf8)
+            3L + length + 1L else 2L + 2L * length + 2L
+        if (lengthWidth > 0 && length > 0)
+            _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.DIRECT, "SomeIpStringLengthWidth", lengthWidth, bound, false))
+    }
+
+    def private void addByteBuffer(SomeIPWireSize _node, EObject _source, PropertyAccessor _accessor) {
+        val int lengthWidth = _accessor.getSomeIpByteBufferLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val int maxLength = _accessor.getSomeIpByteBufferMaxLength(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+        if (lengthWidth > 0 && maxLength > 0)
+            _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.DIRECT, "SomeIpByteBufferLengthWidth", lengthWidth, maxLength, true))
+    }
+
+    // _array is the array type or the element that is deployed as array. The properties of
+    // an element deployed as array are set on the element, those of an array type in its
+    // "# { }" section.
+    def private void addArray(SomeIPWireSize _node, EObject _array, EObject _source, FTypeRef _elementType,
+        PropertyAccessor _accessor, PropertyAccessor _elementAccessor, Set<FType> _types) {
+
+        var Integer lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_source)
+        if (lengthWidth === null && _array != _source)
+            lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_array)
+        var Integer minLength = _accessor.getSomeIpArrayMinLengthHelper(_source)
+        if (minLength === null && _array != _source)
+            minLength = _accessor.getSomeIpArrayMinLengthHelper(_array)
+        var Integer maxLength = _accessor.getSomeIpArrayMaxLengthHelper(_source)
+        if (maxLength === null && _array != _source)
+            maxLength = _accessor.getSomeIpArrayMaxLengthHelper(_array)
+        val int width = lengthWidth ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val long min = (minLength ?: SOMEIP_DEFAULT_MIN_LENGTH).longValue
+        val long max = (maxLength ?: SOMEIP_DEFAULT_MAX_LENGTH).longValue
+
+        val EObject elementSource = if (_array instanceof FArrayType) _array else _source
+        val String section = if (_array instanceof FArrayType) SomeIPWireSize.PLAIN else SomeIPWireSize.DIRECT
+        if (width > 0 && max > 0) {
+            val Long elementSize = _elementType.getMaxSerializedSize(elementSource, _elementAccessor)
+            if (elementSize !== null)
+                _node.addWidth(new SomeIPWireSize.Width(section, "SomeIpArrayLengthWidth", width, max * elementSize, true))
+        }
+
+        // The elements are deployed with the array type, so they cannot be overwritten here
+        val SomeIPWireSize elements = new SomeIPWireSize("[]", null, false)
+        elements.addType(_elementType, elementSource, _elementAccessor, _types)
+        if (width == 0)
+            elements.setCount(max, max)
+        else
+            elements.setCount(min, if (max > 0) max else null)
+        _node.addChild(elements)
+    }
+
+    // The map properties exist for attributes and arguments only
+    def private void addMap(SomeIPWireSize _node, FMapType _map, EObject _source, PropertyAccessor _accessor) {
+        if (!(_source instanceof FAttribute) && !(_source instanceof FArgument))
+            return
+        val int lengthWidth = _accessor.getSomeIpMapLengthWidthHelper(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val int maxLength = _accessor.getSomeIpMapMaxLengthHelper(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+        if (lengthWidth == 0 || maxLength == 0)
+            return
+        val Long keySize = _map.keyType.getMaxSerializedSize(_map, _accessor)
+        val Long valueSize = _map.valueType.getMaxSerializedSize(_map, _accessor)
+        if (keySize !== null && valueSize !== null) {
+            val String property = if (_source instanceof FAttribute) "SomeIpAttrMapLengthWidth" else "SomeIpArgMapLengthWidth"
+            _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.DIRECT, property, lengthWidth,
+                maxLength * (keySize + valueSize), true))
+        }
+    }
+
+    def private void addStruct(SomeIPWireSize _node, FStructType _struct, PropertyAccessor _accessor, Set<FType> _types) {
+        // The serialized type of a polymorphic struct is not known before run time
+        var FStructType itsStruct = _struct
+        while (itsStruct !== null) {
+            if (itsStruct.polymorphic)
+                return
+            itsStruct = itsStruct.base
+        }
+
+        _node.setSection(SomeIPWireSize.STRUCT, 0)
+        val int lengthWidth = _accessor.getSomeIpStructLengthWidthHelper(_struct) ?: SOMEIP_DEFAULT_STRUCT_LENGTH_WIDTH
+        if (lengthWidth > 0) {
+            var long size = 0
+            var boolean isBounded = true
+            for (field : _struct.allElements) {
+                val Long fieldSize = field.getMaxSerializedSize(field.getFieldAccessor(_struct, _accessor))
+                if (fieldSize === null)
+                    isBounded = false
+                else
+                    size += fieldSize
+            }
+            if (isBounded)
+                _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.STRUCT, "SomeIpStructLengthWidth", lengthWidth, size, true))
+        }
+
+        for (field : _struct.allElements) {
+            val boolean isOwnField = _struct.elements.contains(field)
+            _node.addChild(field.getWireSize(field.getFieldAccessor(_struct, _accessor), isOwnField && _node.isOverwritable, _types))
+        }
+    }
+
+    // Fields of base structs are deployed with the type collection of the base struct
+    def private PropertyAccessor getFieldAccessor(FField _field, FStructType _struct, PropertyAccessor _accessor) {
+        if (_struct.elements.contains(_field))
+            return _accessor.getOverwriteAccessor(_field)
+        return getSomeIpAccessor(_field.eContainer.eContainer as FTypeCollection).getOverwriteAccessor(_field)
+    }
+
+    def private void addUnion(SomeIPWireSize _node, FUnionType _union, PropertyAccessor _accessor, Set<FType> _types) {
+        val List<FField> alternatives = _union.allElements
+        _node.setSection(SomeIPWireSize.UNION, alternatives.size)
+        val int typeWidth = _accessor.getSomeIpUnionTypeWidthHelper(_union) ?: SOMEIP_DEFAULT_UNION_TYPE_WIDTH
+        if (typeWidth > 0)
+            _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.UNION, "SomeIpUnionTypeWidth", typeWidth, alternatives.size, true))
+
+        val int lengthWidth = _accessor.getSomeIpUnionLengthWidthHelper(_union) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        if (lengthWidth > 0) {
+            var long size = (_accessor.getSomeIpUnionMaxLengthHelper(_union) ?: SOMEIP_DEFAULT_MAX_LENGTH).longValue
+            var boolean isBounded = true
+            for (alternative : alternatives) {
+                val Long alternativeSize = alternative.getMaxSerializedSize(_accessor.getOverwriteAccessor(alternative))
+                if (alternativeSize === null)
+                    isBounded = false
+                else if (alternativeSize > size)
+                    size = alternativeSize
+            }
+            if (isBounded)
+                _node.addWidth(new SomeIPWireSize.Width(SomeIPWireSize.UNION, "SomeIpUnionLengthWidth", lengthWidth, size, true))
+        }
+
+        for (alternative : alternatives) {
+            _node.addChild(alternative.getWireSize(_accessor.getOverwriteAccessor(alternative), _node.isOverwritable, _types))
+        }
+    }
+
+    def private someipWireSizeReportPath(FInterface _interface) {
+        _interface.versionPathPrefix + _interface.model.directoryPath + '/' + _interface.elementName + "SomeIPWireSize.json"
+    }
+
+    def private someipWireSizeDeploymentPath(FInterface _interface) {
+        _interface.versionPathPrefix + _interface.model.directoryPath + '/' + _interface.elementName + "SomeIPWireSize.fdepl"
+    }
+}
@@ -0,0 +1,147 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.core.resources.IResource
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FType
+import org.franca.core.franca.FTypeCollection
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates a serialization benchmark for all types of a type collection (or interface).
+ *
+ * Every type is filled with random values within the bounds of its deployment
+ * and is then written to and read from a message using the same streams and
+ * deployments as the generated proxies and stub adapters. The results are written
+ * as JSON. Enumerations and unions keep their default value; polymorphic structs
+ * are not measured.
+ */
+class FTypeCollectionSomeIPBenchmarkGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension SomeIPRandomValueGenerator
+
+    def generateBenchmark(FTypeCollection _tc, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_BENCHMARK_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_tc.someipBenchmarkSourcePath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _tc.generateBenchmarkSource(_accessor))
+        }
+        else {
+            _fileSystemAccess.generateFile(_tc.someipBenchmarkSourcePath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateBenchmarkSource(FTypeCollection _tc, PropertyAccessor _accessor) '''
+        «generateCommonApiSomeIPLicenseHeader()»
+        «val types = _tc.types.filter[isMeasured].fillableTypes»
+        #include <chrono>
+        #include <cstdint>
+        #include <cstdlib>
+        #include <fstream>
+        #include <iostream>
+        #include <random>
+        #include <string>
+        #include <type_traits>
+
+        «FOR include : types.map[(eContainer as FTypeCollection).someipDeploymentHeaderPath].toSet.sort»
+            #include <«include»>
+        «ENDFOR»
+
+        «startInternalCompilation»
+        #include <CommonAPI/SomeIP/Address.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/Message.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+        «endInternalCompilation»
+
+        namespace {
+
+        «generateRandomHelpers»
+
+        «types.generateFillFunctions»
+        template<typename _Type, typename _Deployment>
+        void runBenchmark(const char *_name, const _Type &_value, const _Deployment *_depl,
+                          std::size_t _iterations, std::ostream &_json, bool &_first) {
+            CommonAPI::SomeIP::Message message;
+            bool hasError(false);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < _iterations; i++) {
+                message = CommonAPI::SomeIP::Message::createMethodCall(
+                    CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x0101, false);
+                CommonAPI::SomeIP::OutputStream outStream(message, false);
+                outStream.writeValue(_value, _depl);
+                outStream.flush();
+                hasError = hasError || outStream.hasError();
+            }
+            std::chrono::duration<double, std::nano> encode = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < _iterations; i++) {
+                _Type decoded;
+                CommonAPI::SomeIP::InputStream inStream(message, false);
+                inStream.readValue(decoded, _depl);
+                hasError = hasError || inStream.hasError();
+            }
+            std::chrono::duration<double, std::nano> decode = std::chrono::steady_clock::now() - start;
+
+            const double bytes = double(message.getBodyLength());
+            const double encodeNs = encode.count() / double(_iterations);
+            const double decodeNs = decode.count() / double(_iterations);
+            _json << (_first ? "" : ",") << std::endl
+                  << "    { \"type\": \"" << _name << "\", \"bytes\": " << message.getBodyLength()
+                  << ", \"encodeNsPerOp\": " << encodeNs << ", \"decodeNsPerOp\": " << decodeNs
+                  << ", \"encodeMBPerSec\": " << (encodeNs > 0 ? bytes * 1.0e3 / encodeNs : 0)
+                  << ", \"decodeMBPerSec\": " << (decodeNs > 0 ? bytes * 1.0e3 / decodeNs : 0)
+                  << ", \"error\": " << (hasError ? "true" : "false") << " }";
+            _first = false;
+        }
+
+        } // namespace
+
+        int main(int argc, char **argv) {
+            std::ofstream file;
+            if (argc > 1)
+                file.open(argv[1]);
+            std::ostream &json = (argc > 1 ? file : std::cout);
+            const std::size_t iterations = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000);
+            std::mt19937_64 rng(42);
+            bool first(true);
+
+            json << "{" << std::endl
+                 << "  \"typeCollection\": \"«_tc.fullName»\"," << std::endl
+                 << "  \"iterations\": " << iterations << "," << std::endl
+                 << "  \"results\": [";
+            «FOR t : _tc.types.filter[isMeasured]»
+                {
+                    «t.cppTypeName» value;
+                    «t.fillName»(value, rng);
+                    «_tc.generateDeploymentNamespaceUsage»
+                    runBenchmark("«t.elementName»", value, «t.getDeploymentRef(_tc, _accessor)», iterations, json, first);
+                }
+            «ENDFOR»
+            json << std::endl << "  ]" << std::endl << "}" << std::endl;
+            return 0;
+        }
+    '''
+
+    def private generateDeploymentNamespaceUsage(FTypeCollection _tc) {
+        return "using namespace " + _tc.fullName + "_;"
+    }
+
+    def private boolean isMeasured(FType _type) {
+        return _type.isFillable
+    }
+}
@@ -0,0 +1,339 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.core.resources.IResource
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FArrayType
+import org.franca.core.franca.FTypeCollection
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates pack and unpack functions for arrays whose integer element type
+ * has a SomeIpIntegerBitWidth deployment. The elements are stored back to back,
+ * least significant bit first, without any padding between them. The kernels and
+ * the stream operators that are selected by the deployment type of a packed array
+ * do not depend on the model, they are written once to SomeIPPackedArray.hpp.
+ */
+class FTypeCollectionSomeIPBitPackingGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateBitPacking(FTypeCollection _tc, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_BIT_PACKING_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_tc.someipBitPackingHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _tc.generateBitPackingHeader(_accessor))
+            _fileSystemAccess.generateFile(someipPackedArrayHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generatePackedArrayHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(_tc.someipBitPackingHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+            _fileSystemAccess.generateFile(someipPackedArrayHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateBitPackingHeader(FTypeCollection _tc, PropertyAccessor _accessor) '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef «_tc.defineName.toUpperCase»_SOMEIP_BIT_PACKING_HPP_
+        #define «_tc.defineName.toUpperCase»_SOMEIP_BIT_PACKING_HPP_
+
+        #include <cstddef>
+        #include <cstdint>
+        #include <vector>
+
+        #include <«_tc.headerPath»>
+        #include <«someipPackedArrayHeaderPath»>
+
+        «_tc.generateVersionNamespaceBegin»
+        «_tc.model.generateNamespaceBeginDeclaration»
+        «_tc.generateDeploymentNamespaceBegin»
+
+        using CommonAPI::SomeIP::PackedArray::packedSize;
+        using CommonAPI::SomeIP::PackedArray::packBits;
+        using CommonAPI::SomeIP::PackedArray::unpackBits;
+
+        «FOR array : _tc.types.filter(FArrayType).filter[getPackedBitWidth(_accessor) !== null]»
+            «val bitWidth = array.getPackedBitWidth(_accessor)»
+            static const unsigned «array.elementName»BitWidth = «bitWidth»;
+
+            inline void pack«array.elementName.toFirstUpper»(const «_tc.fullName»::«array.elementName» &_value, std::vector<uint8_t> &_out) {
+                _out.resize(packedSize(_value.size(), «bitWidth»));
+                if (!_value.empty())
+                    packBits(_value.data(), _value.size(), «bitWidth», _out.data());
+            }
+
+            inline bool unpack«array.elementName.toFirstUpper»(const std::vector<uint8_t> &_in, std::size_t _count, «_tc.fullName»::«array.elementName» &_value) {
+                if (_in.size() < packedSize(_count, «bitWidth»))
+                    return false;
+                _value.resize(_count);
+                if (_count > 0)
+                    unpackBits(_in.data(), _count, «bitWidth», _value.data());
+                return true;
+            }
+
+        «ENDFOR»
+        «_tc.generateDeploymentNamespaceEnd»
+        «_tc.model.generateNamespaceEndDeclaration»
+        «_tc.generateVersionNamespaceEnd»
+
+        #endif // «_tc.defineName.toUpperCase»_SOMEIP_BIT_PACKING_HPP_
+    '''
+
+    def private generatePackedArrayHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_PACKED_ARRAY_HPP_
+        #define COMMONAPI_SOMEIP_PACKED_ARRAY_HPP_
+
+        #include <cstddef>
+        #include <cstdint>
+        #include <type_traits>
+        #include <vector>
+
+        #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        #define COMMONAPI_SOMEIP_PACKED_ARRAY_X86
+        #include <immintrin.h>
+        #endif
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Bit packed arrays of integers (SomeIpIntegerBitWidth on an array type, -bp).
+         *
+         * The elements are stored back to back, least significant bit first, without
+         * padding between them. The array is sent with the length field of its array
+         * deployment that contains the number of bytes; the last byte is padded with
+         * zero bits. The receiver takes as many elements as fit into the bytes. For bit
+         * widths below 8 the padding can hold further elements, these are received as
+         * trailing zero values.
+         *
+         * Unpacking of 16 and 32 bit elements with up to 24 bits uses AVX2 if the CPU
+         * supports it: eight elements occupy exactly bit width bytes, so the byte
+         * shuffle and the shift of each lane are the same for every group of eight.
+         *
+         * Arrays without deployment or without length field are serialized by the
+         * runtime.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace PackedArray {
+
+        // Number of bytes needed to store _count values of _bits bits
+        inline std::size_t packedSize(std::size_t _count, unsigned _bits) {
+            return (_count * _bits + 7) / 8;
+        }
+
+        // Packs _count values into _out (packedSize(_count, _bits) bytes). Complete
+        // 64 bit words are collected in a register and stored at once.
+        template<typename Type_>
+        inline void packBits(const Type_ *_values, std::size_t _count, unsigned _bits, uint8_t *_out) {
+            typedef typename std::make_unsigned<Type_>::type Unsigned;
+            const uint64_t mask = (_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << _bits) - 1);
+            uint64_t word(0);
+            unsigned filled(0);
+            for (std::size_t i = 0; i < _count; ++i) {
+                const uint64_t value = uint64_t(Unsigned(_values[i])) & mask;
+                word |= value << filled;
+                filled += _bits;
+                if (filled >= 64) {
+                    for (unsigned b = 0; b < 8; ++b)
+                        *_out++ = uint8_t(word >> (8 * b));
+                    filled -= 64;
+                    word = (filled == 0 ? 0 : value >> (_bits - filled));
+                }
+            }
+            for (unsigned b = 0; b < (filled + 7) / 8; ++b)
+                *_out++ = uint8_t(word >> (8 * b));
+        }
+
+        // Unpacks _count values from _in (packedSize(_count, _bits) bytes), signed
+        // values are sign extended.
+        template<typename Type_>
+        inline void unpackBitsScalar(const uint8_t *_in, std::size_t _count, unsigned _bits, Type_ *_values) {
+            const uint64_t mask = (_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << _bits) - 1);
+            const unsigned extension = 64 - _bits;
+            std::size_t remaining = packedSize(_count, _bits);
+            uint64_t word(0);
+            unsigned available(0);
+            for (std::size_t i = 0; i < _count; ++i) {
+                uint64_t value;
+                if (available >= _bits) {
+                    value = word & mask;
+                    word = (_bits == 64 ? 0 : word >> _bits);
+                    available -= _bits;
+                } else {
+                    const unsigned loaded = unsigned(remaining < 8 ? remaining : 8);
+                    uint64_t next(0);
+                    for (unsigned b = 0; b < loaded; ++b)
+                        next |= uint64_t(_in[b]) << (8 * b);
+                    _in += loaded;
+                    remaining -= loaded;
+                    const unsigned consumed = _bits - available;
+                    value = (word | (next << available)) & mask;
+                    word = (consumed == 64 ? 0 : next >> consumed);
+                    available = 8 * loaded - consumed;
+                }
+                if (std::is_signed<Type_>::value && extension > 0)
+                    value = uint64_t(int64_t(value << extension) >> extension);
+                _values[i] = Type_(value);
+            }
+        }
+
+        #ifdef COMMONAPI_SOMEIP_PACKED_ARRAY_X86
+        static const unsigned MAX_VECTOR_BITS = 24;
+
+        // Unpacks groups of eight values of 16 or 32 bit elements, returns the number of
+        // unpacked values. Every value is gathered from four bytes into its 32 bit lane.
+        template<typename Type_>
+        __attribute__((target("avx2")))
+        std::size_t unpackBitsAvx2(const uint8_t *_in, std::size_t _count, unsigned _bits, Type_ *_values) {
+            const std::size_t itsSize = packedSize(_count, _bits);
+            const std::size_t itsHighOffset = (4 * _bits) / 8;
+            uint8_t itsShuffle[32];
+            uint32_t itsShift[8];
+            for (unsigned j = 0; j < 8; j++) {
+                const unsigned itsBit = j * _bits - (j < 4 ? 0 : 8 * unsigned(itsHighOffset));
+                for (unsigned b = 0; b < 4; b++)
+                    itsShuffle[4 * j + b] = uint8_t(itsBit / 8 + b);
+                itsShift[j] = itsBit % 8;
+            }
+            const __m256i itsShuffleMask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(itsShuffle));
+            const __m256i itsShiftCount = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(itsShift));
+            const __m256i itsMask = _mm256_set1_epi32(int((uint32_t(1) << _bits) - 1));
+            const __m128i itsExtension = _mm_cvtsi32_si128(int(32 - _bits));
+
+            std::size_t i(0);
+            std::size_t itsOffset(0);
+            for (; i + 8 <= _count && itsOffset + itsHighOffset + 16 <= itsSize; i += 8, itsOffset += _bits) {
+                const __m128i itsLow = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_in + itsOffset));
+                const __m128i itsHigh = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_in + itsOffset + itsHighOffset));
+                __m256i itsValues = _mm256_inserti128_si256(_mm256_castsi128_si256(itsLow), itsHigh, 1);
+                itsValues = _mm256_shuffle_epi8(itsValues, itsShuffleMask);
+                itsValues = _mm256_and_si256(_mm256_srlv_epi32(itsValues, itsShiftCount), itsMask);
+                if (std::is_signed<Type_>::value)
+                    itsValues = _mm256_sra_epi32(_mm256_sll_epi32(itsValues, itsExtension), itsExtension);
+                if (sizeof(Type_) == 4) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(_values + i), itsValues);
+                } else {
+                    // packs works per 128 bit lane, the permutation moves both halves together
+                    const __m256i itsPacked = (std::is_signed<Type_>::value ? _mm256_packs_epi32(itsValues, itsValues)
+                                                                            : _mm256_packus_epi32(itsValues, itsValues));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(_values + i),
+                                     _mm256_castsi256_si128(_mm256_permute4x64_epi64(itsPacked, 0x08)));
+                }
+            }
+            return i;
+        }
+
+        inline bool hasAvx2() {
+            static const bool itsHasAvx2 = __builtin_cpu_supports("avx2");
+            return itsHasAvx2;
+        }
+        #endif
+
+        template<typename Type_>
+        inline void unpackBits(const uint8_t *_in, std::size_t _count, unsigned _bits, Type_ *_values) {
+            std::size_t i(0);
+        #ifdef COMMONAPI_SOMEIP_PACKED_ARRAY_X86
+            if ((sizeof(Type_) == 2 || sizeof(Type_) == 4) && _bits <= MAX_VECTOR_BITS && hasAvx2())
+                i = unpackBitsAvx2(_in, _count, _bits, _values);
+        #endif
+            // Groups of eight values end on a byte boundary
+            unpackBitsScalar(_in + (i * _bits) / 8, _count - i, _bits, _values + i);
+        }
+
+        /*
+         * Deployment of a packed array type. The bit width is part of the type, so that
+         * the serialization below is selected for all Deployables of the array.
+         */
+        template<typename Inner_, unsigned Bits_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        template<typename Inner_, unsigned Bits_>
+        ByteBufferDeployment getByteBufferDeployment(const Inner_ *_depl) {
+            return ByteBufferDeployment(uint32_t(packedSize(_depl->minLength_, Bits_)),
+                                        uint32_t(packedSize(_depl->maxLength_, Bits_)),
+                                        _depl->lengthWidth_);
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename Element_, typename Inner_, unsigned Bits_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::vector<Element_>, Deployment<Inner_, Bits_>> &_value) {
+            OutputStream &itsOutput = static_cast<OutputStream &>(_output);
+            const Inner_ *itsDepl = _value.getDepl();
+            const std::vector<Element_> &itsValue = _value.getValue();
+            if (itsDepl == nullptr || itsDepl->lengthWidth_ == 0) {
+                itsOutput.writeValue(itsValue, itsDepl);
+                return _output;
+            }
+            ByteBuffer itsBytes(packedSize(itsValue.size(), Bits_));
+            if (!itsValue.empty())
+                packBits(itsValue.data(), itsValue.size(), Bits_, itsBytes.data());
+            const ByteBufferDeployment itsBytesDepl = getByteBufferDeployment<Inner_, Bits_>(itsDepl);
+            itsOutput.writeValue(itsBytes, &itsBytesDepl);
+            return _output;
+        }
+
+        template<typename Element_, typename Inner_, unsigned Bits_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::vector<Element_>, Deployment<Inner_, Bits_>> &_value) {
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            const Inner_ *itsDepl = _value.getDepl();
+            std::vector<Element_> &itsValue = _value.getValue();
+            if (itsDepl == nullptr || itsDepl->lengthWidth_ == 0) {
+                itsInput.readValue(itsValue, itsDepl);
+                return _input;
+            }
+            ByteBuffer itsBytes;
+            const ByteBufferDeployment itsBytesDepl = getByteBufferDeployment<Inner_, Bits_>(itsDepl);
+            itsInput.readValue(itsBytes, &itsBytesDepl);
+            if (itsInput.hasError())
+                return _input;
+            const std::size_t itsCount = (8 * itsBytes.size()) / Bits_;
+            if (packedSize(itsCount, Bits_) != itsBytes.size()) {
+                COMMONAPI_ERROR("SomeIP packed array: dropped array of ", itsBytes.size(),
+                                " bytes, which is no packed size for ", Bits_, " bit elements");
+                itsInput.setError();
+                itsValue.clear();
+                return _input;
+            }
+            itsValue.resize(itsCount);
+            if (itsCount > 0)
+                unpackBits(itsBytes.data(), itsCount, Bits_, itsValue.data());
+            return _input;
+        }
+
+        } // namespace PackedArray
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_PACKED_ARRAY_HPP_
+    '''
+}
@@ -122,6 +122,11 @@ class FTypeCollectionSomeIPDeploymentGenerator {
 
     // Generate deployment types
     def protected dispatch String generateDeploymentType(FArrayType _array, int _indent, PropertyAccessor _accessor) {
+        // The typedef of a packed array type selects the packing stream operators
+        if (_indent == 0 && _array.isPackedArray(_accessor))
+            return "CommonAPI::SomeIP::PackedArray::Deployment<\n" +
+                generateArrayDeploymentType(_array.elementType, _indent + 1, _accessor) + ",\n" +
+                generateIndent(_indent + 1) + _array.getPackedBitWidth(_accessor) + "\n>"
         return generateArrayDeploymentType(_array.elementType, _indent, _accessor)
     }
 
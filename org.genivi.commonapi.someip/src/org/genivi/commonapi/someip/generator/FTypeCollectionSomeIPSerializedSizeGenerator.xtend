@@ -0,0 +1,614 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.HashSet
+import java.util.List
+import java.util.Set
+import org.eclipse.core.resources.IResource
+import org.eclipse.emf.ecore.EObject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FArrayType
+import org.franca.core.franca.FBasicTypeId
+import org.franca.core.franca.FEnumerationType
+import org.franca.core.franca.FField
+import org.franca.core.franca.FMapType
+import org.franca.core.franca.FStructType
+import org.franca.core.franca.FType
+import org.franca.core.franca.FTypeCollection
+import org.franca.core.franca.FTypeDef
+import org.franca.core.franca.FTypeRef
+import org.franca.core.franca.FTypedElement
+import org.franca.core.franca.FUnionType
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the serialized size functions of a type collection (or interface).
+ *
+ * For each type whose SOME/IP size is bounded by its deployment a constant
+ * <Type>MaxSerializedSize is generated. For each type whose size can be computed
+ * from a value, two functions are generated: <Type>SerializedSize(const Type &) uses
+ * the type-level deployment including the overwrites of struct and union elements,
+ * <Type>SerializedSize(const Type &, const Deployment *) reads the deployment object
+ * that the value is serialized with (nullptr for the SOME/IP defaults). The sizes of
+ * bit-width deployed integers and enumerations are upper bounds, all other sizes are
+ * exact. Only the MaxSerializedSize constants are bounds of a type.
+ */
+class FTypeCollectionSomeIPSerializedSizeGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension FrancaSomeIPDeploymentAccessorHelper
+    @Inject extension SomeIPUtf16Generator
+
+    static String SOMEIP_UTF8_BOM_SIZE = "3"
+    static String SOMEIP_UTF16_BOM_SIZE = "2"
+
+    def generateSerializedSize(FTypeCollection _tc, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_SERIALIZED_SIZE_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_tc.someipSerializedSizeHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _tc.generateSerializedSizeHeader(_accessor))
+            // The sizes of UTF-16 deployed strings are counted by SomeIPUtf16.hpp
+            generateUtf16(_fileSystemAccess)
+        }
+        else {
+            _fileSystemAccess.generateFile(_tc.someipSerializedSizeHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateSerializedSizeHeader(FTypeCollection _tc, PropertyAccessor _accessor) '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef «_tc.defineName.toUpperCase»_SOMEIP_SERIALIZED_SIZE_HPP_
+        #define «_tc.defineName.toUpperCase»_SOMEIP_SERIALIZED_SIZE_HPP_
+
+        #include <cstddef>
+        #include <string>
+
+        #include <«_tc.headerPath»>
+        #include <«_tc.someipDeploymentHeaderPath»>
+        #include <«someipUtf16HeaderPath»>
+        «FOR include : _tc.serializedSizeIncludes.sort»
+            #include <«include»>
+        «ENDFOR»
+
+        «_tc.generateVersionNamespaceBegin»
+        «_tc.model.generateNamespaceBeginDeclaration»
+        «_tc.generateDeploymentNamespaceBegin»
+
+        // Size of a string with the given deployment, including length field, BOM and terminator
+        inline std::size_t serializedStringSize(const std::string &_value, std::size_t _lengthWidth,
+                                                std::size_t _length, bool _isUtf16) {
+            if (_lengthWidth == 0)
+                return _length;
+            if (!_isUtf16)
+                return _lengthWidth + «SOMEIP_UTF8_BOM_SIZE» + _value.size() + 1;
+            return _lengthWidth + «SOMEIP_UTF16_BOM_SIZE» + 2 * CommonAPI::SomeIP::Utf16::countUnits(_value.data(), _value.size()) + 2;
+        }
+
+        inline std::size_t serializedStringSize(const std::string &_value, const CommonAPI::SomeIP::StringDeployment *_depl) {
+            if (_depl == nullptr)
+                return serializedStringSize(_value, «SOMEIP_DEFAULT_LENGTH_WIDTH», «SOMEIP_DEFAULT_STRING_LENGTH», false);
+            return serializedStringSize(_value, _depl->stringLengthWidth_, _depl->stringLength_,
+                                        _depl->stringEncoding_ != CommonAPI::SomeIP::StringEncoding::UTF8);
+        }
+
+        inline std::size_t serializedByteBufferSize(const CommonAPI::ByteBuffer &_value, const CommonAPI::SomeIP::ByteBufferDeployment *_depl) {
+            if (_depl == nullptr)
+                return «SOMEIP_DEFAULT_LENGTH_WIDTH» + _value.size();
+            if (_depl->byteBufferLengthWidth_ == 0)
+                return _depl->byteBufferMaxLength_;
+            return _depl->byteBufferLengthWidth_ + _value.size();
+        }
+
+        // typecollection-specific maximum serialized sizes
+        «FOR t : _tc.types»
+            «val maxSize = t.getMaxSerializedSize»
+            «IF maxSize !== null»
+                static const std::size_t «t.elementName»MaxSerializedSize = «maxSize»;
+            «ENDIF»
+        «ENDFOR»
+
+        // typecollection-specific serialized sizes
+        «FOR t : _tc.types.filter[hasSerializedSize]»
+            inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &_value);
+            inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &_value, const «t.sizeDeploymentType» *_depl);
+            «IF t.packedArrayBitWidth !== null»
+                inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &_value, const «t.getDeploymentType(_tc, true)» *_depl);
+            «ENDIF»
+        «ENDFOR»
+
+        «FOR t : _tc.types.filter[hasSerializedSize]»
+            «val sizeExpression = t.getSizeExpression("_value", 0)»
+            inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &«IF sizeExpression.contains("_value")»_value«ENDIF») {
+                return «sizeExpression»;
+            }
+
+            «val deploymentExpression = t.getDeploymentSizeExpression("_value", "_depl")»
+            inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &«IF deploymentExpression.contains("_value")»_value«ENDIF»,
+                    const «t.sizeDeploymentType» *«IF deploymentExpression.contains("_depl")»_depl«ENDIF») {
+                return «deploymentExpression»;
+            }
+
+            «IF t.packedArrayBitWidth !== null»
+                // The packed serialization applies to the deployment of the array type
+                inline std::size_t «t.elementName»SerializedSize(const «t.cppTypeName» &_value, const «t.getDeploymentType(_tc, true)» *_depl) {
+                    if (_depl == nullptr || _depl->lengthWidth_ == 0)
+                        return «t.elementName»SerializedSize(_value, static_cast<const «t.sizeDeploymentType» *>(_depl));
+                    return _depl->lengthWidth_ + (_value.size() * «t.packedArrayBitWidth» + 7) / 8;
+                }
+
+            «ENDIF»
+        «ENDFOR»
+        «_tc.generateDeploymentNamespaceEnd»
+        «_tc.model.generateNamespaceEndDeclaration»
+        «_tc.generateVersionNamespaceEnd»
+
+        #endif // «_tc.defineName.toUpperCase»_SOMEIP_SERIALIZED_SIZE_HPP_
+    '''
+
+    def private Set<String> getSerializedSizeIncludes(FTypeCollection _tc) {
+        var Set<String> includes = new HashSet<String>()
+        for (t : _tc.types) {
+            for (r : t.referencedTypes) {
+                val FTypeCollection container = r.eContainer as FTypeCollection
+                if (container != _tc) {
+                    includes.add(container.someipSerializedSizeHeaderPath)
+                }
+            }
+        }
+        return includes
+    }
+
+    def private Set<FType> getReferencedTypes(FType _type) {
+        var Set<FType> types = new HashSet<FType>()
+        if (_type instanceof FTypeDef) {
+            types.addAll(_type.actualType.referencedTypes)
+        } else if (_type instanceof FArrayType) {
+            types.addAll(_type.elementType.referencedTypes)
+        } else if (_type instanceof FMapType) {
+            types.addAll(_type.keyType.referencedTypes)
+            types.addAll(_type.valueType.referencedTypes)
+        } else if (_type instanceof FStructType) {
+            for (e : _type.allElements)
+                types.addAll(e.type.referencedTypes)
+        } else if (_type instanceof FUnionType) {
+            for (e : _type.allElements)
+                types.addAll(e.type.referencedTypes)
+        }
+        return types
+    }
+
+    def private Set<FType> getReferencedTypes(FTypeRef _typeRef) {
+        var Set<FType> types = new HashSet<FType>()
+        if (_typeRef.derived !== null)
+            types.add(_typeRef.derived)
+        return types
+    }
+
+    def private String getCppTypeName(FType _type) {
+        return (_type.eContainer as FTypeCollection).fullName + "::" + _type.elementName
+    }
+
+    def private PropertyAccessor getTypeAccessor(FType _type) {
+        return getSomeIpAccessor(_type.eContainer as FTypeCollection)
+    }
+
+    ///////////////////////////////////
+    // Maximum serialized sizes      //
+    ///////////////////////////////////
+    def Long getMaxSerializedSize(FType _type) {
+        return _type.getMaxSerializedSize(_type.typeAccessor)
+    }
+
+    def private Long getMaxSerializedSize(FType _type, PropertyAccessor _accessor) {
+        if (_type instanceof FTypeDef) {
+            return _type.actualType.getMaxSerializedSize(_type, _accessor)
+        }
+        if (_type instanceof FEnumerationType) {
+            return _type.getEnumSize(_accessor)
+        }
+        if (_type instanceof FArrayType) {
+            return _type.elementType.getArrayMaxSerializedSize(_type, _accessor)
+        }
+        if (_type instanceof FStructType) {
+            if (_type.isPolymorphicHierarchy)
+                return null
+            var long size = (_accessor.getSomeIpStructLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_STRUCT_LENGTH_WIDTH).longValue
+            for (e : _type.allElements) {
+                val Long elementSize = e.getMaxSerializedSize(_accessor.getOverwriteAccessor(e))
+                if (elementSize === null)
+                    return null
+                size += elementSize
+            }
+            return size
+        }
+        if (_type instanceof FUnionType) {
+            return _type.getUnionMaxSerializedSize(_accessor)
+        }
+        // maps are not bounded on type level
+        return null
+    }
+
+    def Long getMaxSerializedSize(FTypedElement _element, PropertyAccessor _accessor) {
+        if (_element.array)
+            return _element.type.getArrayMaxSerializedSize(_element, _accessor)
+        return _element.type.getMaxSerializedSize(_element, _accessor)
+    }
+
+    def Long getMaxSerializedSize(FTypeRef _typeRef, EObject _source, PropertyAccessor _accessor) {
+        if (_typeRef.derived !== null)
+            return _typeRef.derived.getMaxSerializedSize(_typeRef.derived.getElementAccessor(_accessor))
+        if (_typeRef.interval !== null)
+            return 4L
+        return _typeRef.predefined.getMaxSerializedSize(_source, _accessor)
+    }
+
+    def private Long getMaxSerializedSize(FBasicTypeId _typeId, EObject _source, PropertyAccessor _accessor) {
+        if (_typeId == FBasicTypeId.STRING) {
+            val Integer lengthWidth = _accessor.getSomeIpStringLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            if (lengthWidth == 0)
+                return (_accessor.getSomeIpStringLength(_source) ?: SOMEIP_DEFAULT_STRING_LENGTH).longValue
+            return null
+        }
+        if (_typeId == FBasicTypeId.BYTE_BUFFER) {
+            val Integer maxLength = _accessor.getSomeIpByteBufferMaxLength(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+            if (maxLength == 0)
+                return null
+            val Integer lengthWidth = _accessor.getSomeIpByteBufferLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            return lengthWidth.longValue + maxLength.longValue
+        }
+        return _typeId.primitiveSize
+    }
+
+    def private Long getArrayMaxSerializedSize(FTypeRef _elementType, EObject _source, PropertyAccessor _accessor) {
+        val Integer maxLength = _accessor.getSomeIpArrayMaxLengthHelper(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+        if (maxLength == 0)
+            return null
+        val Long elementSize = _elementType.getMaxSerializedSize(_source, _accessor)
+        if (elementSize === null)
+            return null
+        val Integer lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        return lengthWidth.longValue + maxLength.longValue * elementSize
+    }
+
+    def private Long getUnionMaxSerializedSize(FUnionType _union, PropertyAccessor _accessor) {
+        val long typeWidth = (_accessor.getSomeIpUnionTypeWidthHelper(_union) ?: SOMEIP_DEFAULT_UNION_TYPE_WIDTH).longValue
+        val long lengthWidth = (_accessor.getSomeIpUnionLengthWidthHelper(_union) ?: SOMEIP_DEFAULT_LENGTH_WIDTH).longValue
+        if (lengthWidth == 0) {
+            val Integer maxLength = _accessor.getSomeIpUnionMaxLengthHelper(_union)
+            if (maxLength === null)
+                return null
+            return typeWidth + maxLength.longValue
+        }
+        var long size = 0
+        for (e : _union.allElements) {
+            val Long elementSize = e.getMaxSerializedSize(_accessor.getOverwriteAccessor(e))
+            if (elementSize === null)
+                return null
+            if (elementSize > size)
+                size = elementSize
+        }
+        return typeWidth + lengthWidth + size
+    }
+
+    def private Long getEnumSize(FEnumerationType _enum, PropertyAccessor _accessor) {
+        val Integer bitWidth = _accessor.getSomeIpEnumBitWidthHelper(_enum)
+        if (bitWidth !== null)
+            return (bitWidth.longValue + 7) / 8
+        return (_accessor.getSomeIpEnumWidthHelper(_enum) ?: SOMEIP_DEFAULT_ENUM_WIDTH).longValue
+    }
+
+    def private Long getPrimitiveSize(FBasicTypeId _typeId) {
+        switch (_typeId) {
+            case FBasicTypeId.BOOLEAN: 1L
+            case FBasicTypeId.INT8: 1L
+            case FBasicTypeId.UINT8: 1L
+            case FBasicTypeId.INT16: 2L
+            case FBasicTypeId.UINT16: 2L
+            case FBasicTypeId.INT32: 4L
+            case FBasicTypeId.UINT32: 4L
+            case FBasicTypeId.FLOAT: 4L
+            case FBasicTypeId.INT64: 8L
+            case FBasicTypeId.UINT64: 8L
+            case FBasicTypeId.DOUBLE: 8L
+            default: null
+        }
+    }
+
+    // Size of elements that do not depend on their value
+    def private Long getFixedSerializedSize(FTypeRef _typeRef, PropertyAccessor _accessor) {
+        if (_typeRef.derived instanceof FEnumerationType)
+            return (_typeRef.derived as FEnumerationType).getEnumSize(_typeRef.derived.getElementAccessor(_accessor))
+        if (_typeRef.interval !== null)
+            return 4L
+        if (_typeRef.derived === null)
+            return _typeRef.predefined.primitiveSize
+        return null
+    }
+
+    def private boolean isPolymorphicHierarchy(FStructType _struct) {
+        var FStructType itsStruct = _struct
+        while (itsStruct !== null) {
+            if (itsStruct.polymorphic)
+                return true
+            itsStruct = itsStruct.base
+        }
+        return false
+    }
+
+    ///////////////////////////////////
+    // Value dependent sizes         //
+    ///////////////////////////////////
+    def boolean hasSerializedSize(FType _type) {
+        if (_type instanceof FTypeDef)
+            return _type.actualType.hasSerializedSize
+        if (_type instanceof FArrayType)
+            return _type.elementType.hasSerializedSize
+        if (_type instanceof FMapType)
+            return _type.keyType.hasSerializedSize && _type.valueType.hasSerializedSize
+        if (_type instanceof FStructType)
+            return !_type.isPolymorphicHierarchy && _type.allElements.forall[type.hasSerializedSize]
+        if (_type instanceof FUnionType) {
+            // the contained element is determined by its C++ type
+            val Set<String> elementTypes = new HashSet<String>()
+            return _type.base === null &&
+                   _type.allElements.forall[elementTypes.add(it.getTypeName(it, true)) && type.hasSerializedSize]
+        }
+        return true
+    }
+
+    def private boolean hasSerializedSize(FTypeRef _typeRef) {
+        if (_typeRef.derived !== null)
+            return _typeRef.derived.hasSerializedSize
+        return _typeRef.interval !== null || _typeRef.predefined.primitiveSize !== null ||
+               _typeRef.predefined == FBasicTypeId.STRING || _typeRef.predefined == FBasicTypeId.BYTE_BUFFER
+    }
+
+    // Bit width of an array type whose type-level deployment selects the packed serialization
+    def private Integer getPackedArrayBitWidth(FType _type) {
+        if (_type instanceof FArrayType) {
+            if (_type.isPackedArray(_type.typeAccessor))
+                return _type.getPackedBitWidth(_type.typeAccessor)
+        }
+        return null
+    }
+
+    // Elements without overwrites are serialized with the deployment of their type
+    def private PropertyAccessor getElementAccessor(FType _type, PropertyAccessor _accessor) {
+        if (_accessor !== null && _accessor.isProperOverwrite())
+            return _accessor
+        return _type.typeAccessor
+    }
+
+    def private String getSizeExpression(FType _type, String _value, int _depth) {
+        val PropertyAccessor accessor = _type.typeAccessor
+        val Integer bitWidth = _type.packedArrayBitWidth
+        if (bitWidth !== null) {
+            val Integer lengthWidth = accessor.getSomeIpArrayLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            if (lengthWidth != 0)
+                return lengthWidth + " + (" + _value + ".size() * " + bitWidth + " + 7) / 8"
+        }
+        return _type.getSizeExpression(_value, accessor, _depth)
+    }
+
+    def private String getSizeExpression(FType _type, String _value, PropertyAccessor _accessor, int _depth) {
+        if (_type instanceof FTypeDef) {
+            return _type.actualType.getSizeExpression(_type, _value, _accessor, _depth)
+        }
+        if (_type instanceof FEnumerationType) {
+            return _type.getEnumSize(_accessor).toString
+        }
+        if (_type instanceof FArrayType) {
+            return _type.elementType.getArraySizeExpression(_type, _value, _accessor, _depth)
+        }
+        if (_type instanceof FMapType) {
+            val String element = "_e" + _depth
+            val Integer lengthWidth = _accessor.getSomeIpMapLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            return "[&]() -> std::size_t { std::size_t s(" + lengthWidth + "); " +
+                   "for (auto it = " + _value + ".begin(); it != " + _value + ".end(); ++it) { " +
+                   "const auto &" + element + " = *it; " +
+                   "s += " + _type.keyType.getSizeExpression(_type, element + ".first", _accessor, _depth + 1) + " + " +
+                   _type.valueType.getSizeExpression(_type, element + ".second", _accessor, _depth + 1) + "; } " +
+                   "return s; }()"
+        }
+        if (_type instanceof FStructType) {
+            var String expression = (_accessor.getSomeIpStructLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_STRUCT_LENGTH_WIDTH).toString
+            for (e : _type.allElements) {
+                expression += "\n    + " + e.getSizeExpression(_value + ".get" + e.elementName.toFirstUpper + "()",
+                    _accessor.getOverwriteAccessor(e), _depth)
+            }
+            return expression
+        }
+        if (_type instanceof FUnionType) {
+            val int typeWidth = _accessor.getSomeIpUnionTypeWidthHelper(_type) ?: SOMEIP_DEFAULT_UNION_TYPE_WIDTH
+            val int lengthWidth = _accessor.getSomeIpUnionLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            val int maxLength = _accessor.getSomeIpUnionMaxLengthHelper(_type) ?: SOMEIP_DEFAULT_MAX_LENGTH
+            // without a length field, the element is padded to the maximum length
+            if (lengthWidth == 0 && maxLength > 0)
+                return (typeWidth + maxLength).toString
+            var String expression = "[&]() -> std::size_t { "
+            for (e : _type.allElements) {
+                val String elementType = e.getTypeName(e, true)
+                expression += "if (" + _value + ".isType<" + elementType + ">()) return " + (typeWidth + lengthWidth) + " + " +
+                    e.getSizeExpression(_value + ".get<" + elementType + ">()", _accessor.getOverwriteAccessor(e), _depth) + "; "
+            }
+            return expression + "return " + (typeWidth + lengthWidth) + "; }()"
+        }
+        return "0"
+    }
+
+    def private String getSizeExpression(FTypedElement _element, String _value, PropertyAccessor _accessor, int _depth) {
+        if (_element.array)
+            return "(" + _element.type.getArraySizeExpression(_element, _value, _accessor, _depth) + ")"
+        return "(" + _element.type.getSizeExpression(_element, _value, _accessor, _depth) + ")"
+    }
+
+    def private String getSizeExpression(FTypeRef _typeRef, EObject _source, String _value, PropertyAccessor _accessor, int _depth) {
+        if (_typeRef.derived !== null) {
+            val FType derived = _typeRef.derived
+            val PropertyAccessor accessor = derived.getElementAccessor(_accessor)
+            if (derived instanceof FEnumerationType)
+                return derived.getEnumSize(accessor).toString
+            // Overwritten elements and elements of packed array types (which are packed on type level only)
+            // cannot use the function of their type
+            if (_accessor.isProperOverwrite() || derived.packedArrayBitWidth !== null)
+                return "(" + derived.getSizeExpression(_value, accessor, _depth) + ")"
+            return (derived.eContainer as FTypeCollection).fullName + "_::" + derived.elementName + "SerializedSize(" + _value + ")"
+        }
+        if (_typeRef.interval !== null)
+            return "4"
+        val FBasicTypeId typeId = _typeRef.predefined
+        if (typeId == FBasicTypeId.STRING) {
+            val Integer lengthWidth = _accessor.getSomeIpStringLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            val Integer length = _accessor.getSomeIpStringLength(_source) ?: SOMEIP_DEFAULT_STRING_LENGTH
+            val PropertyAccessor.SomeIpStringEncoding encoding = _accessor.getSomeIpStringEncoding(_source) ?: SOMEIP_DEFAULT_STRING_ENCODING
+            return "serializedStringSize(" + _value + ", " + lengthWidth + ", " + length + ", " +
+                   (encoding != PropertyAccessor.SomeIpStringEncoding.utf8) + ")"
+        }
+        if (typeId == FBasicTypeId.BYTE_BUFFER) {
+            val Integer lengthWidth = _accessor.getSomeIpByteBufferLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            if (lengthWidth == 0)
+                return (_accessor.getSomeIpByteBufferMaxLength(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH).toString
+            return lengthWidth + " + " + _value + ".size()"
+        }
+        return typeId.primitiveSize.toString
+    }
+
+    def private String getArraySizeExpression(FTypeRef _elementType, EObject _source, String _value, PropertyAccessor _accessor, int _depth) {
+        val Integer lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val Long elementSize = _elementType.getFixedSerializedSize(_accessor)
+        if (elementSize !== null) {
+            return lengthWidth + " + " + _value + ".size() * " + elementSize
+        }
+        val String element = "_e" + _depth
+        return "[&]() -> std::size_t { std::size_t s(" + lengthWidth + "); " +
+               "for (auto it = " + _value + ".begin(); it != " + _value + ".end(); ++it) { " +
+               "const auto &" + element + " = *it; " +
+               "s += " + _elementType.getSizeExpression(_source, element, _accessor, _depth + 1) + "; } " +
+               "return s; }()"
+    }
+
+    ///////////////////////////////////
+    // Deployment dependent sizes    //
+    ///////////////////////////////////
+    // The deployment type that elements of structs, unions, arrays and maps are serialized with.
+    // The type-level deployment of a packed array type is derived from it.
+    def private String getSizeDeploymentType(FType _type) {
+        if (_type instanceof FTypeDef)
+            return _type.actualType.getSizeDeploymentType(_type.eContainer as FTypeCollection)
+        if (_type instanceof FArrayType)
+            return "CommonAPI::SomeIP::ArrayDeployment< " +
+                _type.elementType.getSizeDeploymentType(_type.eContainer as FTypeCollection) + " >"
+        return _type.getDeploymentType(_type.eContainer as FTypeCollection, true)
+    }
+
+    def private String getSizeDeploymentType(FTypeRef _typeRef, FTypeCollection _tc) {
+        if (_typeRef.derived !== null)
+            return _typeRef.derived.sizeDeploymentType
+        return _typeRef.getDeploymentType(_tc, true)
+    }
+
+    // Deployment members that are not set by a nullptr deployment take the SOME/IP defaults
+    def private String getDeploymentMember(String _depl, String _member, Object _default) {
+        return "(" + _depl + " != nullptr ? " + _depl + "->" + _member + " : " + _default + ")"
+    }
+
+    def private String getDeploymentSizeExpression(FType _type, String _value, String _depl) {
+        if (_type instanceof FTypeDef) {
+            return _type.actualType.getDeploymentSizeExpression(_value, _depl, 0)
+        }
+        if (_type instanceof FEnumerationType) {
+            val String backingType = _type.getBackingType(_type.typeAccessor).toString.toLowerCase + "_t"
+            return "(" + _depl + " != nullptr ? std::size_t((" + _depl + "->bits_ + 7) / 8) : sizeof(" + backingType + "))"
+        }
+        if (_type instanceof FArrayType) {
+            return _type.elementType.getArrayDeploymentSizeExpression(_value, _depl, 0)
+        }
+        if (_type instanceof FMapType) {
+            return "[&]() -> std::size_t { std::size_t s" + _depl.getDeploymentMember("lengthWidth_", SOMEIP_DEFAULT_LENGTH_WIDTH) + "; " +
+                   "for (auto it = " + _value + ".begin(); it != " + _value + ".end(); ++it) { " +
+                   "const auto &_e0 = *it; " +
+                   "s += " + _type.keyType.getDeploymentSizeExpression("_e0.first", _depl.getDeploymentMember("key_", "nullptr"), 1) + " + " +
+                   _type.valueType.getDeploymentSizeExpression("_e0.second", _depl.getDeploymentMember("value_", "nullptr"), 1) + "; } " +
+                   "return s; }()"
+        }
+        if (_type instanceof FStructType) {
+            val List<FField> elements = _type.allElements
+            if (elements.empty)
+                return "0"
+            var String expression = _depl.getDeploymentMember("structLengthWidth_", SOMEIP_DEFAULT_STRUCT_LENGTH_WIDTH)
+            for (e : elements) {
+                expression += "\n    + " + e.getDeploymentSizeExpression(_value + ".get" + e.elementName.toFirstUpper + "()",
+                    elements.indexOf(e).getElementDeployment(_depl), 0)
+            }
+            return expression
+        }
+        if (_type instanceof FUnionType) {
+            val List<FField> elements = _type.allElements
+            var String expression = "[&]() -> std::size_t { " +
+                "const std::size_t itsTypeWidth" + _depl.getDeploymentMember("unionTypeWidth_", SOMEIP_DEFAULT_UNION_TYPE_WIDTH) + "; " +
+                "const std::size_t itsLengthWidth" + _depl.getDeploymentMember("unionLengthWidth_", SOMEIP_DEFAULT_LENGTH_WIDTH) + "; " +
+                "if (itsLengthWidth == 0 && " + _depl + " != nullptr && " + _depl + "->unionMaxLength_ > 0) " +
+                "return itsTypeWidth + " + _depl + "->unionMaxLength_; "
+            for (e : elements) {
+                val String elementType = e.getTypeName(e, true)
+                expression += "if (" + _value + ".isType<" + elementType + ">()) return itsTypeWidth + itsLengthWidth + " +
+                    e.getDeploymentSizeExpression(_value + ".get<" + elementType + ">()", elements.indexOf(e).getElementDeployment(_depl), 0) + "; "
+            }
+            return expression + "return itsTypeWidth + itsLengthWidth; }()"
+        }
+        return "0"
+    }
+
+    def private String getElementDeployment(int _index, String _depl) {
+        return "(" + _depl + " != nullptr ? std::get<" + _index + ">(" + _depl + "->values_) : nullptr)"
+    }
+
+    def private String getDeploymentSizeExpression(FTypedElement _element, String _value, String _depl, int _depth) {
+        if (_element.array)
+            return "(" + _element.type.getArrayDeploymentSizeExpression(_value, _depl, _depth) + ")"
+        return "(" + _element.type.getDeploymentSizeExpression(_value, _depl, _depth) + ")"
+    }
+
+    def private String getDeploymentSizeExpression(FTypeRef _typeRef, String _value, String _depl, int _depth) {
+        if (_typeRef.derived !== null) {
+            val FType derived = _typeRef.derived
+            return (derived.eContainer as FTypeCollection).fullName + "_::" + derived.elementName + "SerializedSize(" + _value + ", " + _depl + ")"
+        }
+        if (_typeRef.interval !== null)
+            return "4"
+        val FBasicTypeId typeId = _typeRef.predefined
+        if (typeId == FBasicTypeId.STRING)
+            return "serializedStringSize(" + _value + ", " + _depl + ")"
+        if (typeId == FBasicTypeId.BYTE_BUFFER)
+            return "serializedByteBufferSize(" + _value + ", " + _depl + ")"
+        return typeId.primitiveSize.toString
+    }
+
+    def private String getArrayDeploymentSizeExpression(FTypeRef _elementType, String _value, String _depl, int _depth) {
+        val String lengthWidth = _depl.getDeploymentMember("lengthWidth_", SOMEIP_DEFAULT_LENGTH_WIDTH)
+        if (_elementType.derived === null) {
+            val Long elementSize = (if (_elementType.interval !== null) 4L else _elementType.predefined.primitiveSize)
+            if (elementSize !== null)
+                return lengthWidth + " + " + _value + ".size() * " + elementSize
+        }
+        val String element = "_e" + _depth
+        return "[&]() -> std::size_t { std::size_t s" + lengthWidth + "; " +
+               "for (auto it = " + _value + ".begin(); it != " + _value + ".end(); ++it) { " +
+               "const auto &" + element + " = *it; " +
+               "s += " + _elementType.getDeploymentSizeExpression(element, _depl.getDeploymentMember("elementDepl_", "nullptr"), _depth + 1) + "; } " +
+               "return s; }()"
+    }
+}
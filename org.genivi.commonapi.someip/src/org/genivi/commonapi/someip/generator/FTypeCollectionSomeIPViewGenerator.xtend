@@ -0,0 +1,540 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.HashMap
+import java.util.HashSet
+import java.util.LinkedHashSet
+import java.util.Set
+import org.eclipse.core.resources.IResource
+import org.eclipse.emf.ecore.EObject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.franca.core.franca.FArrayType
+import org.franca.core.franca.FBasicTypeId
+import org.franca.core.franca.FEnumerationType
+import org.franca.core.franca.FStructType
+import org.franca.core.franca.FType
+import org.franca.core.franca.FTypeCollection
+import org.franca.core.franca.FTypeDef
+import org.franca.core.franca.FTypeRef
+import org.franca.core.franca.FTypedElement
+import org.franca.core.franca.FUnionType
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the read-only views of a type collection (or interface).
+ *
+ * For each type with a layout that is determined by its type-level deployment a
+ * view <Type>View is generated. Struct and union views are classes over the bytes
+ * of a received message: they check the bounds of all elements when they are
+ * created, decode an element when it is accessed and create the CommonAPI value by
+ * materialize(). Enumerations, arrays and typedefs get a typedef of their codec.
+ * Maps, polymorphic structs, derived unions, unions with elements of the same C++
+ * type, UTF-16 strings, bit width deployed integers and enumerations and elements
+ * that overwrite the deployment of their struct, union or enumeration type have
+ * no view, nor have the types that contain them.
+ */
+class FTypeCollectionSomeIPViewGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension FrancaSomeIPDeploymentAccessorHelper
+    @Inject extension SomeIPViewGenerator
+
+    static String VIEW = "CommonAPI::SomeIP::View::"
+
+    val viewable_ = new HashMap<FType, Boolean>()
+
+    def generateViews(FTypeCollection _tc, IFileSystemAccess _fileSystemAccess,
+        PropertyAccessor _accessor, IResource _modelid) {
+
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_VIEWS_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(_tc.someipViewsHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                _tc.generateViewsHeader)
+            generateView(_fileSystemAccess)
+        }
+        else {
+            _fileSystemAccess.generateFile(_tc.someipViewsHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateViewsHeader(FTypeCollection _tc) '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef «_tc.defineName.toUpperCase»_SOMEIP_VIEWS_HPP_
+        #define «_tc.defineName.toUpperCase»_SOMEIP_VIEWS_HPP_
+
+        #include <cstddef>
+        #include <cstdint>
+
+        #include <«_tc.headerPath»>
+        #include <«someipViewHeaderPath»>
+        «FOR include : _tc.viewIncludes.sort»
+            #include <«include»>
+        «ENDFOR»
+
+        «_tc.generateVersionNamespaceBegin»
+        «_tc.model.generateNamespaceBeginDeclaration»
+        «_tc.generateDeploymentNamespaceBegin»
+
+        «FOR t : _tc.viewTypes»
+            «t.generateView»
+
+        «ENDFOR»
+        «_tc.generateDeploymentNamespaceEnd»
+        «_tc.model.generateNamespaceEndDeclaration»
+        «_tc.generateVersionNamespaceEnd»
+
+        #endif // «_tc.defineName.toUpperCase»_SOMEIP_VIEWS_HPP_
+    '''
+
+    def private dispatch String generateView(FTypeDef _typeDef) '''
+        typedef «_typeDef.actualType.getViewCodec(_typeDef, _typeDef.typeAccessor)» «_typeDef.viewName»;
+    '''
+
+    def private dispatch String generateView(FEnumerationType _enum) '''
+        typedef «VIEW»Enumeration< «_enum.cppTypeName», «_enum.getBackingType(_enum.typeAccessor).toString.toLowerCase»_t, «_enum.typeAccessor.getSomeIpEnumWidthHelper(_enum) ?: SOMEIP_DEFAULT_ENUM_WIDTH» > «_enum.viewName»;
+    '''
+
+    def private dispatch String generateView(FArrayType _array) '''
+        typedef «_array.elementType.getArrayViewCodec(_array, _array.typeAccessor)» «_array.viewName»;
+    '''
+
+    def private dispatch String generateView(FStructType _struct) '''
+        «val accessor = _struct.typeAccessor»
+        «val elements = _struct.allElements»
+        «val lengthWidth = accessor.getSomeIpStructLengthWidthHelper(_struct) ?: SOMEIP_DEFAULT_STRUCT_LENGTH_WIDTH»
+        // View of «_struct.elementName», the accessors decode the field on each call
+        class «_struct.viewName» {
+        public:
+            typedef «_struct.cppTypeName» Type;
+            typedef «_struct.viewName» Value;
+            static const std::size_t fixedSize = 0;
+
+            «_struct.viewName»()
+                : isValid_(false) {
+            }
+
+            «_struct.viewName»(const uint8_t *_data, std::size_t _size, bool _isLittleEndian)
+                : isValid_(false) {
+                «VIEW»Reader itsReader(_data, _size, _isLittleEndian);
+                read(itsReader, *this);
+            }
+
+            bool isValid() const { return isValid_; }
+
+            «FOR e : elements»
+                «val codec = e.getViewCodec(accessor.getOverwriteAccessor(e))»
+                «codec»::Value get«e.elementName.toFirstUpper»() const {
+                    return «codec»::get(fields_.at(offsets_[«elements.indexOf(e)»]));
+                }
+            «ENDFOR»
+
+            Type materialize() const {
+                Type itsValue;
+                materialize(itsValue);
+                return itsValue;
+            }
+
+            void materialize(Type &_value) const {
+                «FOR e : elements»
+                    «val codec = e.getViewCodec(accessor.getOverwriteAccessor(e))»
+                    {
+                        «codec»::Type itsElement;
+                        «codec»::materialize(fields_.at(offsets_[«elements.indexOf(e)»]), itsElement);
+                        _value.set«e.elementName.toFirstUpper»(itsElement);
+                    }
+                «ENDFOR»
+            }
+
+            static bool skip(«VIEW»Reader &_reader) {
+                «VIEW»Reader itsFields;
+                return parse(_reader, itsFields, nullptr);
+            }
+
+            static bool read(«VIEW»Reader &_reader, Value &_value) {
+                _value.isValid_ = parse(_reader, _value.fields_, _value.offsets_);
+                return _value.isValid_;
+            }
+
+            static Value get(const «VIEW»Reader &_reader) {
+                «VIEW»Reader itsReader(_reader);
+                Value itsValue;
+                read(itsReader, itsValue);
+                return itsValue;
+            }
+
+            static void materialize(const «VIEW»Reader &_reader, Type &_value) {
+                get(_reader).materialize(_value);
+            }
+
+        private:
+            // Checks the fields, moves _reader behind the struct and stores where the fields start
+            static bool parse(«VIEW»Reader &_reader, «VIEW»Reader &_fields, uint32_t *_offsets) {
+                «IF lengthWidth > 0»
+                    if (!_reader.enter(«lengthWidth», _fields))
+                        return false;
+                «ELSE»
+                    _fields = _reader.rest();
+                «ENDIF»
+                «VIEW»Reader itsReader(_fields);
+                «FOR e : elements»
+                    if (_offsets)
+                        _offsets[«elements.indexOf(e)»] = uint32_t(itsReader.getPosition());
+                    if (!«e.getViewCodec(accessor.getOverwriteAccessor(e))»::skip(itsReader))
+                        return false;
+                «ENDFOR»
+                «IF lengthWidth > 0»
+                    return true;
+                «ELSE»
+                    return _reader.skip(itsReader.getPosition());
+                «ENDIF»
+            }
+
+            «VIEW»Reader fields_;
+            uint32_t offsets_[«Math.max(1, elements.size)»];
+            bool isValid_;
+        };
+    '''
+
+    def private dispatch String generateView(FUnionType _union) '''
+        «val accessor = _union.typeAccessor»
+        «val elements = _union.allElements»
+        «val lengthWidth = accessor.getSomeIpUnionLengthWidthHelper(_union) ?: SOMEIP_DEFAULT_LENGTH_WIDTH»
+        «val typeWidth = accessor.getSomeIpUnionTypeWidthHelper(_union) ?: SOMEIP_DEFAULT_UNION_TYPE_WIDTH»
+        «val defaultOrder = accessor.getSomeIpUnionDefaultOrderHelper(_union) ?: SOMEIP_DEFAULT_UNION_DEFAULT_ORDER»
+        // View of «_union.elementName», the selector is the position of the contained element (1 for the first)
+        class «_union.viewName» {
+        public:
+            typedef «_union.cppTypeName» Type;
+            typedef «_union.viewName» Value;
+            static const std::size_t fixedSize = «IF lengthWidth == 0»«typeWidth + accessor.getSomeIpUnionMaxLengthHelper(_union)»«ELSE»0«ENDIF»;
+
+            «_union.viewName»()
+                : selector_(0) {
+            }
+
+            «_union.viewName»(const uint8_t *_data, std::size_t _size, bool _isLittleEndian)
+                : selector_(0) {
+                «VIEW»Reader itsReader(_data, _size, _isLittleEndian);
+                read(itsReader, *this);
+            }
+
+            bool isValid() const { return selector_ != 0; }
+            uint32_t getSelector() const { return selector_; }
+
+            «FOR e : elements»
+                «val codec = e.getViewCodec(accessor.getOverwriteAccessor(e))»
+                bool is«e.elementName.toFirstUpper»() const { return selector_ == «elements.indexOf(e) + 1»; }
+                «codec»::Value get«e.elementName.toFirstUpper»() const {
+                    return «codec»::get(element_);
+                }
+            «ENDFOR»
+
+            Type materialize() const {
+                Type itsValue;
+                materialize(itsValue);
+                return itsValue;
+            }
+
+            void materialize(Type &_value) const {
+                switch (selector_) {
+                «FOR e : elements»
+                    «val codec = e.getViewCodec(accessor.getOverwriteAccessor(e))»
+                    case «elements.indexOf(e) + 1»: {
+                        «codec»::Type itsElement;
+                        «codec»::materialize(element_, itsElement);
+                        _value = itsElement;
+                        break;
+                    }
+                «ENDFOR»
+                default:
+                    break;
+                }
+            }
+
+            static bool skip(«VIEW»Reader &_reader) {
+                Value itsValue;
+                return read(_reader, itsValue);
+            }
+
+            static bool read(«VIEW»Reader &_reader, Value &_value) {
+                uint32_t itsSelector;
+                «IF lengthWidth == 0»
+                    if (!_reader.readUnsigned(«typeWidth», itsSelector)
+                        || !_reader.split(«accessor.getSomeIpUnionMaxLengthHelper(_union)», _value.element_))
+                        return false;
+                «ELSE»
+                    uint32_t itsLength;
+                    «IF defaultOrder»
+                        if (!_reader.readUnsigned(«lengthWidth», itsLength)
+                            || !_reader.readUnsigned(«typeWidth», itsSelector)
+                            || !_reader.split(itsLength, _value.element_))
+                            return false;
+                    «ELSE»
+                        if (!_reader.readUnsigned(«typeWidth», itsSelector)
+                            || !_reader.readUnsigned(«lengthWidth», itsLength)
+                            || !_reader.split(itsLength, _value.element_))
+                            return false;
+                    «ENDIF»
+                «ENDIF»
+                «VIEW»Reader itsReader(_value.element_);
+                switch (itsSelector) {
+                «FOR e : elements»
+                    case «elements.indexOf(e) + 1»:
+                        if (!«e.getViewCodec(accessor.getOverwriteAccessor(e))»::skip(itsReader))
+                            return false;
+                        break;
+                «ENDFOR»
+                default:
+                    return false;
+                }
+                _value.selector_ = itsSelector;
+                return true;
+            }
+
+            static Value get(const «VIEW»Reader &_reader) {
+                «VIEW»Reader itsReader(_reader);
+                Value itsValue;
+                read(itsReader, itsValue);
+                return itsValue;
+            }
+
+            static void materialize(const «VIEW»Reader &_reader, Type &_value) {
+                get(_reader).materialize(_value);
+            }
+
+        private:
+            «VIEW»Reader element_;
+            uint32_t selector_;
+        };
+    '''
+
+    def private dispatch String generateView(FType _type) '''
+    '''
+
+    def private Set<String> getViewIncludes(FTypeCollection _tc) {
+        var Set<String> includes = new HashSet<String>()
+        for (t : _tc.viewTypes) {
+            for (r : t.referencedTypes) {
+                val FTypeCollection container = r.eContainer as FTypeCollection
+                if (container != _tc) {
+                    includes.add(container.someipViewsHeaderPath)
+                }
+            }
+        }
+        return includes
+    }
+
+    // The viewable types of the type collection, each after the types it refers to
+    def private Set<FType> getViewTypes(FTypeCollection _tc) {
+        val Set<FType> types = new LinkedHashSet<FType>()
+        for (t : _tc.types.filter[isViewable])
+            _tc.addViewType(t, types)
+        return types
+    }
+
+    def private void addViewType(FTypeCollection _tc, FType _type, Set<FType> _types) {
+        if (_types.contains(_type))
+            return
+        for (r : _type.referencedTypes) {
+            if (r.eContainer == _tc && r != _type)
+                _tc.addViewType(r, _types)
+        }
+        _types.add(_type)
+    }
+
+    def private Set<FType> getReferencedTypes(FType _type) {
+        var Set<FType> types = new HashSet<FType>()
+        if (_type instanceof FTypeDef) {
+            types.addAll(_type.actualType.referencedTypes)
+        } else if (_type instanceof FArrayType) {
+            types.addAll(_type.elementType.referencedTypes)
+        } else if (_type instanceof FStructType) {
+            for (e : _type.allElements)
+                types.addAll(e.type.referencedTypes)
+        } else if (_type instanceof FUnionType) {
+            for (e : _type.allElements)
+                types.addAll(e.type.referencedTypes)
+        }
+        return types
+    }
+
+    def private Set<FType> getReferencedTypes(FTypeRef _typeRef) {
+        var Set<FType> types = new HashSet<FType>()
+        if (_typeRef.derived !== null)
+            types.add(_typeRef.derived)
+        return types
+    }
+
+    def private String getCppTypeName(FType _type) {
+        return (_type.eContainer as FTypeCollection).fullName + "::" + _type.elementName
+    }
+
+    def private PropertyAccessor getTypeAccessor(FType _type) {
+        return getSomeIpAccessor(_type.eContainer as FTypeCollection)
+    }
+
+    def private String viewName(FType _type) {
+        return _type.elementName + "View"
+    }
+
+    ///////////////////////////////////
+    // Viewable types                //
+    ///////////////////////////////////
+    def boolean isViewable(FType _type) {
+        if (viewable_.containsKey(_type))
+            return viewable_.get(_type)
+        // a type that refers to itself is not viewable
+        viewable_.put(_type, false)
+        val boolean viewable = _type.resolveViewable
+        viewable_.put(_type, viewable)
+        return viewable
+    }
+
+    def private boolean resolveViewable(FType _type) {
+        val PropertyAccessor accessor = _type.typeAccessor
+
+        if (_type instanceof FTypeDef)
+            return _type.actualType.isViewable(_type, accessor)
+        if (_type instanceof FEnumerationType)
+            return accessor.getSomeIpEnumBitWidthHelper(_type) === null
+        if (_type instanceof FArrayType)
+            return accessor.getSomeIpIntegerBitWidthHelper(_type) === null &&
+                   _type.elementType.isViewable(_type, accessor)
+        if (_type instanceof FStructType)
+            return !_type.isPolymorphicHierarchy &&
+                   _type.allElements.forall[isViewable(accessor.getOverwriteAccessor(it))]
+        if (_type instanceof FUnionType) {
+            val Integer lengthWidth = accessor.getSomeIpUnionLengthWidthHelper(_type) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            if (_type.base !== null || (lengthWidth == 0 && (accessor.getSomeIpUnionMaxLengthHelper(_type) ?: SOMEIP_DEFAULT_MAX_LENGTH) == 0))
+                return false
+            // the contained element is assigned by its C++ type
+            val Set<String> elementTypes = new HashSet<String>()
+            return _type.allElements.forall[elementTypes.add(getTypeName(_type, true)) &&
+                                            isViewable(accessor.getOverwriteAccessor(it))]
+        }
+        return false
+    }
+
+    // Elements of derived types use the view of the type, which follows the type-level deployment
+    def boolean isViewable(FTypedElement _element, PropertyAccessor _accessor) {
+        if (_accessor.getSomeIpIntegerBitWidthHelper(_element) !== null ||
+            _accessor.getSomeIpEnumBitWidthHelper(_element) !== null)
+            return false
+        if (_element.type.derived !== null && _accessor.isProperOverwrite &&
+            (_accessor.hasSomeIpStructLengthWidth(_element) ||
+             _accessor.hasSomeIpUnionLengthWidth(_element) ||
+             _accessor.hasSomeIpUnionTypeWidth(_element) ||
+             _accessor.hasSomeIpUnionDefaultOrder(_element) ||
+             _accessor.hasSomeIpUnionMaxLength(_element) ||
+             _accessor.hasSomeIpEnumWidth(_element) ||
+             _accessor.hasSomeIpEnumBitWidth(_element)))
+            return false
+        return _element.type.isViewable(_element, _accessor)
+    }
+
+    def private boolean isViewable(FTypeRef _typeRef, EObject _source, PropertyAccessor _accessor) {
+        if (_typeRef.derived !== null)
+            return _typeRef.derived.isViewable
+        if (_typeRef.interval !== null)
+            return true
+        if (_typeRef.predefined == FBasicTypeId.STRING)
+            return (_accessor.getSomeIpStringEncoding(_source) ?: SOMEIP_DEFAULT_STRING_ENCODING) == PropertyAccessor.SomeIpStringEncoding.utf8
+        return _typeRef.predefined == FBasicTypeId.BYTE_BUFFER || _typeRef.predefined.viewPrimitiveType !== null
+    }
+
+    def private boolean isPolymorphicHierarchy(FStructType _struct) {
+        var FStructType itsStruct = _struct
+        while (itsStruct !== null) {
+            if (itsStruct.polymorphic)
+                return true
+            itsStruct = itsStruct.base
+        }
+        return false
+    }
+
+    // Structs and unions, also behind typedefs
+    def boolean isViewClass(FTypedElement _element) {
+        if (_element.array)
+            return false
+        var FType itsType = _element.type.derived
+        while (itsType instanceof FTypeDef)
+            itsType = itsType.actualType.derived
+        return itsType instanceof FStructType || itsType instanceof FUnionType
+    }
+
+    ///////////////////////////////////
+    // Codecs                        //
+    ///////////////////////////////////
+    def String getViewCodec(FTypedElement _element, PropertyAccessor _accessor) {
+        if (_element.array)
+            return _element.type.getArrayViewCodec(_element, _accessor)
+        return _element.type.getViewCodec(_element, _accessor)
+    }
+
+    // The type that the codec of an element decodes to
+    def String getViewValueType(FTypedElement _element, PropertyAccessor _accessor) {
+        if (_element.array || _element.type.derived instanceof FStructType || _element.type.derived instanceof FUnionType
+            || _element.type.derived instanceof FTypeDef)
+            return _element.getViewCodec(_accessor) + "::Value"
+        if (_element.type.derived !== null || _element.type.interval !== null)
+            return _element.getTypeName(_element, true)
+        if (_element.type.predefined == FBasicTypeId.STRING)
+            return VIEW + "StringView"
+        if (_element.type.predefined == FBasicTypeId.BYTE_BUFFER)
+            return VIEW + "ByteBufferView"
+        return _element.type.predefined.viewPrimitiveType
+    }
+
+    def private String getViewCodec(FTypeRef _typeRef, EObject _source, PropertyAccessor _accessor) {
+        if (_typeRef.derived !== null)
+            return (_typeRef.derived.eContainer as FTypeCollection).fullName + "_::" + _typeRef.derived.viewName
+        if (_typeRef.interval !== null)
+            return VIEW + "Primitive< int32_t >"
+        val FBasicTypeId typeId = _typeRef.predefined
+        if (typeId == FBasicTypeId.STRING) {
+            val Integer lengthWidth = _accessor.getSomeIpStringLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            val Integer length = _accessor.getSomeIpStringLength(_source) ?: SOMEIP_DEFAULT_STRING_LENGTH
+            return VIEW + "String< " + lengthWidth + ", " + length + " >"
+        }
+        if (typeId == FBasicTypeId.BYTE_BUFFER) {
+            val Integer lengthWidth = _accessor.getSomeIpByteBufferLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            val Integer maxLength = _accessor.getSomeIpByteBufferMaxLength(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+            return VIEW + "ByteBuffer< " + lengthWidth + ", " + maxLength + " >"
+        }
+        return VIEW + "Primitive< " + typeId.viewPrimitiveType + " >"
+    }
+
+    def private String getArrayViewCodec(FTypeRef _elementType, EObject _source, PropertyAccessor _accessor) {
+        val Integer lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        val Integer maxLength = _accessor.getSomeIpArrayMaxLengthHelper(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+        return VIEW + "Array< " + _elementType.getViewCodec(_source, _accessor) + ", " + lengthWidth + ", " + maxLength + " >"
+    }
+
+    def private String getViewPrimitiveType(FBasicTypeId _typeId) {
+        switch (_typeId) {
+            case FBasicTypeId.BOOLEAN: "bool"
+            case FBasicTypeId.INT8: "int8_t"
+            case FBasicTypeId.UINT8: "uint8_t"
+            case FBasicTypeId.INT16: "int16_t"
+            case FBasicTypeId.UINT16: "uint16_t"
+            case FBasicTypeId.INT32: "int32_t"
+            case FBasicTypeId.UINT32: "uint32_t"
+            case FBasicTypeId.INT64: "int64_t"
+            case FBasicTypeId.UINT64: "uint64_t"
+            case FBasicTypeId.FLOAT: "float"
+            case FBasicTypeId.DOUBLE: "double"
+            default: null
+        }
+    }
+}
@@ -15,14 +15,15 @@ import org.eclipse.core.resources.IResource
 import org.eclipse.emf.ecore.resource.Resource
 import org.eclipse.xtext.generator.IFileSystemAccess
 import org.eclipse.xtext.generator.IGenerator
+import org.franca.core.franca.FInterface
 import org.franca.core.franca.FModel
-import org.franca.deploymodel.core.FDeployedInterface
-import org.franca.deploymodel.core.FDeployedTypeCollection
+import org.franca.core.franca.FTypeCollection
 import org.franca.deploymodel.dsl.fDeploy.FDInterface
 import org.franca.deploymodel.dsl.fDeploy.FDModel
 import org.franca.deploymodel.dsl.fDeploy.FDTypes
 import org.genivi.commonapi.core.generator.FDeployManager
 import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.DeploymentCache
 import org.genivi.commonapi.someip.deployment.PropertyAccessor
 import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
 import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
@@ -35,6 +36,14 @@ class FrancaSomeIPGenerator implements IGenerator {
     @Inject extension FInterfaceSomeIPStubAdapterGenerator
     @Inject extension FInterfaceSomeIPDeploymentGenerator
     @Inject private extension FInterfaceSomeIPJsonGenerator
+    @Inject private extension FTypeCollectionSomeIPSerializedSizeGenerator
+    @Inject private extension FTypeCollectionSomeIPBitPackingGenerator
+    @Inject private extension FTypeCollectionSomeIPBenchmarkGenerator
+    @Inject private extension FTypeCollectionSomeIPViewGenerator
+    @Inject private extension FInterfaceSomeIPMetricsGenerator
+    @Inject private extension SomeIPCaptureGenerator
+    @Inject private extension FInterfaceSomeIPLoadGeneratorGenerator
+    @Inject private extension FInterfaceSomeIPWireSizeGenerator
 
     @Inject FDeployManager fDeployManager
 
@@ -51,7 +60,9 @@ class FrancaSomeIPGenerator implements IGenerator {
         var List<FDExtensionRoot> deployedProviders = new LinkedList<FDExtensionRoot>()
         var IResource res = null
 
+        var long start = SomeIPGeneratorStatistics::start
         var rootModel = fDeployManager.loadModel(input.URI, input.URI);
+        SomeIPGeneratorStatistics::stop("load", start)
 
         generatedFiles_ = new HashSet<String>()
 
@@ -59,51 +70,65 @@ class FrancaSomeIPGenerator implements IGenerator {
             PreferenceConstantsSomeIP::P_GENERATE_DEPENDENCIES_SOMEIP, "true"
         ).equals("true")
 
-        // models holds the map of all models from imported .fidl files
-        var models = fDeployManager.fidlModels
-        // deployments holds the map of all models from imported .fdepl files
-        var deployments = fDeployManager.deploymentModels
+        // the deployed elements and their cached properties are created per run
+        DeploymentCache::resetCounters
+        isDeploymentCached_ = FPreferencesSomeIP::instance.getPreference(
+            PreferenceConstantsSomeIP::P_CACHE_DEPLOYMENT_SOMEIP, "true"
+        ).equals("true")
 
-        if (rootModel instanceof FDModel) {
-            deployments.put(input.URI.toString , rootModel)
-        } else {
-            System.err.println("CommonAPI-SomeIP requires a deployment model!")
-            return
-        }
+        // the models are cleared even if the generation fails
+        try {
+            // models holds the map of all models from imported .fidl files
+            var models = fDeployManager.fidlModels
+            // deployments holds the map of all models from imported .fdepl files
+            var deployments = fDeployManager.deploymentModels
+
+            if (rootModel instanceof FDModel) {
+                deployments.put(input.URI.toString , rootModel)
+            } else {
+                System.err.println("CommonAPI-SomeIP requires a deployment model!")
+                return
+            }
 
-        for (itsEntry : deployments.entrySet) {
-            val itsDeployment = itsEntry.value
+            start = SomeIPGeneratorStatistics::start
+            for (itsEntry : deployments.entrySet) {
+                val itsDeployment = itsEntry.value
 
-            // Get Core deployments
-            val itsCoreInterfaces = getFDInterfaces(itsDeployment, CORE_SPECIFICATION_TYPE)
-            val itsCoreTypeCollections = getFDTypesList(itsDeployment, CORE_SPECIFICATION_TYPE)
+                // Get Core deployments
+                val itsCoreInterfaces = getFDInterfaces(itsDeployment, CORE_SPECIFICATION_TYPE)
+                val itsCoreTypeCollections = getFDTypesList(itsDeployment, CORE_SPECIFICATION_TYPE)
 
-            // Get SOME/IP deployments
-            val itsSomeIPInterfaces = getFDInterfaces(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
-            val itsSomeIPTypeCollections = getFDTypesList(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
-            val itsSomeIPProviders = getFDProviders(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
+                // Get SOME/IP deployments
+                val itsSomeIPInterfaces = getFDInterfaces(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
+                val itsSomeIPTypeCollections = getFDTypesList(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
+                val itsSomeIPProviders = getFDProviders(itsDeployment, SOMEIP_SPECIFICATION_TYPE)
 
-            // Merge Core deployments for interfaces to their SOME/IP deployments
-            for (itsSomeIPDeployment : itsSomeIPInterfaces)
-                for (itsCoreDeployment : itsCoreInterfaces)
-                    mergeDeployments(itsCoreDeployment, itsSomeIPDeployment)
+                // Merge Core deployments for interfaces to their SOME/IP deployments
+                for (itsSomeIPDeployment : itsSomeIPInterfaces)
+                    for (itsCoreDeployment : itsCoreInterfaces)
+                        mergeDeployments(itsCoreDeployment, itsSomeIPDeployment)
 
-            // Merge Core deployments for type collections to their SOME/IP deployments
-            for (itsSomeIPDeployment : itsSomeIPTypeCollections)
-                for (itsCoreDeployment : itsCoreTypeCollections)
-                    mergeDeployments(itsCoreDeployment, itsSomeIPDeployment)
+                // Merge Core deployments for type collections to their SOME/IP deployments
+                for (itsSomeIPDeployment : itsSomeIPTypeCollections)
+                    for (itsCoreDeployment : itsCoreTypeCollections)
+                        mergeDeployments(itsCoreDeployment, itsSomeIPDeployment)
 
-            deployedInterfaces.addAll(itsSomeIPInterfaces)
-            deployedTypeCollections.addAll(itsSomeIPTypeCollections)
-            deployedProviders.addAll(itsSomeIPProviders)
-        }
+                deployedInterfaces.addAll(itsSomeIPInterfaces)
+                deployedTypeCollections.addAll(itsSomeIPTypeCollections)
+                deployedProviders.addAll(itsSomeIPProviders)
+            }
+            SomeIPGeneratorStatistics::stop("merge", start)
 
-        doGenerateDeployment(rootModel as FDModel, deployments, models,
-            deployedInterfaces, deployedTypeCollections, deployedProviders,
-            fileSystemAccess, res, true)
+            doGenerateDeployment(rootModel as FDModel, deployments, models,
+                deployedInterfaces, deployedTypeCollections, deployedProviders,
+                SomeIPGeneratorStatistics::countGeneratedFiles(fileSystemAccess), res, true)
 
-        fDeployManager.clearFidlModels
-        fDeployManager.clearDeploymentModels
+            SomeIPGeneratorStatistics::count("deploymentCacheHits", DeploymentCache::hits)
+            SomeIPGeneratorStatistics::count("deploymentCacheMisses", DeploymentCache::misses)
+        } finally {
+            fDeployManager.clearFidlModels
+            fDeployManager.clearDeploymentModels
+        }
     }
 
     def private void doGenerateDeployment(FDModel _deployment,
@@ -126,6 +151,7 @@ class FrancaSomeIPGenerator implements IGenerator {
         var String basePath = deploymentName.substring(
             0, lastIndex)
 
+        val long start = SomeIPGeneratorStatistics::start
         var Set<String> itsImports = new HashSet<String>()
         for (anImport : _deployment.imports) {
             val String cannonical = basePath.getCanonical(anImport.importURI)
@@ -137,6 +163,7 @@ class FrancaSomeIPGenerator implements IGenerator {
                 doInsertAccessors(itsEntry.value, _interfaces, _typeCollections)
             }
         }
+        SomeIPGeneratorStatistics::stop("imports", start)
 
         for (itsEntry : _deployments.entrySet) {
             if (itsImports.contains(itsEntry.key)) {
@@ -198,7 +225,7 @@ class FrancaSomeIPGenerator implements IGenerator {
         _typeCollections.forEach [
             val currentTypeCollection = it
             val PropertyAccessor typeCollectionDeploymentAccessor = new PropertyAccessor(
-                new FDeployedTypeCollection(it))
+                DeploymentCache::createDeployedTypeCollection(it, isDeploymentCached_))
             insertAccessor(currentTypeCollection.target, typeCollectionDeploymentAccessor)
         ]
 
@@ -213,7 +240,7 @@ class FrancaSomeIPGenerator implements IGenerator {
         _interfaces.forEach [
             val currentInterface = it
             val PropertyAccessor interfaceDeploymentAccessor = new PropertyAccessor(
-                new FDeployedInterface(it))
+                DeploymentCache::createDeployedInterface(it, isDeploymentCached_))
             insertAccessor(currentInterface.target, interfaceDeploymentAccessor)
         ]
 
@@ -235,45 +262,87 @@ class FrancaSomeIPGenerator implements IGenerator {
         var interfacesToGenerate = _model.interfaces.toSet
 
         typeCollectionsToGenerate.forEach [
-            it.generateTypeCollectionDeployment(fileSystemAccess, getSomeIpAccessor(it), res)
+            countElements(it)
+            timed("template.typeCollectionDeployment") [| it.generateTypeCollectionDeployment(fileSystemAccess, getSomeIpAccessor(it), res) ]
+            timed("template.serializedSize") [| it.generateSerializedSize(fileSystemAccess, getSomeIpAccessor(it), res) ]
+            timed("template.bitPacking") [| it.generateBitPacking(fileSystemAccess, getSomeIpAccessor(it), res) ]
+            timed("template.benchmark") [| it.generateBenchmark(fileSystemAccess, getSomeIpAccessor(it), res) ]
+            timed("template.views") [| it.generateViews(fileSystemAccess, getSomeIpAccessor(it), res) ]
         ]
 
         interfacesToGenerate.forEach [
-            var PropertyAccessor interfaceAccessor = getSomeIpAccessor(it)
+            countElements(it)
+            val PropertyAccessor interfaceAccessor = getSomeIpAccessor(it)
             if (FPreferencesSomeIP::instance.getPreference(PreferenceConstantsSomeIP::P_GENERATEPROXY_SOMEIP, "true").
                 equals("true")) {
-                it.generateProxy(fileSystemAccess, interfaceAccessor, _providers, res)
+                timed("template.proxy") [| it.generateProxy(fileSystemAccess, interfaceAccessor, _providers, res) ]
             }
             if (FPreferencesSomeIP::instance.getPreference(PreferenceConstantsSomeIP::P_GENERATESTUB_SOMEIP, "true").
                 equals("true")) {
-                it.generateStubAdapter(fileSystemAccess, interfaceAccessor, _providers, res)
-                it.generateJSONStubAdapter(fileSystemAccess, interfaceAccessor, _providers)
+                timed("template.stubAdapter") [| it.generateStubAdapter(fileSystemAccess, interfaceAccessor, _providers, res) ]
+                timed("template.json") [| it.generateJSONStubAdapter(fileSystemAccess, interfaceAccessor, _providers) ]
             }
             if (FPreferencesSomeIP::instance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_COMMON_SOMEIP, "true").
                 equals("true")) {
-                it.generateDeployment(fileSystemAccess, interfaceAccessor, res)
+                timed("template.deployment") [| it.generateDeployment(fileSystemAccess, interfaceAccessor, res) ]
             }
+            timed("template.serializedSize") [| it.generateSerializedSize(fileSystemAccess, interfaceAccessor, res) ]
+            timed("template.bitPacking") [| it.generateBitPacking(fileSystemAccess, interfaceAccessor, res) ]
+            timed("template.benchmark") [| it.generateBenchmark(fileSystemAccess, interfaceAccessor, res) ]
+            timed("template.views") [| it.generateViews(fileSystemAccess, interfaceAccessor, res) ]
+            timed("template.metrics") [| it.generateMetrics(fileSystemAccess, interfaceAccessor, res) ]
+            timed("template.loadGenerator") [| it.generateLoadGenerator(fileSystemAccess, interfaceAccessor, _providers, res) ]
+            timed("template.wireSize") [| it.generateWireSize(fileSystemAccess, interfaceAccessor, res) ]
             it.managedInterfaces.forEach [
                 val currentManagedInterface = it
-                var PropertyAccessor managedDeploymentAccessor
-                if (_interfaces.exists[it.target == currentManagedInterface]) {
-                    managedDeploymentAccessor = new PropertyAccessor(
-                        new FDeployedInterface(_interfaces.filter[it.target == currentManagedInterface].last))
-                } else {
-                    managedDeploymentAccessor = new PropertyAccessor()
-                }
+                val PropertyAccessor managedDeploymentAccessor =
+                    if (_interfaces.exists[it.target == currentManagedInterface]) {
+                        new PropertyAccessor(
+                            DeploymentCache::createDeployedInterface(
+                                _interfaces.filter[it.target == currentManagedInterface].last, isDeploymentCached_))
+                    } else {
+                        new PropertyAccessor()
+                    }
                 if (FPreferencesSomeIP::instance.getPreference(PreferenceConstantsSomeIP::P_GENERATEPROXY_SOMEIP, "true").
                     equals("true")) {
-                    it.generateProxy(fileSystemAccess, managedDeploymentAccessor, _providers, res)
+                    timed("template.proxy") [| it.generateProxy(fileSystemAccess, managedDeploymentAccessor, _providers, res) ]
                 }
                 if (FPreferencesSomeIP::instance.getPreference(PreferenceConstantsSomeIP::P_GENERATESTUB_SOMEIP, "true").
                     equals("true")) {
-                    it.generateStubAdapter(fileSystemAccess, managedDeploymentAccessor, _providers, res)
+                    timed("template.stubAdapter") [| it.generateStubAdapter(fileSystemAccess, managedDeploymentAccessor, _providers, res) ]
                 }
+                timed("template.metrics") [| it.generateMetrics(fileSystemAccess, managedDeploymentAccessor, res) ]
             ]
         ]
+
+        if (!interfacesToGenerate.empty) {
+            timed("template.capture") [| generateCapture(fileSystemAccess) ]
+        }
+    }
+
+    // Adds the run time of _body to a phase of the generator statistics
+    def private void timed(String _phase, ()=>void _body) {
+        val long start = SomeIPGeneratorStatistics::start
+        _body.apply
+        SomeIPGeneratorStatistics::stop(_phase, start)
+    }
+
+    def private void countElements(FTypeCollection _tc) {
+        if (!SomeIPGeneratorStatistics::isEnabled)
+            return
+        SomeIPGeneratorStatistics::count("types", _tc.types.size)
+        SomeIPGeneratorStatistics::count("constants", _tc.constants.size)
+        if (_tc instanceof FInterface) {
+            SomeIPGeneratorStatistics::count("interfaces", 1)
+            SomeIPGeneratorStatistics::count("attributes", _tc.attributes.size)
+            SomeIPGeneratorStatistics::count("methods", _tc.methods.size)
+            SomeIPGeneratorStatistics::count("broadcasts", _tc.broadcasts.size)
+        } else {
+            SomeIPGeneratorStatistics::count("typeCollections", 1)
+        }
     }
 
     var boolean withDependencies_;
+    var boolean isDeploymentCached_;
     var Set<String> generatedFiles_;
 }
@@ -6,7 +6,9 @@ package org.genivi.commonapi.someip.generator
 
 import java.util.ArrayList
 import java.util.HashSet
+import java.util.LinkedHashMap
 import java.util.List
+import java.util.Map
 import java.util.Set
 import javax.inject.Inject
 import org.eclipse.emf.common.util.EList
@@ -114,6 +116,145 @@ class FrancaSomeIPGeneratorExtensions {
         return _tc.versionPathPrefix + _tc.model.directoryPath + '/' + _tc.someipDeploymentSourceFile
     }
 
+    def String someipSerializedSizeHeaderFile(FTypeCollection _tc) {
+        return _tc.elementName + "SomeIPSerializedSize.hpp"
+    }
+
+    def String someipSerializedSizeHeaderPath(FTypeCollection _tc) {
+        return _tc.versionPathPrefix + _tc.model.directoryPath + '/' + _tc.someipSerializedSizeHeaderFile
+    }
+
+    def String someipViewsHeaderFile(FTypeCollection _tc) {
+        return _tc.elementName + "SomeIPViews.hpp"
+    }
+
+    def String someipViewsHeaderPath(FTypeCollection _tc) {
+        return _tc.versionPathPrefix + _tc.model.directoryPath + '/' + _tc.someipViewsHeaderFile
+    }
+
+    def String someipBitPackingHeaderFile(FTypeCollection _tc) {
+        return _tc.elementName + "SomeIPBitPacking.hpp"
+    }
+
+    def String someipBitPackingHeaderPath(FTypeCollection _tc) {
+        return _tc.versionPathPrefix + _tc.model.directoryPath + '/' + _tc.someipBitPackingHeaderFile
+    }
+
+    def String someipPackedArrayHeaderPath() {
+        return "SomeIPPackedArray.hpp"
+    }
+
+    def String someipBenchmarkSourceFile(FTypeCollection _tc) {
+        return _tc.elementName + "SomeIPBenchmark.cpp"
+    }
+
+    def String someipBenchmarkSourcePath(FTypeCollection _tc) {
+        return _tc.versionPathPrefix + _tc.model.directoryPath + '/' + _tc.someipBenchmarkSourceFile
+    }
+
+    def String someipMetricsHeaderFile(FInterface fInterface) {
+        return fInterface.elementName + "SomeIPMetrics.hpp"
+    }
+
+    def String someipMetricsHeaderPath(FInterface fInterface) {
+        return fInterface.versionPathPrefix + fInterface.model.directoryPath + '/' + fInterface.someipMetricsHeaderFile
+    }
+
+    def String someipMetricsClassName(FInterface fInterface) {
+        return fInterface.elementName + 'SomeIPMetrics'
+    }
+
+    def String someipLoadGeneratorSourceFile(FInterface fInterface) {
+        return fInterface.elementName + "SomeIPLoadGenerator.cpp"
+    }
+
+    def String someipLoadGeneratorSourcePath(FInterface fInterface) {
+        return fInterface.versionPathPrefix + fInterface.model.directoryPath + '/' + fInterface.someipLoadGeneratorSourceFile
+    }
+
+    def String someipCaptureHeaderPath() {
+        return "SomeIPCapture.hpp"
+    }
+
+    def String someipExecutionHeaderPath() {
+        return "SomeIPExecution.hpp"
+    }
+
+    def String someipDeltaHeaderPath() {
+        return "SomeIPDelta.hpp"
+    }
+
+    def String someipCompressionHeaderPath() {
+        return "SomeIPCompression.hpp"
+    }
+
+    def String someipUtf16HeaderPath() {
+        return "SomeIPUtf16.hpp"
+    }
+
+    def String someipBatchHeaderPath() {
+        return "SomeIPBatch.hpp"
+    }
+
+    def String someipSharedMemoryHeaderPath() {
+        return "SomeIPSharedMemory.hpp"
+    }
+
+    def String someipViewHeaderPath() {
+        return "SomeIPView.hpp"
+    }
+
+    def String someipBulkHeaderPath() {
+        return "SomeIPBulk.hpp"
+    }
+
+    def String someipCoalescingHeaderPath() {
+        return "SomeIPCoalescing.hpp"
+    }
+
+    def String someipDeadlineHeaderPath() {
+        return "SomeIPDeadline.hpp"
+    }
+
+    def String someipBackpressureHeaderPath() {
+        return "SomeIPBackpressure.hpp"
+    }
+
+    def String someipPolymorphHeaderPath() {
+        return "SomeIPPolymorph.hpp"
+    }
+
+    // Major version of an interface as used in the SOME/IP header
+    def int getSomeIpMajorVersion(FInterface _interface) {
+        if (_interface.version !== null)
+            return _interface.version.major
+        return 0
+    }
+
+    // Method IDs of the interface and their names. Attribute getters and setters are
+    // dispatched by the stub adapter, but called by the runtime attributes on the proxy side.
+    def Map<Integer, String> getSomeIpMethodNames(FInterface _interface, PropertyAccessor _accessor, boolean _proxy) {
+        val Map<Integer, String> methods = new LinkedHashMap<Integer, String>()
+        for (method : _interface.methods) {
+            val Integer id = _accessor.getSomeIpMethodID(method)
+            if (id !== null && !methods.containsKey(id))
+                methods.put(id, method.elementName)
+        }
+        if (!_proxy) {
+            for (attribute : _interface.attributes) {
+                val Integer getter = _accessor.getSomeIpGetterID(attribute)
+                if (getter !== null && getter != 0 && !methods.containsKey(getter))
+                    methods.put(getter, "get" + attribute.elementName.toFirstUpper)
+                if (!attribute.readonly) {
+                    val Integer setter = _accessor.getSomeIpSetterID(attribute)
+                    if (setter !== null && !methods.containsKey(setter))
+                        methods.put(setter, "set" + attribute.elementName.toFirstUpper)
+                }
+            }
+        }
+        return methods
+    }
+
     def String someipProxyHeaderFile(FInterface fInterface) {
         return fInterface.elementName + "SomeIPProxy.hpp"
     }
@@ -237,6 +378,467 @@ class FrancaSomeIPGeneratorExtensions {
 
     }
 
+    // Attributes with SomeIpGetterCoalescing share one getter request between concurrent asynchronous calls
+    def boolean isCoalescedGetter(FAttribute _attribute, PropertyAccessor _accessor) {
+        return Boolean.TRUE.equals(_accessor.getSomeIpGetterCoalescing(_attribute))
+    }
+
+    def boolean hasCoalescedGetters(FInterface _interface, PropertyAccessor _accessor) {
+        return !_interface.attributes.filter[isCoalescedGetter(_accessor)].empty
+    }
+
+    // Methods with SomeIpMethodMaxInFlight limit the calls that are dispatched and queued at the same time
+    def boolean isLimitedMethod(FMethod _method, PropertyAccessor _accessor) {
+        val Integer maxInFlight = _accessor.getSomeIpMethodMaxInFlight(_method)
+        return maxInFlight !== null && maxInFlight > 0
+    }
+
+    def int getMaxInFlight(FMethod _method, PropertyAccessor _accessor) {
+        return _accessor.getSomeIpMethodMaxInFlight(_method)
+    }
+
+    def int getQueueDepth(FMethod _method, PropertyAccessor _accessor) {
+        val Integer queueDepth = _accessor.getSomeIpMethodQueueDepth(_method)
+        if (queueDepth === null || queueDepth < 0)
+            return 0
+        return queueDepth
+    }
+
+    def boolean hasLimitedMethods(FInterface _interface, PropertyAccessor _accessor) {
+        return _interface.methods.exists[isLimitedMethod(_accessor)]
+    }
+
+    // Observable array and map attributes with SomeIpNotifierDeltaID and SomeIpNotifierDeltaResyncID
+    // send their changes on the delta event
+    def boolean isDeltaAttribute(FAttribute _attribute, PropertyAccessor _accessor) {
+        return _attribute.isObservable && _accessor.getSomeIpNotifierDeltaID(_attribute) !== null &&
+            _accessor.getSomeIpNotifierDeltaResyncID(_attribute) !== null &&
+            (_attribute.isDeltaMap || _attribute.array || _attribute.type.derived instanceof FArrayType)
+    }
+
+    def boolean isDeltaMap(FAttribute _attribute) {
+        return !_attribute.array && _attribute.type.derived instanceof FMapType
+    }
+
+    def String getDeltaIdentifier(FAttribute _attribute, PropertyAccessor _accessor) {
+        return "CommonAPI::SomeIP::event_id_t(0x" + _accessor.getSomeIpNotifierDeltaID(_attribute).toHexString + ")"
+    }
+
+    def String getDeltaResyncIdentifier(FAttribute _attribute, PropertyAccessor _accessor) {
+        return "CommonAPI::SomeIP::method_id_t(0x" + _accessor.getSomeIpNotifierDeltaResyncID(_attribute).toHexString + ")"
+    }
+
+    def boolean hasDeltaAttributes(FInterface _interface, PropertyAccessor _accessor) {
+        return !_interface.attributes.filter[isDeltaAttribute(_accessor)].empty
+    }
+
+    // Arguments of the delta event: sequence number, keyframe flag and the changes, which
+    // are (upserts, removed keys) for maps and (length, indexes, values) for arrays
+    def List<String> getDeltaTypes(FAttribute _attribute, FInterface _interface) {
+        val String typeName = _attribute.getTypeName(_interface, true)
+        if (_attribute.isDeltaMap)
+            return #["uint32_t", "bool", typeName, "std::vector< " + typeName + "::key_type >"]
+        return #["uint32_t", "bool", "uint32_t", "std::vector< uint32_t >", typeName]
+    }
+
+    // The changes are serialized with the deployment of the attribute without its minimum
+    // length, as they may be shorter than the value (see Delta::getChangesDeployment)
+    def List<String> getDeltaDeploymentTypes(FAttribute _attribute, FInterface _interface) {
+        if (_attribute.isDeltaMap) {
+            val String keyDeployment = _attribute.getDeltaKeyDeploymentType(_interface)
+            return #["CommonAPI::SomeIP::IntegerDeployment<uint32_t>", "CommonAPI::EmptyDeployment",
+                _attribute.getDeploymentType(_interface, true), "CommonAPI::SomeIP::ArrayDeployment< " + keyDeployment + " >"]
+        }
+        return #["CommonAPI::SomeIP::IntegerDeployment<uint32_t>", "CommonAPI::EmptyDeployment",
+            "CommonAPI::SomeIP::IntegerDeployment<uint32_t>",
+            "CommonAPI::SomeIP::ArrayDeployment< CommonAPI::SomeIP::IntegerDeployment<uint32_t> >",
+            _attribute.getDeploymentType(_interface, true)]
+    }
+
+    // Deployments of the arguments of the delta event, given the names of the deployments
+    // of the changes and of the removed keys
+    def List<String> getDeltaDeploymentRefs(FAttribute _attribute, String _changes, String _keys) {
+        if (_attribute.isDeltaMap)
+            return #["nullptr", "nullptr", _changes + ".get()", _keys + ".get()"]
+        return #["nullptr", "nullptr", "nullptr", "nullptr", _changes + ".get()"]
+    }
+
+    // The deployment of the keys of a map attribute
+    def String getDeltaKeyDeploymentType(FAttribute _attribute, FInterface _interface) {
+        return (_attribute.type.derived as FMapType).keyType.getDeploymentType(_interface, true)
+    }
+
+    def List<String> getDeltaDeployables(FAttribute _attribute, FInterface _interface) {
+        val List<String> types = _attribute.getDeltaTypes(_interface)
+        val List<String> deployments = _attribute.getDeltaDeploymentTypes(_interface)
+        val List<String> deployables = new ArrayList<String>()
+        for (i : 0 ..< types.size) {
+            deployables.add("CommonAPI::Deployable< " + types.get(i) + ", " + deployments.get(i) + " >")
+        }
+        return deployables
+    }
+
+    // Event groups of SomeIpBatchEventGroups that have an event ID in SomeIpBatchEventIDs
+    // and at least one attribute
+    def List<Integer> getBatchEventGroups(FInterface _interface, PropertyAccessor _accessor) {
+        val List<Integer> groups = new ArrayList<Integer>()
+        val List<Integer> itsGroups = _accessor.getSomeIpBatchEventGroups(_interface)
+        val List<Integer> itsIdentifiers = _accessor.getSomeIpBatchEventIDs(_interface)
+        if (itsGroups !== null && itsIdentifiers !== null) {
+            for (i : 0 ..< Math.min(itsGroups.size, itsIdentifiers.size)) {
+                if (!_interface.getBatchAttributes(itsGroups.get(i), _accessor).empty)
+                    groups.add(itsGroups.get(i))
+            }
+        }
+        return groups
+    }
+
+    def boolean hasBatchEventGroups(FInterface _interface, PropertyAccessor _accessor) {
+        return !_interface.getBatchEventGroups(_accessor).empty
+    }
+
+    def Integer getBatchEventID(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        val List<Integer> itsGroups = _accessor.getSomeIpBatchEventGroups(_interface)
+        return _accessor.getSomeIpBatchEventIDs(_interface).get(itsGroups.indexOf(_group))
+    }
+
+    def String getBatchIdentifier(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return "CommonAPI::SomeIP::event_id_t(0x" + _interface.getBatchEventID(_group, _accessor).toHexString + ")"
+    }
+
+    def String getBatchEventGroup(Integer _group) {
+        return "CommonAPI::SomeIP::eventgroup_id_t(0x" + _group.toHexString + ")"
+    }
+
+    // Observable attributes whose only event group is the batch event group. Their
+    // position in the list identifies them in the batch event.
+    def List<FAttribute> getBatchAttributes(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return _interface.attributes.filter[
+            isObservable && !isDeltaAttribute(_accessor) && _accessor.getSomeIpEventGroups(it) == #[_group]
+        ].toList
+    }
+
+    // Batch event group of the attribute, null if it is notified on its own
+    def Integer getBatchEventGroup(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
+        for (group : _interface.getBatchEventGroups(_accessor)) {
+            if (_interface.getBatchAttributes(group, _accessor).contains(_attribute))
+                return group
+        }
+        return null
+    }
+
+    def boolean isBatchAttribute(FAttribute _attribute, FInterface _interface, PropertyAccessor _accessor) {
+        return _attribute.getBatchEventGroup(_interface, _accessor) !== null
+    }
+
+    def String getBatchName(Integer _group) {
+        return "EventGroup" + _group + "Batch"
+    }
+
+    // Arguments of the batch event: a slot for each attribute of the event group that
+    // contains its value if it is changed or present
+    def List<String> getBatchTypes(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return _interface.getBatchAttributes(_group, _accessor).map[
+            "CommonAPI::SomeIP::Batch::Slot< " + getTypeName(_interface, true) + " >"
+        ].toList
+    }
+
+    def List<String> getBatchDeployables(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return _interface.getBatchAttributes(_group, _accessor).map[
+            "CommonAPI::Deployable< CommonAPI::SomeIP::Batch::Slot< " + getTypeName(_interface, true) + " >, " +
+                getDeploymentType(_interface, true) + " >"
+        ].toList
+    }
+
+    def List<String> getBatchDeploymentRefs(FInterface _interface, Integer _group, PropertyAccessor _accessor) {
+        return _interface.getBatchAttributes(_group, _accessor).map[
+            getDeploymentRef(array, null, _interface, _accessor.getOverwriteAccessor(it))
+        ].toList
+    }
+
+    // String and ByteBuffer attributes and arguments with SomeIpAttrCompressionThreshold or
+    // SomeIpArgCompressionThreshold are sent compressed if they are not shorter than the threshold
+    def Integer getCompressionThreshold(FTypedElement _element) {
+        if (_element.array || !_element.type.isStringOrByteBuffer)
+            return null
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (itsAccessor === null)
+            return null
+        if (_element instanceof FAttribute)
+            return itsAccessor.getSomeIpAttrCompressionThreshold(_element)
+        if (_element instanceof FArgument)
+            return itsAccessor.getSomeIpArgCompressionThreshold(_element)
+        return null
+    }
+
+    // String and ByteBuffer attributes and broadcast arguments with SomeIpAttrSharedMemoryThreshold
+    // or SomeIpArgSharedMemoryThreshold are passed in shared memory to local subscribers if they
+    // are not shorter than the threshold. The shared memory takes precedence over a compression
+    // threshold.
+    def Integer getSharedMemoryThreshold(FTypedElement _element) {
+        if (_element.array || !_element.type.isStringOrByteBuffer)
+            return null
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (itsAccessor === null)
+            return null
+        if (_element instanceof FAttribute)
+            return itsAccessor.getSomeIpAttrSharedMemoryThreshold(_element)
+        if (_element instanceof FArgument && _element.eContainer instanceof FBroadcast)
+            return itsAccessor.getSomeIpArgSharedMemoryThreshold(_element as FArgument)
+        return null
+    }
+
+    // With UTF-16 strings (-ut) String attributes and arguments with SomeIpStringEncoding utf16le
+    // or utf16be are transcoded by the generated code. A shared memory or compression threshold
+    // takes precedence.
+    def boolean isUtf16String(FTypedElement _element) {
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_UTF16_STRINGS_SOMEIP, "false").equals("true"))
+            return false
+        if (_element.array || !_element.type.isString)
+            return false
+        if (!(_element instanceof FAttribute) && !(_element instanceof FArgument))
+            return false
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (itsAccessor === null)
+            return false
+        if (_element.sharedMemoryThreshold !== null || _element.compressionThreshold !== null)
+            return false
+        val PropertyAccessor.SomeIpStringEncoding itsEncoding = itsAccessor.getSomeIpStringEncoding(_element)
+        return itsEncoding == PropertyAccessor.SomeIpStringEncoding.utf16le ||
+            itsEncoding == PropertyAccessor.SomeIpStringEncoding.utf16be
+    }
+
+    // Bit width of an array of integers if it is smaller than the natural width of the element type
+    def Integer getPackedBitWidth(FArrayType _array, PropertyAccessor _accessor) {
+        if (_array.elementType.derived !== null || _array.elementType.interval !== null)
+            return null
+        val FBasicTypeId typeId = _array.elementType.predefined
+        var int naturalWidth
+        switch (typeId) {
+            case FBasicTypeId.INT8,
+            case FBasicTypeId.UINT8: naturalWidth = 8
+            case FBasicTypeId.INT16,
+            case FBasicTypeId.UINT16: naturalWidth = 16
+            case FBasicTypeId.INT32,
+            case FBasicTypeId.UINT32: naturalWidth = 32
+            case FBasicTypeId.INT64,
+            case FBasicTypeId.UINT64: naturalWidth = 64
+            default: return null
+        }
+        val Integer bitWidth = _accessor.getSomeIpIntegerBitWidthHelper(_array)
+        if (bitWidth === null || bitWidth <= 0 || bitWidth >= naturalWidth)
+            return null
+        return bitWidth
+    }
+
+    // With bit packing (-bp) the array types with a packed bit width are serialized by the
+    // stream operators of SomeIPPackedArray.hpp, selected by the deployment type
+    def boolean isPackedArray(FArrayType _array, PropertyAccessor _accessor) {
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_BIT_PACKING_SOMEIP, "false").equals("true"))
+            return false
+        return _array.getPackedBitWidth(_accessor) !== null
+    }
+
+    // With bulk arrays (-ba) arrays of integers and floating point values are serialized as
+    // one block that is copied or byte swapped as a whole. This applies to arrays of attributes
+    // and arguments that do not use the type deployment of an array type and have no integer
+    // bit width.
+    def boolean isBulkArray(FTypedElement _element) {
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_BULK_ARRAYS_SOMEIP, "false").equals("true"))
+            return false
+        if (!(_element instanceof FAttribute) && !(_element instanceof FArgument))
+            return false
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (itsAccessor === null)
+            return false
+        val PropertyAccessor itsOverwriteAccessor = itsAccessor.getOverwriteAccessor(_element)
+        var FBasicTypeId itsElementType = null
+        if (_element.array) {
+            if (_element.type.derived === null && _element.type.interval === null)
+                itsElementType = _element.type.predefined
+        }
+        else if (_element.type.derived instanceof FArrayType) {
+            val FArrayType itsArray = _element.type.derived as FArrayType
+            if (!itsOverwriteAccessor.hasSpecificDeployment(_element) && itsOverwriteAccessor.hasDeployment(itsArray))
+                return false
+            if (itsArray.elementType.derived === null && itsArray.elementType.interval === null &&
+                getSpecificAccessor(itsArray)?.getSomeIpIntegerBitWidthHelper(itsArray) === null)
+                itsElementType = itsArray.elementType.predefined
+        }
+        if (itsElementType === null || itsElementType.bulkSize == 0)
+            return false
+        val Integer itsBitWidth = itsOverwriteAccessor.getSomeIpIntegerBitWidthHelper(_element)
+        return (itsBitWidth === null || itsBitWidth == 8 * itsElementType.bulkSize)
+    }
+
+    def private int getBulkSize(FBasicTypeId _type) {
+        switch (_type) {
+            case FBasicTypeId.INT8,
+            case FBasicTypeId.UINT8: return 1
+            case FBasicTypeId.INT16,
+            case FBasicTypeId.UINT16: return 2
+            case FBasicTypeId.INT32,
+            case FBasicTypeId.UINT32,
+            case FBasicTypeId.FLOAT: return 4
+            case FBasicTypeId.INT64,
+            case FBasicTypeId.UINT64,
+            case FBasicTypeId.DOUBLE: return 8
+            default: return 0
+        }
+    }
+
+    // The byte order of a bulk array is the one of its attribute, method or broadcast
+    def private String getBulkLittleEndian(FTypedElement _element) {
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (_element instanceof FAttribute)
+            return itsAccessor.getSomeIpEndianess(_element)
+        val container = _element.eContainer
+        if (container instanceof FMethod)
+            return itsAccessor.getSomeIpEndianess(container)
+        if (container instanceof FBroadcast)
+            return itsAccessor.getSomeIpEndianess(container)
+        return "false"
+    }
+
+    def boolean hasBulkElements(FInterface _interface) {
+        return !_interface.attributes.filter[isBulkArray].empty ||
+            !_interface.methods.filter[(inArgs + outArgs).exists[isBulkArray]].empty ||
+            !_interface.broadcasts.filter[outArgs.exists[isBulkArray]].empty
+    }
+
+    // With generator option -pp, arrays of polymorphic structs of attributes and arguments
+    // are decoded through the type table of their hierarchy into pooled blocks. This
+    // does not apply to arrays that use the type deployment of an array type.
+    def boolean isPooledPolymorphicArray(FTypedElement _element) {
+        return _element.pooledPolymorphicType !== null
+    }
+
+    // Element type of an array of polymorphic structs
+    def private FStructType getPooledPolymorphicType(FTypedElement _element) {
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_POOLED_POLYMORPH_SOMEIP, "false").equals("true"))
+            return null
+        if (!(_element instanceof FAttribute) && !(_element instanceof FArgument))
+            return null
+        val PropertyAccessor itsAccessor = _element.interfaceAccessor
+        if (itsAccessor === null)
+            return null
+        var FTypeRef itsElementType = null
+        if (_element.array) {
+            itsElementType = _element.type
+        }
+        else if (_element.type.derived instanceof FArrayType) {
+            val FArrayType itsArray = _element.type.derived as FArrayType
+            val PropertyAccessor itsOverwriteAccessor = itsAccessor.getOverwriteAccessor(_element)
+            if (!itsOverwriteAccessor.hasSpecificDeployment(_element) && itsOverwriteAccessor.hasDeployment(itsArray))
+                return null
+            itsElementType = itsArray.elementType
+        }
+        if (itsElementType === null || !(itsElementType.derived instanceof FStructType))
+            return null
+        var FStructType itsStruct = itsElementType.derived as FStructType
+        while (itsStruct !== null) {
+            if (itsStruct.polymorphic)
+                return itsElementType.derived as FStructType
+            itsStruct = itsStruct.base
+        }
+        return null
+    }
+
+    // The element type and the types derived from it that are declared in its type
+    // collection or in the interface of the element. Other types are created by the
+    // generic factory of the hierarchy.
+    def private List<FStructType> getPooledPolymorphicTypes(FTypedElement _element) {
+        val FStructType itsType = _element.pooledPolymorphicType
+        val List<FStructType> itsTypes = new ArrayList<FStructType>()
+        itsTypes.add(itsType)
+        val List<FType> itsCandidates = new ArrayList<FType>((itsType.eContainer as FTypeCollection).types)
+        var container = _element.eContainer
+        while (container !== null && !(container instanceof FInterface))
+            container = container.eContainer
+        if (container !== null && container != itsType.eContainer)
+            itsCandidates.addAll((container as FInterface).types)
+        for (candidate : itsCandidates.filter(FStructType)) {
+            var FStructType itsBase = candidate.base
+            while (itsBase !== null && itsBase != itsType)
+                itsBase = itsBase.base
+            if (itsBase !== null)
+                itsTypes.add(candidate)
+        }
+        return itsTypes
+    }
+
+    // Lower bound of the serialized size of an element: the serial and the fields of the
+    // element type that are integers, floating point values or booleans without bit width
+    def private int getPooledPolymorphicMinSize(FStructType _type) {
+        var int itsSize = 4
+        var FStructType itsStruct = _type
+        while (itsStruct !== null) {
+            val PropertyAccessor itsAccessor = getSomeIpAccessor(itsStruct.eContainer as FTypeCollection)
+            for (e : itsStruct.elements) {
+                if (!e.array && e.type.derived === null && e.type.interval === null &&
+                    itsAccessor.getOverwriteAccessor(e).getSomeIpIntegerBitWidthHelper(e) === null) {
+                    if (e.type.predefined == FBasicTypeId.BOOLEAN)
+                        itsSize = itsSize + 1
+                    else
+                        itsSize = itsSize + e.type.predefined.bulkSize
+                }
+            }
+            itsStruct = itsStruct.base
+        }
+        return itsSize
+    }
+
+    def private String getPooledPolymorphicDeploymentType(FTypedElement _element, String _arrayType) {
+        return "CommonAPI::SomeIP::Polymorph::Deployment< " + _arrayType + ", " + _element.pooledPolymorphicType.pooledPolymorphicMinSize +
+            ", " + _element.pooledPolymorphicTypes.map[(eContainer as FTypeCollection).getFullName + "::" + elementName].join(", ") +
+            " >"
+    }
+
+    def boolean hasPooledPolymorphicElements(FInterface _interface) {
+        return !_interface.attributes.filter[isPooledPolymorphicArray].empty ||
+            !_interface.methods.filter[(inArgs + outArgs).exists[isPooledPolymorphicArray]].empty ||
+            !_interface.broadcasts.filter[outArgs.exists[isPooledPolymorphicArray]].empty
+    }
+
+    def private PropertyAccessor getInterfaceAccessor(FTypedElement _element) {
+        var container = _element.eContainer
+        while (container !== null && !(container instanceof FInterface))
+            container = container.eContainer
+        if (container === null)
+            return null
+        return getAccessor(container as FInterface) as PropertyAccessor
+    }
+
+    def private boolean isStringOrByteBuffer(FTypeRef _typeRef) {
+        if (_typeRef.derived instanceof FTypeDef)
+            return (_typeRef.derived as FTypeDef).actualType.isStringOrByteBuffer
+        return _typeRef.derived === null && _typeRef.interval === null &&
+            (_typeRef.predefined == FBasicTypeId.STRING || _typeRef.predefined == FBasicTypeId.BYTE_BUFFER)
+    }
+
+    def private boolean isString(FTypeRef _typeRef) {
+        if (_typeRef.derived instanceof FTypeDef)
+            return (_typeRef.derived as FTypeDef).actualType.isString
+        return _typeRef.derived === null && _typeRef.interval === null && _typeRef.predefined == FBasicTypeId.STRING
+    }
+
+    def boolean hasCompressedElements(FInterface _interface) {
+        return !_interface.attributes.filter[getCompressionThreshold !== null].empty ||
+            !_interface.methods.filter[(inArgs + outArgs).exists[getCompressionThreshold !== null]].empty ||
+            !_interface.broadcasts.filter[outArgs.exists[getCompressionThreshold !== null]].empty
+    }
+
+    def boolean hasSharedMemoryElements(FInterface _interface) {
+        return !_interface.attributes.filter[getSharedMemoryThreshold !== null].empty ||
+            !_interface.broadcasts.filter[outArgs.exists[getSharedMemoryThreshold !== null]].empty
+    }
+
+    def boolean hasUtf16Elements(FInterface _interface) {
+        return !_interface.attributes.filter[isUtf16String].empty ||
+            !_interface.methods.filter[(inArgs + outArgs).exists[isUtf16String]].empty ||
+            !_interface.broadcasts.filter[outArgs.exists[isUtf16String]].empty
+    }
+
     def List<String> getNotifierEventGroups(FAttribute _attribute, PropertyAccessor _accessor) {
         val List<Integer> value = _accessor.getSomeIpEventGroups(_attribute)
         if (value !== null)
@@ -285,9 +887,40 @@ class FrancaSomeIPGeneratorExtensions {
     }
 
     def dispatch String getDeploymentType(FTypedElement _typedElement, FTypeCollection _interface, boolean _useTc) {
+        if (_typedElement.isBulkArray) {
+            var String itsArrayType
+            if (_typedElement.array)
+                itsArrayType = "CommonAPI::SomeIP::ArrayDeployment< " +
+                    _typedElement.type.getDeploymentType(_interface, _useTc) + " >"
+            else
+                itsArrayType = _typedElement.type.getDeploymentType(_interface, _useTc)
+            return "CommonAPI::SomeIP::Bulk::Deployment< " + itsArrayType + ", " +
+                _typedElement.bulkLittleEndian + " >"
+        }
+        if (_typedElement.isPooledPolymorphicArray) {
+            var String itsArrayType
+            if (_typedElement.array)
+                itsArrayType = "CommonAPI::SomeIP::ArrayDeployment< " +
+                    _typedElement.type.getDeploymentType(_interface, _useTc) + " >"
+            else
+                itsArrayType = _typedElement.type.getDeploymentType(_interface, _useTc)
+            return _typedElement.getPooledPolymorphicDeploymentType(itsArrayType)
+        }
         if (_typedElement.array)
             return "CommonAPI::SomeIP::ArrayDeployment< " + _typedElement.type.getDeploymentType(_interface, _useTc) +
                 " >"
+        // The thresholds are part of the type, they select the shared memory or compressing serialization
+        val Integer sharedMemoryThreshold = _typedElement.sharedMemoryThreshold
+        if (sharedMemoryThreshold !== null)
+            return "CommonAPI::SomeIP::SharedMemory::Deployment< " +
+                _typedElement.type.getDeploymentType(_interface, _useTc) + ", " + sharedMemoryThreshold + " >"
+        val Integer threshold = _typedElement.compressionThreshold
+        if (threshold !== null)
+            return "CommonAPI::SomeIP::Compression::Deployment< " +
+                _typedElement.type.getDeploymentType(_interface, _useTc) + ", " + threshold + " >"
+        if (_typedElement.isUtf16String)
+            return "CommonAPI::SomeIP::Utf16::Deployment< " +
+                _typedElement.type.getDeploymentType(_interface, _useTc) + " >"
         return _typedElement.type.getDeploymentType(_interface, _useTc)
     }
 
@@ -574,6 +1207,8 @@ class FrancaSomeIPGeneratorExtensions {
             elemType = containerName + "_::" + typeName + "Deployment_t"
             if (_typedElement.array)
                 elemType = "CommonAPI::SomeIP::ArrayDeployment< " + elemType + " >"
+            if (_typedElement.isPooledPolymorphicArray)
+                elemType = _typedElement.getPooledPolymorphicDeploymentType(elemType)
         } else {
             elemType = _typedElement.getDeploymentType(null, false)
         }
@@ -635,6 +1270,8 @@ class FrancaSomeIPGeneratorExtensions {
         var Set<String> ret = new HashSet<String>()
         ret.add(someipDeploymentHeaderPath(_array.eContainer as FTypeCollection))
         ret.addAll(_array.elementType.getDeploymentInputIncludes(_accessor))
+        if (_array.isPackedArray(_accessor))
+            ret.add(someipPackedArrayHeaderPath)
         return ret
     }
 
@@ -752,8 +1389,72 @@ class FrancaSomeIPGeneratorExtensions {
         for (t : _interface.types) {
             ret.addAll(t.getDeploymentInputIncludes(_accessor))
         }
+        if (_interface.hasCompressedElements) {
+            ret.add(someipCompressionHeaderPath)
+        }
+        if (_interface.hasSharedMemoryElements) {
+            ret.add(someipSharedMemoryHeaderPath)
+        }
+        if (_interface.hasUtf16Elements) {
+            ret.add(someipUtf16HeaderPath)
+        }
+        if (_interface.hasBulkElements) {
+            ret.add(someipBulkHeaderPath)
+        }
+        if (_interface.hasPooledPolymorphicElements) {
+            ret.add(someipPolymorphHeaderPath)
+        }
 
         return ret
     }
 
+    // Static tracepoints (USDT) of the generated proxies and stub adapters. The probes
+    // are only compiled on Linux if <sys/sdt.h> is available and COMMONAPI_SOMEIP_NO_PROBES
+    // is not defined. Each probe has the arguments service, instance, method/event and
+    // payload size.
+    def generateTracepointDefinitions() '''
+        #ifndef COMMONAPI_SOMEIP_PROBE
+        #if defined(__linux__) && !defined(COMMONAPI_SOMEIP_NO_PROBES) && defined(__has_include)
+        #if __has_include(<sys/sdt.h>)
+        #include <sys/sdt.h>
+        #define COMMONAPI_SOMEIP_PROBES
+        #define COMMONAPI_SOMEIP_PROBE(_name, _service, _instance, _id, _size) \
+            DTRACE_PROBE4(commonapi_someip, _name, _service, _instance, _id, _size)
+        #define COMMONAPI_SOMEIP_PROBE_HOOK(...) __VA_ARGS__
+        #endif
+        #endif
+        #ifndef COMMONAPI_SOMEIP_PROBE
+        #define COMMONAPI_SOMEIP_PROBE(_name, _service, _instance, _id, _size)
+        #define COMMONAPI_SOMEIP_PROBE_HOOK(...)
+        #endif
+        #endif
+    '''
+
+    // Payload size of the given arguments if it does not depend on their values, otherwise -1
+    def String getTracePayloadSize(Iterable<? extends FTypedElement> _elements) {
+        var long size = 0
+        for (e : _elements) {
+            if (e.array || e.type.derived !== null)
+                return "-1"
+            if (e.type.interval !== null) {
+                size += 4
+            } else {
+                switch (e.type.predefined) {
+                    case FBasicTypeId.BOOLEAN,
+                    case FBasicTypeId.INT8,
+                    case FBasicTypeId.UINT8: size += 1
+                    case FBasicTypeId.INT16,
+                    case FBasicTypeId.UINT16: size += 2
+                    case FBasicTypeId.INT32,
+                    case FBasicTypeId.UINT32,
+                    case FBasicTypeId.FLOAT: size += 4
+                    case FBasicTypeId.INT64,
+                    case FBasicTypeId.UINT64,
+                    case FBasicTypeId.DOUBLE: size += 8
+                    default: return "-1"
+                }
+            }
+        }
+        return Long.toString(size)
+    }
 }
@@ -0,0 +1,303 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the limits of the methods that are deployed with SomeIpMethodMaxInFlight and
+ * SomeIpMethodQueueDepth: the limiter of the stub adapter that rejects the calls beyond
+ * them and the window of the proxy that does not send them. The header does not depend
+ * on the model, it is written once to the default output directory.
+ */
+class SomeIPBackpressureGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateBackpressure(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipBackpressureHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateBackpressureHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipBackpressureHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateBackpressureHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_BACKPRESSURE_HPP_
+        #define COMMONAPI_SOMEIP_BACKPRESSURE_HPP_
+
+        #include <atomic>
+        #include <cstdint>
+        #include <deque>
+        #include <functional>
+        #include <future>
+        #include <memory>
+        #include <mutex>
+        #include <utility>
+
+        #include <CommonAPI/Types.hpp>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Backpressure {
+
+        // Return code of the error reply to a rejected call, the first code SOME/IP
+        // reserves for errors of services and methods. The runtime passes every error
+        // reply as REMOTE_ERROR without its return code, so the caller of a rejected call
+        // gets REMOTE_ERROR. The limiter of the stub adapter and the window of the proxy
+        // count the calls they rejected.
+        static const uint8_t RETURN_CODE_OVERLOADED = 0x20;
+
+        typedef std::function<void()> Task;
+        typedef std::function<void(Task)> Executor;
+
+        /**
+         * Limits the calls of a method in a stub adapter. At most maxInFlight tasks run
+         * at the same time and at most queueDepth tasks wait for them, further tasks
+         * are rejected.
+         *
+         * A call is in flight until its reply is sent. A task that replies later takes
+         * the permit of the call with Permit::take() and releases it when it has sent
+         * the reply; the next waiting task is then passed to its executor. Otherwise
+         * the call ends with the task and the thread that ran it continues with the
+         * next waiting task.
+         *
+         * Limiters are created with std::make_shared, their tasks and permits keep
+         * them alive.
+         */
+        class Limiter : public std::enable_shared_from_this<Limiter> {
+        public:
+            /**
+             * The slot of a call in flight. Releasing the permit, or destroying the
+             * last reference to it, ends the call.
+             */
+            class Permit {
+            public:
+                explicit Permit(std::shared_ptr<Limiter> _limiter)
+                    : limiter_(_limiter), isReleased_(false) {
+                }
+
+                ~Permit() {
+                    release();
+                }
+
+                Permit(const Permit &) = delete;
+                Permit &operator=(const Permit &) = delete;
+
+                // Takes the permit of the task that runs on this thread. Returns an empty
+                // pointer outside of the tasks of a limiter and if it was taken before.
+                static std::shared_ptr<Permit> take() {
+                    std::shared_ptr<Permit> itsPermit;
+                    itsPermit.swap(current());
+                    return itsPermit;
+                }
+
+                void release() {
+                    if (!isReleased_.exchange(true))
+                        limiter_->release();
+                }
+
+            private:
+                friend class Limiter;
+
+                static std::shared_ptr<Permit> &current() {
+                    static thread_local std::shared_ptr<Permit> itsCurrent;
+                    return itsCurrent;
+                }
+
+                const std::shared_ptr<Limiter> limiter_;
+                std::atomic<bool> isReleased_;
+            };
+
+            Limiter(std::size_t _maxInFlight, std::size_t _queueDepth)
+                : maxInFlight_(_maxInFlight == 0 ? 1 : _maxInFlight), queueDepth_(_queueDepth),
+                  inFlight_(0), rejected_(0) {
+            }
+
+            Limiter(const Limiter &) = delete;
+            Limiter &operator=(const Limiter &) = delete;
+
+            // Passes the task to _execute if it may run now or queues it. Returns false
+            // if the task was rejected because both limits are reached.
+            bool submit(Task _task, const Executor &_execute) {
+                {
+                    std::lock_guard<std::mutex> itsLock(mutex_);
+                    if (inFlight_ >= maxInFlight_) {
+                        if (queue_.size() >= queueDepth_) {
+                            rejected_++;
+                            return false;
+                        }
+                        queue_.emplace_back(std::move(_task), _execute);
+                        return true;
+                    }
+                    inFlight_++;
+                }
+                _execute(drain(std::move(_task)));
+                return true;
+            }
+
+            std::size_t getInFlight() const {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                return inFlight_;
+            }
+
+            std::size_t getQueued() const {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                return queue_.size();
+            }
+
+            uint64_t getRejected() const {
+                return rejected_;
+            }
+
+        private:
+            typedef std::pair<Task, Executor> Entry;
+
+            // Ends a call whose permit was taken: the next waiting task gets its slot
+            void release() {
+                Entry itsNext;
+                {
+                    std::lock_guard<std::mutex> itsLock(mutex_);
+                    if (queue_.empty()) {
+                        inFlight_--;
+                        return;
+                    }
+                    itsNext = std::move(queue_.front());
+                    queue_.pop_front();
+                }
+                itsNext.second(drain(std::move(itsNext.first)));
+            }
+
+            // Runs the task and, as long as no task takes its permit, the waiting ones
+            Task drain(Task _task) {
+                std::shared_ptr<Limiter> itsLimiter(shared_from_this());
+                return [itsLimiter, _task]() {
+                    Task itsTask(_task);
+                    while (itsLimiter->run(itsTask)) {
+                        std::lock_guard<std::mutex> itsLock(itsLimiter->mutex_);
+                        if (itsLimiter->queue_.empty()) {
+                            itsLimiter->inFlight_--;
+                            return;
+                        }
+                        itsTask = std::move(itsLimiter->queue_.front().first);
+                        itsLimiter->queue_.pop_front();
+                    }
+                };
+            }
+
+            // Returns true if the call ended with the task, false if its permit was taken
+            bool run(const Task &_task) {
+                std::shared_ptr<Permit> &itsCurrent = Permit::current();
+                std::shared_ptr<Permit> itsOuter(std::move(itsCurrent));
+                itsCurrent = std::make_shared<Permit>(shared_from_this());
+                _task();
+                std::shared_ptr<Permit> itsPermit(std::move(itsCurrent));
+                itsCurrent = std::move(itsOuter);
+                if (!itsPermit)
+                    return false;
+                itsPermit->isReleased_ = true;
+                return true;
+            }
+
+            const std::size_t maxInFlight_;
+            const std::size_t queueDepth_;
+            mutable std::mutex mutex_;
+            std::size_t inFlight_;
+            std::deque<Entry> queue_;
+            std::atomic<uint64_t> rejected_;
+        };
+
+        /**
+         * Limits the calls of a method a proxy has outstanding to the calls the stub
+         * adapter accepts (maxInFlight + queueDepth), so that a single proxy does not
+         * cause error replies. Calls beyond are not sent and end at once with
+         * REMOTE_ERROR, like the calls the stub adapter rejects; getRefused() counts them.
+         */
+        class Window {
+        public:
+            explicit Window(std::size_t _size)
+                : size_(_size), outstanding_(0), refused_(0) {
+            }
+
+            Window(const Window &) = delete;
+            Window &operator=(const Window &) = delete;
+
+            bool tryAcquire() {
+                std::size_t itsOutstanding = outstanding_;
+                do {
+                    if (itsOutstanding >= size_) {
+                        refused_++;
+                        return false;
+                    }
+                } while (!outstanding_.compare_exchange_weak(itsOutstanding, itsOutstanding + 1));
+                return true;
+            }
+
+            void release() {
+                outstanding_--;
+            }
+
+            std::size_t getOutstanding() const {
+                return outstanding_;
+            }
+
+            uint64_t getRefused() const {
+                return refused_;
+            }
+
+            // Holds a call of a synchronous method
+            class Slot {
+            public:
+                explicit Slot(Window &_window)
+                    : window_(_window), isAcquired_(_window.tryAcquire()) {
+                }
+
+                ~Slot() {
+                    if (isAcquired_)
+                        window_.release();
+                }
+
+                Slot(const Slot &) = delete;
+                Slot &operator=(const Slot &) = delete;
+
+                explicit operator bool() const {
+                    return isAcquired_;
+                }
+
+            private:
+                Window &window_;
+                const bool isAcquired_;
+            };
+
+        private:
+            const std::size_t size_;
+            std::atomic<std::size_t> outstanding_;
+            std::atomic<uint64_t> refused_;
+        };
+
+        // Ends an asynchronous call that was not sent with REMOTE_ERROR and default values
+        template<typename... Values_, typename Callback_>
+        std::future<CommonAPI::CallStatus> reject(const Callback_ &_callback) {
+            if (_callback)
+                _callback(CommonAPI::CallStatus::REMOTE_ERROR, Values_()...);
+            std::promise<CommonAPI::CallStatus> itsPromise;
+            itsPromise.set_value(CommonAPI::CallStatus::REMOTE_ERROR);
+            return itsPromise.get_future();
+        }
+
+        } // namespace Backpressure
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_BACKPRESSURE_HPP_
+    '''
+}
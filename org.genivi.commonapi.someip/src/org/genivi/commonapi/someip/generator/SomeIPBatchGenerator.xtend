@@ -0,0 +1,362 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the helpers of the batch notifications of the event groups that are
+ * deployed with SomeIpBatchEventGroups: the collection of the changed attributes
+ * in the stub adapter and the changed events of the attributes in the proxy. The
+ * header does not depend on the model, it is written once to the default output
+ * directory.
+ */
+class SomeIPBatchGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateBatch(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipBatchHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateBatchHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipBatchHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateBatchHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_BATCH_HPP_
+        #define COMMONAPI_SOMEIP_BATCH_HPP_
+
+        #include <algorithm>
+        #include <cstdint>
+        #include <functional>
+        #include <mutex>
+        #include <thread>
+        #include <vector>
+
+        #include <CommonAPI/Event.hpp>
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Batch {
+
+        typedef uint16_t Position;
+
+        /*
+         * Batch event of an event group. Each attribute of the group is sent as a slot:
+         * a state byte that is followed by the value unless the slot is absent.
+         * Unchanged attributes are absent, all attributes are present once a new
+         * subscriber was accepted, so that the field value cached by the middleware
+         * is complete again.
+         */
+        enum class State : uint8_t {
+            ABSENT = 0,
+            PRESENT = 1,
+            CHANGED = 2
+        };
+
+        template<typename Value_>
+        struct Slot {
+            Slot()
+                : state_(State::ABSENT),
+                  value_() {
+            }
+
+            Slot(State _state, const Value_ &_value)
+                : state_(_state),
+                  value_(_value) {
+            }
+
+            State state_;
+            Value_ value_;
+        };
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the slot type
+        template<typename Value_, typename Deployment_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<Slot<Value_>, Deployment_> &_slot) {
+            OutputStream &itsOutput = static_cast<OutputStream &>(_output);
+            const Slot<Value_> &itsSlot = _slot.getValue();
+            itsOutput.writeValue(uint8_t(itsSlot.state_), static_cast<const EmptyDeployment *>(nullptr));
+            if (itsSlot.state_ != State::ABSENT) {
+                itsOutput << CommonAPI::Deployable<Value_, Deployment_>(itsSlot.value_, _slot.getDepl());
+            }
+            return _output;
+        }
+
+        template<typename Value_, typename Deployment_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<Slot<Value_>, Deployment_> &_slot) {
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            Slot<Value_> &itsSlot = _slot.getValue();
+            uint8_t itsState(0);
+            itsInput.readValue(itsState, static_cast<const EmptyDeployment *>(nullptr));
+            if (itsInput.hasError()) {
+                return _input;
+            }
+            if (itsState > uint8_t(State::CHANGED)) {
+                COMMONAPI_ERROR("SomeIP batch: dropped batch with unknown slot state ", int(itsState));
+                itsInput.setError();
+                return _input;
+            }
+            itsSlot.state_ = State(itsState);
+            if (itsSlot.state_ == State::ABSENT) {
+                itsSlot.value_ = Value_();
+                return _input;
+            }
+            CommonAPI::Deployable<Value_, Deployment_> itsValue(_slot.getDepl());
+            itsInput >> itsValue;
+            itsSlot.value_ = itsValue.getValue();
+            return _input;
+        }
+
+        /**
+         * Collects the changed attributes of an event group of the stub adapter. A batch
+         * is a flush window of the whole group, not of its caller: while any batch is
+         * open, the changes of all threads are held back and sent as one event when the
+         * outermost batch is committed. A thread that keeps a batch open therefore delays
+         * the notifications of the other threads. A change while no batch is open is sent
+         * right away. The mutex guards the state and the values of the stub adapter for a
+         * short time only, it is not held while a batch is open.
+         */
+        class Sender {
+        public:
+            Sender()
+                : depth_(0),
+                  isRefreshing_(false) {
+            }
+
+            std::mutex &getMutex() {
+                return mutex_;
+            }
+
+            // Opens a batch, the mutex must be held
+            void begin() {
+                depth_++;
+            }
+
+            // Marks the attribute as changed, the mutex must be held. Returns true if
+            // the change is to be sent now, as no batch is open.
+            bool change(Position _position) {
+                if (std::find(changed_.begin(), changed_.end(), _position) == changed_.end()) {
+                    changed_.push_back(_position);
+                }
+                return (depth_ == 0);
+            }
+
+            // Marks all attributes as present for a new subscriber, the mutex must be
+            // held. Returns true if they are to be sent now, as no batch is open.
+            bool refresh() {
+                isRefreshing_ = true;
+                return (depth_ == 0);
+            }
+
+            // Closes a batch, the mutex must be held. Returns true if the outermost
+            // batch ended with something to send.
+            bool commit() {
+                if (depth_ > 0) {
+                    depth_--;
+                }
+                return (depth_ == 0 && (isRefreshing_ || !changed_.empty()));
+            }
+
+            // The states of the _count attributes of the group for the next event,
+            // the mutex must be held
+            std::vector<State> take(std::size_t _count) {
+                std::vector<State> itsStates(_count, isRefreshing_ ? State::PRESENT : State::ABSENT);
+                for (auto itsPosition : changed_) {
+                    if (itsPosition < _count) {
+                        itsStates[itsPosition] = State::CHANGED;
+                    }
+                }
+                changed_.clear();
+                isRefreshing_ = false;
+                return itsStates;
+            }
+
+        private:
+            std::mutex mutex_;
+            unsigned depth_;
+            bool isRefreshing_;
+            std::vector<Position> changed_;
+        };
+
+        /**
+         * Open batch of a stub adapter, returned by its begin method of the event group.
+         * The batch is committed when the scope is destroyed. It holds back the changes
+         * of all threads to the group, so it should be kept as short as possible. A scope
+         * must not outlive the stub adapter that returned it.
+         */
+        class Scope {
+        public:
+            explicit Scope(std::function<void ()> _commit)
+                : commit_(std::move(_commit)) {
+            }
+
+            Scope(Scope &&_other)
+                : commit_(std::move(_other.commit_)) {
+                _other.commit_ = nullptr;
+            }
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+            ~Scope() {
+                if (commit_) {
+                    commit_();
+                }
+            }
+
+        private:
+            std::function<void ()> commit_;
+        };
+
+        /**
+         * Received batches of the proxy. The last batch holds the values of all attributes
+         * that were received so far and marks the attributes that the last event changed
+         * or contained for the first time. Listeners that subscribe later get the known
+         * values, all marked as changed.
+         */
+        template<typename Value_>
+        class Cache {
+        public:
+            typedef std::function<void (const Value_ &)> Handler;
+            typedef std::function<void (Value_ &, Value_ &)> Merge;
+
+            Cache()
+                : hasValue_(false),
+                  last_(),
+                  known_() {
+            }
+
+            // Merges a received event into the last batch and the known values and calls
+            // the handler with the last batch
+            void write(const Merge &_merge, const Handler &_handler) {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                _merge(last_, known_);
+                hasValue_ = true;
+                _handler(last_);
+            }
+
+            // Calls the handler with the known values if a batch was received
+            bool read(const Handler &_handler) const {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                if (!hasValue_) {
+                    return false;
+                }
+                _handler(known_);
+                return true;
+            }
+
+            void reset() {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                hasValue_ = false;
+                last_ = Value_();
+                known_ = Value_();
+            }
+
+        private:
+            mutable std::recursive_mutex mutex_;
+            bool hasValue_;
+            Value_ last_;
+            Value_ known_;
+        };
+
+        /**
+         * Changed event of a proxy attribute that is sent within the batch event of its
+         * event group. Listeners are notified if the attribute is marked as changed in
+         * a batch, this includes the first batch that contains it and the known values
+         * that are delivered when subscribing. All attributes of a batch are notified
+         * before the next batch is processed.
+         */
+        template<typename Value_, typename Batch_>
+        class ChangedEvent : public CommonAPI::Event<Value_> {
+        public:
+            typedef typename CommonAPI::Event<Value_>::Listener Listener;
+            typedef typename CommonAPI::Event<Value_>::Subscription Subscription;
+
+            ChangedEvent(CommonAPI::Event<Batch_> &_batchEvent,
+                         Value_ Batch_::*_value, bool Batch_::*_isChanged)
+                : batchEvent_(_batchEvent),
+                  value_(_value),
+                  isChanged_(_isChanged),
+                  subscription_(0),
+                  hasValue_(false),
+                  last_() {
+            }
+
+        protected:
+            void onFirstListenerAdded(const Listener &_listener) {
+                (void)_listener;
+                {
+                    std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                    subscriber_ = std::this_thread::get_id();
+                }
+                subscription_ = batchEvent_.subscribe(
+                    [this](const Batch_ &_batch) { receive(_batch); });
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                subscriber_ = std::thread::id();
+            }
+
+            void onListenerAdded(const Listener &_listener, const Subscription _subscription) {
+                (void)_listener;
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                if (hasValue_) {
+                    this->notifySpecificListener(_subscription, last_);
+                }
+            }
+
+            void onLastListenerRemoved(const Listener &_listener) {
+                (void)_listener;
+                batchEvent_.unsubscribe(subscription_);
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                hasValue_ = false;
+                last_ = Value_();
+            }
+
+        private:
+            // A batch that is delivered while subscribing reaches the new listener
+            // through onListenerAdded
+            void receive(const Batch_ &_batch) {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                if (!(_batch.*isChanged_)) {
+                    return;
+                }
+                last_ = _batch.*value_;
+                hasValue_ = true;
+                if (subscriber_ != std::this_thread::get_id()) {
+                    this->notifyListeners(last_);
+                }
+            }
+
+            CommonAPI::Event<Batch_> &batchEvent_;
+            Value_ Batch_::*value_;
+            bool Batch_::*isChanged_;
+            Subscription subscription_;
+
+            std::recursive_mutex mutex_;
+            std::thread::id subscriber_;
+            bool hasValue_;
+            Value_ last_;
+        };
+
+        } // namespace Batch
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_BATCH_HPP_
+    '''
+}
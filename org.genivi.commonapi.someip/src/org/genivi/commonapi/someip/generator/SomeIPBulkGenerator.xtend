@@ -0,0 +1,267 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the bulk serialization of integer and floating point arrays of attributes
+ * and arguments: the byte swap kernels and the stream operators that are selected by
+ * the deployment type of the element. The header does not depend on the model, it is
+ * written once to the default output directory.
+ */
+class SomeIPBulkGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateBulk(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipBulkHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateBulkHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipBulkHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateBulkHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_BULK_HPP_
+        #define COMMONAPI_SOMEIP_BULK_HPP_
+
+        #include <cstddef>
+        #include <cstdint>
+        #include <cstring>
+        #include <vector>
+
+        #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        #define COMMONAPI_SOMEIP_BULK_X86
+        #include <immintrin.h>
+        #elif defined(__ARM_NEON)
+        #include <arm_neon.h>
+        #endif
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Bulk serialization of arrays of integers and floating point values.
+         *
+         * The elements of such an array are contiguous in memory and on the wire, they
+         * differ at most in their byte order. Instead of writing and reading the elements
+         * one by one, the array is copied as one block if the deployed byte order is the
+         * one of the host, otherwise the block is byte swapped with SSSE3 if the CPU
+         * supports it, or with NEON if the target has it (always on AArch64). The
+         * wire format does not change: the array is sent as ByteBuffer
+         * whose length field contains the length of the array in bytes, the minimum and
+         * maximum length of the array deployment are checked as byte lengths. Arrays with
+         * a length width of 0 (fixed length) are serialized element by element.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Bulk {
+
+        #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        static const bool HOST_IS_LITTLE_ENDIAN = false;
+        #else
+        static const bool HOST_IS_LITTLE_ENDIAN = true;
+        #endif
+
+        template<std::size_t Size_>
+        struct Word;
+
+        template<>
+        struct Word<2> {
+            typedef uint16_t Type;
+            static Type swap(Type _value) {
+                return Type((_value >> 8) | (_value << 8));
+            }
+        #if defined(__ARM_NEON)
+            static uint8x16_t reverse(uint8x16_t _block) {
+                return vrev16q_u8(_block);
+            }
+        #endif
+        };
+
+        template<>
+        struct Word<4> {
+            typedef uint32_t Type;
+            static Type swap(Type _value) {
+                return ((_value >> 24) | ((_value >> 8) & 0x0000FF00u) |
+                        ((_value << 8) & 0x00FF0000u) | (_value << 24));
+            }
+        #if defined(__ARM_NEON)
+            static uint8x16_t reverse(uint8x16_t _block) {
+                return vrev32q_u8(_block);
+            }
+        #endif
+        };
+
+        template<>
+        struct Word<8> {
+            typedef uint64_t Type;
+            static Type swap(Type _value) {
+                return ((Type(Word<4>::swap(uint32_t(_value))) << 32) | Word<4>::swap(uint32_t(_value >> 32)));
+            }
+        #if defined(__ARM_NEON)
+            static uint8x16_t reverse(uint8x16_t _block) {
+                return vrev64q_u8(_block);
+            }
+        #endif
+        };
+
+        #ifdef COMMONAPI_SOMEIP_BULK_X86
+        // Reverses the byte order of complete blocks of 16 bytes, returns the number of
+        // swapped elements
+        template<std::size_t Size_>
+        __attribute__((target("ssse3")))
+        std::size_t swapSsse3(const uint8_t *_source, uint8_t *_target, std::size_t _count) {
+            uint8_t itsOrder[16];
+            for (std::size_t b = 0; b < 16; b++)
+                itsOrder[b] = uint8_t(b / Size_ * Size_ + Size_ - 1 - b % Size_);
+            const __m128i itsMask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(itsOrder));
+            std::size_t i(0);
+            for (; i + 16 / Size_ <= _count; i += 16 / Size_) {
+                const __m128i itsBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + i * Size_));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(_target + i * Size_), _mm_shuffle_epi8(itsBlock, itsMask));
+            }
+            return i;
+        }
+
+        inline bool hasSsse3() {
+            static const bool itsHasSsse3 = __builtin_cpu_supports("ssse3");
+            return itsHasSsse3;
+        }
+        #endif
+
+        // Reverses the byte order of _count elements of Size_ bytes
+        template<std::size_t Size_>
+        void swap(const uint8_t *_source, uint8_t *_target, std::size_t _count) {
+            std::size_t i(0);
+        #if defined(COMMONAPI_SOMEIP_BULK_X86)
+            if (hasSsse3())
+                i = swapSsse3<Size_>(_source, _target, _count);
+        #elif defined(__ARM_NEON)
+            for (; i + 16 / Size_ <= _count; i += 16 / Size_) {
+                vst1q_u8(_target + i * Size_, Word<Size_>::reverse(vld1q_u8(_source + i * Size_)));
+            }
+        #endif
+            for (; i < _count; i++) {
+                typename Word<Size_>::Type itsWord;
+                std::memcpy(&itsWord, _source + i * Size_, Size_);
+                itsWord = Word<Size_>::swap(itsWord);
+                std::memcpy(_target + i * Size_, &itsWord, Size_);
+            }
+        }
+
+        template<>
+        inline void swap<1>(const uint8_t *_source, uint8_t *_target, std::size_t _count) {
+            std::memcpy(_target, _source, _count);
+        }
+
+        // Copies _count elements between host and wire byte order
+        template<typename Element_>
+        void copy(const void *_source, void *_target, std::size_t _count, bool _isLittleEndian) {
+            if (_count == 0)
+                return;
+            if (_isLittleEndian == HOST_IS_LITTLE_ENDIAN) {
+                std::memcpy(_target, _source, _count * sizeof(Element_));
+            } else {
+                swap<sizeof(Element_)>(static_cast<const uint8_t *>(_source), static_cast<uint8_t *>(_target), _count);
+            }
+        }
+
+        // Length of _length elements in bytes, limited to the largest length field
+        template<typename Element_>
+        uint32_t getByteLength(uint32_t _length) {
+            const uint64_t itsLength = uint64_t(_length) * sizeof(Element_);
+            return (itsLength > 0xFFFFFFFFu ? 0xFFFFFFFFu : uint32_t(itsLength));
+        }
+
+        /*
+         * Deployment of a bulk array. The byte order is part of the type, so that the
+         * serialization below is selected for all Deployables of the element, with or
+         * without a deployment object.
+         */
+        template<typename Inner_, bool IsLittleEndian_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        // Lengths of the array deployment as lengths of the ByteBuffer on the wire
+        template<typename Element_, typename Inner_>
+        ByteBufferDeployment getByteBufferDeployment(const Inner_ *_depl) {
+            if (_depl == nullptr)
+                return ByteBufferDeployment(0, 0, 4);
+            return ByteBufferDeployment(getByteLength<Element_>(_depl->minLength_),
+                                        getByteLength<Element_>(_depl->maxLength_),
+                                        _depl->lengthWidth_);
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename Element_, typename Inner_, bool IsLittleEndian_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::vector<Element_>, Deployment<Inner_, IsLittleEndian_>> &_value) {
+            OutputStream &itsOutput = static_cast<OutputStream &>(_output);
+            const Inner_ *itsDepl = _value.getDepl();
+            const std::vector<Element_> &itsValue = _value.getValue();
+            if (itsDepl != nullptr && itsDepl->lengthWidth_ == 0) {
+                itsOutput.writeValue(itsValue, itsDepl);
+                return _output;
+            }
+            ByteBuffer itsBytes(itsValue.size() * sizeof(Element_));
+            copy<Element_>(itsValue.data(), itsBytes.data(), itsValue.size(), IsLittleEndian_);
+            const ByteBufferDeployment itsBytesDepl = getByteBufferDeployment<Element_>(itsDepl);
+            itsOutput.writeValue(itsBytes, &itsBytesDepl);
+            return _output;
+        }
+
+        template<typename Element_, typename Inner_, bool IsLittleEndian_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::vector<Element_>, Deployment<Inner_, IsLittleEndian_>> &_value) {
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            const Inner_ *itsDepl = _value.getDepl();
+            std::vector<Element_> &itsValue = _value.getValue();
+            if (itsDepl != nullptr && itsDepl->lengthWidth_ == 0) {
+                itsInput.readValue(itsValue, itsDepl);
+                return _input;
+            }
+            ByteBuffer itsBytes;
+            const ByteBufferDeployment itsBytesDepl = getByteBufferDeployment<Element_>(itsDepl);
+            itsInput.readValue(itsBytes, &itsBytesDepl);
+            if (itsInput.hasError())
+                return _input;
+            if (itsBytes.size() % sizeof(Element_) != 0) {
+                COMMONAPI_ERROR("SomeIP bulk: dropped array of ", itsBytes.size(),
+                                " bytes, which is no multiple of the element size ", sizeof(Element_));
+                itsInput.setError();
+                itsValue.clear();
+                return _input;
+            }
+            itsValue.resize(itsBytes.size() / sizeof(Element_));
+            copy<Element_>(itsBytes.data(), itsValue.data(), itsValue.size(), IsLittleEndian_);
+            return _input;
+        }
+
+        } // namespace Bulk
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_BULK_HPP_
+    '''
+}
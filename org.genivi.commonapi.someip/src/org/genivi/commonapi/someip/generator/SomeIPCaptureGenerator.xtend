@@ -0,0 +1,615 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the message capture that is used by the capture taps of the stub
+ * adapters and read by the load generators. The header does not depend on
+ * the model, it is written once to the default output directory.
+ */
+class SomeIPCaptureGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateCapture(IFileSystemAccess _fileSystemAccess) {
+        if (!FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CAPTURE_SOMEIP, "false").equals("true") &&
+            !FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_LOAD_GENERATOR_SOMEIP, "false").equals("true")) {
+            return
+        }
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipCaptureHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateCaptureHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipCaptureHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateCaptureHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_CAPTURE_HPP_
+        #define COMMONAPI_SOMEIP_CAPTURE_HPP_
+
+        #include <algorithm>
+        #include <atomic>
+        #include <chrono>
+        #include <cstdint>
+        #include <cstdlib>
+        #include <cstring>
+        #include <fstream>
+        #include <iterator>
+        #include <mutex>
+        #include <string>
+        #include <thread>
+        #include <utility>
+        #include <vector>
+
+        #ifndef _WIN32
+        #include <dirent.h>
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <unistd.h>
+        #endif
+
+        /*
+         * Capture of SOME/IP messages into memory mapped files.
+         *
+         * The capture is written to the files <path>.<sequence>, all of the same size.
+         * If a file is full, the next one is created and the oldest one is removed so
+         * that at most "files" files exist.
+         *
+         * File format (all values in host byte order, see byteOrder):
+         *
+         *   FileHeader (64 bytes)
+         *     char     magic[8]           "SOMEIPCP"
+         *     uint16_t version            1
+         *     uint16_t headerSize         64
+         *     uint16_t recordHeaderSize   24
+         *     uint16_t byteOrder          0x0102 as written by the capturing host
+         *     uint64_t sequence           number of the file, starting with 0
+         *     uint64_t capacity           size of the file in bytes
+         *     int64_t  realtimeNs         system clock at creation (ns since 1970)
+         *     int64_t  steadyNs           steady clock at creation (ns)
+         *     uint64_t used               end of the reserved records, may exceed capacity
+         *     uint32_t pid                capturing process
+         *     uint32_t reserved
+         *
+         *   Record (starting at offset 64, each aligned to 8 bytes)
+         *     uint32_t size               size of the record including header and padding
+         *     uint32_t commit             0x54494d43 if the record is complete
+         *     int64_t  timestamp          steady clock (ns), compare with steadyNs
+         *     uint16_t instance           SOME/IP instance
+         *     uint8_t  direction          1 = request received by a stub adapter,
+         *                                 2 = reply, not written by the generated taps
+         *     uint8_t  reserved
+         *     uint32_t length             length of the message that follows
+         *     uint8_t  message[length]    SOME/IP header (16 bytes, network byte order)
+         *                                 followed by the payload
+         *
+         * A record with size 0 ends the records of a file. A record that is not
+         * committed is either being written or was interrupted and must be skipped.
+         *
+         * Writing a record reserves its space with one atomic add on the file header,
+         * copies the message and commits it. No locks are taken unless the file is
+         * full and the next file must be created.
+         *
+         * The capture of a process is configured by the environment variables
+         *   COMMONAPI_SOMEIP_CAPTURE            path of the files, capturing is off if not set
+         *   COMMONAPI_SOMEIP_CAPTURE_FILE_SIZE  size of each file in bytes (default 64 MiB)
+         *   COMMONAPI_SOMEIP_CAPTURE_FILES      number of files that are kept (default 4)
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Capture {
+
+        static const char MAGIC[8] = { 'S', 'O', 'M', 'E', 'I', 'P', 'C', 'P' };
+        static const uint16_t VERSION = 1;
+        static const uint16_t BYTE_ORDER_MARK = 0x0102;
+        static const uint32_t COMMITTED = 0x54494d43;
+        static const uint32_t SOMEIP_HEADER_SIZE = 16;
+
+        // The generated proxies do not see the reply messages, the taps of the stub
+        // adapters only capture requests
+        enum class Direction : uint8_t {
+            REQUEST = 1,
+            REPLY = 2
+        };
+
+        // SOME/IP message types and return codes as used in the captured headers
+        static const uint8_t MT_REQUEST = 0x00;
+        static const uint8_t MT_REQUEST_NO_RETURN = 0x01;
+        static const uint8_t MT_RESPONSE = 0x80;
+        static const uint8_t MT_ERROR = 0x81;
+        static const uint8_t RC_OK = 0x00;
+        static const uint8_t RC_NOT_OK = 0x01;
+
+        struct FileHeader {
+            char magic[8];
+            uint16_t version;
+            uint16_t headerSize;
+            uint16_t recordHeaderSize;
+            uint16_t byteOrder;
+            uint64_t sequence;
+            uint64_t capacity;
+            int64_t realtimeNs;
+            int64_t steadyNs;
+            std::atomic<uint64_t> used;
+            uint32_t pid;
+            uint32_t reserved;
+        };
+
+        struct RecordHeader {
+            uint32_t size;
+            std::atomic<uint32_t> commit;
+            int64_t timestamp;
+            uint16_t instance;
+            uint8_t direction;
+            uint8_t reserved;
+            uint32_t length;
+        };
+
+        static_assert(sizeof(FileHeader) == 64, "unexpected size of the capture file header");
+        static_assert(sizeof(RecordHeader) == 24, "unexpected size of the capture record header");
+
+        /**
+         * The SOME/IP header of a captured message.
+         */
+        struct MessageHeader {
+            uint16_t service;
+            uint16_t method;
+            uint16_t client;
+            uint16_t session;
+            uint8_t interfaceVersion;
+            uint8_t messageType;
+            uint8_t returnCode;
+        };
+
+        inline int64_t steadyNow() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * Appends messages to the capture files. Multiple threads may write at the same time.
+         */
+        class Writer {
+        public:
+            Writer()
+                : enabled_(false), current_(nullptr), fileSize_(0), files_(0), dropped_(0) {
+                for (Segment &itsSegment : segments_) {
+                    itsSegment.users.store(0, std::memory_order_relaxed);
+                    itsSegment.base = nullptr;
+                    itsSegment.sequence = 0;
+                }
+            }
+
+            ~Writer() {
+                close();
+            }
+
+            Writer(const Writer &) = delete;
+            Writer &operator=(const Writer &) = delete;
+
+            /**
+             * The writer of the process, configured by the environment variables.
+             */
+            static Writer &get() {
+                static Writer itsWriter(fromEnvironment());
+                return itsWriter;
+            }
+
+            bool open(const std::string &_path, uint64_t _fileSize, uint32_t _files) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                if (current_.load(std::memory_order_relaxed) != nullptr
+                        || _fileSize < sizeof(FileHeader) + sizeof(RecordHeader) + SOMEIP_HEADER_SIZE
+                        || _files == 0) {
+                    return false;
+                }
+                path_ = _path;
+                fileSize_ = (_fileSize + 7) & ~uint64_t(7);
+                files_ = _files;
+                if (!map(segments_[0], 0)) {
+                    return false;
+                }
+                current_.store(&segments_[0], std::memory_order_release);
+                enabled_.store(true, std::memory_order_release);
+                return true;
+            }
+
+            void close() {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                enabled_.store(false, std::memory_order_release);
+                Segment *itsSegment = current_.exchange(nullptr, std::memory_order_acq_rel);
+                if (itsSegment != nullptr) {
+                    unmap(*itsSegment);
+                }
+            }
+
+            bool isEnabled() const {
+                return enabled_.load(std::memory_order_relaxed);
+            }
+
+            // Number of messages that could not be written
+            uint64_t getDropped() const {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            void write(Direction _direction, uint16_t _instance, const MessageHeader &_header,
+                       const uint8_t *_payload, uint32_t _payloadLength) {
+                if (!enabled_.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                const int64_t itsTimestamp = steadyNow();
+                const uint32_t itsLength = SOMEIP_HEADER_SIZE + _payloadLength;
+                const uint64_t itsSize = (uint64_t(sizeof(RecordHeader)) + itsLength + 7) & ~uint64_t(7);
+
+                for (;;) {
+                    Segment *itsSegment = acquire();
+                    if (itsSegment == nullptr) {
+                        return;
+                    }
+                    FileHeader *itsFile = reinterpret_cast<FileHeader *>(itsSegment->base);
+                    const uint64_t itsOffset = itsFile->used.fetch_add(itsSize, std::memory_order_relaxed);
+                    if (itsOffset + itsSize <= fileSize_) {
+                        RecordHeader *itsRecord = reinterpret_cast<RecordHeader *>(itsSegment->base + itsOffset);
+                        itsRecord->size = uint32_t(itsSize);
+                        itsRecord->timestamp = itsTimestamp;
+                        itsRecord->instance = _instance;
+                        itsRecord->direction = uint8_t(_direction);
+                        itsRecord->reserved = 0;
+                        itsRecord->length = itsLength;
+                        uint8_t *itsMessage = reinterpret_cast<uint8_t *>(itsRecord + 1);
+                        writeHeader(itsMessage, _header, _payloadLength);
+                        if (_payloadLength > 0) {
+                            std::memcpy(itsMessage + SOMEIP_HEADER_SIZE, _payload, _payloadLength);
+                        }
+                        itsRecord->commit.store(COMMITTED, std::memory_order_release);
+                        release(itsSegment);
+                        return;
+                    }
+                    release(itsSegment);
+                    if (itsSize > fileSize_ - sizeof(FileHeader) || !rotate(itsSegment)) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            }
+
+            static std::string getFileName(const std::string &_path, uint64_t _sequence) {
+                return _path + "." + std::to_string(_sequence);
+            }
+
+        private:
+            struct Segment {
+                std::atomic<uint32_t> users;
+                uint8_t *base;
+                uint64_t sequence;
+            };
+
+            struct Configuration {
+                std::string path;
+                uint64_t fileSize;
+                uint32_t files;
+            };
+
+            explicit Writer(const Configuration &_configuration)
+                : Writer() {
+                if (!_configuration.path.empty()) {
+                    open(_configuration.path, _configuration.fileSize, _configuration.files);
+                }
+            }
+
+            static Configuration fromEnvironment() {
+                Configuration itsConfiguration { "", 64 * 1024 * 1024, 4 };
+                const char *itsPath = std::getenv("COMMONAPI_SOMEIP_CAPTURE");
+                if (itsPath != nullptr) {
+                    itsConfiguration.path = itsPath;
+                }
+                const char *itsFileSize = std::getenv("COMMONAPI_SOMEIP_CAPTURE_FILE_SIZE");
+                if (itsFileSize != nullptr) {
+                    itsConfiguration.fileSize = std::strtoull(itsFileSize, nullptr, 0);
+                }
+                const char *itsFiles = std::getenv("COMMONAPI_SOMEIP_CAPTURE_FILES");
+                if (itsFiles != nullptr) {
+                    itsConfiguration.files = uint32_t(std::strtoul(itsFiles, nullptr, 0));
+                }
+                return itsConfiguration;
+            }
+
+            // Returns the current segment and keeps it mapped until it is released
+            Segment *acquire() {
+                for (;;) {
+                    Segment *itsSegment = current_.load(std::memory_order_acquire);
+                    if (itsSegment == nullptr) {
+                        return nullptr;
+                    }
+                    itsSegment->users.fetch_add(1, std::memory_order_acq_rel);
+                    if (current_.load(std::memory_order_acquire) == itsSegment) {
+                        return itsSegment;
+                    }
+                    itsSegment->users.fetch_sub(1, std::memory_order_release);
+                }
+            }
+
+            void release(Segment *_segment) {
+                _segment->users.fetch_sub(1, std::memory_order_release);
+            }
+
+            static void writeHeader(uint8_t *_data, const MessageHeader &_header, uint32_t _payloadLength) {
+                const uint32_t itsLength = _payloadLength + 8;
+                _data[0] = uint8_t(_header.service >> 8);
+                _data[1] = uint8_t(_header.service);
+                _data[2] = uint8_t(_header.method >> 8);
+                _data[3] = uint8_t(_header.method);
+                _data[4] = uint8_t(itsLength >> 24);
+                _data[5] = uint8_t(itsLength >> 16);
+                _data[6] = uint8_t(itsLength >> 8);
+                _data[7] = uint8_t(itsLength);
+                _data[8] = uint8_t(_header.client >> 8);
+                _data[9] = uint8_t(_header.client);
+                _data[10] = uint8_t(_header.session >> 8);
+                _data[11] = uint8_t(_header.session);
+                _data[12] = 0x01;
+                _data[13] = _header.interfaceVersion;
+                _data[14] = _header.messageType;
+                _data[15] = _header.returnCode;
+            }
+
+            // Replaces the full segment by the next file. Only the first writer that
+            // finds the segment full creates the file, the others continue with it.
+            bool rotate(Segment *_full) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                if (current_.load(std::memory_order_acquire) != _full) {
+                    return (current_.load(std::memory_order_acquire) != nullptr);
+                }
+                Segment &itsNext = (_full == &segments_[0] ? segments_[1] : segments_[0]);
+                if (!map(itsNext, _full->sequence + 1)) {
+                    enabled_.store(false, std::memory_order_release);
+                    current_.store(nullptr, std::memory_order_release);
+                    unmap(*_full);
+                    return false;
+                }
+                current_.store(&itsNext, std::memory_order_release);
+                unmap(*_full);
+                if (itsNext.sequence >= files_) {
+                    ::unlink(getFileName(path_, itsNext.sequence - files_).c_str());
+                }
+                return true;
+            }
+
+            bool map(Segment &_segment, uint64_t _sequence) {
+        #ifndef _WIN32
+                const std::string itsName = getFileName(path_, _sequence);
+                int itsFd = ::open(itsName.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (itsFd < 0) {
+                    return false;
+                }
+                if (::ftruncate(itsFd, off_t(fileSize_)) != 0) {
+                    ::close(itsFd);
+                    return false;
+                }
+                int itsFlags = MAP_SHARED;
+        #ifdef MAP_POPULATE
+                // Avoid page faults while messages are written
+                itsFlags |= MAP_POPULATE;
+        #endif
+                void *itsBase = ::mmap(nullptr, size_t(fileSize_), PROT_READ | PROT_WRITE, itsFlags, itsFd, 0);
+                ::close(itsFd);
+                if (itsBase == MAP_FAILED) {
+                    return false;
+                }
+
+                FileHeader *itsFile = reinterpret_cast<FileHeader *>(itsBase);
+                std::memcpy(itsFile->magic, MAGIC, sizeof(MAGIC));
+                itsFile->version = VERSION;
+                itsFile->headerSize = uint16_t(sizeof(FileHeader));
+                itsFile->recordHeaderSize = uint16_t(sizeof(RecordHeader));
+                itsFile->byteOrder = BYTE_ORDER_MARK;
+                itsFile->sequence = _sequence;
+                itsFile->capacity = fileSize_;
+                itsFile->realtimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count();
+                itsFile->steadyNs = steadyNow();
+                itsFile->pid = uint32_t(::getpid());
+                itsFile->reserved = 0;
+                itsFile->used.store(sizeof(FileHeader), std::memory_order_release);
+
+                _segment.base = static_cast<uint8_t *>(itsBase);
+                _segment.sequence = _sequence;
+                return true;
+        #else
+                (void)_segment;
+                (void)_sequence;
+                return false;
+        #endif
+            }
+
+            // Waits until no writer uses the segment anymore and unmaps it
+            void unmap(Segment &_segment) {
+                while (_segment.users.load(std::memory_order_acquire) != 0) {
+                    std::this_thread::yield();
+                }
+        #ifndef _WIN32
+                if (_segment.base != nullptr) {
+                    ::munmap(_segment.base, size_t(fileSize_));
+                }
+        #endif
+                _segment.base = nullptr;
+            }
+
+            std::atomic<bool> enabled_;
+            std::atomic<Segment *> current_;
+            Segment segments_[2];
+            std::mutex mutex_;
+            std::string path_;
+            uint64_t fileSize_;
+            uint32_t files_;
+            std::atomic<uint64_t> dropped_;
+        };
+
+        /**
+         * Captures a request received by a stub adapter.
+         */
+        inline void captureRequest(uint16_t _service, uint16_t _instance, uint16_t _method,
+                                   uint16_t _client, uint16_t _session, uint8_t _interfaceVersion,
+                                   bool _isFireAndForget, const uint8_t *_payload, uint32_t _payloadLength) {
+            Writer &itsWriter = Writer::get();
+            if (itsWriter.isEnabled()) {
+                const MessageHeader itsHeader { _service, _method, _client, _session, _interfaceVersion,
+                                                (_isFireAndForget ? MT_REQUEST_NO_RETURN : MT_REQUEST), RC_OK };
+                itsWriter.write(Direction::REQUEST, _instance, itsHeader, _payload, _payloadLength);
+            }
+        }
+
+        /**
+         * A captured message as read from a capture file.
+         */
+        struct Record {
+            int64_t timestamp;
+            uint16_t instance;
+            Direction direction;
+            MessageHeader header;
+            std::vector<uint8_t> payload;
+        };
+
+        /**
+         * The values of a capture file header as read from a capture file.
+         */
+        struct FileInfo {
+            uint64_t sequence;
+            uint64_t capacity;
+            int64_t realtimeNs;
+            int64_t steadyNs;
+            uint64_t used;
+            uint32_t pid;
+        };
+
+        /**
+         * Reads the records of a capture file.
+         */
+        class Reader {
+        public:
+            Reader()
+                : info_(), recordHeaderSize_(0), offset_(0) {
+            }
+
+            bool open(const std::string &_file) {
+                std::ifstream itsFile(_file, std::ios::binary);
+                if (!itsFile) {
+                    return false;
+                }
+                data_.assign(std::istreambuf_iterator<char>(itsFile), std::istreambuf_iterator<char>());
+                if (data_.size() < sizeof(FileHeader)
+                        || std::memcmp(&data_[0], MAGIC, sizeof(MAGIC)) != 0
+                        || read<uint16_t>(8) != VERSION
+                        || read<uint16_t>(14) != BYTE_ORDER_MARK) {
+                    return false;
+                }
+                info_.sequence = read<uint64_t>(16);
+                info_.capacity = read<uint64_t>(24);
+                info_.realtimeNs = read<int64_t>(32);
+                info_.steadyNs = read<int64_t>(40);
+                info_.used = read<uint64_t>(48);
+                info_.pid = read<uint32_t>(56);
+                recordHeaderSize_ = read<uint16_t>(12);
+                offset_ = read<uint16_t>(10);
+                return (recordHeaderSize_ >= sizeof(RecordHeader));
+            }
+
+            const FileInfo &getInfo() const {
+                return info_;
+            }
+
+            /**
+             * Reads the next complete record. Returns false at the end of the records.
+             */
+            bool next(Record &_record) {
+                while (offset_ + sizeof(RecordHeader) <= data_.size()) {
+                    const uint32_t itsSize = read<uint32_t>(offset_);
+                    if (itsSize < recordHeaderSize_ || offset_ + itsSize > data_.size()) {
+                        return false;
+                    }
+                    const std::size_t itsRecord = offset_;
+                    offset_ += itsSize;
+                    const uint32_t itsLength = read<uint32_t>(itsRecord + 20);
+                    if (read<uint32_t>(itsRecord + 4) != COMMITTED
+                            || itsLength < SOMEIP_HEADER_SIZE
+                            || itsRecord + recordHeaderSize_ + itsLength > offset_) {
+                        continue;
+                    }
+                    const uint8_t *itsData = &data_[itsRecord + recordHeaderSize_];
+                    _record.timestamp = read<int64_t>(itsRecord + 8);
+                    _record.instance = read<uint16_t>(itsRecord + 16);
+                    _record.direction = Direction(data_[itsRecord + 18]);
+                    _record.header.service = uint16_t((itsData[0] << 8) | itsData[1]);
+                    _record.header.method = uint16_t((itsData[2] << 8) | itsData[3]);
+                    _record.header.client = uint16_t((itsData[8] << 8) | itsData[9]);
+                    _record.header.session = uint16_t((itsData[10] << 8) | itsData[11]);
+                    _record.header.interfaceVersion = itsData[13];
+                    _record.header.messageType = itsData[14];
+                    _record.header.returnCode = itsData[15];
+                    _record.payload.assign(itsData + SOMEIP_HEADER_SIZE, itsData + itsLength);
+                    return true;
+                }
+                return false;
+            }
+
+            /**
+             * The existing files of a capture, oldest first.
+             */
+            static std::vector<std::string> getFiles(const std::string &_path) {
+                std::vector<std::pair<uint64_t, std::string>> itsFiles;
+        #ifndef _WIN32
+                const std::size_t itsSeparator = _path.find_last_of('/');
+                const std::string itsDirectory = (itsSeparator == std::string::npos ? "." : _path.substr(0, itsSeparator + 1));
+                const std::string itsPrefix = (itsSeparator == std::string::npos ? _path : _path.substr(itsSeparator + 1)) + ".";
+                DIR *itsDir = ::opendir(itsDirectory.c_str());
+                if (itsDir != nullptr) {
+                    while (struct dirent *itsEntry = ::readdir(itsDir)) {
+                        const std::string itsName(itsEntry->d_name);
+                        if (itsName.size() > itsPrefix.size() && itsName.compare(0, itsPrefix.size(), itsPrefix) == 0
+                                && itsName.find_first_not_of("0123456789", itsPrefix.size()) == std::string::npos) {
+                            const uint64_t itsSequence = std::strtoull(itsName.c_str() + itsPrefix.size(), nullptr, 10);
+                            itsFiles.push_back(std::make_pair(itsSequence, Writer::getFileName(_path, itsSequence)));
+                        }
+                    }
+                    ::closedir(itsDir);
+                }
+        #endif
+                std::sort(itsFiles.begin(), itsFiles.end());
+                std::vector<std::string> itsNames;
+                for (auto &itsFile : itsFiles) {
+                    itsNames.push_back(itsFile.second);
+                }
+                return itsNames;
+            }
+
+        private:
+            template<typename T_>
+            T_ read(std::size_t _offset) const {
+                T_ itsValue;
+                std::memcpy(&itsValue, &data_[_offset], sizeof(T_));
+                return itsValue;
+            }
+
+            std::vector<uint8_t> data_;
+            FileInfo info_;
+            uint16_t recordHeaderSize_;
+            std::size_t offset_;
+        };
+
+        } // namespace Capture
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_CAPTURE_HPP_
+    '''
+}
@@ -0,0 +1,150 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the single flight getter of the proxy attributes that are deployed with
+ * SomeIpGetterCoalescing: concurrent asynchronous getter calls share one request and
+ * its reply is passed to all of them. The header does not depend on the model, it is
+ * written once to the default output directory.
+ */
+class SomeIPCoalescingGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateCoalescing(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipCoalescingHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateCoalescingHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipCoalescingHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateCoalescingHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_COALESCING_HPP_
+        #define COMMONAPI_SOMEIP_COALESCING_HPP_
+
+        #include <functional>
+        #include <future>
+        #include <map>
+        #include <memory>
+        #include <mutex>
+        #include <vector>
+
+        #include <CommonAPI/CallInfo.hpp>
+        #include <CommonAPI/Types.hpp>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Coalescing {
+
+        /**
+         * Single flight getter of an attribute (SomeIpGetterCoalescing).
+         *
+         * The first asynchronous getter call sends the request, calls that arrive while
+         * it is pending join it instead of sending their own. The reply is passed to the
+         * callbacks and futures of all calls in the order the calls arrived. A call that
+         * arrives after the reply sends a new request. Calls only join requests with the
+         * same timeout, so that no call waits longer than it asked for.
+         *
+         * The pending requests are shared with the reply handlers, replies that arrive
+         * after the attribute was destroyed are still delivered.
+         */
+        template<typename Value_>
+        class Getter {
+        public:
+            typedef std::function<void(const CommonAPI::CallStatus &, Value_)> Callback;
+            typedef std::function<std::future<CommonAPI::CallStatus>(Callback, const CommonAPI::CallInfo *)> Request;
+
+            Getter()
+                : defaultTimeout_(CommonAPI::CallInfo().timeout_),
+                  flights_(std::make_shared<Flights>()) {
+            }
+
+            std::future<CommonAPI::CallStatus> getValueAsync(Callback _callback, const CommonAPI::CallInfo *_info,
+                                                             const Request &_request) {
+                const CommonAPI::Timeout_t itsTimeout = (_info ? _info->timeout_ : defaultTimeout_);
+                std::promise<CommonAPI::CallStatus> itsPromise;
+                std::future<CommonAPI::CallStatus> itsFuture = itsPromise.get_future();
+                std::shared_ptr<Flight> itsFlight;
+                {
+                    std::lock_guard<std::mutex> itsLock(flights_->mutex_);
+                    std::shared_ptr<Flight> &itsPending = flights_->pending_[itsTimeout];
+                    if (itsPending) {
+                        itsPending->waiters_.push_back(Waiter(std::move(_callback), std::move(itsPromise)));
+                        return itsFuture;
+                    }
+                    itsPending = std::make_shared<Flight>();
+                    itsPending->waiters_.push_back(Waiter(std::move(_callback), std::move(itsPromise)));
+                    itsFlight = itsPending;
+                }
+
+                std::shared_ptr<Flights> itsFlights(flights_);
+                (void)_request([itsFlights, itsFlight, itsTimeout](const CommonAPI::CallStatus &_status, Value_ _value) {
+                    std::vector<Waiter> itsWaiters;
+                    {
+                        std::lock_guard<std::mutex> itsLock(itsFlights->mutex_);
+                        auto found = itsFlights->pending_.find(itsTimeout);
+                        if (found != itsFlights->pending_.end() && found->second == itsFlight)
+                            itsFlights->pending_.erase(found);
+                        itsWaiters.swap(itsFlight->waiters_);
+                    }
+                    for (auto &itsWaiter : itsWaiters) {
+                        if (itsWaiter.callback_)
+                            itsWaiter.callback_(_status, _value);
+                        itsWaiter.promise_.set_value(_status);
+                    }
+                }, _info);
+                return itsFuture;
+            }
+
+            // Number of calls that wait for a pending request
+            std::size_t getWaiting() const {
+                std::lock_guard<std::mutex> itsLock(flights_->mutex_);
+                std::size_t itsWaiting(0);
+                for (const auto &itsPending : flights_->pending_)
+                    itsWaiting += itsPending.second->waiters_.size();
+                return itsWaiting;
+            }
+
+        private:
+            struct Waiter {
+                Waiter(Callback _callback, std::promise<CommonAPI::CallStatus> _promise)
+                    : callback_(std::move(_callback)), promise_(std::move(_promise)) {
+                }
+
+                Callback callback_;
+                std::promise<CommonAPI::CallStatus> promise_;
+            };
+
+            struct Flight {
+                std::vector<Waiter> waiters_;
+            };
+
+            struct Flights {
+                mutable std::mutex mutex_;
+                std::map<CommonAPI::Timeout_t, std::shared_ptr<Flight>> pending_;
+            };
+
+            const CommonAPI::Timeout_t defaultTimeout_;
+            std::shared_ptr<Flights> flights_;
+        };
+
+        } // namespace Coalescing
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_COALESCING_HPP_
+    '''
+}
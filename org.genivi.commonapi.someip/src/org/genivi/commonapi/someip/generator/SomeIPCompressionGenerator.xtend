@@ -0,0 +1,378 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the compression of String and ByteBuffer attributes and arguments that
+ * are deployed with SomeIpAttrCompressionThreshold or SomeIpArgCompressionThreshold:
+ * the LZ4 block codec, the frame format and the stream operators that are selected
+ * by the deployment type of the element. The header does not depend on the model,
+ * it is written once to the default output directory.
+ */
+class SomeIPCompressionGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateCompression(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipCompressionHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateCompressionHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipCompressionHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateCompressionHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_COMPRESSION_HPP_
+        #define COMMONAPI_SOMEIP_COMPRESSION_HPP_
+
+        #include <cstdint>
+        #include <cstring>
+        #include <string>
+        #include <vector>
+
+        #ifdef COMMONAPI_SOMEIP_COMPRESSION_LZ4
+        #include <lz4.h>
+        #endif
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Compression of String and ByteBuffer values (SomeIpAttrCompressionThreshold,
+         * SomeIpArgCompressionThreshold).
+         *
+         * A compressed element is sent as ByteBuffer with a 32 bit length field that
+         * contains a frame:
+         *
+         *   uint8_t  codec              0 = stored, 1 = LZ4
+         *   uint32_t size               little endian, only if codec == 1
+         *   uint8_t  data[]             the value (stored) or an LZ4 block
+         *
+         * Values shorter than the threshold and values that do not become smaller are
+         * stored. Strings are sent as their UTF-8 bytes without terminator, the length,
+         * length width and encoding deployments of the element do not apply.
+         *
+         * The LZ4 block format is implemented here. If COMMONAPI_SOMEIP_COMPRESSION_LZ4
+         * is defined, liblz4 is used instead; both produce compatible blocks.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Compression {
+
+        static const uint8_t CODEC_STORED = 0;
+        static const uint8_t CODEC_LZ4 = 1;
+        static const std::size_t HEADER_SIZE = 5;
+
+        namespace Lz4 {
+
+        static const std::size_t MIN_MATCH = 4;
+        static const std::size_t LAST_LITERALS = 5;     // the last bytes are always literals
+        static const std::size_t MATCH_LIMIT = 12;      // the last match starts before this
+        static const std::size_t MAX_OFFSET = 65535;
+        static const unsigned HASH_BITS = 12;
+
+        inline std::size_t bound(std::size_t _size) {
+            return _size + _size / 255 + 16;
+        }
+
+        inline uint32_t read32(const uint8_t *_p) {
+            uint32_t itsValue;
+            std::memcpy(&itsValue, _p, sizeof(itsValue));
+            return itsValue;
+        }
+
+        inline uint32_t hash(uint32_t _sequence) {
+            return (_sequence * 2654435761U) >> (32 - HASH_BITS);
+        }
+
+        inline uint8_t *writeLength(uint8_t *_op, std::size_t _length) {
+            while (_length >= 255) {
+                *_op++ = 255;
+                _length -= 255;
+            }
+            *_op++ = static_cast<uint8_t>(_length);
+            return _op;
+        }
+
+        inline uint8_t *writeSequence(uint8_t *_op, const uint8_t *_literals, std::size_t _literalLength,
+                                      std::size_t _offset, std::size_t _matchLength) {
+            uint8_t *itsToken = _op++;
+            *itsToken = static_cast<uint8_t>((_literalLength < 15 ? _literalLength : 15) << 4);
+            if (_literalLength >= 15) {
+                _op = writeLength(_op, _literalLength - 15);
+            }
+            std::memcpy(_op, _literals, _literalLength);
+            _op += _literalLength;
+            if (_matchLength > 0) {
+                *_op++ = static_cast<uint8_t>(_offset);
+                *_op++ = static_cast<uint8_t>(_offset >> 8);
+                const std::size_t itsLength = _matchLength - MIN_MATCH;
+                *itsToken = static_cast<uint8_t>(*itsToken | (itsLength < 15 ? itsLength : 15));
+                if (itsLength >= 15) {
+                    _op = writeLength(_op, itsLength - 15);
+                }
+            }
+            return _op;
+        }
+
+        // Greedy compression with a single hash table. Returns the size of the block,
+        // the destination must hold bound(_size) bytes.
+        inline std::size_t compress(const uint8_t *_source, std::size_t _size, uint8_t *_destination) {
+            uint8_t *op = _destination;
+            const uint8_t *anchor = _source;
+            if (_size > MATCH_LIMIT) {
+                uint32_t itsTable[1 << HASH_BITS] = { 0 };
+                const uint8_t *ip = _source + 1;
+                const uint8_t *itsMatchLimit = _source + _size - MATCH_LIMIT;
+                const uint8_t *itsEnd = _source + _size - LAST_LITERALS;
+                unsigned itsMisses = 0;
+                while (ip <= itsMatchLimit) {
+                    const uint32_t itsSequence = read32(ip);
+                    const uint32_t itsHash = hash(itsSequence);
+                    const uint8_t *itsReference = _source + itsTable[itsHash];
+                    itsTable[itsHash] = static_cast<uint32_t>(ip - _source);
+                    if (itsReference >= ip || std::size_t(ip - itsReference) > MAX_OFFSET
+                            || read32(itsReference) != itsSequence) {
+                        // Skips faster through incompressible data
+                        ip += 1 + (itsMisses++ >> 6);
+                        continue;
+                    }
+                    itsMisses = 0;
+                    while (ip > anchor && itsReference > _source && ip[-1] == itsReference[-1]) {
+                        ip--;
+                        itsReference--;
+                    }
+                    std::size_t itsLength = MIN_MATCH;
+                    while (ip + itsLength < itsEnd && ip[itsLength] == itsReference[itsLength]) {
+                        itsLength++;
+                    }
+                    op = writeSequence(op, anchor, std::size_t(ip - anchor), std::size_t(ip - itsReference), itsLength);
+                    ip += itsLength;
+                    anchor = ip;
+                    if (ip - 2 >= _source) {
+                        itsTable[hash(read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - _source);
+                    }
+                }
+            }
+            op = writeSequence(op, anchor, std::size_t(_source + _size - anchor), 0, 0);
+            return std::size_t(op - _destination);
+        }
+
+        inline bool readLength(const uint8_t *&_ip, const uint8_t *_end, std::size_t &_length) {
+            uint8_t itsByte;
+            do {
+                if (_ip >= _end) {
+                    return false;
+                }
+                itsByte = *_ip++;
+                _length += itsByte;
+            } while (itsByte == 255);
+            return true;
+        }
+
+        // Decompresses a block into exactly _size bytes. Returns false for corrupt blocks.
+        inline bool decompress(const uint8_t *_source, std::size_t _sourceSize,
+                               uint8_t *_destination, std::size_t _size) {
+            const uint8_t *ip = _source;
+            const uint8_t *itsSourceEnd = _source + _sourceSize;
+            uint8_t *op = _destination;
+            uint8_t *itsEnd = _destination + _size;
+            for (;;) {
+                if (ip >= itsSourceEnd) {
+                    return false;
+                }
+                const uint8_t itsToken = *ip++;
+                std::size_t itsLiterals = itsToken >> 4;
+                if (itsLiterals == 15 && !readLength(ip, itsSourceEnd, itsLiterals)) {
+                    return false;
+                }
+                if (itsLiterals > std::size_t(itsSourceEnd - ip) || itsLiterals > std::size_t(itsEnd - op)) {
+                    return false;
+                }
+                std::memcpy(op, ip, itsLiterals);
+                ip += itsLiterals;
+                op += itsLiterals;
+                if (ip == itsSourceEnd) {
+                    return (op == itsEnd);
+                }
+                if (itsSourceEnd - ip < 2) {
+                    return false;
+                }
+                const std::size_t itsOffset = std::size_t(ip[0]) | (std::size_t(ip[1]) << 8);
+                ip += 2;
+                if (itsOffset == 0 || itsOffset > std::size_t(op - _destination)) {
+                    return false;
+                }
+                std::size_t itsLength = itsToken & 15;
+                if (itsLength == 15 && !readLength(ip, itsSourceEnd, itsLength)) {
+                    return false;
+                }
+                itsLength += MIN_MATCH;
+                if (itsLength > std::size_t(itsEnd - op)) {
+                    return false;
+                }
+                const uint8_t *itsMatch = op - itsOffset;
+                if (itsOffset >= itsLength) {
+                    std::memcpy(op, itsMatch, itsLength);
+                    op += itsLength;
+                } else {
+                    // Overlapping copy repeats the last itsOffset bytes
+                    for (std::size_t i = 0; i < itsLength; i++) {
+                        *op++ = itsMatch[i];
+                    }
+                }
+            }
+        }
+
+        } // namespace Lz4
+
+        // Writes the frame of a value
+        inline void encode(const uint8_t *_data, std::size_t _size, uint32_t _threshold, std::vector<uint8_t> &_frame) {
+            if (_size >= _threshold && _size <= 0x7E000000) {
+                _frame.resize(HEADER_SIZE + Lz4::bound(_size));
+        #ifdef COMMONAPI_SOMEIP_COMPRESSION_LZ4
+                const int itsResult = LZ4_compress_default(reinterpret_cast<const char *>(_data),
+                        reinterpret_cast<char *>(&_frame[HEADER_SIZE]),
+                        static_cast<int>(_size), static_cast<int>(_frame.size() - HEADER_SIZE));
+                const std::size_t itsCompressed = (itsResult > 0 ? std::size_t(itsResult) : _size);
+        #else
+                const std::size_t itsCompressed = Lz4::compress(_data, _size, &_frame[HEADER_SIZE]);
+        #endif
+                if (itsCompressed + HEADER_SIZE < _size + 1) {
+                    _frame[0] = CODEC_LZ4;
+                    for (std::size_t i = 0; i < 4; i++) {
+                        _frame[1 + i] = static_cast<uint8_t>(_size >> (8 * i));
+                    }
+                    _frame.resize(HEADER_SIZE + itsCompressed);
+                    return;
+                }
+            }
+            _frame.resize(1 + _size);
+            _frame[0] = CODEC_STORED;
+            if (_size > 0) {
+                std::memcpy(&_frame[1], _data, _size);
+            }
+        }
+
+        // Reads the value of a frame. Returns false for corrupt frames.
+        template<typename Value_>
+        bool decode(const std::vector<uint8_t> &_frame, Value_ &_value) {
+            if (_frame.empty()) {
+                return false;
+            }
+            if (_frame[0] == CODEC_STORED) {
+                _value.assign(_frame.begin() + 1, _frame.end());
+                return true;
+            }
+            if (_frame[0] != CODEC_LZ4 || _frame.size() < HEADER_SIZE + 1) {
+                return false;
+            }
+            std::size_t itsSize(0);
+            for (std::size_t i = 0; i < 4; i++) {
+                itsSize |= std::size_t(_frame[1 + i]) << (8 * i);
+            }
+            // An LZ4 block expands at most 255 times, larger sizes are corrupt
+            const std::size_t itsCompressed = _frame.size() - HEADER_SIZE;
+            if (itsSize / 255 > itsCompressed) {
+                return false;
+            }
+            _value.resize(itsSize);
+            if (itsSize == 0) {
+                return false;
+            }
+        #ifdef COMMONAPI_SOMEIP_COMPRESSION_LZ4
+            return (LZ4_decompress_safe(reinterpret_cast<const char *>(&_frame[HEADER_SIZE]),
+                                        reinterpret_cast<char *>(&_value[0]),
+                                        static_cast<int>(itsCompressed), static_cast<int>(itsSize))
+                    == static_cast<int>(itsSize));
+        #else
+            return Lz4::decompress(&_frame[HEADER_SIZE], itsCompressed,
+                                   reinterpret_cast<uint8_t *>(&_value[0]), itsSize);
+        #endif
+        }
+
+        /*
+         * Deployment of a compressed element. The threshold is part of the type, so that
+         * the serialization below is selected for all Deployables of the element, with or
+         * without a deployment object.
+         */
+        template<typename Inner_, uint32_t Threshold_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        inline CommonAPI::OutputStream<OutputStream> &writeFrame(CommonAPI::OutputStream<OutputStream> &_output,
+                const uint8_t *_data, std::size_t _size, uint32_t _threshold) {
+            ByteBuffer itsFrame;
+            encode(_data, _size, _threshold, itsFrame);
+            static_cast<OutputStream &>(_output).writeValue(itsFrame, static_cast<const ByteBufferDeployment *>(nullptr));
+            return _output;
+        }
+
+        template<typename Value_>
+        CommonAPI::InputStream<InputStream> &readFrame(CommonAPI::InputStream<InputStream> &_input, Value_ &_value) {
+            ByteBuffer itsFrame;
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            itsInput.readValue(itsFrame, static_cast<const ByteBufferDeployment *>(nullptr));
+            if (!itsInput.hasError() && !decode(itsFrame, _value)) {
+                COMMONAPI_ERROR("SomeIP compression: dropped corrupt frame of ", itsFrame.size(), " bytes");
+                _value.clear();
+                itsInput.setError();
+            }
+            return _input;
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<ByteBuffer, Deployment<Inner_, Threshold_>> &_value) {
+            const ByteBuffer &itsValue = _value.getValue();
+            return writeFrame(_output, itsValue.data(), itsValue.size(), Threshold_);
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::string, Deployment<Inner_, Threshold_>> &_value) {
+            const std::string &itsValue = _value.getValue();
+            return writeFrame(_output, reinterpret_cast<const uint8_t *>(itsValue.data()), itsValue.size(), Threshold_);
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<ByteBuffer, Deployment<Inner_, Threshold_>> &_value) {
+            return readFrame(_input, _value.getValue());
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::string, Deployment<Inner_, Threshold_>> &_value) {
+            return readFrame(_input, _value.getValue());
+        }
+
+        } // namespace Compression
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_COMPRESSION_HPP_
+    '''
+}
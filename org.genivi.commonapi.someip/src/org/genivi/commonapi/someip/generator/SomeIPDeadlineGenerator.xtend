@@ -0,0 +1,302 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the cancellation of asynchronous proxy calls and the load shedding of stub
+ * adapters (generator option -dl). The header does not depend on the model, it is
+ * written once to the default output directory.
+ */
+class SomeIPDeadlineGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateDeadline(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipDeadlineHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateDeadlineHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipDeadlineHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateDeadlineHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_DEADLINE_HPP_
+        #define COMMONAPI_SOMEIP_DEADLINE_HPP_
+
+        #include <algorithm>
+        #include <atomic>
+        #include <chrono>
+        #include <cstdint>
+        #include <functional>
+        #include <future>
+        #include <map>
+        #include <memory>
+        #include <mutex>
+        #include <type_traits>
+        #include <vector>
+
+        #include <CommonAPI/CallInfo.hpp>
+        #include <CommonAPI/Types.hpp>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Deadline {
+
+        // Status passed to the callback and future of a call that was cancelled. CommonAPI
+        // has no status of its own for it, the call neither failed locally nor remotely.
+        //
+        // The value is CallStatus::UNKNOWN, which the runtime may also report for a call
+        // that was not cancelled: the status does not show the cancellation. A callback
+        // that must know checks Token::isCancelled() of the token it called with, the
+        // caller of a Call checks Call::isCancelled().
+        static const CommonAPI::CallStatus CANCELLED = CommonAPI::CallStatus::UNKNOWN;
+
+        class Cancellable {
+        public:
+            virtual ~Cancellable() {}
+            virtual void cancel() = 0;
+        };
+
+        /**
+         * Cancels the asynchronous calls that were made in a Scope of the token. The
+         * callbacks of pending calls are called with CANCELLED at once, their replies
+         * are dropped when they arrive. Calls made after cancel() are not sent.
+         *
+         * Copies of a token share its state, cancel() may be called from any thread.
+         */
+        class Token {
+        public:
+            Token()
+                : state_(std::make_shared<State>()) {
+            }
+
+            void cancel() {
+                std::vector<std::weak_ptr<Cancellable>> itsCalls;
+                {
+                    std::lock_guard<std::mutex> itsLock(state_->mutex_);
+                    if (state_->isCancelled_)
+                        return;
+                    state_->isCancelled_ = true;
+                    itsCalls.swap(state_->calls_);
+                }
+                for (auto &itsCall : itsCalls) {
+                    std::shared_ptr<Cancellable> itsPending = itsCall.lock();
+                    if (itsPending)
+                        itsPending->cancel();
+                }
+            }
+
+            bool isCancelled() const {
+                std::lock_guard<std::mutex> itsLock(state_->mutex_);
+                return state_->isCancelled_;
+            }
+
+            // A call that is added to a cancelled token is cancelled at once
+            void add(const std::shared_ptr<Cancellable> &_call) const {
+                {
+                    std::lock_guard<std::mutex> itsLock(state_->mutex_);
+                    if (!state_->isCancelled_) {
+                        std::vector<std::weak_ptr<Cancellable>> &itsCalls = state_->calls_;
+                        if (itsCalls.size() == itsCalls.capacity()) {
+                            itsCalls.erase(std::remove_if(itsCalls.begin(), itsCalls.end(),
+                                [](const std::weak_ptr<Cancellable> &_pending) { return _pending.expired(); }),
+                                itsCalls.end());
+                        }
+                        itsCalls.push_back(_call);
+                        return;
+                    }
+                }
+                _call->cancel();
+            }
+
+            // Token of the innermost scope of the calling thread, nullptr if there is none
+            static const Token *getCurrent() {
+                return current();
+            }
+
+        private:
+            friend class Scope;
+
+            static const Token *&current() {
+                static thread_local const Token *itsCurrent(nullptr);
+                return itsCurrent;
+            }
+
+            struct State {
+                State() : isCancelled_(false) {}
+
+                mutable std::mutex mutex_;
+                bool isCancelled_;
+                std::vector<std::weak_ptr<Cancellable>> calls_;
+            };
+
+            std::shared_ptr<State> state_;
+        };
+
+        /**
+         * Makes the token the current token of the calling thread until the scope ends.
+         * The asynchronous proxy calls made in the scope can be cancelled by the token.
+         * Scopes may be nested, the innermost scope wins.
+         */
+        class Scope {
+        public:
+            explicit Scope(const Token &_token)
+                : token_(_token), previous_(Token::current()) {
+                Token::current() = &token_;
+            }
+
+            ~Scope() {
+                Token::current() = previous_;
+            }
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            const Token token_;
+            const Token *previous_;
+        };
+
+        /**
+         * A pending asynchronous call of a proxy method. Either the reply or the
+         * cancellation completes the call, whichever comes first, the other one is
+         * dropped. A cancelled call passes default constructed values to the callback.
+         *
+         * The call is kept alive by the reply handler of the connection, the token only
+         * refers to it. Callback_ may be a reference type, the call keeps a copy.
+         */
+        template<typename Callback_, typename... Values_>
+        class Call : public Cancellable {
+        public:
+            explicit Call(Callback_ _callback)
+                : callback_(_callback), isDone_(false), isCancelled_(false) {
+            }
+
+            // Creates the call and adds it to the current token of the calling thread
+            static std::shared_ptr<Call> create(Callback_ _callback) {
+                std::shared_ptr<Call> itsCall = std::make_shared<Call>(_callback);
+                const Token *itsToken = Token::getCurrent();
+                if (itsToken)
+                    itsToken->add(itsCall);
+                return itsCall;
+            }
+
+            template<typename... Arguments_>
+            void complete(const CommonAPI::CallStatus &_status, Arguments_ &&... _arguments) {
+                if (isDone_.exchange(true))
+                    return;
+                finish(_status, std::forward<Arguments_>(_arguments)...);
+            }
+
+            void cancel() {
+                if (isDone_.exchange(true))
+                    return;
+                isCancelled_ = true;
+                finish(CANCELLED, Values_()...);
+            }
+
+            bool isDone() const {
+                return isDone_;
+            }
+
+            // True if the call was completed by its token, false if by a reply, also by
+            // one with CallStatus::UNKNOWN. Set before the callback is called.
+            bool isCancelled() const {
+                return isCancelled_;
+            }
+
+            // May be called once
+            std::future<CommonAPI::CallStatus> getFuture() {
+                return promise_.get_future();
+            }
+
+        private:
+            template<typename... Arguments_>
+            void finish(const CommonAPI::CallStatus &_status, Arguments_ &&... _arguments) {
+                if (callback_)
+                    callback_(_status, std::forward<Arguments_>(_arguments)...);
+                promise_.set_value(_status);
+            }
+
+            typename std::decay<Callback_>::type callback_;
+            std::atomic<bool> isDone_;
+            std::atomic<bool> isCancelled_;
+            std::promise<CommonAPI::CallStatus> promise_;
+        };
+
+        /**
+         * Drops the requests of a stub adapter whose callers have given up. A request
+         * expires when its deadline has passed since it was received, the dispatch
+         * task of an expired request neither calls the stub nor sends a reply.
+         *
+         * SOME/IP does not transport the timeout or deadline of the caller. The deadline
+         * is the timeout the method is deployed with, a caller that waits longer or
+         * shorter than that is not taken into account.
+         */
+        class Shedder {
+        public:
+            typedef std::chrono::steady_clock Clock;
+            typedef std::function<void()> Task;
+
+            Shedder()
+                : dropped_(0) {
+            }
+
+            // Deadline of methods without deployed timeout, the default timeout of CommonAPI
+            static std::chrono::milliseconds getDefaultDeadline() {
+                return std::chrono::milliseconds(CommonAPI::CallInfo().timeout_);
+            }
+
+            // Wraps the dispatch task of a request that was received now. The shedder
+            // must outlive the task.
+            Task guard(uint16_t _method, std::chrono::milliseconds _deadline, Task _task) {
+                const Clock::time_point itsExpiry(Clock::now() + _deadline);
+                return [this, _method, itsExpiry, _task]() {
+                    if (Clock::now() >= itsExpiry) {
+                        drop(_method);
+                        return;
+                    }
+                    _task();
+                };
+            }
+
+            uint64_t getDropped() const {
+                return dropped_;
+            }
+
+            uint64_t getDropped(uint16_t _method) const {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                auto found = droppedByMethod_.find(_method);
+                return (found != droppedByMethod_.end() ? found->second : 0);
+            }
+
+        private:
+            void drop(uint16_t _method) {
+                dropped_++;
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                droppedByMethod_[_method]++;
+            }
+
+            std::atomic<uint64_t> dropped_;
+            mutable std::mutex mutex_;
+            std::map<uint16_t, uint64_t> droppedByMethod_;
+        };
+
+        } // namespace Deadline
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_DEADLINE_HPP_
+    '''
+}
@@ -0,0 +1,446 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the helpers of the delta notifications of observable array and map
+ * attributes that are deployed with SomeIpNotifierDeltaID and SomeIpNotifierDeltaResyncID:
+ * the changes between two values and their deployment, the sequence numbering of the
+ * stub adapter and the copy of the attribute in the proxy. The header does not depend on the model, it is written
+ * once to the default output directory.
+ */
+class SomeIPDeltaGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateDelta(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipDeltaHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateDeltaHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipDeltaHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateDeltaHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_DELTA_HPP_
+        #define COMMONAPI_SOMEIP_DELTA_HPP_
+
+        #include <cstdint>
+        #include <functional>
+        #include <memory>
+        #include <mutex>
+        #include <unordered_map>
+        #include <vector>
+
+        #include <CommonAPI/SomeIP/Deployment.hpp>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Delta {
+
+        typedef uint32_t Sequence;
+
+        /**
+         * Changes between two values of a map: the inserted or updated entries and the
+         * keys of the removed entries.
+         */
+        template<typename Key_, typename Value_, typename... Rest_>
+        void diff(const std::unordered_map<Key_, Value_, Rest_...> &_old,
+                  const std::unordered_map<Key_, Value_, Rest_...> &_new,
+                  std::unordered_map<Key_, Value_, Rest_...> &_upserts,
+                  std::vector<Key_> &_removed) {
+            _upserts.clear();
+            _removed.clear();
+            for (const auto &itsEntry : _new) {
+                auto itsOld = _old.find(itsEntry.first);
+                if (itsOld == _old.end() || !(itsOld->second == itsEntry.second)) {
+                    _upserts.insert(itsEntry);
+                }
+            }
+            for (const auto &itsEntry : _old) {
+                if (_new.find(itsEntry.first) == _new.end()) {
+                    _removed.push_back(itsEntry.first);
+                }
+            }
+        }
+
+        template<typename Key_, typename Value_, typename... Rest_>
+        void apply(std::unordered_map<Key_, Value_, Rest_...> &_value,
+                   const std::unordered_map<Key_, Value_, Rest_...> &_upserts,
+                   const std::vector<Key_> &_removed) {
+            for (const auto &itsKey : _removed) {
+                _value.erase(itsKey);
+            }
+            for (const auto &itsEntry : _upserts) {
+                auto itsIterator = _value.find(itsEntry.first);
+                if (itsIterator != _value.end()) {
+                    itsIterator->second = itsEntry.second;
+                } else {
+                    _value.insert(itsEntry);
+                }
+            }
+        }
+
+        /**
+         * Changes between two values of an array: the indexes and values of the changed
+         * or appended elements. The length of the new value is sent with the changes.
+         */
+        template<typename Element_, typename... Rest_>
+        void diff(const std::vector<Element_, Rest_...> &_old,
+                  const std::vector<Element_, Rest_...> &_new,
+                  std::vector<uint32_t> &_indexes,
+                  std::vector<Element_, Rest_...> &_values) {
+            _indexes.clear();
+            _values.clear();
+            for (std::size_t i = 0; i < _new.size(); i++) {
+                if (i >= _old.size() || !(_old[i] == _new[i])) {
+                    _indexes.push_back(static_cast<uint32_t>(i));
+                    _values.push_back(_new[i]);
+                }
+            }
+        }
+
+        // Returns false if the changes do not fit the length
+        template<typename Element_, typename... Rest_>
+        bool apply(std::vector<Element_, Rest_...> &_value,
+                   uint32_t _length,
+                   const std::vector<uint32_t> &_indexes,
+                   const std::vector<Element_, Rest_...> &_values) {
+            if (_indexes.size() != _values.size()) {
+                return false;
+            }
+            for (auto itsIndex : _indexes) {
+                if (itsIndex >= _length) {
+                    return false;
+                }
+            }
+            _value.resize(_length);
+            for (std::size_t i = 0; i < _indexes.size(); i++) {
+                _value[_indexes[i]] = _values[i];
+            }
+            return true;
+        }
+
+        /**
+         * Keeps the last sent value of an attribute and numbers the updates. The mutex
+         * must be held while an update is computed and sent, so that the events leave
+         * in the order of their sequence numbers.
+         */
+        template<typename Value_>
+        class Sender {
+        public:
+            Sender()
+                : sequence_(0), hasValue_(false) {
+            }
+
+            std::mutex &getMutex() {
+                return mutex_;
+            }
+
+            // The last sent value and its sequence number, nullptr if nothing was sent
+            const Value_ *getKeyframe(Sequence &_sequence) const {
+                _sequence = sequence_;
+                return (hasValue_ ? &value_ : nullptr);
+            }
+
+            // The value the next changes are based on and its sequence number, as returned
+            // by the resync request. If nothing was sent yet, _current becomes that value.
+            const Value_ &getKeyframe(const Value_ &_current, Sequence &_sequence) {
+                if (!hasValue_) {
+                    value_ = _current;
+                    hasValue_ = true;
+                }
+                _sequence = sequence_;
+                return value_;
+            }
+
+        protected:
+            Sequence next() {
+                hasValue_ = true;
+                return ++sequence_;
+            }
+
+            std::mutex mutex_;
+            Sequence sequence_;
+            bool hasValue_;
+            Value_ value_;
+        };
+
+        template<typename Map_>
+        class MapSender : public Sender<Map_> {
+        public:
+            typedef std::vector<typename Map_::key_type> Keys;
+
+            /**
+             * Computes the changes to the last sent value. Returns true if the value is
+             * to be sent as keyframe instead: for the first value and if the changes are
+             * not considerably smaller than the value.
+             */
+            bool update(const Map_ &_value, Sequence &_sequence, Map_ &_upserts, Keys &_removed) {
+                bool isFull(!this->hasValue_);
+                if (!isFull) {
+                    diff(this->value_, _value, _upserts, _removed);
+                    isFull = (2 * (_upserts.size() + _removed.size()) > _value.size());
+                }
+                if (isFull) {
+                    _upserts.clear();
+                    _removed.clear();
+                    this->value_ = _value;
+                } else {
+                    apply(this->value_, _upserts, _removed);
+                }
+                _sequence = this->next();
+                return isFull;
+            }
+        };
+
+        template<typename Vector_>
+        class ArraySender : public Sender<Vector_> {
+        public:
+            // See MapSender::update
+            bool update(const Vector_ &_value, Sequence &_sequence, std::vector<uint32_t> &_indexes, Vector_ &_values) {
+                bool isFull(!this->hasValue_);
+                if (!isFull) {
+                    diff(this->value_, _value, _indexes, _values);
+                    isFull = (2 * _indexes.size() > _value.size());
+                }
+                if (isFull) {
+                    _indexes.clear();
+                    _values.clear();
+                    this->value_ = _value;
+                } else {
+                    apply(this->value_, static_cast<uint32_t>(_value.size()), _indexes, _values);
+                }
+                _sequence = this->next();
+                return isFull;
+            }
+        };
+
+        /**
+         * Deployment of the changes of an array or map attribute: the deployment of the
+         * attribute without its minimum length, as the changes may be shorter than the
+         * value. The elements keep their deployment. nullptr if the attribute has none.
+         */
+        template<typename Deployment_>
+        std::shared_ptr<Deployment_> getChangesDeployment(const Deployment_ *_deployment) {
+            if (_deployment == nullptr)
+                return nullptr;
+            std::shared_ptr<Deployment_> itsDeployment = std::make_shared<Deployment_>(*_deployment);
+            itsDeployment->minLength_ = 0;
+            return itsDeployment;
+        }
+
+        // Deployment of the removed keys of a map attribute, the keys keep their deployment
+        template<typename KeyDeployment_, typename Deployment_>
+        std::shared_ptr<ArrayDeployment<KeyDeployment_>> getKeysDeployment(const Deployment_ *_deployment) {
+            if (_deployment == nullptr)
+                return nullptr;
+            return std::make_shared<ArrayDeployment<KeyDeployment_>>(_deployment->key_, 0, 0, 4);
+        }
+
+        enum class Result {
+            APPLIED,
+            DISCARDED,
+            RESYNC      // a keyframe must be requested
+        };
+
+        /**
+         * Checks the sequence numbers of received updates. Changes are only applied in
+         * order on top of a keyframe; a gap desynchronizes the receiver until the next
+         * keyframe.
+         */
+        class Receiver {
+        public:
+            Receiver()
+                : sequence_(0), isSynchronized_(false) {
+            }
+
+            Result onKeyframe(Sequence _sequence) {
+                if (isSynchronized_ && _sequence == sequence_) {
+                    return Result::DISCARDED;
+                }
+                sequence_ = _sequence;
+                isSynchronized_ = true;
+                return Result::APPLIED;
+            }
+
+            // A keyframe returned by the resync request may be overtaken by later changes,
+            // it is only applied if it is newer than the applied changes.
+            Result onResync(Sequence _sequence) {
+                if (isSynchronized_ && Sequence(sequence_ - _sequence) < 0x80000000u) {
+                    return Result::DISCARDED;
+                }
+                sequence_ = _sequence;
+                isSynchronized_ = true;
+                return Result::APPLIED;
+            }
+
+            Result onChanges(Sequence _sequence) {
+                if (isSynchronized_) {
+                    if (_sequence == Sequence(sequence_ + 1)) {
+                        sequence_ = _sequence;
+                        return Result::APPLIED;
+                    }
+                    if (_sequence == sequence_) {
+                        return Result::DISCARDED;
+                    }
+                }
+                isSynchronized_ = false;
+                return Result::RESYNC;
+            }
+
+            void reset() {
+                isSynchronized_ = false;
+            }
+
+            bool isSynchronized() const {
+                return isSynchronized_;
+            }
+
+        private:
+            Sequence sequence_;
+            bool isSynchronized_;
+        };
+
+        /**
+         * The local copy of an attribute that is updated by keyframes and changes. The
+         * handler is called with the new value while the copy is locked; the mutex is
+         * recursive so that a handler may read the copy again.
+         */
+        template<typename Value_>
+        class Replica {
+        public:
+            typedef std::function<void (const Value_ &)> Handler;
+
+            // Calls the handler with the value if the copy is synchronized
+            bool read(const Handler &_handler) const {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                if (!receiver_.isSynchronized()) {
+                    return false;
+                }
+                _handler(value_);
+                return true;
+            }
+
+            void reset() {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                receiver_.reset();
+                value_ = Value_();
+            }
+
+            // Applies the value and sequence number returned by the resync request
+            Result resync(Sequence _sequence, const Value_ &_value, const Handler &_handler) {
+                std::lock_guard<std::recursive_mutex> itsLock(mutex_);
+                const Result itsResult = receiver_.onResync(_sequence);
+                if (itsResult == Result::APPLIED) {
+                    value_ = _value;
+                    _handler(value_);
+                }
+                return itsResult;
+            }
+
+        protected:
+            Result keyframe(Sequence _sequence, const Value_ &_value, const Handler &_handler) {
+                const Result itsResult = receiver_.onKeyframe(_sequence);
+                if (itsResult == Result::APPLIED) {
+                    value_ = _value;
+                    _handler(value_);
+                }
+                return itsResult;
+            }
+
+            mutable std::recursive_mutex mutex_;
+            Receiver receiver_;
+            Value_ value_;
+        };
+
+        template<typename Map_>
+        class MapReplica : public Replica<Map_> {
+        public:
+            typedef std::vector<typename Map_::key_type> Keys;
+
+            Result receive(Sequence _sequence, bool _isFull, const Map_ &_upserts, const Keys &_removed,
+                           const typename Replica<Map_>::Handler &_handler) {
+                std::lock_guard<std::recursive_mutex> itsLock(this->mutex_);
+                if (_isFull) {
+                    return this->keyframe(_sequence, _upserts, _handler);
+                }
+                const Result itsResult = this->receiver_.onChanges(_sequence);
+                if (itsResult == Result::APPLIED) {
+                    apply(this->value_, _upserts, _removed);
+                    _handler(this->value_);
+                }
+                return itsResult;
+            }
+        };
+
+        template<typename Vector_>
+        class ArrayReplica : public Replica<Vector_> {
+        public:
+            Result receive(Sequence _sequence, bool _isFull, uint32_t _length,
+                           const std::vector<uint32_t> &_indexes, const Vector_ &_values,
+                           const typename Replica<Vector_>::Handler &_handler) {
+                std::lock_guard<std::recursive_mutex> itsLock(this->mutex_);
+                if (_isFull) {
+                    return this->keyframe(_sequence, _values, _handler);
+                }
+                Result itsResult = this->receiver_.onChanges(_sequence);
+                if (itsResult == Result::APPLIED) {
+                    if (apply(this->value_, _length, _indexes, _values)) {
+                        _handler(this->value_);
+                    } else {
+                        this->receiver_.reset();
+                        itsResult = Result::RESYNC;
+                    }
+                }
+                return itsResult;
+            }
+        };
+
+        /**
+         * Lets the replies of asynchronous calls reach their owner only while it exists.
+         * The owner resets the guard in its destructor, which waits for a running reply.
+         */
+        template<typename Owner_>
+        class Guard {
+        public:
+            explicit Guard(Owner_ *_owner)
+                : owner_(_owner) {
+            }
+
+            template<typename Function_>
+            void call(const Function_ &_function) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                if (owner_ != nullptr) {
+                    _function(*owner_);
+                }
+            }
+
+            void reset() {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                owner_ = nullptr;
+            }
+
+        private:
+            std::mutex mutex_;
+            Owner_ *owner_;
+        };
+
+        } // namespace Delta
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_DELTA_HPP_
+    '''
+}
@@ -0,0 +1,262 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the executors that run stub methods and attribute setters which are
+ * deployed with SomeIpMethodExecution or SomeIpSetterExecution other than Inline.
+ * The header does not depend on the model, it is written once to the default
+ * output directory.
+ */
+class SomeIPExecutionGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateExecution(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipExecutionHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateExecutionHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipExecutionHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateExecutionHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_EXECUTION_HPP_
+        #define COMMONAPI_SOMEIP_EXECUTION_HPP_
+
+        #include <atomic>
+        #include <condition_variable>
+        #include <cstdlib>
+        #include <deque>
+        #include <functional>
+        #include <memory>
+        #include <mutex>
+        #include <thread>
+        #include <vector>
+
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Execution {
+
+        typedef std::function<void()> Task;
+
+        /**
+         * A pool of worker threads shared by all stub adapters of the process. Every
+         * worker has its own queue; tasks posted by a worker are queued locally and
+         * idle workers steal from the other queues. Tasks of the same method may run
+         * concurrently and complete in any order.
+         *
+         * The number of workers is read from COMMONAPI_SOMEIP_POOL_THREADS and defaults
+         * to the number of hardware threads (at least two).
+         */
+        class Pool {
+        public:
+            explicit Pool(std::size_t _threads)
+                : queues_(_threads == 0 ? 1 : _threads), next_(0), pending_(0), isStopped_(false) {
+                for (std::size_t i = 0; i < queues_.size(); i++) {
+                    workers_.push_back(std::thread(&Pool::run, this, i));
+                }
+            }
+
+            ~Pool() {
+                {
+                    std::lock_guard<std::mutex> itsLock(mutex_);
+                    isStopped_ = true;
+                }
+                condition_.notify_all();
+                for (auto &itsWorker : workers_) {
+                    if (itsWorker.get_id() == std::this_thread::get_id()) {
+                        itsWorker.detach();
+                    } else {
+                        itsWorker.join();
+                    }
+                }
+            }
+
+            Pool(const Pool &) = delete;
+            Pool &operator=(const Pool &) = delete;
+
+            /**
+             * The pool of the process. It is never destroyed, because tasks may still
+             * be posted while static objects are destroyed.
+             */
+            static Pool &get() {
+                static Pool *itsPool = new Pool(fromEnvironment());
+                return *itsPool;
+            }
+
+            void post(Task _task) {
+                const std::size_t itsIndex = (current() < queues_.size() ? current()
+                        : next_.fetch_add(1, std::memory_order_relaxed) % queues_.size());
+                {
+                    std::lock_guard<std::mutex> itsLock(queues_[itsIndex].mutex);
+                    queues_[itsIndex].tasks.push_back(std::move(_task));
+                }
+                {
+                    std::lock_guard<std::mutex> itsLock(mutex_);
+                    pending_++;
+                }
+                condition_.notify_one();
+            }
+
+            std::size_t getThreads() const {
+                return queues_.size();
+            }
+
+        private:
+            struct Queue {
+                std::mutex mutex;
+                std::deque<Task> tasks;
+            };
+
+            static std::size_t fromEnvironment() {
+                const char *itsThreads = std::getenv("COMMONAPI_SOMEIP_POOL_THREADS");
+                if (itsThreads != nullptr && std::strtoul(itsThreads, nullptr, 10) > 0) {
+                    return std::strtoul(itsThreads, nullptr, 10);
+                }
+                const std::size_t itsHardware = std::thread::hardware_concurrency();
+                return (itsHardware < 2 ? 2 : itsHardware);
+            }
+
+            // Index of the worker that runs on the calling thread, or an invalid index
+            static std::size_t &current() {
+                static thread_local std::size_t itsIndex = std::size_t(-1);
+                return itsIndex;
+            }
+
+            // Takes the newest task of the own queue or the oldest task of another queue
+            bool take(std::size_t _index, Task &_task) {
+                {
+                    Queue &itsQueue = queues_[_index];
+                    std::lock_guard<std::mutex> itsLock(itsQueue.mutex);
+                    if (!itsQueue.tasks.empty()) {
+                        _task = std::move(itsQueue.tasks.back());
+                        itsQueue.tasks.pop_back();
+                        return true;
+                    }
+                }
+                for (std::size_t i = 1; i < queues_.size(); i++) {
+                    Queue &itsQueue = queues_[(_index + i) % queues_.size()];
+                    std::lock_guard<std::mutex> itsLock(itsQueue.mutex);
+                    if (!itsQueue.tasks.empty()) {
+                        _task = std::move(itsQueue.tasks.front());
+                        itsQueue.tasks.pop_front();
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void run(std::size_t _index) {
+                current() = _index;
+                for (;;) {
+                    {
+                        std::unique_lock<std::mutex> itsLock(mutex_);
+                        condition_.wait(itsLock, [this]() { return pending_ > 0 || isStopped_; });
+                        if (isStopped_) {
+                            return;
+                        }
+                        pending_--;
+                    }
+                    // A task is reserved for this worker, it may still be in transit to a queue
+                    Task itsTask;
+                    while (!take(_index, itsTask)) {
+                        std::this_thread::yield();
+                    }
+                    itsTask();
+                }
+            }
+
+            std::vector<Queue> queues_;
+            std::vector<std::thread> workers_;
+            std::atomic<std::size_t> next_;
+            std::mutex mutex_;
+            std::condition_variable condition_;
+            std::size_t pending_;
+            bool isStopped_;
+        };
+
+        /**
+         * A thread that runs the tasks of one method in the order they were posted.
+         * The thread is detached if it destroys its own owner.
+         */
+        class DedicatedThread {
+        public:
+            DedicatedThread()
+                : state_(std::make_shared<State>()) {
+                std::shared_ptr<State> itsState(state_);
+                thread_ = std::thread([itsState]() { run(*itsState); });
+            }
+
+            ~DedicatedThread() {
+                {
+                    std::lock_guard<std::mutex> itsLock(state_->mutex);
+                    state_->isStopped = true;
+                }
+                state_->condition.notify_one();
+                if (thread_.get_id() == std::this_thread::get_id()) {
+                    thread_.detach();
+                } else {
+                    thread_.join();
+                }
+            }
+
+            DedicatedThread(const DedicatedThread &) = delete;
+            DedicatedThread &operator=(const DedicatedThread &) = delete;
+
+            // The task may destroy this thread before post returns
+            void post(Task _task) {
+                std::shared_ptr<State> itsState(state_);
+                {
+                    std::lock_guard<std::mutex> itsLock(itsState->mutex);
+                    itsState->tasks.push_back(std::move(_task));
+                }
+                itsState->condition.notify_one();
+            }
+
+        private:
+            struct State {
+                std::mutex mutex;
+                std::condition_variable condition;
+                std::deque<Task> tasks;
+                bool isStopped = false;
+            };
+
+            static void run(State &_state) {
+                std::unique_lock<std::mutex> itsLock(_state.mutex);
+                for (;;) {
+                    _state.condition.wait(itsLock, [&_state]() { return !_state.tasks.empty() || _state.isStopped; });
+                    if (_state.isStopped) {
+                        return;
+                    }
+                    Task itsTask(std::move(_state.tasks.front()));
+                    _state.tasks.pop_front();
+                    itsLock.unlock();
+                    itsTask();
+                    itsTask = nullptr;
+                    itsLock.lock();
+                }
+            }
+
+            std::shared_ptr<State> state_;
+            std::thread thread_;
+        };
+
+        } // namespace Execution
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_EXECUTION_HPP_
+    '''
+}
@@ -0,0 +1,232 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator;
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.lang.management.MemoryType;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+
+import org.eclipse.xtext.generator.IFileSystemAccess;
+
+/**
+ * Collects timings and counters of a generator run. The phases and counters are
+ * accumulated for the whole run and for the input file that is currently processed.
+ * Nothing is recorded unless the statistics are enabled.
+ */
+public class SomeIPGeneratorStatistics {
+
+	private static class Record {
+		final String name;
+		long nanos = 0;
+		long generatedFiles = 0;
+		long generatedBytes = 0;
+		final Map<String, Long> phases = new LinkedHashMap<String, Long>();
+		final Map<String, Long> counters = new LinkedHashMap<String, Long>();
+
+		Record(String _name) {
+			name = _name;
+		}
+	}
+
+	// Counts the files written by the generators before passing them on
+	private static class CountingFileSystemAccess implements IFileSystemAccess {
+		private final IFileSystemAccess delegate_;
+
+		CountingFileSystemAccess(IFileSystemAccess _delegate) {
+			delegate_ = _delegate;
+		}
+
+		@Override
+		public void generateFile(String _fileName, CharSequence _contents) {
+			countGeneratedFile(_contents.toString().getBytes(StandardCharsets.UTF_8).length);
+			delegate_.generateFile(_fileName, _contents);
+		}
+
+		@Override
+		public void generateFile(String _fileName, String _outputConfigurationName, CharSequence _contents) {
+			countGeneratedFile(_contents.toString().getBytes(StandardCharsets.UTF_8).length);
+			delegate_.generateFile(_fileName, _outputConfigurationName, _contents);
+		}
+
+		@Override
+		public void deleteFile(String _fileName) {
+			delegate_.deleteFile(_fileName);
+		}
+	}
+
+	private static volatile boolean enabled_ = false;
+	private static Record total_ = new Record(null);
+	private static List<Record> files_ = new ArrayList<Record>();
+	private static Record current_ = null;
+	private static long fileStart_ = 0;
+
+	public static synchronized void enable() {
+		enabled_ = true;
+		total_ = new Record(null);
+		files_.clear();
+		current_ = null;
+		for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+			if (pool.getType() == MemoryType.HEAP)
+				pool.resetPeakUsage();
+		}
+		total_.nanos = System.nanoTime();
+	}
+
+	public static boolean isEnabled() {
+		return enabled_;
+	}
+
+	public static synchronized void beginFile(String _file) {
+		if (!enabled_)
+			return;
+		current_ = new Record(_file);
+		files_.add(current_);
+		fileStart_ = System.nanoTime();
+	}
+
+	public static synchronized void endFile() {
+		if (!enabled_ || current_ == null)
+			return;
+		current_.nanos = System.nanoTime() - fileStart_;
+		current_ = null;
+	}
+
+	/**
+	 * Returns a file system access that counts the generated files and bytes if the
+	 * statistics are enabled, otherwise the given file system access.
+	 */
+	public static IFileSystemAccess countGeneratedFiles(IFileSystemAccess _access) {
+		return (enabled_ ? new CountingFileSystemAccess(_access) : _access);
+	}
+
+	/**
+	 * Returns the start time of a phase that is passed to {@link #stop(String, long)}.
+	 */
+	public static long start() {
+		return (enabled_ ? System.nanoTime() : 0);
+	}
+
+	public static void stop(String _phase, long _start) {
+		if (!enabled_)
+			return;
+		long nanos = System.nanoTime() - _start;
+		synchronized (SomeIPGeneratorStatistics.class) {
+			add(total_.phases, _phase, nanos);
+			if (current_ != null)
+				add(current_.phases, _phase, nanos);
+		}
+	}
+
+	public static void count(String _counter, long _value) {
+		if (!enabled_)
+			return;
+		synchronized (SomeIPGeneratorStatistics.class) {
+			add(total_.counters, _counter, _value);
+			if (current_ != null)
+				add(current_.counters, _counter, _value);
+		}
+	}
+
+	public static void countGeneratedFile(long _bytes) {
+		if (!enabled_)
+			return;
+		synchronized (SomeIPGeneratorStatistics.class) {
+			total_.generatedFiles++;
+			total_.generatedBytes += _bytes;
+			if (current_ != null) {
+				current_.generatedFiles++;
+				current_.generatedBytes += _bytes;
+			}
+		}
+	}
+
+	/**
+	 * Returns the report of the run as JSON object. Times are given in milliseconds.
+	 */
+	public static synchronized String toJson() {
+		StringBuilder json = new StringBuilder();
+		json.append("{\n");
+		json.append("  \"version\": 1,\n");
+		json.append("  \"totalMs\": ").append(toMillis(System.nanoTime() - total_.nanos)).append(",\n");
+		json.append("  \"peakHeapBytes\": ").append(getPeakHeapUsage()).append(",\n");
+		appendRecord(json, total_, "  ");
+		json.append(",\n  \"files\": [");
+		for (int i = 0; i < files_.size(); i++) {
+			Record file = files_.get(i);
+			json.append(i == 0 ? "\n" : ",\n");
+			json.append("    {\n");
+			json.append("      \"file\": ").append(quote(file.name)).append(",\n");
+			json.append("      \"totalMs\": ").append(toMillis(file.nanos)).append(",\n");
+			appendRecord(json, file, "      ");
+			json.append("\n    }");
+		}
+		json.append(files_.isEmpty() ? "]\n" : "\n  ]\n");
+		json.append("}\n");
+		return json.toString();
+	}
+
+	// Sum of the peak usage of all heap memory pools since the statistics were enabled
+	private static long getPeakHeapUsage() {
+		long peak = 0;
+		for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+			if (pool.getType() == MemoryType.HEAP && pool.getPeakUsage() != null)
+				peak += pool.getPeakUsage().getUsed();
+		}
+		return peak;
+	}
+
+	private static void appendRecord(StringBuilder _json, Record _record, String _indent) {
+		_json.append(_indent).append("\"generatedFiles\": ").append(_record.generatedFiles).append(",\n");
+		_json.append(_indent).append("\"generatedBytes\": ").append(_record.generatedBytes).append(",\n");
+		_json.append(_indent).append("\"phasesMs\": {");
+		String separator = "";
+		for (Map.Entry<String, Long> phase : _record.phases.entrySet()) {
+			_json.append(separator).append(quote(phase.getKey())).append(": ").append(toMillis(phase.getValue()));
+			separator = ", ";
+		}
+		_json.append("},\n");
+		_json.append(_indent).append("\"counters\": {");
+		separator = "";
+		for (Map.Entry<String, Long> counter : _record.counters.entrySet()) {
+			_json.append(separator).append(quote(counter.getKey())).append(": ").append(counter.getValue());
+			separator = ", ";
+		}
+		_json.append("}");
+	}
+
+	private static void add(Map<String, Long> _map, String _key, long _value) {
+		Long value = _map.get(_key);
+		_map.put(_key, (value == null ? _value : value + _value));
+	}
+
+	private static String toMillis(long _nanos) {
+		return String.format(Locale.ROOT, "%.3f", _nanos / 1.0e6);
+	}
+
+	static String quote(String _value) {
+		StringBuilder quoted = new StringBuilder("\"");
+		for (char c : _value.toCharArray()) {
+			switch (c) {
+			case '"': quoted.append("\\\""); break;
+			case '\\': quoted.append("\\\\"); break;
+			case '\n': quoted.append("\\n"); break;
+			case '\r': quoted.append("\\r"); break;
+			case '\t': quoted.append("\\t"); break;
+			default:
+				if (c < 0x20)
+					quoted.append(String.format("\\u%04x", (int) c));
+				else
+					quoted.append(c);
+			}
+		}
+		return quoted.append('"').toString();
+	}
+}
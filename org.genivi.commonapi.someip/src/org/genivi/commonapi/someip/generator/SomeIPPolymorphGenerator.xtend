@@ -0,0 +1,311 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the pooled decoding of arrays of polymorphic structs (generator option -pp):
+ * the type table of a hierarchy, the block the elements of an array are constructed in
+ * and the stream operators that are selected by the deployment type of the array. The
+ * header does not depend on the model, it is written once to the default output directory.
+ */
+class SomeIPPolymorphGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generatePolymorph(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipPolymorphHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generatePolymorphHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipPolymorphHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generatePolymorphHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_POLYMORPH_HPP_
+        #define COMMONAPI_SOMEIP_POLYMORPH_HPP_
+
+        #include <algorithm>
+        #include <cstddef>
+        #include <cstdint>
+        #include <limits>
+        #include <memory>
+        #include <new>
+        #include <type_traits>
+        #include <vector>
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/Types.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Pooled decoding of arrays of polymorphic structs.
+         *
+         * The runtime decodes every element of such an array on its own: it looks up the
+         * type of the serial through the generic factory of the hierarchy and allocates the
+         * element together with its reference count. Here the type is looked up in a table
+         * of the hierarchy, the last hit is tried first, and the elements of the array are
+         * constructed in a few blocks that grow geometrically. Serials that are not part of
+         * the table and elements beyond the bound of the length are created by the factory.
+         * The wire format does not change, encoding is not affected.
+         *
+         * The elements of a block are aliasing shared_ptrs of the block: they share its
+         * reference count, and the block with all its elements is destroyed when the last of
+         * them is released. An application that keeps one element keeps the memory and the
+         * objects of its whole block, up to half of the array, alive. Elements that outlive
+         * the array are better copied into objects of their own.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Polymorph {
+
+        template<std::size_t... Values_>
+        struct Max;
+
+        template<>
+        struct Max<> {
+            static const std::size_t value = 1;
+        };
+
+        template<std::size_t First_, std::size_t... Rest_>
+        struct Max<First_, Rest_...> {
+            static const std::size_t value = (First_ > Max<Rest_...>::value ? First_ : Max<Rest_...>::value);
+        };
+
+        template<typename Root_>
+        struct Entry {
+            CommonAPI::Serial serial_;
+            Root_ *(*construct_)(void *);
+        };
+
+        template<typename Root_, typename Type_>
+        Root_ *construct(void *_slot) {
+            return new (_slot) Type_();
+        }
+
+        /*
+         * Type table of a hierarchy, the serial of each type and the function that constructs
+         * the type in place. Serials are hashes, the table is sorted by them.
+         */
+        template<typename Root_, typename... Types_>
+        class Table {
+        public:
+            static const std::size_t ALIGNMENT = Max<alignof(Types_)...>::value;
+            static const std::size_t STRIDE = (Max<sizeof(Types_)...>::value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+            static_assert(ALIGNMENT <= alignof(std::max_align_t), "over-aligned polymorphic struct");
+            static_assert(std::has_virtual_destructor<Root_>::value, "polymorphic struct without virtual destructor");
+
+            static const Table &get() {
+                static const Table itsTable;
+                return itsTable;
+            }
+
+            // Entry of the serial, nullptr if the type is not part of the table
+            const Entry<Root_> *find(CommonAPI::Serial _serial) const {
+                auto itsEntry = std::lower_bound(entries_.begin(), entries_.end(), _serial,
+                    [](const Entry<Root_> &_entry, CommonAPI::Serial _value) { return _entry.serial_ < _value; });
+                return (itsEntry != entries_.end() && itsEntry->serial_ == _serial ? &*itsEntry : nullptr);
+            }
+
+        private:
+            Table()
+                : entries_({ Entry<Root_>{ Types_().getSerial(), &construct<Root_, Types_> }... }) {
+                std::sort(entries_.begin(), entries_.end(),
+                    [](const Entry<Root_> &_left, const Entry<Root_> &_right) { return _left.serial_ < _right.serial_; });
+            }
+
+            std::vector<Entry<Root_>> entries_;
+        };
+
+        template<typename Root_, typename... Types_>
+        const std::size_t Table<Root_, Types_...>::ALIGNMENT;
+
+        template<typename Root_, typename... Types_>
+        const std::size_t Table<Root_, Types_...>::STRIDE;
+
+        /*
+         * Block of the elements of a decoded array: _capacity slots of _stride bytes, followed
+         * by the pointers to the constructed elements that are destroyed with the block. If
+         * the block cannot be allocated, the arena has no capacity. The arena is owned by the
+         * shared_ptrs of its elements, a single element keeps it alive.
+         */
+        template<typename Root_>
+        class Arena {
+        public:
+            Arena(std::size_t _capacity, std::size_t _stride)
+                : block_(nullptr), elements_(nullptr), stride_(_stride), capacity_(0), size_(0) {
+                if (_capacity > 0 && _capacity <= std::numeric_limits<std::size_t>::max() / (_stride + sizeof(Root_ *))) {
+                    block_ = static_cast<uint8_t *>(::operator new(_capacity * (_stride + sizeof(Root_ *)), std::nothrow));
+                    if (block_ != nullptr) {
+                        elements_ = reinterpret_cast<Root_ **>(block_ + _capacity * _stride);
+                        capacity_ = _capacity;
+                    }
+                }
+            }
+
+            ~Arena() {
+                while (size_ > 0)
+                    elements_[--size_]->~Root_();
+                ::operator delete(block_);
+            }
+
+            Arena(const Arena &) = delete;
+            Arena &operator=(const Arena &) = delete;
+
+            bool isFull() const {
+                return size_ >= capacity_;
+            }
+
+            // Constructs an element in the next slot, the arena must not be full
+            Root_ *construct(Root_ *(*_construct)(void *)) {
+                Root_ *itsElement = _construct(block_ + size_ * stride_);
+                elements_[size_++] = itsElement;
+                return itsElement;
+            }
+
+        private:
+            uint8_t *block_;
+            Root_ **elements_;
+            const std::size_t stride_;
+            std::size_t capacity_;
+            std::size_t size_;
+        };
+
+        /*
+         * Deployment of an array of polymorphic structs. MinSize_ is a lower bound of the
+         * serialized size of an element, it limits the number of elements the blocks hold.
+         * Root_ is the element type of the array, Types_ are the types of the table.
+         */
+        template<typename Inner_, std::size_t MinSize_, typename Root_, typename... Types_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        // Elements of the first block of an array
+        static const std::size_t FIRST_CAPACITY = 1024;
+
+        inline bool readLength(InputStream &_input, uint8_t _width, uint32_t &_length) {
+            if (_width == 1) {
+                uint8_t itsLength(0);
+                _input.readValue(itsLength, static_cast<const EmptyDeployment *>(nullptr));
+                _length = itsLength;
+            } else if (_width == 2) {
+                uint16_t itsLength(0);
+                _input.readValue(itsLength, static_cast<const EmptyDeployment *>(nullptr));
+                _length = itsLength;
+            } else {
+                _input.readValue(_length, static_cast<const EmptyDeployment *>(nullptr));
+            }
+            return !_input.hasError();
+        }
+
+        // Skips the rest of an array that cannot be decoded
+        inline void skip(InputStream &_input, std::size_t _end) {
+            while (_input.getPosition() < _end && !_input.hasError()) {
+                uint8_t itsByte;
+                _input.readValue(itsByte, static_cast<const EmptyDeployment *>(nullptr));
+            }
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename ElementDepl_, std::size_t MinSize_, typename Root_, typename... Types_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::vector<std::shared_ptr<Root_>>,
+                                            Deployment<ArrayDeployment<ElementDepl_>, MinSize_, Root_, Types_...>> &_value) {
+            OutputStream &itsOutput = static_cast<OutputStream &>(_output);
+            itsOutput.writeValue(_value.getValue(), static_cast<const ArrayDeployment<ElementDepl_> *>(_value.getDepl()));
+            return _output;
+        }
+
+        template<typename ElementDepl_, std::size_t MinSize_, typename Root_, typename... Types_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::vector<std::shared_ptr<Root_>>,
+                                      Deployment<ArrayDeployment<ElementDepl_>, MinSize_, Root_, Types_...>> &_value) {
+            typedef Table<Root_, Types_...> Table_;
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            const ArrayDeployment<ElementDepl_> *itsDepl = _value.getDepl();
+            std::vector<std::shared_ptr<Root_>> &itsValue = _value.getValue();
+            const uint8_t itsLengthWidth = (itsDepl != nullptr ? itsDepl->lengthWidth_ : 4);
+            if (itsLengthWidth == 0) {
+                itsInput.readValue(itsValue, itsDepl);
+                return _input;
+            }
+
+            uint32_t itsLength(0);
+            itsValue.clear();
+            if (!readLength(itsInput, itsLengthWidth, itsLength))
+                return _input;
+
+            const ElementDepl_ *itsElementDepl = (itsDepl != nullptr ? itsDepl->elementDepl_ : nullptr);
+            const Table_ &itsTable = Table_::get();
+            std::size_t itsRemaining = itsLength / (MinSize_ > 4 ? MinSize_ : 4);
+            if (itsDepl != nullptr && itsDepl->maxLength_ > 0 && itsRemaining > itsDepl->maxLength_)
+                itsRemaining = itsDepl->maxLength_;
+            // The length is not trusted before the elements are read: the first block is
+            // limited and each further one at most doubles the elements decoded so far
+            std::size_t itsCapacity = (itsRemaining < FIRST_CAPACITY ? itsRemaining : FIRST_CAPACITY);
+            std::shared_ptr<Arena<Root_>> itsArena = std::make_shared<Arena<Root_>>(itsCapacity, Table_::STRIDE);
+            itsRemaining -= itsCapacity;
+            const Entry<Root_> *itsEntry(nullptr);
+            const std::size_t itsEnd = itsInput.getPosition() + itsLength;
+            while (itsInput.getPosition() < itsEnd) {
+                CommonAPI::Serial itsSerial(0);
+                itsInput.readValue(itsSerial, static_cast<const EmptyDeployment *>(nullptr));
+                if (itsInput.hasError())
+                    break;
+                if (itsEntry == nullptr || itsEntry->serial_ != itsSerial)
+                    itsEntry = itsTable.find(itsSerial);
+
+                if (itsEntry != nullptr && itsArena->isFull() && itsRemaining > 0) {
+                    itsCapacity = (itsRemaining < 2 * itsCapacity ? itsRemaining : 2 * itsCapacity);
+                    itsArena = std::make_shared<Arena<Root_>>(itsCapacity, Table_::STRIDE);
+                    itsRemaining -= itsCapacity;
+                }
+
+                std::shared_ptr<Root_> itsElement;
+                if (itsEntry != nullptr && !itsArena->isFull())
+                    itsElement = std::shared_ptr<Root_>(itsArena, itsArena->construct(itsEntry->construct_));
+                else
+                    itsElement = Root_::create(itsSerial);
+                if (!itsElement) {
+                    COMMONAPI_ERROR("SomeIP polymorph: dropped array with unknown serial ", itsSerial);
+                    skip(itsInput, itsEnd);
+                    itsValue.clear();
+                    return _input;
+                }
+
+                itsElement->template readValue<>(_input, itsElementDepl);
+                if (itsInput.hasError())
+                    break;
+                itsValue.push_back(std::move(itsElement));
+            }
+            return _input;
+        }
+
+        } // namespace Polymorph
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_POLYMORPH_HPP_
+    '''
+}
@@ -0,0 +1,269 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import java.util.LinkedHashSet
+import java.util.Set
+import org.eclipse.emf.ecore.EObject
+import org.franca.core.franca.FArrayType
+import org.franca.core.franca.FBasicTypeId
+import org.franca.core.franca.FField
+import org.franca.core.franca.FMapType
+import org.franca.core.franca.FStructType
+import org.franca.core.franca.FType
+import org.franca.core.franca.FTypeCollection
+import org.franca.core.franca.FTypeDef
+import org.franca.core.franca.FTypeRef
+import org.genivi.commonapi.core.generator.FrancaGeneratorExtensions
+import org.genivi.commonapi.someip.deployment.PropertyAccessor
+
+/**
+ * Generates C++ code that fills values with random data within the bounds of their
+ * deployment. It is shared by the generated serialization benchmarks and load
+ * generators. The fill functions expect a std::mt19937_64 named _rng.
+ *
+ * Enumerations and unions keep their default value; polymorphic structs are not filled.
+ */
+class SomeIPRandomValueGenerator {
+    @Inject extension FrancaGeneratorExtensions
+    @Inject extension FrancaSomeIPGeneratorExtensions
+    @Inject extension FrancaSomeIPDeploymentAccessorHelper
+
+    // Upper bound for the number of elements of unbounded containers
+    static int SOMEIP_RANDOM_DEFAULT_LENGTH = 16
+    // Upper bound for the number of elements of bounded containers
+    static int SOMEIP_RANDOM_MAX_LENGTH = 1024
+
+    // Helper functions used by the fill functions, to be placed in an anonymous namespace
+    def generateRandomHelpers() '''
+        inline std::size_t randomLength(std::mt19937_64 &_rng, std::size_t _min, std::size_t _max) {
+            return std::uniform_int_distribution<std::size_t>(_min, _max < _min ? _min : _max)(_rng);
+        }
+
+        template<typename _Type>
+        typename std::enable_if<std::is_integral<_Type>::value>::type
+        fillValue(_Type &_value, std::mt19937_64 &_rng, unsigned _bits = sizeof(_Type) * 8) {
+            uint64_t raw = _rng();
+            if (std::is_signed<_Type>::value && _bits > 1)
+                _bits--;
+            if (_bits < 64)
+                raw &= (uint64_t(1) << _bits) - 1;
+            _value = _Type(raw);
+        }
+
+        template<typename _Type>
+        typename std::enable_if<std::is_floating_point<_Type>::value>::type
+        fillValue(_Type &_value, std::mt19937_64 &_rng) {
+            _value = std::uniform_real_distribution<_Type>(_Type(-1.0e6), _Type(1.0e6))(_rng);
+        }
+
+        inline void fillString(std::string &_value, std::mt19937_64 &_rng, std::size_t _min, std::size_t _max) {
+            _value.resize(randomLength(_rng, _min, _max));
+            for (auto &c : _value)
+                c = char(std::uniform_int_distribution<int>('a', 'z')(_rng));
+        }
+
+        inline void fillByteBuffer(CommonAPI::ByteBuffer &_value, std::mt19937_64 &_rng, std::size_t _min, std::size_t _max) {
+            _value.resize(randomLength(_rng, _min, _max));
+            for (auto &b : _value)
+                b = uint8_t(_rng());
+        }
+    '''
+
+    // Declarations and definitions of the fill functions of the given types
+    def generateFillFunctions(Set<FType> _types) '''
+        «FOR t : _types»
+            void «t.fillName»(«t.cppTypeName» &_value, std::mt19937_64 &_rng);
+        «ENDFOR»
+
+        «FOR t : _types»
+            void «t.fillName»(«t.cppTypeName» &_value, std::mt19937_64 &_rng) {
+                «t.generateFill»
+            }
+
+        «ENDFOR»
+    '''
+
+    def String getCppTypeName(FType _type) {
+        return (_type.eContainer as FTypeCollection).fullName + "::" + _type.elementName
+    }
+
+    def String getFillName(FType _type) {
+        return "fill_" + (_type.eContainer as FTypeCollection).fullName.replace("::", "_") + "_" + _type.elementName
+    }
+
+    // Polymorphic structs are not filled
+    def boolean isFillable(FType _type) {
+        return !(_type instanceof FStructType && (_type as FStructType).isPolymorphicHierarchy)
+    }
+
+    def boolean isPolymorphicHierarchy(FStructType _struct) {
+        var FStructType itsStruct = _struct
+        while (itsStruct !== null) {
+            if (itsStruct.polymorphic)
+                return true
+            itsStruct = itsStruct.base
+        }
+        return false
+    }
+
+    // The given types and the types they depend on, without polymorphic structs
+    def Set<FType> getFillableTypes(Iterable<? extends FType> _types) {
+        val Set<FType> types = new LinkedHashSet<FType>()
+        for (t : _types)
+            t.collectTypes(types)
+        return types
+    }
+
+    // The types referenced by the given type references and the types they depend on
+    def Set<FType> getFillableTypeRefs(Iterable<FTypeRef> _typeRefs) {
+        val Set<FType> types = new LinkedHashSet<FType>()
+        for (t : _typeRefs)
+            t.collectTypes(types)
+        return types
+    }
+
+    def private void collectTypes(FType _type, Set<FType> _types) {
+        if (!_type.isFillable || !_types.add(_type))
+            return
+        if (_type instanceof FTypeDef) {
+            _type.actualType.collectTypes(_types)
+        } else if (_type instanceof FArrayType) {
+            _type.elementType.collectTypes(_types)
+        } else if (_type instanceof FMapType) {
+            _type.keyType.collectTypes(_types)
+            _type.valueType.collectTypes(_types)
+        } else if (_type instanceof FStructType) {
+            for (e : _type.allElements)
+                e.type.collectTypes(_types)
+        }
+    }
+
+    def private void collectTypes(FTypeRef _typeRef, Set<FType> _types) {
+        if (_typeRef.derived !== null)
+            _typeRef.derived.collectTypes(_types)
+    }
+
+    ///////////////////////////////////
+    // Generate fill statements      //
+    ///////////////////////////////////
+    def String generateFill(FType _type) {
+        val PropertyAccessor accessor = getSomeIpAccessor(_type.eContainer as FTypeCollection)
+
+        if (_type instanceof FTypeDef) {
+            return _type.actualType.generateFill(_type, accessor, "_value", 0)
+        }
+        if (_type instanceof FArrayType) {
+            return _type.elementType.generateArrayFill(_type, accessor, "_value", 0)
+        }
+        if (_type instanceof FMapType) {
+            val Integer minLength = accessor.getSomeIpMapMinLengthHelper(_type) ?: SOMEIP_DEFAULT_MIN_LENGTH
+            val Integer maxLength = accessor.getSomeIpMapMaxLengthHelper(_type) ?: SOMEIP_DEFAULT_MAX_LENGTH
+            return "_value.clear();\n" +
+                   "for (std::size_t i0 = randomLength(_rng, " + minLength + ", " + maxLength.upperLength + "); i0 > 0; i0--) {\n" +
+                   "    std::remove_reference<decltype(_value)>::type::key_type key;\n" +
+                   "    std::remove_reference<decltype(_value)>::type::mapped_type value;\n" +
+                   "    " + _type.keyType.generateFill(_type, accessor, "key", 1) + "\n" +
+                   "    " + _type.valueType.generateFill(_type, accessor, "value", 1) + "\n" +
+                   "    _value[key] = value;\n" +
+                   "}"
+        }
+        if (_type instanceof FStructType) {
+            var String fill = ""
+            for (e : _type.allElements) {
+                if (!e.refersToPolymorphicStruct)
+                    fill += e.generateFieldFill(accessor.getOverwriteAccessor(e))
+            }
+            return fill
+        }
+        // enumerations and unions keep their default value
+        return "(void)_value;\n(void)_rng;"
+    }
+
+    def private String generateFieldFill(FField _field, PropertyAccessor _accessor) {
+        val String getter = "_value.get" + _field.elementName.toFirstUpper + "()"
+        var String fill = _field.type.generateFill(_field, _accessor, "field", 1)
+        if (_field.array)
+            fill = _field.type.generateArrayFill(_field, _accessor, "field", 1)
+        return "{\n" +
+               "    std::decay<decltype(" + getter + ")>::type field(" + getter + ");\n" +
+               "    " + fill.replace("\n", "\n    ") + "\n" +
+               "    _value.set" + _field.elementName.toFirstUpper + "(field);\n" +
+               "}\n"
+    }
+
+    def private boolean refersToPolymorphicStruct(FField _field) {
+        val FType derived = _field.type.derived
+        return derived instanceof FStructType && (derived as FStructType).isPolymorphicHierarchy
+    }
+
+    def String generateArrayFill(FTypeRef _elementType, EObject _source, PropertyAccessor _accessor,
+                                 String _target, int _depth) {
+        val Integer minLength = _accessor.getSomeIpArrayMinLengthHelper(_source) ?: SOMEIP_DEFAULT_MIN_LENGTH
+        val Integer maxLength = _accessor.getSomeIpArrayMaxLengthHelper(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+        val Integer lengthWidth = _accessor.getSomeIpArrayLengthWidthHelper(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+        // arrays without length field always have their maximum length
+        var String length = "randomLength(_rng, " + minLength + ", " + maxLength.upperLength + ")"
+        if (lengthWidth == 0 && maxLength > 0)
+            length = maxLength.toString
+        val String index = "i" + _depth
+        val String element = "e" + _depth
+        return _target + ".resize(" + length + ");\n" +
+               "for (std::size_t " + index + " = 0; " + index + " < " + _target + ".size(); " + index + "++) {\n" +
+               "    std::remove_reference<decltype(" + _target + ")>::type::value_type " + element + ";\n" +
+               "    " + _elementType.generateFill(_source, _accessor, element, _depth + 1) + "\n" +
+               "    " + _target + "[" + index + "] = " + element + ";\n" +
+               "}"
+    }
+
+    def String generateFill(FTypeRef _typeRef, EObject _source, PropertyAccessor _accessor,
+                            String _target, int _depth) {
+        if (_typeRef.derived !== null) {
+            if (_typeRef.derived instanceof FStructType && (_typeRef.derived as FStructType).isPolymorphicHierarchy)
+                return ""
+            return _typeRef.derived.fillName + "(" + _target + ", _rng);"
+        }
+        if (_typeRef.interval !== null) {
+            return _target + " = int32_t(std::uniform_int_distribution<int64_t>(" +
+                   (_typeRef.interval.lowerBound ?: Integer.MIN_VALUE) + "LL, " +
+                   (_typeRef.interval.upperBound ?: Integer.MAX_VALUE) + "LL)(_rng));"
+        }
+        val FBasicTypeId typeId = _typeRef.predefined
+        if (typeId == FBasicTypeId.STRING) {
+            val Integer lengthWidth = _accessor.getSomeIpStringLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            val Integer length = _accessor.getSomeIpStringLength(_source) ?: SOMEIP_DEFAULT_STRING_LENGTH
+            val PropertyAccessor.SomeIpStringEncoding encoding = _accessor.getSomeIpStringEncoding(_source) ?: SOMEIP_DEFAULT_STRING_ENCODING
+            // the deployed length includes BOM and terminator (4 bytes for all encodings)
+            val int unitSize = (encoding == PropertyAccessor.SomeIpStringEncoding.utf8 ? 1 : 2)
+            var int maxChars = SOMEIP_RANDOM_DEFAULT_LENGTH
+            if (length > 4)
+                maxChars = Math.min((length - 4) / unitSize, SOMEIP_RANDOM_MAX_LENGTH)
+            val int minChars = (lengthWidth == 0 ? maxChars : 0)
+            return "fillString(" + _target + ", _rng, " + minChars + ", " + maxChars + ");"
+        }
+        if (typeId == FBasicTypeId.BYTE_BUFFER) {
+            val Integer minLength = _accessor.getSomeIpByteBufferMinLength(_source) ?: SOMEIP_DEFAULT_MIN_LENGTH
+            val Integer maxLength = _accessor.getSomeIpByteBufferMaxLength(_source) ?: SOMEIP_DEFAULT_MAX_LENGTH
+            val Integer lengthWidth = _accessor.getSomeIpByteBufferLengthWidth(_source) ?: SOMEIP_DEFAULT_LENGTH_WIDTH
+            if (lengthWidth == 0 && maxLength > 0)
+                return "fillByteBuffer(" + _target + ", _rng, " + maxLength + ", " + maxLength + ");"
+            return "fillByteBuffer(" + _target + ", _rng, " + minLength + ", " + maxLength.upperLength + ");"
+        }
+        if (typeId == FBasicTypeId.FLOAT || typeId == FBasicTypeId.DOUBLE || typeId == FBasicTypeId.BOOLEAN) {
+            return "fillValue(" + _target + ", _rng);"
+        }
+        val Integer bitWidth = _accessor.getSomeIpIntegerBitWidthHelper(_source)
+        if (bitWidth !== null)
+            return "fillValue(" + _target + ", _rng, " + bitWidth + ");"
+        return "fillValue(" + _target + ", _rng);"
+    }
+
+    def private int getUpperLength(Integer _maxLength) {
+        if (_maxLength === null || _maxLength == 0)
+            return SOMEIP_RANDOM_DEFAULT_LENGTH
+        return Math.min(_maxLength, SOMEIP_RANDOM_MAX_LENGTH)
+    }
+}
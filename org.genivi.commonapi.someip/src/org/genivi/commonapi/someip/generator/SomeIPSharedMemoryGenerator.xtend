@@ -0,0 +1,762 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the shared memory transport of String and ByteBuffer attributes and
+ * broadcast arguments that are deployed with SomeIpAttrSharedMemoryThreshold or
+ * SomeIpArgSharedMemoryThreshold: the segment pool of the writer, the mappings of
+ * the reader, the handle format and the stream operators that are selected by the
+ * deployment type of the element. The header does not depend on the model, it is
+ * written once to the default output directory.
+ */
+class SomeIPSharedMemoryGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateSharedMemory(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipSharedMemoryHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateSharedMemoryHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipSharedMemoryHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateSharedMemoryHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_SHARED_MEMORY_HPP_
+        #define COMMONAPI_SOMEIP_SHARED_MEMORY_HPP_
+
+        #include <atomic>
+        #include <chrono>
+        #include <cstdint>
+        #include <cstring>
+        #include <map>
+        #include <memory>
+        #include <mutex>
+        #include <set>
+        #include <sstream>
+        #include <string>
+        #include <vector>
+
+        #ifndef _WIN32
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+        #endif
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+        #include <CommonAPI/SomeIP/Types.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Shared memory transport of large String and ByteBuffer values
+         * (SomeIpAttrSharedMemoryThreshold, SomeIpArgSharedMemoryThreshold).
+         *
+         * An element with a threshold is sent as ByteBuffer with a 32 bit length field
+         * that contains a frame:
+         *
+         *   uint8_t  mode               0 = inline, 1 = shared
+         *   uint8_t  data[]             the value, only if mode == 0
+         *   uint32_t size               little endian, only if mode == 1
+         *   uint64_t generation         little endian, only if mode == 1
+         *   char     name[]             the segment, only if mode == 1
+         *
+         * Values of at least the threshold size are copied into a POSIX shared memory
+         * segment of the sending process, the message only carries the handle. The
+         * receiver maps the segment read only and copies the value out of it; it does
+         * not pass through the message buffers, the routing manager or a socket.
+         *
+         * Shared memory is only used for the events of a stub adapter whose subscribers
+         * are all local, see Destination and Subscribers. All other messages, events
+         * with a remote subscriber, replies and the messages of proxies, carry their
+         * values inline.
+         *
+         * Each segment has a counters object with a generation and the number of
+         * references that the readers have not released yet. The writer publishes a
+         * value with one reference for each local subscriber, each reading process
+         * releases one reference when it reads the handle the first time. A segment is
+         * reused only when all references are released. If all segments are in use,
+         * the value is sent inline. A reader that finds another generation in the
+         * segment logs an error and reads an empty value.
+         *
+         * The segments are created with the mode set by Writer::setMode, 0600 by
+         * default, so only processes of the same user can read them.
+         *
+         * Strings are sent as their UTF-8 bytes without terminator, the length, length
+         * width and encoding deployments of the element do not apply.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace SharedMemory {
+
+        static const uint8_t MODE_INLINE = 0;
+        static const uint8_t MODE_SHARED = 1;
+        static const std::size_t HANDLE_SIZE = 13;
+        static const char NAME_PREFIX[] = "/commonapi-someip-";
+        static const char COUNTERS_SUFFIX[] = ".counters";
+
+        // Counters of a segment, in an object of their own that the readers may write
+        struct SegmentHeader {
+            std::atomic<uint64_t> generation_;  // 0 while the writer claims the segment
+            std::atomic<uint32_t> references_;  // readers that have not released the generation
+        };
+
+        static const std::size_t SEGMENT_HEADER_SIZE = 64;
+        static_assert(sizeof(SegmentHeader) <= SEGMENT_HEADER_SIZE, "segment header too large");
+        static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                      "shared counters must be lock free");
+
+        inline void writeLittleEndian(uint64_t _value, std::size_t _size, uint8_t *_target) {
+            for (std::size_t i = 0; i < _size; i++) {
+                _target[i] = uint8_t(_value >> (8 * i));
+            }
+        }
+
+        inline uint64_t readLittleEndian(const uint8_t *_source, std::size_t _size) {
+            uint64_t itsValue(0);
+            for (std::size_t i = 0; i < _size; i++) {
+                itsValue |= uint64_t(_source[i]) << (8 * i);
+            }
+            return itsValue;
+        }
+
+        // Drops one reference of the generation, unless the segment holds another one
+        inline void release(SegmentHeader *_header, uint64_t _generation) {
+            uint32_t itsReferences = _header->references_.load();
+            while (itsReferences > 0 && _header->generation_.load() == _generation
+                    && !_header->references_.compare_exchange_weak(itsReferences, itsReferences - 1)) {
+            }
+        }
+
+        // A mapped object, unmapped on destruction
+        class Mapping {
+        public:
+            Mapping(uint8_t *_data, std::size_t _size)
+                : data_(_data), size_(_size) {
+            }
+
+            ~Mapping() {
+        #ifndef _WIN32
+                if (data_) {
+                    munmap(data_, size_);
+                }
+        #endif
+            }
+
+            Mapping(const Mapping &) = delete;
+            Mapping &operator=(const Mapping &) = delete;
+
+            SegmentHeader *getHeader() const {
+                return reinterpret_cast<SegmentHeader *>(data_);
+            }
+
+            uint8_t *getData() const {
+                return data_;
+            }
+
+            std::size_t getSize() const {
+                return size_;
+            }
+
+            static std::unique_ptr<Mapping> map(int _fd, std::size_t _size, bool _isWritable) {
+        #ifndef _WIN32
+                void *itsData = mmap(nullptr, _size, (_isWritable ? PROT_READ | PROT_WRITE : PROT_READ), MAP_SHARED, _fd, 0);
+                if (itsData != MAP_FAILED) {
+                    return std::unique_ptr<Mapping>(new Mapping(static_cast<uint8_t *>(itsData), _size));
+                }
+        #else
+                (void)_fd;
+                (void)_size;
+                (void)_isWritable;
+        #endif
+                return nullptr;
+            }
+
+        private:
+            uint8_t *data_;
+            std::size_t size_;
+        };
+
+        /*
+         * The segments of the sending process. Segments are created on demand up to
+         * the segment limit and are unlinked when the process ends.
+         */
+        class Writer {
+        public:
+            static Writer &get() {
+                static Writer theWriter;
+                return theWriter;
+            }
+
+            ~Writer() {
+        #ifndef _WIN32
+                for (auto &itsSegment : segments_) {
+                    shm_unlink(itsSegment->name_.c_str());
+                    shm_unlink((itsSegment->name_ + COUNTERS_SUFFIX).c_str());
+                    close(itsSegment->fd_);
+                }
+        #endif
+            }
+
+            // At most _segments segments are used
+            void setLimits(std::size_t _segments) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                maxSegments_ = _segments;
+            }
+
+            // Permissions of the segments that are created afterwards. The readers need
+            // read access to the segment and read and write access to its counters.
+            void setMode(mode_t _mode) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                mode_ = _mode;
+            }
+
+            // Copies the value into a free segment for _references readers and returns
+            // the handle frame. Returns false if all segments are in use.
+            bool publish(const uint8_t *_data, std::size_t _size, uint32_t _references, ByteBuffer &_frame) {
+        #ifndef _WIN32
+                if (_size > UINT32_MAX || _references == 0) {
+                    return false;
+                }
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                Segment *itsSegment(nullptr);
+                for (auto &itsCandidate : segments_) {
+                    if (claim(*itsCandidate)) {
+                        itsSegment = itsCandidate.get();
+                        break;
+                    }
+                }
+                if (!itsSegment) {
+                    if (segments_.size() >= maxSegments_) {
+                        return false;
+                    }
+                    itsSegment = create();
+                    if (!itsSegment) {
+                        return false;
+                    }
+                }
+                if (itsSegment->mapping_->getSize() < _size && !resize(*itsSegment, _size)) {
+                    // The segment stays claimed and is tried again with the next value
+                    return false;
+                }
+
+                std::memcpy(itsSegment->mapping_->getData(), _data, _size);
+                itsSegment->generation_ = ++generation_;
+                SegmentHeader *itsHeader = itsSegment->counters_->getHeader();
+                itsHeader->references_.store(_references);
+                itsHeader->generation_.store(itsSegment->generation_);
+
+                _frame.resize(HANDLE_SIZE + itsSegment->name_.size());
+                _frame[0] = MODE_SHARED;
+                writeLittleEndian(_size, 4, &_frame[1]);
+                writeLittleEndian(itsSegment->generation_, 8, &_frame[5]);
+                std::memcpy(&_frame[HANDLE_SIZE], itsSegment->name_.data(), itsSegment->name_.size());
+                return true;
+        #else
+                (void)_data;
+                (void)_size;
+                (void)_references;
+                (void)_frame;
+                return false;
+        #endif
+            }
+
+            // Adds a reference to the value of a handle frame. Returns false if the
+            // segment holds another value.
+            bool retain(const ByteBuffer &_frame) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                Segment *itsSegment = find(_frame);
+                if (!itsSegment) {
+                    return false;
+                }
+                itsSegment->counters_->getHeader()->references_.fetch_add(1);
+                return true;
+            }
+
+            // Drops a reference to the value of a handle frame that the writer holds
+            void release(const ByteBuffer &_frame) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                Segment *itsSegment = find(_frame);
+                if (itsSegment) {
+                    SharedMemory::release(itsSegment->counters_->getHeader(), itsSegment->generation_);
+                }
+            }
+
+        private:
+            struct Segment {
+                std::string name_;
+                int fd_;
+                std::unique_ptr<Mapping> mapping_;
+                std::unique_ptr<Mapping> counters_;
+                uint64_t generation_;
+            };
+
+            Writer()
+                : maxSegments_(16), mode_(0600), generation_(0) {
+        #ifndef _WIN32
+                std::stringstream itsPrefix;
+                itsPrefix << NAME_PREFIX << getpid() << "-" << std::hex
+                          << std::chrono::steady_clock::now().time_since_epoch().count() << "-";
+                prefix_ = itsPrefix.str();
+        #endif
+            }
+
+            // The segment that still holds the value of a handle frame
+            Segment *find(const ByteBuffer &_frame) {
+                if (_frame.size() <= HANDLE_SIZE || _frame[0] != MODE_SHARED) {
+                    return nullptr;
+                }
+                const uint64_t itsGeneration = readLittleEndian(&_frame[5], 8);
+                const std::string itsName(_frame.begin() + HANDLE_SIZE, _frame.end());
+                for (auto &itsSegment : segments_) {
+                    if (itsSegment->name_ == itsName && itsSegment->generation_ == itsGeneration) {
+                        return itsSegment.get();
+                    }
+                }
+                return nullptr;
+            }
+
+            // Takes a segment back whose references are all released. Marks it as being
+            // written first; a reader that was not counted and comes too late sees that
+            // its generation has gone before or after it copied the value.
+            bool claim(Segment &_segment) {
+                if (_segment.generation_ == 0) {
+                    return true;
+                }
+                SegmentHeader *itsHeader = _segment.counters_->getHeader();
+                if (itsHeader->references_.load() != 0) {
+                    return false;
+                }
+                itsHeader->generation_.store(0);
+                _segment.generation_ = 0;
+                return true;
+            }
+
+        #ifndef _WIN32
+            Segment *create() {
+                std::unique_ptr<Segment> itsSegment(new Segment);
+                itsSegment->name_ = prefix_ + std::to_string(segments_.size());
+                const std::string itsCountersName = itsSegment->name_ + COUNTERS_SUFFIX;
+                const int itsCountersFd = shm_open(itsCountersName.c_str(), O_CREAT | O_EXCL | O_RDWR, mode_);
+                if (itsCountersFd < 0) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot create ", itsCountersName);
+                    return nullptr;
+                }
+                // shm_open applies the umask, the mode is set as configured
+                if (fchmod(itsCountersFd, mode_) == 0 && ftruncate(itsCountersFd, off_t(SEGMENT_HEADER_SIZE)) == 0) {
+                    itsSegment->counters_ = Mapping::map(itsCountersFd, SEGMENT_HEADER_SIZE, true);
+                }
+                close(itsCountersFd);
+                if (!itsSegment->counters_) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot map ", itsCountersName);
+                    shm_unlink(itsCountersName.c_str());
+                    return nullptr;
+                }
+                itsSegment->fd_ = shm_open(itsSegment->name_.c_str(), O_CREAT | O_EXCL | O_RDWR, mode_);
+                if (itsSegment->fd_ < 0) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot create ", itsSegment->name_);
+                    shm_unlink(itsCountersName.c_str());
+                    return nullptr;
+                }
+                itsSegment->generation_ = 0;
+                if (fchmod(itsSegment->fd_, mode_) != 0 || !resize(*itsSegment, 0)) {
+                    shm_unlink(itsSegment->name_.c_str());
+                    shm_unlink(itsCountersName.c_str());
+                    close(itsSegment->fd_);
+                    return nullptr;
+                }
+                segments_.push_back(std::move(itsSegment));
+                return segments_.back().get();
+            }
+
+            // Segments only grow, in steps of 64 KiB; mappings of the readers stay valid
+            bool resize(Segment &_segment, std::size_t _size) {
+                const std::size_t itsStep(65536);
+                const std::size_t itsSize = (_size + itsStep) / itsStep * itsStep;
+                if (ftruncate(_segment.fd_, off_t(itsSize)) != 0) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot resize ", _segment.name_, " to ", itsSize, " bytes");
+                    return false;
+                }
+                std::unique_ptr<Mapping> itsMapping = Mapping::map(_segment.fd_, itsSize, true);
+                if (!itsMapping) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot map ", _segment.name_);
+                    return false;
+                }
+                _segment.mapping_ = std::move(itsMapping);
+                return true;
+            }
+        #else
+            Segment *create() {
+                return nullptr;
+            }
+
+            bool resize(Segment &, std::size_t) {
+                return false;
+            }
+        #endif
+
+            std::mutex mutex_;
+            std::vector<std::unique_ptr<Segment>> segments_;
+            std::size_t maxSegments_;
+            mode_t mode_;
+            uint64_t generation_;
+            std::string prefix_;
+        };
+
+        /*
+         * The segments that the receiving process has mapped. A mapping is kept while
+         * it is in use and for later values from the same segment. The process holds one
+         * reference to a value: it releases it with the first read and keeps a copy of
+         * the value for the other proxies that read the same handle.
+         */
+        class Reader {
+        public:
+            static Reader &get() {
+                static Reader theReader;
+                return theReader;
+            }
+
+            // Reads the value of a handle frame. Returns false if the segment cannot be
+            // mapped or does not hold the generation of the handle anymore.
+            template<typename Value_>
+            bool read(const ByteBuffer &_frame, Value_ &_value) {
+                if (_frame.size() <= HANDLE_SIZE || _frame[0] != MODE_SHARED) {
+                    return false;
+                }
+                const std::size_t itsSize = std::size_t(readLittleEndian(&_frame[1], 4));
+                const uint64_t itsGeneration = readLittleEndian(&_frame[5], 8);
+                const std::string itsName(_frame.begin() + HANDLE_SIZE, _frame.end());
+
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                Segment *itsSegment = map(itsName, itsSize);
+                if (!itsSegment) {
+                    return false;
+                }
+                if (itsSegment->generation_ != itsGeneration) {
+                    SegmentHeader *itsHeader = itsSegment->counters_->getHeader();
+                    // The writer marks a segment as claimed before it writes, so the copy
+                    // is complete if the generation holds before and after it
+                    if (itsHeader->generation_.load() != itsGeneration) {
+                        return false;
+                    }
+                    const uint8_t *itsData = itsSegment->mapping_->getData();
+                    itsSegment->value_.assign(itsData, itsData + itsSize);
+                    if (itsHeader->generation_.load() != itsGeneration) {
+                        itsSegment->value_.clear();
+                        return false;
+                    }
+                    itsSegment->generation_ = itsGeneration;
+                    release(itsHeader, itsGeneration);
+                }
+                _value.assign(itsSegment->value_.begin(), itsSegment->value_.end());
+                return true;
+            }
+
+        private:
+            struct Segment {
+                std::unique_ptr<Mapping> mapping_;
+                std::unique_ptr<Mapping> counters_;
+                uint64_t generation_;
+                ByteBuffer value_;
+            };
+
+            Reader() = default;
+
+            Segment *map(const std::string &_name, std::size_t _size) {
+                // Only segments of CommonAPI writers are opened
+                if (_name.compare(0, sizeof(NAME_PREFIX) - 1, NAME_PREFIX) != 0
+                        || _name.find('/', 1) != std::string::npos) {
+                    return nullptr;
+                }
+                auto it = segments_.find(_name);
+                if (it != segments_.end() && it->second->mapping_->getSize() >= _size) {
+                    return it->second.get();
+                }
+                if (it == segments_.end() && segments_.size() >= 64) {
+                    segments_.clear();
+                }
+        #ifndef _WIN32
+                // The segment may have grown, it is mapped again with its current size
+                std::unique_ptr<Segment> itsSegment(new Segment);
+                itsSegment->generation_ = 0;
+                int itsFd = shm_open(_name.c_str(), O_RDONLY, 0);
+                if (itsFd < 0) {
+                    COMMONAPI_ERROR("SomeIP shared memory: cannot open ", _name);
+                    return nullptr;
+                }
+                struct stat itsStat;
+                if (fstat(itsFd, &itsStat) == 0 && std::size_t(itsStat.st_size) >= _size) {
+                    itsSegment->mapping_ = Mapping::map(itsFd, std::size_t(itsStat.st_size), false);
+                }
+                close(itsFd);
+                if (!itsSegment->mapping_) {
+                    return nullptr;
+                }
+                if (it != segments_.end()) {
+                    itsSegment->counters_ = std::move(it->second->counters_);
+                    itsSegment->generation_ = it->second->generation_;
+                    itsSegment->value_.swap(it->second->value_);
+                } else {
+                    const std::string itsCountersName = _name + COUNTERS_SUFFIX;
+                    itsFd = shm_open(itsCountersName.c_str(), O_RDWR, 0);
+                    if (itsFd < 0) {
+                        COMMONAPI_ERROR("SomeIP shared memory: cannot open ", itsCountersName);
+                        return nullptr;
+                    }
+                    if (fstat(itsFd, &itsStat) == 0 && std::size_t(itsStat.st_size) >= SEGMENT_HEADER_SIZE) {
+                        itsSegment->counters_ = Mapping::map(itsFd, SEGMENT_HEADER_SIZE, true);
+                    }
+                    close(itsFd);
+                    if (!itsSegment->counters_) {
+                        return nullptr;
+                    }
+                }
+                Segment *itsResult = itsSegment.get();
+                segments_[_name] = std::move(itsSegment);
+                return itsResult;
+        #else
+                return nullptr;
+        #endif
+            }
+
+            std::mutex mutex_;
+            std::map<std::string, std::unique_ptr<Segment>> segments_;
+        };
+
+        /*
+         * Receivers of the event that is serialized on the current thread. The stub
+         * adapter sets them while it sends an event whose subscribers are all local,
+         * values are sent inline without a destination. The handles that are published
+         * for the event are collected for Field.
+         */
+        class Destination {
+        public:
+            explicit Destination(uint32_t _references)
+                : references_(_references),
+                  previous_(current()) {
+                current() = this;
+            }
+
+            ~Destination() {
+                current() = previous_;
+            }
+
+            Destination(const Destination &) = delete;
+            Destination &operator=(const Destination &) = delete;
+
+            uint32_t getReferences() const {
+                return references_;
+            }
+
+            void add(const ByteBuffer &_frame) {
+                frames_.push_back(_frame);
+            }
+
+            std::vector<ByteBuffer> &getFrames() {
+                return frames_;
+            }
+
+            static Destination *&current() {
+                static thread_local Destination *theDestination(nullptr);
+                return theDestination;
+            }
+
+        private:
+            uint32_t references_;
+            Destination *previous_;
+            std::vector<ByteBuffer> frames_;
+        };
+
+        /*
+         * Local and remote subscribers of the event groups of a stub adapter. Subscribers
+         * whose client type is unknown count as remote.
+         */
+        class Subscribers {
+        public:
+            // Returns true if the subscriber is local
+            bool update(eventgroup_id_t _eventgroup, client_id_t _client, const sec_client_t *_sec_client, bool _subscribe) {
+                const bool isLocal = (_sec_client != nullptr && _sec_client->client_type == VSOMEIP_CLIENT_UDS);
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                std::multiset<client_id_t> &itsClients = (isLocal ? local_ : remote_)[_eventgroup];
+                if (_subscribe) {
+                    itsClients.insert(_client);
+                } else {
+                    auto it = itsClients.find(_client);
+                    if (it != itsClients.end()) {
+                        itsClients.erase(it);
+                    }
+                }
+                return isLocal;
+            }
+
+            // Number of local receivers of an event of the event groups, 0 if one of its
+            // subscribers is remote
+            uint32_t getReaders(const std::set<eventgroup_id_t> &_eventgroups) const {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                std::set<client_id_t> itsClients;
+                for (auto itsEventgroup : _eventgroups) {
+                    auto itsRemote = remote_.find(itsEventgroup);
+                    if (itsRemote != remote_.end() && !itsRemote->second.empty()) {
+                        return 0;
+                    }
+                    auto itsLocal = local_.find(itsEventgroup);
+                    if (itsLocal != local_.end()) {
+                        itsClients.insert(itsLocal->second.begin(), itsLocal->second.end());
+                    }
+                }
+                return uint32_t(itsClients.size());
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            std::map<eventgroup_id_t, std::multiset<client_id_t>> local_;
+            std::map<eventgroup_id_t, std::multiset<client_id_t>> remote_;
+        };
+
+        /*
+         * Last value of a field attribute that was sent in shared memory. The middleware
+         * sends it again to each new subscriber, so the writer holds one reference to it
+         * until the next value is sent and adds one for each new local subscriber. A
+         * value that is sent between a subscription and the delivery of the last value
+         * keeps the added reference, its segment is not reused.
+         */
+        class Field {
+        public:
+            Field() = default;
+            Field(const Field &) = delete;
+            Field &operator=(const Field &) = delete;
+
+            ~Field() {
+                for (const auto &itsFrame : frames_) {
+                    Writer::get().release(itsFrame);
+                }
+            }
+
+            // Keeps the handles of the value that was sent, releases those of the last one
+            void update(std::vector<ByteBuffer> &_frames) {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                for (const auto &itsFrame : frames_) {
+                    Writer::get().release(itsFrame);
+                }
+                frames_.swap(_frames);
+            }
+
+            // Adds a reference for a new local subscriber
+            void retain() {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                for (const auto &itsFrame : frames_) {
+                    Writer::get().retain(itsFrame);
+                }
+            }
+
+            // True if the last value was sent in shared memory
+            bool isShared() const {
+                std::lock_guard<std::mutex> itsLock(mutex_);
+                return !frames_.empty();
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            std::vector<ByteBuffer> frames_;
+        };
+
+        /*
+         * Deployment of an element in shared memory. The threshold is part of the type,
+         * so that the serialization below is selected for all Deployables of the element,
+         * with or without a deployment object.
+         */
+        template<typename Inner_, uint32_t Threshold_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        inline CommonAPI::OutputStream<OutputStream> &writeFrame(CommonAPI::OutputStream<OutputStream> &_output,
+                const uint8_t *_data, std::size_t _size, uint32_t _threshold) {
+            ByteBuffer itsFrame;
+            Destination *itsDestination = Destination::current();
+            if (_size >= _threshold && itsDestination != nullptr
+                    && Writer::get().publish(_data, _size, itsDestination->getReferences(), itsFrame)) {
+                itsDestination->add(itsFrame);
+            } else {
+                itsFrame.resize(_size + 1);
+                itsFrame[0] = MODE_INLINE;
+                if (_size > 0) {
+                    std::memcpy(&itsFrame[1], _data, _size);
+                }
+            }
+            static_cast<OutputStream &>(_output).writeValue(itsFrame, static_cast<const ByteBufferDeployment *>(nullptr));
+            return _output;
+        }
+
+        template<typename Value_>
+        CommonAPI::InputStream<InputStream> &readFrame(CommonAPI::InputStream<InputStream> &_input, Value_ &_value) {
+            ByteBuffer itsFrame;
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            itsInput.readValue(itsFrame, static_cast<const ByteBufferDeployment *>(nullptr));
+            if (itsInput.hasError()) {
+                return _input;
+            }
+            if (!itsFrame.empty() && itsFrame[0] == MODE_INLINE) {
+                _value.assign(itsFrame.begin() + 1, itsFrame.end());
+            } else if (!Reader::get().read(itsFrame, _value)) {
+                COMMONAPI_ERROR("SomeIP shared memory: cannot read the value of a ", itsFrame.size(), " bytes frame");
+                _value.clear();
+            }
+            return _input;
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<ByteBuffer, Deployment<Inner_, Threshold_>> &_value) {
+            const ByteBuffer &itsValue = _value.getValue();
+            return writeFrame(_output, itsValue.data(), itsValue.size(), Threshold_);
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::string, Deployment<Inner_, Threshold_>> &_value) {
+            const std::string &itsValue = _value.getValue();
+            return writeFrame(_output, reinterpret_cast<const uint8_t *>(itsValue.data()), itsValue.size(), Threshold_);
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<ByteBuffer, Deployment<Inner_, Threshold_>> &_value) {
+            return readFrame(_input, _value.getValue());
+        }
+
+        template<typename Inner_, uint32_t Threshold_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::string, Deployment<Inner_, Threshold_>> &_value) {
+            return readFrame(_input, _value.getValue());
+        }
+
+        } // namespace SharedMemory
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_SHARED_MEMORY_HPP_
+    '''
+}
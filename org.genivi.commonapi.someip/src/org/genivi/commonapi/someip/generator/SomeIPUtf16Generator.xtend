@@ -0,0 +1,491 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the transcoding of String attributes and arguments that are deployed with
+ * SomeIpStringEncoding utf16le or utf16be: the validating UTF-8/UTF-16 conversion with
+ * SSE2/AVX2 kernels for ASCII runs and the stream operators that are selected by the
+ * deployment type of the element. The header does not depend on the model, it is
+ * written once to the default output directory.
+ */
+class SomeIPUtf16Generator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateUtf16(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipUtf16HeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateUtf16Header())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipUtf16HeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateUtf16Header() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_UTF16_HPP_
+        #define COMMONAPI_SOMEIP_UTF16_HPP_
+
+        #include <cstdint>
+        #include <cstring>
+        #include <string>
+        #include <vector>
+
+        #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+        #define COMMONAPI_SOMEIP_UTF16_X86
+        #include <immintrin.h>
+        #endif
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/Logger.hpp>
+        #include <CommonAPI/SomeIP/InputStream.hpp>
+        #include <CommonAPI/SomeIP/OutputStream.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Transcoding of UTF-16 deployed strings (SomeIpStringEncoding utf16le/utf16be).
+         *
+         * The wire format is the one of the runtime: length field, byte order mark, the
+         * UTF-16 code units in the deployed byte order and a 0x0000 terminator. Both
+         * directions validate their input: the UTF-8 value must not contain overlong
+         * sequences, surrogates or code points above U+10FFFF, a received value must
+         * have the deployed byte order mark and no unpaired surrogates.
+         *
+         * Runs of ASCII characters are converted 16 (SSE2) or 32 (AVX2) bytes at a time.
+         * AVX2 is selected at runtime if the CPU supports it, all other characters are
+         * converted by the scalar code. countUnits, which the serialized size functions
+         * (-sz) use, is selected the same way.
+         *
+         * Strings without length field (fixed length) and strings in structs, arrays or
+         * maps are still transcoded by the runtime.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace Utf16 {
+
+        static const std::size_t BOM_SIZE = 2;
+        static const std::size_t TERMINATOR_SIZE = 2;
+
+        inline void putUnit(uint8_t *_destination, uint16_t _unit, bool _isBigEndian) {
+            _destination[_isBigEndian ? 1 : 0] = static_cast<uint8_t>(_unit);
+            _destination[_isBigEndian ? 0 : 1] = static_cast<uint8_t>(_unit >> 8);
+        }
+
+        inline uint16_t getUnit(const uint8_t *_source, bool _isBigEndian) {
+            return _isBigEndian ? static_cast<uint16_t>((_source[0] << 8) | _source[1])
+                                : static_cast<uint16_t>((_source[1] << 8) | _source[0]);
+        }
+
+        /*
+         * ASCII kernels. They convert the leading ASCII characters and stop at the first
+         * block that contains another character, the remainder is left to the caller.
+         * widenAscii reads _size UTF-8 bytes and writes 2 bytes per character, narrowAscii
+         * reads _units code units and writes 1 byte per character. Both return the number
+         * of converted characters.
+         */
+        inline std::size_t widenAsciiScalar(const uint8_t *_source, std::size_t _size, uint8_t *_destination,
+                                            bool _isBigEndian) {
+            std::size_t i(0);
+            for (; i < _size && _source[i] < 0x80; i++) {
+                putUnit(_destination + 2 * i, _source[i], _isBigEndian);
+            }
+            return i;
+        }
+
+        inline std::size_t narrowAsciiScalar(const uint8_t *_source, std::size_t _units, uint8_t *_destination,
+                                             bool _isBigEndian) {
+            std::size_t i(0);
+            for (; i < _units; i++) {
+                const uint16_t itsUnit = getUnit(_source + 2 * i, _isBigEndian);
+                if (itsUnit >= 0x80)
+                    break;
+                _destination[i] = static_cast<uint8_t>(itsUnit);
+            }
+            return i;
+        }
+
+        #ifdef COMMONAPI_SOMEIP_UTF16_X86
+        inline std::size_t widenAsciiSse2(const uint8_t *_source, std::size_t _size, uint8_t *_destination,
+                                          bool _isBigEndian) {
+            const __m128i itsZero = _mm_setzero_si128();
+            std::size_t i(0);
+            for (; i + 16 <= _size; i += 16) {
+                const __m128i itsBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + i));
+                if (_mm_movemask_epi8(itsBytes) != 0)
+                    break;
+                __m128i itsLow, itsHigh;
+                if (_isBigEndian) {
+                    itsLow = _mm_unpacklo_epi8(itsZero, itsBytes);
+                    itsHigh = _mm_unpackhi_epi8(itsZero, itsBytes);
+                } else {
+                    itsLow = _mm_unpacklo_epi8(itsBytes, itsZero);
+                    itsHigh = _mm_unpackhi_epi8(itsBytes, itsZero);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(_destination + 2 * i), itsLow);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(_destination + 2 * i + 16), itsHigh);
+            }
+            return i;
+        }
+
+        inline std::size_t narrowAsciiSse2(const uint8_t *_source, std::size_t _units, uint8_t *_destination,
+                                           bool _isBigEndian) {
+            const __m128i itsMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const __m128i itsZero = _mm_setzero_si128();
+            std::size_t i(0);
+            for (; i + 8 <= _units; i += 8) {
+                __m128i itsUnits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + 2 * i));
+                if (_isBigEndian)
+                    itsUnits = _mm_or_si128(_mm_slli_epi16(itsUnits, 8), _mm_srli_epi16(itsUnits, 8));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(itsUnits, itsMask), itsZero)) != 0xFFFF)
+                    break;
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(_destination + i), _mm_packus_epi16(itsUnits, itsUnits));
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2")))
+        inline std::size_t widenAsciiAvx2(const uint8_t *_source, std::size_t _size, uint8_t *_destination,
+                                          bool _isBigEndian) {
+            std::size_t i(0);
+            for (; i + 32 <= _size; i += 32) {
+                const __m256i itsBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_source + i));
+                if (_mm256_movemask_epi8(itsBytes) != 0)
+                    break;
+                __m256i itsLow = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(itsBytes));
+                __m256i itsHigh = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(itsBytes, 1));
+                if (_isBigEndian) {
+                    itsLow = _mm256_slli_epi16(itsLow, 8);
+                    itsHigh = _mm256_slli_epi16(itsHigh, 8);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(_destination + 2 * i), itsLow);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(_destination + 2 * i + 32), itsHigh);
+            }
+            return i;
+        }
+
+        __attribute__((target("avx2")))
+        inline std::size_t narrowAsciiAvx2(const uint8_t *_source, std::size_t _units, uint8_t *_destination,
+                                           bool _isBigEndian) {
+            const __m256i itsMask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            std::size_t i(0);
+            for (; i + 16 <= _units; i += 16) {
+                __m256i itsUnits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_source + 2 * i));
+                if (_isBigEndian)
+                    itsUnits = _mm256_or_si256(_mm256_slli_epi16(itsUnits, 8), _mm256_srli_epi16(itsUnits, 8));
+                if (!_mm256_testz_si256(itsUnits, itsMask))
+                    break;
+                // packus works per 128 bit lane, the permutation moves both halves together
+                const __m256i itsPacked = _mm256_permute4x64_epi64(_mm256_packus_epi16(itsUnits, itsUnits), 0xD8);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(_destination + i), _mm256_castsi256_si128(itsPacked));
+            }
+            return i;
+        }
+
+        inline bool hasAvx2() {
+            static const bool itsHasAvx2 = __builtin_cpu_supports("avx2");
+            return itsHasAvx2;
+        }
+        #endif
+
+        /*
+         * Counting kernels. They return the number of UTF-16 code units of _size UTF-8
+         * bytes without validating them: every byte that is not a continuation byte
+         * starts a code point, four byte sequences need a surrogate pair. The vector
+         * variants count whole blocks and return the number of counted bytes in _counted.
+         */
+        inline std::size_t countUnitsScalar(const uint8_t *_source, std::size_t _size) {
+            std::size_t itsUnits(0);
+            for (std::size_t i = 0; i < _size; i++) {
+                if ((_source[i] & 0xC0) != 0x80)
+                    itsUnits += (_source[i] >= 0xF0 ? 2 : 1);
+            }
+            return itsUnits;
+        }
+
+        #ifdef COMMONAPI_SOMEIP_UTF16_X86
+        inline std::size_t countUnitsSse2(const uint8_t *_source, std::size_t _size, std::size_t &_counted) {
+            // Signed compares: continuation bytes are -128..-65, four byte leads -16..-1
+            const __m128i itsLastContinuation = _mm_set1_epi8(-65);
+            const __m128i itsLastThreeByteLead = _mm_set1_epi8(-17);
+            const __m128i itsZero = _mm_setzero_si128();
+            std::size_t itsUnits(0);
+            std::size_t i(0);
+            for (; i + 16 <= _size; i += 16) {
+                const __m128i itsBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_source + i));
+                const unsigned itsLeads = unsigned(_mm_movemask_epi8(_mm_cmpgt_epi8(itsBytes, itsLastContinuation)));
+                const unsigned itsFourByteLeads = unsigned(_mm_movemask_epi8(_mm_and_si128(
+                    _mm_cmpgt_epi8(itsBytes, itsLastThreeByteLead), _mm_cmplt_epi8(itsBytes, itsZero))));
+                itsUnits += __builtin_popcount(itsLeads) + __builtin_popcount(itsFourByteLeads);
+            }
+            _counted = i;
+            return itsUnits;
+        }
+
+        __attribute__((target("avx2")))
+        inline std::size_t countUnitsAvx2(const uint8_t *_source, std::size_t _size, std::size_t &_counted) {
+            const __m256i itsLastContinuation = _mm256_set1_epi8(-65);
+            const __m256i itsLastThreeByteLead = _mm256_set1_epi8(-17);
+            const __m256i itsZero = _mm256_setzero_si256();
+            std::size_t itsUnits(0);
+            std::size_t i(0);
+            for (; i + 32 <= _size; i += 32) {
+                const __m256i itsBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_source + i));
+                const unsigned itsLeads = unsigned(_mm256_movemask_epi8(_mm256_cmpgt_epi8(itsBytes, itsLastContinuation)));
+                const unsigned itsFourByteLeads = unsigned(_mm256_movemask_epi8(_mm256_and_si256(
+                    _mm256_cmpgt_epi8(itsBytes, itsLastThreeByteLead), _mm256_cmpgt_epi8(itsZero, itsBytes))));
+                itsUnits += __builtin_popcount(itsLeads) + __builtin_popcount(itsFourByteLeads);
+            }
+            _counted = i;
+            return itsUnits;
+        }
+        #endif
+
+        inline std::size_t countUnits(const char *_data, std::size_t _size) {
+            const uint8_t *itsSource = reinterpret_cast<const uint8_t *>(_data);
+            std::size_t itsUnits(0);
+            std::size_t i(0);
+        #ifdef COMMONAPI_SOMEIP_UTF16_X86
+            std::size_t itsCounted(0);
+            if (hasAvx2()) {
+                itsUnits = countUnitsAvx2(itsSource, _size, itsCounted);
+                i = itsCounted;
+            }
+            itsUnits += countUnitsSse2(itsSource + i, _size - i, itsCounted);
+            i += itsCounted;
+        #endif
+            return itsUnits + countUnitsScalar(itsSource + i, _size - i);
+        }
+
+        inline std::size_t widenAscii(const uint8_t *_source, std::size_t _size, uint8_t *_destination,
+                                      bool _isBigEndian) {
+            std::size_t i(0);
+        #ifdef COMMONAPI_SOMEIP_UTF16_X86
+            if (hasAvx2())
+                i = widenAsciiAvx2(_source, _size, _destination, _isBigEndian);
+            i += widenAsciiSse2(_source + i, _size - i, _destination + 2 * i, _isBigEndian);
+        #endif
+            return i + widenAsciiScalar(_source + i, _size - i, _destination + 2 * i, _isBigEndian);
+        }
+
+        inline std::size_t narrowAscii(const uint8_t *_source, std::size_t _units, uint8_t *_destination,
+                                       bool _isBigEndian) {
+            std::size_t i(0);
+        #ifdef COMMONAPI_SOMEIP_UTF16_X86
+            if (hasAvx2())
+                i = narrowAsciiAvx2(_source, _units, _destination, _isBigEndian);
+            i += narrowAsciiSse2(_source + 2 * i, _units - i, _destination + i, _isBigEndian);
+        #endif
+            return i + narrowAsciiScalar(_source + 2 * i, _units - i, _destination + i, _isBigEndian);
+        }
+
+        /*
+         * Converts an UTF-8 string into BOM, code units and terminator. Returns false if
+         * the string is not valid UTF-8. The ASCII kernel is passed as template argument
+         * to compare the scalar and the vector variants.
+         */
+        template<std::size_t (*Widen_)(const uint8_t *, std::size_t, uint8_t *, bool)>
+        bool encode(const std::string &_value, bool _isBigEndian, std::vector<uint8_t> &_buffer) {
+            const uint8_t *itsSource = reinterpret_cast<const uint8_t *>(_value.data());
+            const std::size_t itsSize = _value.size();
+            // An UTF-8 byte never becomes more than one code unit
+            _buffer.resize(BOM_SIZE + 2 * itsSize + TERMINATOR_SIZE);
+            uint8_t *itsDestination = _buffer.data();
+            putUnit(itsDestination, 0xFEFF, _isBigEndian);
+            itsDestination += BOM_SIZE;
+
+            std::size_t i(0);
+            while (i < itsSize) {
+                const std::size_t itsAscii = Widen_(itsSource + i, itsSize - i, itsDestination, _isBigEndian);
+                i += itsAscii;
+                itsDestination += 2 * itsAscii;
+                if (i == itsSize)
+                    break;
+
+                const uint8_t itsLead = itsSource[i];
+                uint32_t itsCodePoint;
+                std::size_t itsLength;
+                uint8_t itsMin(0x80), itsMax(0xBF);
+                if (itsLead >= 0xC2 && itsLead <= 0xDF) {
+                    itsCodePoint = itsLead & 0x1F;
+                    itsLength = 2;
+                } else if (itsLead >= 0xE0 && itsLead <= 0xEF) {
+                    itsCodePoint = itsLead & 0x0F;
+                    itsLength = 3;
+                    if (itsLead == 0xE0) itsMin = 0xA0;         // overlong
+                    if (itsLead == 0xED) itsMax = 0x9F;         // surrogates
+                } else if (itsLead >= 0xF0 && itsLead <= 0xF4) {
+                    itsCodePoint = itsLead & 0x07;
+                    itsLength = 4;
+                    if (itsLead == 0xF0) itsMin = 0x90;         // overlong
+                    if (itsLead == 0xF4) itsMax = 0x8F;         // above U+10FFFF
+                } else {
+                    return false;
+                }
+                if (itsSize - i < itsLength || itsSource[i + 1] < itsMin || itsSource[i + 1] > itsMax)
+                    return false;
+                for (std::size_t j = 1; j < itsLength; j++) {
+                    const uint8_t itsByte = itsSource[i + j];
+                    if ((itsByte & 0xC0) != 0x80)
+                        return false;
+                    itsCodePoint = (itsCodePoint << 6) | (itsByte & 0x3F);
+                }
+                i += itsLength;
+
+                if (itsCodePoint >= 0x10000) {
+                    itsCodePoint -= 0x10000;
+                    putUnit(itsDestination, static_cast<uint16_t>(0xD800 | (itsCodePoint >> 10)), _isBigEndian);
+                    putUnit(itsDestination + 2, static_cast<uint16_t>(0xDC00 | (itsCodePoint & 0x3FF)), _isBigEndian);
+                    itsDestination += 4;
+                } else {
+                    putUnit(itsDestination, static_cast<uint16_t>(itsCodePoint), _isBigEndian);
+                    itsDestination += 2;
+                }
+            }
+            putUnit(itsDestination, 0, _isBigEndian);
+            itsDestination += TERMINATOR_SIZE;
+            _buffer.resize(std::size_t(itsDestination - _buffer.data()));
+            return true;
+        }
+
+        /*
+         * Converts BOM, code units and terminator into an UTF-8 string. Returns false if
+         * the byte order mark does not match, the terminator is missing or a surrogate is
+         * not paired.
+         */
+        template<std::size_t (*Narrow_)(const uint8_t *, std::size_t, uint8_t *, bool)>
+        bool decode(const std::vector<uint8_t> &_buffer, bool _isBigEndian, std::string &_value) {
+            if (_buffer.size() < BOM_SIZE + TERMINATOR_SIZE || _buffer.size() % 2 != 0)
+                return false;
+            const uint8_t *itsSource = _buffer.data();
+            if (getUnit(itsSource, _isBigEndian) != 0xFEFF
+                    || getUnit(itsSource + _buffer.size() - TERMINATOR_SIZE, _isBigEndian) != 0)
+                return false;
+            itsSource += BOM_SIZE;
+            const std::size_t itsUnits = (_buffer.size() - BOM_SIZE - TERMINATOR_SIZE) / 2;
+
+            // A code unit never becomes more than three UTF-8 bytes
+            _value.resize(3 * itsUnits);
+            uint8_t *itsDestination = reinterpret_cast<uint8_t *>(&_value[0]);
+            uint8_t *itsStart = itsDestination;
+            std::size_t i(0);
+            while (i < itsUnits) {
+                const std::size_t itsAscii = Narrow_(itsSource + 2 * i, itsUnits - i, itsDestination, _isBigEndian);
+                i += itsAscii;
+                itsDestination += itsAscii;
+                if (i == itsUnits)
+                    break;
+
+                uint32_t itsCodePoint = getUnit(itsSource + 2 * i, _isBigEndian);
+                i++;
+                if (itsCodePoint >= 0xD800 && itsCodePoint <= 0xDFFF) {
+                    if (itsCodePoint >= 0xDC00 || i == itsUnits)
+                        return false;
+                    const uint16_t itsLow = getUnit(itsSource + 2 * i, _isBigEndian);
+                    if (itsLow < 0xDC00 || itsLow > 0xDFFF)
+                        return false;
+                    i++;
+                    itsCodePoint = 0x10000 + ((itsCodePoint - 0xD800) << 10) + (itsLow - 0xDC00);
+                }
+                if (itsCodePoint < 0x80) {
+                    *itsDestination++ = static_cast<uint8_t>(itsCodePoint);
+                } else if (itsCodePoint < 0x800) {
+                    *itsDestination++ = static_cast<uint8_t>(0xC0 | (itsCodePoint >> 6));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | (itsCodePoint & 0x3F));
+                } else if (itsCodePoint < 0x10000) {
+                    *itsDestination++ = static_cast<uint8_t>(0xE0 | (itsCodePoint >> 12));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | ((itsCodePoint >> 6) & 0x3F));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | (itsCodePoint & 0x3F));
+                } else {
+                    *itsDestination++ = static_cast<uint8_t>(0xF0 | (itsCodePoint >> 18));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | ((itsCodePoint >> 12) & 0x3F));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | ((itsCodePoint >> 6) & 0x3F));
+                    *itsDestination++ = static_cast<uint8_t>(0x80 | (itsCodePoint & 0x3F));
+                }
+            }
+            _value.resize(std::size_t(itsDestination - itsStart));
+            return true;
+        }
+
+        /*
+         * Deployment of an UTF-16 deployed string. The type selects the serialization
+         * below, the encoding and length width are taken from the deployment object.
+         */
+        template<typename Inner_>
+        struct Deployment : Inner_ {
+            template<typename... Arguments_>
+            Deployment(Arguments_... _arguments)
+                : Inner_(_arguments...) {
+            }
+        };
+
+        // Strings without deployment, with a fixed length or deployed as UTF-8 are
+        // serialized by the runtime
+        template<typename Inner_>
+        bool isTranscoded(const Deployment<Inner_> *_depl) {
+            return (_depl != nullptr && _depl->stringLengthWidth_ > 0
+                    && _depl->stringEncoding_ != StringEncoding::UTF8);
+        }
+
+        // More specialized than the Deployable operators of CommonAPI, found by argument
+        // dependent lookup through the deployment type
+        template<typename Inner_>
+        CommonAPI::OutputStream<OutputStream> &operator<<(CommonAPI::OutputStream<OutputStream> &_output,
+                const CommonAPI::Deployable<std::string, Deployment<Inner_>> &_value) {
+            OutputStream &itsOutput = static_cast<OutputStream &>(_output);
+            const Deployment<Inner_> *itsDepl = _value.getDepl();
+            if (isTranscoded(itsDepl)) {
+                ByteBuffer itsBuffer;
+                if (encode<widenAscii>(_value.getValue(),
+                        itsDepl->stringEncoding_ == StringEncoding::UTF16BE, itsBuffer)) {
+                    const ByteBufferDeployment itsBufferDepl(0, 0, itsDepl->stringLengthWidth_);
+                    itsOutput.writeValue(itsBuffer, &itsBufferDepl);
+                    return _output;
+                }
+                // The output stream has no setter for its error, the encoder of the runtime
+                // rejects the same strings and fails the stream
+                COMMONAPI_ERROR("SomeIP UTF-16: invalid UTF-8 string of ", _value.getValue().size(), " bytes");
+            }
+            itsOutput.writeValue(_value.getValue(), static_cast<const Inner_ *>(itsDepl));
+            return _output;
+        }
+
+        template<typename Inner_>
+        CommonAPI::InputStream<InputStream> &operator>>(CommonAPI::InputStream<InputStream> &_input,
+                CommonAPI::Deployable<std::string, Deployment<Inner_>> &_value) {
+            InputStream &itsInput = static_cast<InputStream &>(_input);
+            const Deployment<Inner_> *itsDepl = _value.getDepl();
+            if (!isTranscoded(itsDepl)) {
+                itsInput.readValue(_value.getValue(), static_cast<const Inner_ *>(itsDepl));
+                return _input;
+            }
+            ByteBuffer itsBuffer;
+            const ByteBufferDeployment itsBufferDepl(0, 0, itsDepl->stringLengthWidth_);
+            itsInput.readValue(itsBuffer, &itsBufferDepl);
+            if (!itsInput.hasError() && !decode<narrowAscii>(itsBuffer,
+                    itsDepl->stringEncoding_ == StringEncoding::UTF16BE, _value.getValue())) {
+                COMMONAPI_ERROR("SomeIP UTF-16: dropped invalid string of ", itsBuffer.size(), " bytes");
+                itsInput.setError();
+                _value.getValue().clear();
+            }
+            return _input;
+        }
+
+        } // namespace Utf16
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_UTF16_HPP_
+    '''
+}
@@ -0,0 +1,478 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator
+
+import com.google.inject.Inject
+import org.eclipse.xtext.generator.IFileSystemAccess
+import org.genivi.commonapi.someip.preferences.FPreferencesSomeIP
+import org.genivi.commonapi.someip.preferences.PreferenceConstantsSomeIP
+
+/**
+ * Generates the runtime of the read-only views (option -vw): the reader of a
+ * received payload and the codecs of primitives, strings, byte buffers,
+ * enumerations and arrays. The generated struct and union views of the type
+ * collections are built from them. The header does not depend on the model, it
+ * is written once to the default output directory.
+ */
+class SomeIPViewGenerator {
+    @Inject extension FrancaSomeIPGeneratorExtensions
+
+    def generateView(IFileSystemAccess _fileSystemAccess) {
+        if (FPreferencesSomeIP::getInstance.getPreference(PreferenceConstantsSomeIP::P_GENERATE_CODE_SOMEIP, "true").equals("true")) {
+            _fileSystemAccess.generateFile(someipViewHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                generateViewHeader())
+        }
+        else {
+            _fileSystemAccess.generateFile(someipViewHeaderPath, IFileSystemAccess.DEFAULT_OUTPUT,
+                PreferenceConstantsSomeIP::NO_CODE)
+        }
+    }
+
+    def private generateViewHeader() '''
+        «generateCommonApiSomeIPLicenseHeader()»
+
+        #ifndef COMMONAPI_SOMEIP_VIEW_HPP_
+        #define COMMONAPI_SOMEIP_VIEW_HPP_
+
+        #include <cstddef>
+        #include <cstdint>
+        #include <cstring>
+        #include <string>
+        #include <type_traits>
+        #include <vector>
+
+        «startInternalCompilation»
+
+        #include <CommonAPI/ByteBuffer.hpp>
+        #include <CommonAPI/Enumeration.hpp>
+
+        «endInternalCompilation»
+
+        /*
+         * Read-only views over received SOME/IP payloads.
+         *
+         * A view refers to the bytes of a received message and decodes an element only
+         * when it is accessed. The generated struct and union views check the bounds of
+         * all their elements when they are created; the accessors then decode without
+         * further checks. materialize() creates the CommonAPI value. A view is valid as
+         * long as the message it refers to.
+         *
+         * The layout of an element is described by a codec:
+         *
+         *   typedef ... Type;      the CommonAPI type of the element
+         *   typedef ... Value;     what an accessor returns, a value or a view
+         *   static const std::size_t fixedSize;   the size of every element, 0 if it varies
+         *   static bool skip(Reader &);           checks the element and moves behind it
+         *   static bool read(Reader &, Value &);  as skip, and returns the element
+         *   static Value get(const Reader &);     decodes a checked element
+         *   static void materialize(const Reader &, Type &);
+         *
+         * The codecs of primitives, strings, byte buffers, enumerations and arrays are
+         * defined here, a generated struct or union view is the codec of its type.
+         * UTF-16 strings, maps, polymorphic structs and bit width deployed integers and
+         * enumerations have no codec.
+         */
+        namespace CommonAPI {
+        namespace SomeIP {
+        namespace View {
+
+        // Decodes _size bytes in the given byte order
+        inline uint64_t load(const uint8_t *_data, std::size_t _size, bool _isLittleEndian) {
+            uint64_t value(0);
+            if (_isLittleEndian) {
+                for (std::size_t i = _size; i > 0; --i)
+                    value = (value << 8) | _data[i - 1];
+            } else {
+                for (std::size_t i = 0; i < _size; ++i)
+                    value = (value << 8) | _data[i];
+            }
+            return value;
+        }
+
+        // Position in a payload, all moves are checked against its end
+        class Reader {
+        public:
+            Reader()
+                : data_(nullptr), size_(0), position_(0), isLittleEndian_(false) {
+            }
+
+            Reader(const uint8_t *_data, std::size_t _size, bool _isLittleEndian)
+                : data_(_data), size_(_size), position_(0), isLittleEndian_(_isLittleEndian) {
+            }
+
+            const uint8_t *current() const { return data_ + position_; }
+            std::size_t getPosition() const { return position_; }
+            std::size_t getRemaining() const { return size_ - position_; }
+            bool isLittleEndian() const { return isLittleEndian_; }
+
+            // The reader at another position of the same payload
+            Reader at(std::size_t _position) const {
+                Reader itsReader(*this);
+                itsReader.position_ = _position;
+                return itsReader;
+            }
+
+            // The reader over the remaining bytes
+            Reader rest() const {
+                return Reader(current(), getRemaining(), isLittleEndian_);
+            }
+
+            bool skip(std::size_t _size) {
+                if (_size > getRemaining())
+                    return false;
+                position_ += _size;
+                return true;
+            }
+
+            // Reads an unsigned value of 1, 2 or 4 bytes, such as a length or a union type
+            bool readUnsigned(std::size_t _width, uint32_t &_value) {
+                if (_width > getRemaining())
+                    return false;
+                _value = uint32_t(load(current(), _width, isLittleEndian_));
+                position_ += _width;
+                return true;
+            }
+
+            // Returns the next _size bytes in _part and moves behind them
+            bool split(std::size_t _size, Reader &_part) {
+                if (_size > getRemaining())
+                    return false;
+                _part = Reader(current(), _size, isLittleEndian_);
+                position_ += _size;
+                return true;
+            }
+
+            // Reads a length field of _width bytes and splits off the bytes it covers
+            bool enter(std::size_t _width, Reader &_content) {
+                uint32_t itsLength;
+                return readUnsigned(_width, itsLength) && split(itsLength, _content);
+            }
+
+        private:
+            const uint8_t *data_;
+            std::size_t size_;
+            std::size_t position_;
+            bool isLittleEndian_;
+        };
+
+        template<std::size_t Size_> struct UnsignedOf;
+        template<> struct UnsignedOf<1> { typedef uint8_t Type; };
+        template<> struct UnsignedOf<2> { typedef uint16_t Type; };
+        template<> struct UnsignedOf<4> { typedef uint32_t Type; };
+        template<> struct UnsignedOf<8> { typedef uint64_t Type; };
+
+        // Integers, floating point values and booleans
+        template<typename Type_>
+        struct Primitive {
+            typedef Type_ Type;
+            typedef Type_ Value;
+            static const std::size_t fixedSize = sizeof(Type_);
+
+            static bool skip(Reader &_reader) {
+                return _reader.skip(fixedSize);
+            }
+
+            static bool read(Reader &_reader, Value &_value) {
+                if (fixedSize > _reader.getRemaining())
+                    return false;
+                _value = get(_reader);
+                return _reader.skip(fixedSize);
+            }
+
+            static Value get(const Reader &_reader) {
+                const typename UnsignedOf<sizeof(Type_)>::Type raw
+                    = typename UnsignedOf<sizeof(Type_)>::Type(load(_reader.current(), fixedSize, _reader.isLittleEndian()));
+                Type_ itsValue;
+                std::memcpy(&itsValue, &raw, sizeof(Type_));
+                return itsValue;
+            }
+
+            static void materialize(const Reader &_reader, Type &_value) {
+                _value = get(_reader);
+            }
+        };
+
+        template<>
+        inline bool Primitive<bool>::get(const Reader &_reader) {
+            return (*_reader.current() != 0);
+        }
+
+        // Characters of a received UTF-8 string, without byte order mark and terminator
+        class StringView {
+        public:
+            StringView() : data_(nullptr), size_(0) {}
+            StringView(const char *_data, std::size_t _size) : data_(_data), size_(_size) {}
+
+            const char *data() const { return data_; }
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            std::string str() const { return std::string(data_, size_); }
+
+            bool operator==(const std::string &_other) const {
+                return size_ == _other.size() && (size_ == 0 || std::memcmp(data_, _other.data(), size_) == 0);
+            }
+            bool operator!=(const std::string &_other) const { return !(*this == _other); }
+
+        private:
+            const char *data_;
+            std::size_t size_;
+        };
+
+        static const uint8_t UTF8_BOM[] = { 0xEF, 0xBB, 0xBF };
+        static const std::size_t UTF8_BOM_SIZE = sizeof(UTF8_BOM);
+
+        // UTF-8 strings. With a length width of 0, the string fills Length_ bytes.
+        template<std::size_t LengthWidth_, std::size_t Length_>
+        struct String {
+            typedef std::string Type;
+            typedef StringView Value;
+            static const std::size_t fixedSize = (LengthWidth_ == 0 ? Length_ : 0);
+
+            static bool skip(Reader &_reader) {
+                Value itsValue;
+                return read(_reader, itsValue);
+            }
+
+            static bool read(Reader &_reader, Value &_value) {
+                Reader itsContent;
+                if (LengthWidth_ == 0) {
+                    if (!_reader.split(Length_, itsContent))
+                        return false;
+                } else {
+                    if (!_reader.enter(LengthWidth_, itsContent))
+                        return false;
+                }
+                return decode(itsContent, _value);
+            }
+
+            static Value get(const Reader &_reader) {
+                Reader itsReader(_reader);
+                Value itsValue;
+                read(itsReader, itsValue);
+                return itsValue;
+            }
+
+            static void materialize(const Reader &_reader, Type &_value) {
+                const Value itsValue = get(_reader);
+                _value.assign(itsValue.data(), itsValue.size());
+            }
+
+        private:
+            // Content: byte order mark, characters, terminator (and padding)
+            static bool decode(const Reader &_content, Value &_value) {
+                const std::size_t itsSize = _content.getRemaining();
+                if (itsSize == 0) {
+                    _value = Value();
+                    return true;
+                }
+                if (itsSize < UTF8_BOM_SIZE + 1 || std::memcmp(_content.current(), UTF8_BOM, UTF8_BOM_SIZE) != 0)
+                    return false;
+                const char *itsCharacters = reinterpret_cast<const char *>(_content.current() + UTF8_BOM_SIZE);
+                const std::size_t itsLimit = itsSize - UTF8_BOM_SIZE;
+                if (LengthWidth_ == 0) {
+                    const void *itsTerminator = std::memchr(itsCharacters, 0, itsLimit);
+                    if (itsTerminator == nullptr)
+                        return false;
+                    _value = Value(itsCharacters, std::size_t(static_cast<const char *>(itsTerminator) - itsCharacters));
+                    return true;
+                }
+                if (itsCharacters[itsLimit - 1] != 0)
+                    return false;
+                _value = Value(itsCharacters, itsLimit - 1);
+                return true;
+            }
+        };
+
+        // Bytes of a received byte buffer
+        class ByteBufferView {
+        public:
+            ByteBufferView() : data_(nullptr), size_(0) {}
+            ByteBufferView(const uint8_t *_data, std::size_t _size) : data_(_data), size_(_size) {}
+
+            const uint8_t *data() const { return data_; }
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            uint8_t operator[](std::size_t _index) const { return data_[_index]; }
+            CommonAPI::ByteBuffer materialize() const { return CommonAPI::ByteBuffer(data_, data_ + size_); }
+
+        private:
+            const uint8_t *data_;
+            std::size_t size_;
+        };
+
+        // Byte buffers. With a length width of 0, the buffer has MaxLength_ bytes.
+        template<std::size_t LengthWidth_, std::size_t MaxLength_>
+        struct ByteBuffer {
+            typedef CommonAPI::ByteBuffer Type;
+            typedef ByteBufferView Value;
+            static const std::size_t fixedSize = (LengthWidth_ == 0 ? MaxLength_ : 0);
+
+            static bool skip(Reader &_reader) {
+                Value itsValue;
+                return read(_reader, itsValue);
+            }
+
+            static bool read(Reader &_reader, Value &_value) {
+                Reader itsContent;
+                if (LengthWidth_ == 0) {
+                    if (!_reader.split(MaxLength_, itsContent))
+                        return false;
+                } else {
+                    if (!_reader.enter(LengthWidth_, itsContent))
+                        return false;
+                    if (MaxLength_ > 0 && itsContent.getRemaining() > MaxLength_)
+                        return false;
+                }
+                _value = Value(itsContent.current(), itsContent.getRemaining());
+                return true;
+            }
+
+            static Value get(const Reader &_reader) {
+                Reader itsReader(_reader);
+                Value itsValue;
+                read(itsReader, itsValue);
+                return itsValue;
+            }
+
+            static void materialize(const Reader &_reader, Type &_value) {
+                const Value itsValue = get(_reader);
+                _value.assign(itsValue.data(), itsValue.data() + itsValue.size());
+            }
+        };
+
+        // Enumerations of Width_ bytes, signed backing types are sign extended
+        template<typename Type_, typename Base_, std::size_t Width_>
+        struct Enumeration {
+            typedef Type_ Type;
+            typedef Type_ Value;
+            static const std::size_t fixedSize = Width_;
+
+            static bool skip(Reader &_reader) {
+                return _reader.skip(Width_);
+            }
+
+            static bool read(Reader &_reader, Value &_value) {
+                if (Width_ > _reader.getRemaining())
+                    return false;
+                _value = get(_reader);
+                return _reader.skip(Width_);
+            }
+
+            static Value get(const Reader &_reader) {
+                uint64_t raw = load(_reader.current(), Width_, _reader.isLittleEndian());
+                if (std::is_signed<Base_>::value && Width_ < 8 && (raw >> (8 * Width_ - 1)) != 0)
+                    raw |= ~uint64_t(0) << (8 * Width_);
+                Type_ itsValue;
+                static_cast<CommonAPI::Enumeration<Base_> &>(itsValue) = static_cast<Base_>(raw);
+                return itsValue;
+            }
+
+            static void materialize(const Reader &_reader, Type &_value) {
+                _value = get(_reader);
+            }
+        };
+
+        // Arrays. With a length width of 0, the array has MaxLength_ elements. Elements
+        // of fixed size are accessed directly, others by walking from the first element.
+        template<typename Element_, std::size_t LengthWidth_, std::size_t MaxLength_>
+        class Array {
+        public:
+            typedef std::vector<typename Element_::Type> Type;
+            typedef Array Value;
+            static const std::size_t fixedSize
+                = (LengthWidth_ == 0 ? MaxLength_ * Element_::fixedSize : 0);
+
+            Array() : size_(0) {}
+
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+
+            typename Element_::Value operator[](std::size_t _index) const {
+                return Element_::get(locate(_index));
+            }
+
+            Type materialize() const {
+                Type itsValue;
+                materialize(itsValue);
+                return itsValue;
+            }
+
+            void materialize(Type &_value) const {
+                _value.resize(size_);
+                Reader itsReader(elements_);
+                for (std::size_t i = 0; i < size_; ++i) {
+                    Element_::materialize(itsReader, _value[i]);
+                    Element_::skip(itsReader);
+                }
+            }
+
+            static bool skip(Reader &_reader) {
+                Array itsValue;
+                return read(_reader, itsValue);
+            }
+
+            static bool read(Reader &_reader, Value &_value) {
+                if (LengthWidth_ == 0) {
+                    _value.size_ = MaxLength_;
+                    if (Element_::fixedSize > 0)
+                        return _reader.split(MaxLength_ * Element_::fixedSize, _value.elements_);
+                    _value.elements_ = _reader.rest();
+                    Reader itsReader(_value.elements_);
+                    for (std::size_t i = 0; i < MaxLength_; ++i) {
+                        if (!Element_::skip(itsReader))
+                            return false;
+                    }
+                    return _reader.skip(itsReader.getPosition());
+                }
+                if (!_reader.enter(LengthWidth_, _value.elements_))
+                    return false;
+                if (Element_::fixedSize > 0) {
+                    if (_value.elements_.getRemaining() % Element_::fixedSize != 0)
+                        return false;
+                    _value.size_ = _value.elements_.getRemaining() / Element_::fixedSize;
+                } else {
+                    Reader itsReader(_value.elements_);
+                    _value.size_ = 0;
+                    while (itsReader.getRemaining() > 0) {
+                        if (!Element_::skip(itsReader))
+                            return false;
+                        _value.size_++;
+                    }
+                }
+                return (MaxLength_ == 0 || _value.size_ <= MaxLength_);
+            }
+
+            static Value get(const Reader &_reader) {
+                Reader itsReader(_reader);
+                Value itsValue;
+                read(itsReader, itsValue);
+                return itsValue;
+            }
+
+            static void materialize(const Reader &_reader, Type &_value) {
+                get(_reader).materialize(_value);
+            }
+
+        private:
+            Reader locate(std::size_t _index) const {
+                if (Element_::fixedSize > 0)
+                    return elements_.at(_index * Element_::fixedSize);
+                Reader itsReader(elements_);
+                for (std::size_t i = 0; i < _index; ++i)
+                    Element_::skip(itsReader);
+                return itsReader;
+            }
+
+            Reader elements_;
+            std::size_t size_;
+        };
+
+        } // namespace View
+        } // namespace SomeIP
+        } // namespace CommonAPI
+
+        #endif // COMMONAPI_SOMEIP_VIEW_HPP_
+    '''
+}
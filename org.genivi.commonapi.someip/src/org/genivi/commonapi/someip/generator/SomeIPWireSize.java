@@ -0,0 +1,252 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+   This Source Code Form is subject to the terms of the Mozilla Public
+   License, v. 2.0. If a copy of the MPL was not distributed with this
+   file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+package org.genivi.commonapi.someip.generator;
+
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Result of the wire size analysis (generator option -ws) of a message or of an element
+ * that is serialized in a message: the length and type fields of the element whose deployed
+ * width is larger than their bound requires and the elements it contains. An element that
+ * contains nothing to reduce is not part of the result.
+ */
+public class SomeIPWireSize {
+
+	// Sections of the properties in an fdepl: on the element itself, "# { }" for array
+	// types, "#struct { }" and "#union { }"
+	public static final String DIRECT = null;
+	public static final String PLAIN = "";
+	public static final String STRUCT = "struct";
+	public static final String UNION = "union";
+
+	/**
+	 * A length or type field. The bound is the largest value the field can take, the minimal
+	 * width the number of bytes (1, 2 or 4) that holds it. A bound that is only declared
+	 * (the encoded SomeIpStringLength of a string with a length field) is not checked at
+	 * run time.
+	 */
+	public static class Width {
+		public final String section;
+		public final String property;
+		public final int width;
+		public final int minimalWidth;
+		public final long bound;
+		public final boolean isChecked;
+
+		public Width(String _section, String _property, int _width, long _bound, boolean _isChecked) {
+			section = _section;
+			property = _property;
+			width = _width;
+			minimalWidth = getMinimalWidth(_bound);
+			bound = _bound;
+			isChecked = _isChecked;
+		}
+
+		public boolean isReducible() {
+			return minimalWidth < width;
+		}
+
+		public int getSaving() {
+			return (isChecked && isReducible() ? width - minimalWidth : 0);
+		}
+	}
+
+	private final String name_;
+	private final String kind_;
+	private final boolean isOverwritable_;
+	private final List<Width> widths_ = new ArrayList<Width>();
+	private final List<SomeIPWireSize> children_ = new ArrayList<SomeIPWireSize>();
+	private String section_ = DIRECT;
+	private int alternatives_ = 0;
+	private long minCount_ = 1;
+	private Long maxCount_ = 1L;
+
+	/**
+	 * An element with _name (field, argument or attribute name, "[]" for the elements of an
+	 * array) or a message with _name and _kind. Elements that cannot be overwritten in the
+	 * deployment of the interface are reported, but not written to the fdepl.
+	 */
+	public SomeIPWireSize(String _name, String _kind, boolean _isOverwritable) {
+		name_ = _name;
+		kind_ = _kind;
+		isOverwritable_ = _isOverwritable;
+	}
+
+	public static int getMinimalWidth(long _bound) {
+		if (_bound <= 0xFFL)
+			return 1;
+		if (_bound <= 0xFFFFL)
+			return 2;
+		return 4;
+	}
+
+	public String getName() {
+		return name_;
+	}
+
+	public String getKind() {
+		return kind_;
+	}
+
+	public boolean isOverwritable() {
+		return isOverwritable_;
+	}
+
+	public void addWidth(Width _width) {
+		if (_width.isReducible())
+			widths_.add(_width);
+	}
+
+	public void addChild(SomeIPWireSize _child) {
+		if (!_child.isEmpty())
+			children_.add(_child);
+	}
+
+	// The children are the fields of a struct or the alternatives of a union
+	public void setSection(String _section, int _alternatives) {
+		section_ = _section;
+		alternatives_ = (UNION.equals(_section) ? _alternatives : 0);
+	}
+
+	public String getSection() {
+		return section_;
+	}
+
+	// Number of times the element is serialized in its parent, _max is null if unbounded
+	public void setCount(long _min, Long _max) {
+		minCount_ = _min;
+		maxCount_ = _max;
+	}
+
+	public boolean isEmpty() {
+		return widths_.isEmpty() && children_.isEmpty();
+	}
+
+	public List<Width> getWidths(String _section) {
+		List<Width> widths = new ArrayList<Width>();
+		for (Width width : widths_) {
+			if (_section == null ? width.section == null : _section.equals(width.section))
+				widths.add(width);
+		}
+		return widths;
+	}
+
+	// Children that are written to the fdepl
+	public List<SomeIPWireSize> getOverwrites() {
+		List<SomeIPWireSize> overwrites = new ArrayList<SomeIPWireSize>();
+		for (SomeIPWireSize child : children_) {
+			if (child.hasOverwrites())
+				overwrites.add(child);
+		}
+		return overwrites;
+	}
+
+	public boolean hasOverwrites() {
+		if (!isOverwritable_)
+			return false;
+		if (!widths_.isEmpty())
+			return true;
+		for (SomeIPWireSize child : children_) {
+			if (child.hasOverwrites())
+				return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Bytes the reduced widths save in one serialization of the element at least.
+	 */
+	public long getMinSaving() {
+		long saving = getOwnSaving();
+		if (alternatives_ > 0) {
+			long min = (children_.size() < alternatives_ ? 0 : Long.MAX_VALUE);
+			for (SomeIPWireSize child : children_)
+				min = Math.min(min, child.minCount_ * child.getMinSaving());
+			return saving + (children_.isEmpty() ? 0 : min);
+		}
+		for (SomeIPWireSize child : children_)
+			saving += child.minCount_ * child.getMinSaving();
+		return saving;
+	}
+
+	/**
+	 * Bytes the reduced widths save in one serialization of the element at most, null if
+	 * this is not bounded (reduced fields within arrays without a maximum length).
+	 */
+	public Long getMaxSaving() {
+		long saving = getOwnSaving();
+		long max = 0;
+		for (SomeIPWireSize child : children_) {
+			Long childSaving = child.getMaxSaving();
+			if (childSaving == null)
+				return null;
+			if (childSaving == 0)
+				continue;
+			if (child.maxCount_ == null)
+				return null;
+			if (alternatives_ > 0)
+				max = Math.max(max, child.maxCount_ * childSaving);
+			else
+				saving += child.maxCount_ * childSaving;
+		}
+		return saving + max;
+	}
+
+	private long getOwnSaving() {
+		long saving = 0;
+		for (Width width : widths_)
+			saving += width.getSaving();
+		return saving;
+	}
+
+	/**
+	 * Returns the report of the messages of an interface as JSON object.
+	 */
+	public static String toJson(String _interface, List<SomeIPWireSize> _messages) {
+		StringBuilder json = new StringBuilder();
+		json.append("{\n");
+		json.append("  \"version\": 1,\n");
+		json.append("  \"interface\": ").append(SomeIPGeneratorStatistics.quote(_interface)).append(",\n");
+		json.append("  \"messages\": [");
+		for (int i = 0; i < _messages.size(); i++) {
+			SomeIPWireSize message = _messages.get(i);
+			Long maxSaving = message.getMaxSaving();
+			json.append(i == 0 ? "\n" : ",\n");
+			json.append("    {\n");
+			json.append("      \"name\": ").append(SomeIPGeneratorStatistics.quote(message.name_)).append(",\n");
+			json.append("      \"kind\": ").append(SomeIPGeneratorStatistics.quote(message.kind_)).append(",\n");
+			json.append("      \"savedBytes\": { \"min\": ").append(message.getMinSaving())
+				.append(", \"max\": ").append(maxSaving == null ? "null" : maxSaving.toString()).append(" },\n");
+			json.append("      \"fields\": [");
+			List<String> fields = new ArrayList<String>();
+			for (SomeIPWireSize child : message.children_)
+				child.appendFields(fields, "", true);
+			for (int j = 0; j < fields.size(); j++)
+				json.append(j == 0 ? "\n" : ",\n").append("        ").append(fields.get(j));
+			json.append(fields.isEmpty() ? "]\n" : "\n      ]\n");
+			json.append("    }");
+		}
+		json.append(_messages.isEmpty() ? "]\n" : "\n  ]\n");
+		json.append("}\n");
+		return json.toString();
+	}
+
+	private void appendFields(List<String> _fields, String _parent, boolean _isOverwritable) {
+		String path = (_parent.isEmpty() || name_.equals("[]") ? _parent + name_ : _parent + "." + name_);
+		boolean isOverwritable = _isOverwritable && isOverwritable_;
+		for (Width width : widths_) {
+			_fields.add("{ \"path\": " + SomeIPGeneratorStatistics.quote(path)
+				+ ", \"property\": " + SomeIPGeneratorStatistics.quote(width.property)
+				+ ", \"width\": " + width.width
+				+ ", \"minimalWidth\": " + width.minimalWidth
+				+ ", \"bound\": " + width.bound
+				+ ", \"checked\": " + width.isChecked
+				+ ", \"overwrite\": " + isOverwritable + " }");
+		}
+		for (SomeIPWireSize child : children_)
+			child.appendFields(_fields, path, isOverwritable);
+	}
+}
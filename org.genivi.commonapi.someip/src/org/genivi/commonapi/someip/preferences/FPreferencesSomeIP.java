@@ -81,6 +81,51 @@ public class FPreferencesSomeIP
         if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_SYNC_CALLS_SOMEIP)) {
             preferences.put(PreferenceConstantsSomeIP.P_GENERATE_SYNC_CALLS_SOMEIP, "true");    
         }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_SERIALIZED_SIZE_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_SERIALIZED_SIZE_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_BIT_PACKING_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_BIT_PACKING_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_BENCHMARK_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_BENCHMARK_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_CACHE_DEPLOYMENT_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_CACHE_DEPLOYMENT_SOMEIP, "true");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_INSTRUMENTATION_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_INSTRUMENTATION_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_TRACEPOINTS_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_TRACEPOINTS_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_CAPTURE_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_CAPTURE_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_LOAD_GENERATOR_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_LOAD_GENERATOR_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_LAZY_MEMBERS_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_LAZY_MEMBERS_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_VIEWS_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_VIEWS_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_GENERATE_DEADLINES_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_GENERATE_DEADLINES_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_POOLED_POLYMORPH_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_POOLED_POLYMORPH_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_WIRE_SIZE_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_WIRE_SIZE_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_BULK_ARRAYS_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_BULK_ARRAYS_SOMEIP, "false");
+        }
+        if (!preferences.containsKey(PreferenceConstantsSomeIP.P_UTF16_STRINGS_SOMEIP)) {
+            preferences.put(PreferenceConstantsSomeIP.P_UTF16_STRINGS_SOMEIP, "false");
+        }
     }
 
     public String getPreference(String preferencename, String defaultValue) {
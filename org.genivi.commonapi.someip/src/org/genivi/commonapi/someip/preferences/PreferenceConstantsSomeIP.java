@@ -29,6 +29,21 @@ public interface PreferenceConstantsSomeIP extends PreferenceConstants
 	public static final String P_GENERATE_SYNC_CALLS_SOMEIP = P_GENERATE_SYNC_CALLS;
     public static final String P_ENABLE_SOMEIP_VALIDATOR= "enableSomeIPValidator";
     public static final String P_ENABLE_SOMEIP_DEPLOYMENT_VALIDATOR = "enableSomeIPDeploymentValidator";
+    public static final String P_GENERATE_SERIALIZED_SIZE_SOMEIP = "generateSerializedSizeSomeIP";
+    public static final String P_GENERATE_BIT_PACKING_SOMEIP = "generateBitPackingSomeIP";
+    public static final String P_GENERATE_BENCHMARK_SOMEIP = "generateBenchmarkSomeIP";
+    public static final String P_CACHE_DEPLOYMENT_SOMEIP = "cacheDeploymentSomeIP";
+    public static final String P_GENERATE_INSTRUMENTATION_SOMEIP = "generateInstrumentationSomeIP";
+    public static final String P_GENERATE_TRACEPOINTS_SOMEIP = "generateTracepointsSomeIP";
+    public static final String P_GENERATE_CAPTURE_SOMEIP = "generateCaptureSomeIP";
+    public static final String P_GENERATE_LOAD_GENERATOR_SOMEIP = "generateLoadGeneratorSomeIP";
+    public static final String P_LAZY_MEMBERS_SOMEIP = "lazyMembersSomeIP";
+    public static final String P_GENERATE_VIEWS_SOMEIP = "generateViewsSomeIP";
+    public static final String P_GENERATE_DEADLINES_SOMEIP = "generateDeadlinesSomeIP";
+    public static final String P_POOLED_POLYMORPH_SOMEIP = "pooledPolymorphSomeIP";
+    public static final String P_WIRE_SIZE_SOMEIP = "wireSizeSomeIP";
+    public static final String P_BULK_ARRAYS_SOMEIP = "bulkArraysSomeIP";
+    public static final String P_UTF16_STRINGS_SOMEIP = "utf16StringsSomeIP";
 
 	// preference values
     public static final String DEFAULT_OUTPUT_SOMEIP   	= "./src-gen/";
@@ -0,0 +1,30 @@
+# Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Checks that the ELF file FILE contains the static tracepoints of the
+# generated proxies and stub adapters (generator option -tp).
+#
+# usage: cmake -DREADELF=<readelf> -DFILE=<library> -P CheckTracepoints.cmake
+
+set(PROVIDER "commonapi_someip")
+set(PROBES request_send reply_receive dispatch_entry dispatch_exit event_fire)
+
+execute_process(COMMAND ${READELF} -n ${FILE}
+                OUTPUT_VARIABLE NOTES
+                RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "${READELF} -n ${FILE} failed: ${RESULT}")
+endif()
+
+if(NOT NOTES MATCHES "Provider: ${PROVIDER}")
+    message(FATAL_ERROR "${FILE} does not contain probes of provider ${PROVIDER}")
+endif()
+
+foreach(PROBE ${PROBES})
+    if(NOT NOTES MATCHES "Provider: ${PROVIDER}[ \t\r\n]+Name: ${PROBE}[ \t\r\n]")
+        message(FATAL_ERROR "${FILE} does not contain probe ${PROVIDER}:${PROBE}")
+    endif()
+    message(STATUS "found probe ${PROVIDER}:${PROBE}")
+endforeach()
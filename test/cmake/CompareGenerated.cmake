@@ -0,0 +1,44 @@
+# Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+# Compares the generated file ACTUAL with the expected file EXPECTED. With
+# IGNORE_WHITESPACE, indentation, trailing whitespace and empty lines are not
+# compared, as they depend on the template engine of the generator.
+#
+# usage: cmake -DEXPECTED=<file> -DACTUAL=<file> [-DIGNORE_WHITESPACE=ON] -P CompareGenerated.cmake
+
+foreach(FILE ${EXPECTED} ${ACTUAL})
+    if(NOT EXISTS ${FILE})
+        message(FATAL_ERROR "${FILE} does not exist")
+    endif()
+endforeach()
+
+function(read_lines FILE LINES)
+    file(STRINGS ${FILE} CONTENT)
+    set(RESULT)
+    foreach(LINE IN LISTS CONTENT)
+        if(IGNORE_WHITESPACE)
+            string(STRIP "${LINE}" LINE)
+            if(LINE STREQUAL "")
+                continue()
+            endif()
+        endif()
+        list(APPEND RESULT "${LINE}")
+    endforeach()
+    set(${LINES} "${RESULT}" PARENT_SCOPE)
+endfunction()
+
+if(IGNORE_WHITESPACE)
+    read_lines(${EXPECTED} EXPECTED_LINES)
+    read_lines(${ACTUAL} ACTUAL_LINES)
+else()
+    file(READ ${EXPECTED} EXPECTED_LINES)
+    file(READ ${ACTUAL} ACTUAL_LINES)
+endif()
+
+if(NOT EXPECTED_LINES STREQUAL ACTUAL_LINES)
+    message(FATAL_ERROR "${ACTUAL} differs from ${EXPECTED}")
+endif()
+message(STATUS "${ACTUAL} matches ${EXPECTED}")
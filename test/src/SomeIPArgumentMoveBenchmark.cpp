@@ -0,0 +1,125 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPArgumentMoveBenchmark
+*
+* Multithreaded benchmark of the reply path of generated proxies: a nested
+* container argument is deserialized into a Deployable and then handed to the
+* caller, either by copy (global heap allocates every inner container twice)
+* or by move (the deserialized containers are reused as they are). Both paths
+* allocate from the global heap; there is no per-message arena, as the C++ data
+* types and the input stream that allocates them are not generated here.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+typedef std::vector<std::vector<std::string>> NestedArray;
+typedef std::unordered_map<uint32_t, std::string> StringMap;
+
+typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::StringDeployment> InnerDeployment;
+typedef CommonAPI::SomeIP::ArrayDeployment<InnerDeployment> NestedDeployment;
+typedef CommonAPI::SomeIP::MapDeployment<CommonAPI::EmptyDeployment, CommonAPI::SomeIP::StringDeployment> MapDeployment;
+
+static const CommonAPI::SomeIP::StringDeployment stringDeployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF8);
+static const InnerDeployment innerDeployment(&stringDeployment, 0, 0, 4);
+static const NestedDeployment nestedDeployment(&innerDeployment, 0, 0, 4);
+static const MapDeployment mapDeployment(nullptr, &stringDeployment, 0, 0, 4);
+
+static CommonAPI::SomeIP::Message createPayload(const NestedArray &_nested, const StringMap &_map) {
+    CommonAPI::SomeIP::Message message = CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 515, false);
+    CommonAPI::SomeIP::OutputStream outStream(message, false);
+    outStream.writeValue(_nested, &nestedDeployment);
+    outStream.writeValue(_map, &mapDeployment);
+    outStream.flush();
+    return message;
+}
+
+template<bool _move>
+static void runWorker(CommonAPI::SomeIP::Message _message, std::size_t _iterations, std::atomic<std::size_t> &_checksum) {
+    NestedArray nested;
+    StringMap map;
+    std::size_t checksum(0);
+    for (std::size_t i = 0; i < _iterations; i++) {
+        CommonAPI::Deployable<NestedArray, NestedDeployment> deploy_nested(&nestedDeployment);
+        CommonAPI::Deployable<StringMap, MapDeployment> deploy_map(&mapDeployment);
+        CommonAPI::SomeIP::InputStream inStream(_message, false);
+        inStream >> deploy_nested >> deploy_map;
+        if (inStream.hasError()) {
+            std::cerr << "deserialization failed" << std::endl;
+            std::exit(1);
+        }
+        if (_move) {
+            nested = std::move(deploy_nested.getValue());
+            map = std::move(deploy_map.getValue());
+        } else {
+            nested = deploy_nested.getValue();
+            map = deploy_map.getValue();
+        }
+        checksum += nested.size() + map.size();
+    }
+    _checksum += checksum;
+}
+
+template<bool _move>
+static double runBenchmark(const CommonAPI::SomeIP::Message &_message, std::size_t _threads, std::size_t _iterations) {
+    std::atomic<std::size_t> checksum(0);
+    std::vector<std::thread> workers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t t = 0; t < _threads; t++) {
+        workers.push_back(std::thread(runWorker<_move>, _message, _iterations, std::ref(checksum)));
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (checksum == 0) {
+        std::cerr << "empty payload" << std::endl;
+    }
+    return double(_threads * _iterations) / elapsed.count();
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000);
+    std::size_t maxThreads = std::thread::hardware_concurrency();
+    if (maxThreads == 0) {
+        maxThreads = 4;
+    }
+
+    NestedArray nested(64, std::vector<std::string>(32, "commonapi.someip.deploymenttest"));
+    StringMap map;
+    for (uint32_t i = 0; i < 400; i++) {
+        map[i] = "value_" + std::to_string(i);
+    }
+    CommonAPI::SomeIP::Message message = createPayload(nested, map);
+
+    std::cout << "threads,copy_msgs_per_s,move_msgs_per_s" << std::endl;
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        double copied = runBenchmark<false>(message, threads, iterations);
+        double moved = runBenchmark<true>(message, threads, iterations);
+        std::cout << threads << "," << copied << "," << moved << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBackpressureBenchmark
+*
+* Throughput and latency of a method under overload, with and without the limits
+* of SomeIpMethodMaxInFlight and SomeIpMethodQueueDepth. The method runs on a pool
+* and takes a fixed time per call. Requests arrive open loop at a multiple of the
+* capacity of the pool. Without limits every request is queued, with limits the
+* requests beyond them are rejected at once. Reports per offered load the calls
+* completed per second, the share of rejected calls and the latency percentiles
+* of the completed calls, from arrival to the end of the method.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SomeIPBackpressure.hpp"
+#include "SomeIPExecution.hpp"
+
+namespace Backpressure = CommonAPI::SomeIP::Backpressure;
+namespace Execution = CommonAPI::SomeIP::Execution;
+
+typedef std::chrono::steady_clock Clock;
+
+struct Result {
+    std::size_t offered;
+    std::size_t completed;
+    std::size_t completedInTime;
+    std::size_t rejected;
+    std::vector<double> latencies;
+};
+
+static double percentile(std::vector<double> &_values, double _percentile) {
+    if (_values.empty()) {
+        return 0.0;
+    }
+    std::size_t index = std::size_t(_percentile * double(_values.size() - 1));
+    std::nth_element(_values.begin(), _values.begin() + long(index), _values.end());
+    return _values[index];
+}
+
+static Result runBenchmark(bool _isLimited, double _rate, std::chrono::milliseconds _duration,
+                           std::chrono::microseconds _callTime, std::size_t _workers, std::size_t _queueDepth) {
+    Result result{ 0, 0, 0, 0, std::vector<double>() };
+    std::mutex mutex;
+    std::atomic<std::size_t> pending(0);
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point end = start + _duration;
+
+    Backpressure::Limiter limiter(_workers, _queueDepth);
+    {
+        Execution::Pool pool(_workers);
+        auto execute = [&pool](Backpressure::Task _task) { pool.post(_task); };
+
+        // Sends the requests that are due every 100us
+        double due = 0.0;
+        for (Clock::time_point tick = start; tick < end; tick += std::chrono::microseconds(100)) {
+            std::this_thread::sleep_until(tick);
+            due += _rate / 10000.0;
+            for (; due >= 1.0; due -= 1.0) {
+                const Clock::time_point arrival = Clock::now();
+                Backpressure::Task call = [&, arrival]() {
+                    std::this_thread::sleep_for(_callTime);
+                    const Clock::time_point done = Clock::now();
+                    std::lock_guard<std::mutex> itsLock(mutex);
+                    result.completed++;
+                    if (done <= end)
+                        result.completedInTime++;
+                    result.latencies.push_back(std::chrono::duration<double, std::milli>(done - arrival).count());
+                    pending--;
+                };
+                result.offered++;
+                pending++;
+                if (!_isLimited) {
+                    pool.post(call);
+                } else if (!limiter.submit(call, execute)) {
+                    result.rejected++;
+                    pending--;
+                }
+            }
+        }
+
+        // Waits for the queued calls before the pool is destroyed
+        while (pending > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::chrono::milliseconds duration(argc > 1 ? std::strtol(argv[1], nullptr, 10) : 1000);
+    std::chrono::microseconds callTime(argc > 2 ? std::strtol(argv[2], nullptr, 10) : 1000);
+    std::size_t workers(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 4);
+    std::size_t queueDepth(argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 16);
+
+    const double capacity = double(workers) * 1000000.0 / double(callTime.count());
+    std::cout << "mode,load,offered_per_s,completed_per_s,rejected_percent,p50_ms,p99_ms,max_ms" << std::endl;
+    for (double load : { 0.5, 0.9, 1.0, 1.5, 2.0, 3.0, 4.0 }) {
+        for (bool isLimited : { false, true }) {
+            Result result = runBenchmark(isLimited, load * capacity, duration, callTime, workers, queueDepth);
+            const double seconds = double(duration.count()) / 1000.0;
+            std::cout << (isLimited ? "limited" : "unlimited") << ","
+                      << load << ","
+                      << double(result.offered) / seconds << ","
+                      << double(result.completedInTime) / seconds << ","
+                      << 100.0 * double(result.rejected) / double(std::max<std::size_t>(result.offered, 1)) << ","
+                      << percentile(result.latencies, 0.5) << ","
+                      << percentile(result.latencies, 0.99) << ","
+                      << percentile(result.latencies, 1.0) << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,332 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBackpressureTest
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "SomeIPBackpressure.hpp"
+#include "SomeIPExecution.hpp"
+
+namespace Backpressure = CommonAPI::SomeIP::Backpressure;
+namespace Execution = CommonAPI::SomeIP::Execution;
+
+// Blocks the tasks that wait for it until it is opened
+class Gate {
+public:
+    void wait() {
+        std::unique_lock<std::mutex> itsLock(mutex_);
+        waiting_++;
+        condition_.notify_all();
+        condition_.wait_for(itsLock, std::chrono::seconds(10), [this]() { return isOpen_; });
+    }
+
+    bool waitForWaiting(std::size_t _waiting) {
+        std::unique_lock<std::mutex> itsLock(mutex_);
+        return condition_.wait_for(itsLock, std::chrono::seconds(10), [this, _waiting]() { return waiting_ >= _waiting; });
+    }
+
+    void open() {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        isOpen_ = true;
+        condition_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::size_t waiting_ = 0;
+    bool isOpen_ = false;
+};
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class BackpressureTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test Calls beyond the running and the queued ones are rejected, queued calls run in order.
+*/
+TEST_F(BackpressureTest, RejectBeyondQueue) {
+    Execution::Pool pool(4);
+    auto limiter = std::make_shared<Backpressure::Limiter>(1, 2);
+    auto execute = [&pool](Backpressure::Task _task) { pool.post(_task); };
+
+    Gate gate;
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<int> done(0);
+    auto call = [&](int _index) {
+        return [&, _index]() {
+            if (_index == 0)
+                gate.wait();
+            std::lock_guard<std::mutex> itsLock(mutex);
+            order.push_back(_index);
+            done++;
+        };
+    };
+
+    EXPECT_TRUE(limiter->submit(call(0), execute));
+    ASSERT_TRUE(gate.waitForWaiting(1));
+    EXPECT_TRUE(limiter->submit(call(1), execute));
+    EXPECT_TRUE(limiter->submit(call(2), execute));
+    EXPECT_FALSE(limiter->submit(call(3), execute));
+    EXPECT_EQ(1u, limiter->getInFlight());
+    EXPECT_EQ(2u, limiter->getQueued());
+    EXPECT_EQ(1u, limiter->getRejected());
+
+    gate.open();
+    for (int i = 0; i < 1000 && done < 3; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(3, done.load());
+    EXPECT_EQ((std::vector<int>{ 0, 1, 2 }), order);
+    EXPECT_EQ(0u, limiter->getInFlight());
+    EXPECT_EQ(0u, limiter->getQueued());
+}
+
+/**
+* @test Many threads flood a limited method: the limits hold and every accepted call runs once.
+*/
+TEST_F(BackpressureTest, Stress) {
+    const std::size_t maxInFlight = 3;
+    const std::size_t queueDepth = 5;
+    const std::size_t clients = 16;
+    const std::size_t calls = 500;
+
+    Execution::Pool pool(8);
+    auto limiter = std::make_shared<Backpressure::Limiter>(maxInFlight, queueDepth);
+    auto execute = [&pool](Backpressure::Task _task) { pool.post(_task); };
+
+    std::atomic<std::size_t> running(0), maxRunning(0), maxQueued(0);
+    std::atomic<std::size_t> accepted(0), rejected(0), completed(0);
+    Backpressure::Task call = [&]() {
+        std::size_t itsRunning = ++running;
+        std::size_t itsMax = maxRunning;
+        while (itsRunning > itsMax && !maxRunning.compare_exchange_weak(itsMax, itsRunning));
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        running--;
+        completed++;
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < clients; i++) {
+        threads.push_back(std::thread([&]() {
+            for (std::size_t j = 0; j < calls; j++) {
+                if (limiter->submit(call, execute))
+                    accepted++;
+                else
+                    rejected++;
+                std::size_t itsQueued = limiter->getQueued();
+                std::size_t itsMax = maxQueued;
+                while (itsQueued > itsMax && !maxQueued.compare_exchange_weak(itsMax, itsQueued));
+                if (j % 16 == 0)
+                    std::this_thread::yield();
+            }
+        }));
+    }
+    for (auto &itsThread : threads)
+        itsThread.join();
+    for (int i = 0; i < 1000 && completed < accepted; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_EQ(clients * calls, accepted + rejected);
+    EXPECT_EQ(accepted.load(), completed.load());
+    EXPECT_EQ(rejected.load(), limiter->getRejected());
+    EXPECT_GT(rejected.load(), 0u);
+    EXPECT_LE(maxRunning.load(), maxInFlight);
+    EXPECT_LE(maxQueued.load(), queueDepth);
+    EXPECT_EQ(0u, limiter->getInFlight());
+    EXPECT_EQ(0u, limiter->getQueued());
+}
+
+/**
+* @test Calls of an inline method run on the calling threads, waiting ones on the thread that finishes.
+*/
+TEST_F(BackpressureTest, Inline) {
+    auto limiter = std::make_shared<Backpressure::Limiter>(2, 100);
+    auto execute = [](Backpressure::Task _task) { _task(); };
+
+    std::atomic<std::size_t> running(0), maxRunning(0), completed(0);
+    Backpressure::Task call = [&]() {
+        std::size_t itsRunning = ++running;
+        std::size_t itsMax = maxRunning;
+        while (itsRunning > itsMax && !maxRunning.compare_exchange_weak(itsMax, itsRunning));
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+        running--;
+        completed++;
+    };
+
+    std::atomic<std::size_t> accepted(0);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 8; i++) {
+        threads.push_back(std::thread([&]() {
+            for (std::size_t j = 0; j < 200; j++) {
+                if (limiter->submit(call, execute))
+                    accepted++;
+            }
+        }));
+    }
+    for (auto &itsThread : threads)
+        itsThread.join();
+
+    // The last thread that finishes a call runs the waiting ones before it returns
+    EXPECT_EQ(accepted.load(), completed.load());
+    EXPECT_LE(maxRunning.load(), 2u);
+    EXPECT_EQ(0u, limiter->getInFlight());
+}
+
+/**
+* @test The window of a proxy refuses calls beyond its size, counts them and ends them with REMOTE_ERROR.
+*/
+TEST_F(BackpressureTest, Window) {
+    Backpressure::Window window(2);
+    EXPECT_TRUE(window.tryAcquire());
+    {
+        Backpressure::Window::Slot slot(window);
+        EXPECT_TRUE(bool(slot));
+        Backpressure::Window::Slot refused(window);
+        EXPECT_FALSE(bool(refused));
+        EXPECT_EQ(2u, window.getOutstanding());
+    }
+    EXPECT_EQ(1u, window.getOutstanding());
+    EXPECT_TRUE(window.tryAcquire());
+    EXPECT_FALSE(window.tryAcquire());
+    window.release();
+    window.release();
+    EXPECT_EQ(0u, window.getOutstanding());
+    EXPECT_EQ(2u, window.getRefused());
+
+    int calls = 0;
+    CommonAPI::CallStatus status = CommonAPI::CallStatus::SUCCESS;
+    std::string text("value");
+    std::function<void(const CommonAPI::CallStatus &, const int32_t &, const std::string &)> callback
+        = [&](const CommonAPI::CallStatus &_status, const int32_t &_value, const std::string &_text) {
+            calls++;
+            status = _status;
+            EXPECT_EQ(0, _value);
+            text = _text;
+        };
+    std::future<CommonAPI::CallStatus> future = Backpressure::reject<int32_t, std::string>(callback);
+    EXPECT_EQ(CommonAPI::CallStatus::REMOTE_ERROR, future.get());
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(CommonAPI::CallStatus::REMOTE_ERROR, status);
+    EXPECT_EQ("", text);
+
+    std::function<void(const CommonAPI::CallStatus &)> none;
+    EXPECT_EQ(CommonAPI::CallStatus::REMOTE_ERROR, Backpressure::reject<>(none).get());
+}
+
+/**
+* @test A call whose reply is sent later stays in flight until its permit is released.
+*/
+TEST_F(BackpressureTest, DeferredReply) {
+    auto limiter = std::make_shared<Backpressure::Limiter>(1, 1);
+    auto execute = [](Backpressure::Task _task) { _task(); };
+
+    std::vector<std::shared_ptr<Backpressure::Limiter::Permit>> replies;
+    std::vector<int> order;
+    auto call = [&](int _index) {
+        return [&, _index]() {
+            order.push_back(_index);
+            replies.push_back(Backpressure::Limiter::Permit::take());
+            EXPECT_FALSE(Backpressure::Limiter::Permit::take());
+        };
+    };
+
+    EXPECT_FALSE(Backpressure::Limiter::Permit::take());
+    EXPECT_TRUE(limiter->submit(call(0), execute));
+    EXPECT_EQ(1u, limiter->getInFlight());
+    EXPECT_TRUE(limiter->submit(call(1), execute));
+    EXPECT_FALSE(limiter->submit(call(2), execute));
+    EXPECT_EQ((std::vector<int>{ 0 }), order);
+    EXPECT_EQ(1u, limiter->getQueued());
+
+    // Sending the reply runs the waiting call
+    ASSERT_TRUE(bool(replies[0]));
+    replies[0]->release();
+    replies[0]->release();
+    EXPECT_EQ((std::vector<int>{ 0, 1 }), order);
+    EXPECT_EQ(1u, limiter->getInFlight());
+    EXPECT_EQ(0u, limiter->getQueued());
+
+    // A reply that is dropped ends the call as well
+    ASSERT_TRUE(bool(replies[1]));
+    replies[1].reset();
+    EXPECT_EQ(0u, limiter->getInFlight());
+
+    std::size_t inFlight(0);
+    EXPECT_TRUE(limiter->submit([&]() { inFlight = limiter->getInFlight(); }, execute));
+    EXPECT_EQ(1u, inFlight);
+    EXPECT_EQ(0u, limiter->getInFlight());
+}
+
+/**
+* @test Replies that are sent from other threads pass the slots on to the waiting calls.
+*/
+TEST_F(BackpressureTest, DeferredReplyStress) {
+    const std::size_t maxInFlight = 2;
+    const std::size_t calls = 2000;
+
+    Execution::Pool pool(4);
+    Execution::Pool replier(2);
+    auto limiter = std::make_shared<Backpressure::Limiter>(maxInFlight, calls);
+    auto execute = [&pool](Backpressure::Task _task) { pool.post(_task); };
+
+    std::atomic<std::size_t> running(0), maxRunning(0), completed(0);
+    Backpressure::Task call = [&]() {
+        std::size_t itsRunning = ++running;
+        std::size_t itsMax = maxRunning;
+        while (itsRunning > itsMax && !maxRunning.compare_exchange_weak(itsMax, itsRunning));
+        std::shared_ptr<Backpressure::Limiter::Permit> itsPermit = Backpressure::Limiter::Permit::take();
+        replier.post([&running, &completed, itsPermit]() {
+            running--;
+            completed++;
+            itsPermit->release();
+        });
+    };
+
+    for (std::size_t i = 0; i < calls; i++)
+        EXPECT_TRUE(limiter->submit(call, execute));
+    for (int i = 0; i < 1000 && (completed < calls || limiter->getInFlight() > 0); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_EQ(calls, completed.load());
+    EXPECT_LE(maxRunning.load(), maxInFlight);
+    EXPECT_EQ(0u, limiter->getInFlight());
+    EXPECT_EQ(0u, limiter->getQueued());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
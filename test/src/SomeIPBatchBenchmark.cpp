@@ -0,0 +1,257 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBatchBenchmark
+*
+* Benchmark of batch notifications (SomeIpBatchEventGroups) for an event group
+* of ten UInt32 attributes. A logical update changes one to ten of them. Without
+* batching every changed attribute is sent on its own notifier, with batching
+* the update is sent as one batch event that carries a slot for each attribute
+* with the values of the changed ones. Both sides are measured: the stub side collects
+* the changes and serializes the events, the proxy side deserializes them and
+* notifies the listeners of the attributes. Reports per logical update the
+* messages, which wake up the subscriber once each, the bytes including the
+* SOME/IP headers, the notified listeners and the time.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPBatch.hpp"
+
+namespace Batch = CommonAPI::SomeIP::Batch;
+
+static const std::size_t FIELDS = 10;
+static const std::size_t HEADER_SIZE = 16;     // SOME/IP header of every message
+
+typedef CommonAPI::Deployable<Batch::Slot<uint32_t>, CommonAPI::EmptyDeployment> DeployedSlot;
+
+// Batch of the event group as generated into the proxy
+struct GroupBatch {
+    uint32_t f0, f1, f2, f3, f4, f5, f6, f7, f8, f9;
+    bool isF0Changed, isF1Changed, isF2Changed, isF3Changed, isF4Changed,
+         isF5Changed, isF6Changed, isF7Changed, isF8Changed, isF9Changed;
+};
+
+static uint32_t GroupBatch::* const values[FIELDS] = {
+    &GroupBatch::f0, &GroupBatch::f1, &GroupBatch::f2, &GroupBatch::f3, &GroupBatch::f4,
+    &GroupBatch::f5, &GroupBatch::f6, &GroupBatch::f7, &GroupBatch::f8, &GroupBatch::f9
+};
+
+static bool GroupBatch::* const isChanged[FIELDS] = {
+    &GroupBatch::isF0Changed, &GroupBatch::isF1Changed, &GroupBatch::isF2Changed, &GroupBatch::isF3Changed,
+    &GroupBatch::isF4Changed, &GroupBatch::isF5Changed, &GroupBatch::isF6Changed, &GroupBatch::isF7Changed,
+    &GroupBatch::isF8Changed, &GroupBatch::isF9Changed
+};
+
+// Proxy side events, fed by the benchmark instead of the SomeIP events
+class BatchEvent : public CommonAPI::Event<GroupBatch> {
+public:
+    void receive(const GroupBatch &_batch) {
+        notifyListeners(_batch);
+    }
+};
+
+class ValueEvent : public CommonAPI::Event<uint32_t> {
+public:
+    void receive(const uint32_t &_value) {
+        notifyListeners(_value);
+    }
+};
+
+struct Result {
+    std::size_t messages;
+    std::size_t bytes;
+    std::size_t notifications;
+    double time;
+};
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static void checkStream(bool _hasError) {
+    if (_hasError) {
+        std::cerr << "serialization failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+// Sends every changed attribute on its own notifier
+static Result runIndividual(std::size_t _changed, std::size_t _updates) {
+    Result result{ 0, 0, 0, 0.0 };
+    ValueEvent events[FIELDS];
+    uint32_t stubValues[FIELDS] = {};
+    uint32_t proxyValues[FIELDS] = {};
+    for (std::size_t f = 0; f < FIELDS; f++) {
+        events[f].subscribe([&result, &proxyValues, f](const uint32_t &_value) {
+            proxyValues[f] = _value;
+            result.notifications++;
+        });
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _updates; i++) {
+        for (std::size_t f = 0; f < _changed; f++) {
+            stubValues[f] = uint32_t(i * FIELDS + f + 1);
+
+            CommonAPI::SomeIP::Message message = createMessage();
+            {
+                CommonAPI::Deployable<uint32_t, CommonAPI::EmptyDeployment> deployedValue(stubValues[f], nullptr);
+                CommonAPI::SomeIP::OutputStream outStream(message, false);
+                outStream << deployedValue;
+                checkStream(outStream.hasError());
+                outStream.flush();
+            }
+            {
+                CommonAPI::Deployable<uint32_t, CommonAPI::EmptyDeployment> deployedValue(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+                CommonAPI::SomeIP::InputStream inStream(message, false);
+                inStream >> deployedValue;
+                checkStream(inStream.hasError());
+                events[f].receive(deployedValue.getValue());
+            }
+            result.messages++;
+            result.bytes += HEADER_SIZE + message.getBodyLength();
+        }
+    }
+    result.time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    for (std::size_t f = 0; f < FIELDS; f++) {
+        if (proxyValues[f] != stubValues[f]) {
+            std::cerr << "individual: value differs" << std::endl;
+            std::exit(1);
+        }
+    }
+    return result;
+}
+
+// Sends the changed attributes as one batch, like the fire and commit methods of
+// the stub adapter and the batch event of the proxy
+static Result runBatch(std::size_t _changed, std::size_t _updates) {
+    Result result{ 0, 0, 0, 0.0 };
+    Batch::Sender sender;
+    Batch::Cache<GroupBatch> cache;
+    BatchEvent batchEvent;
+    std::vector<std::unique_ptr<Batch::ChangedEvent<uint32_t, GroupBatch>>> events;
+    uint32_t stubValues[FIELDS] = {};
+    uint32_t proxyValues[FIELDS] = {};
+    for (std::size_t f = 0; f < FIELDS; f++) {
+        events.emplace_back(new Batch::ChangedEvent<uint32_t, GroupBatch>(batchEvent, values[f], isChanged[f]));
+        events[f]->subscribe([&result, &proxyValues, f](const uint32_t &_value) {
+            proxyValues[f] = _value;
+            result.notifications++;
+        });
+    }
+
+    auto send = [&]() {
+        const std::vector<Batch::State> itsStates = sender.take(FIELDS);
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            for (std::size_t f = 0; f < FIELDS; f++) {
+                DeployedSlot deployedSlot(Batch::Slot<uint32_t>(itsStates[f], stubValues[f]), nullptr);
+                outStream << deployedSlot;
+            }
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+        {
+            CommonAPI::SomeIP::InputStream inStream(message, false);
+            std::vector<DeployedSlot> deployedSlots(FIELDS, DeployedSlot(static_cast<CommonAPI::EmptyDeployment *>(nullptr)));
+            for (std::size_t f = 0; f < FIELDS; f++) {
+                inStream >> deployedSlots[f];
+            }
+            checkStream(inStream.hasError());
+            cache.write([&deployedSlots](GroupBatch &_last, GroupBatch &_known) {
+                for (std::size_t f = 0; f < FIELDS; f++) {
+                    const Batch::Slot<uint32_t> &itsSlot = deployedSlots[f].getValue();
+                    _last.*isChanged[f] = (itsSlot.state_ == Batch::State::CHANGED ||
+                        (itsSlot.state_ == Batch::State::PRESENT && !(_known.*isChanged[f])));
+                    if (itsSlot.state_ != Batch::State::ABSENT) {
+                        _last.*values[f] = itsSlot.value_;
+                        _known.*values[f] = itsSlot.value_;
+                        _known.*isChanged[f] = true;
+                    }
+                }
+            }, [&batchEvent](const GroupBatch &_batch) { batchEvent.receive(_batch); });
+        }
+        result.messages++;
+        result.bytes += HEADER_SIZE + message.getBodyLength();
+    };
+
+    // The batch after subscribing notifies all attributes and is not measured
+    {
+        std::lock_guard<std::mutex> itsLock(sender.getMutex());
+        sender.refresh();
+        send();
+        result = Result{ 0, 0, 0, 0.0 };
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _updates; i++) {
+        {
+            std::lock_guard<std::mutex> itsLock(sender.getMutex());
+            sender.begin();
+        }
+        Batch::Scope itsBatch([&sender, &send]() {
+            std::lock_guard<std::mutex> itsLock(sender.getMutex());
+            if (sender.commit()) {
+                send();
+            }
+        });
+        for (std::size_t f = 0; f < _changed; f++) {
+            std::lock_guard<std::mutex> itsLock(sender.getMutex());
+            stubValues[f] = uint32_t(i * FIELDS + f + 1);
+            if (sender.change(Batch::Position(f))) {
+                send();
+            }
+        }
+    }
+    result.time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    for (std::size_t f = 0; f < FIELDS; f++) {
+        if (proxyValues[f] != stubValues[f]) {
+            std::cerr << "batch: value differs" << std::endl;
+            std::exit(1);
+        }
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t updates = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000);
+
+    std::cout << "changed_fields,mode,messages_per_update,bytes_per_update,notifications_per_update,us_per_update" << std::endl;
+    for (std::size_t changed = 1; changed <= FIELDS; changed++) {
+        const Result individual = runIndividual(changed, updates);
+        const Result batch = runBatch(changed, updates);
+        for (auto &itsResult : { std::make_pair("individual", individual), std::make_pair("batch", batch) }) {
+            std::cout << changed << ","
+                      << itsResult.first << ","
+                      << double(itsResult.second.messages) / double(updates) << ","
+                      << double(itsResult.second.bytes) / double(updates) << ","
+                      << double(itsResult.second.notifications) / double(updates) << ","
+                      << itsResult.second.time / double(updates) << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,370 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBatchTest
+*/
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+
+#include "SomeIPBatch.hpp"
+
+namespace Batch = CommonAPI::SomeIP::Batch;
+
+typedef std::vector<Batch::State> States;
+
+static const Batch::State ABSENT = Batch::State::ABSENT;
+static const Batch::State PRESENT = Batch::State::PRESENT;
+static const Batch::State CHANGED = Batch::State::CHANGED;
+
+// Batch of an event group with two attributes, as generated into the proxy
+struct TestBatch {
+    uint32_t speed;
+    bool isSpeedChanged;
+    std::string gear;
+    bool isGearChanged;
+};
+
+// Batch event that is fed by the test instead of the SomeIP event, merges the
+// slots like the generated batch event of the proxy
+class TestBatchEvent : public CommonAPI::Event<TestBatch> {
+public:
+    void receive(const Batch::Slot<uint32_t> &_speed, const Batch::Slot<std::string> &_gear) {
+        cache_.write([&](TestBatch &_last, TestBatch &_known) {
+            _last.isSpeedChanged = (_speed.state_ == CHANGED || (_speed.state_ == PRESENT && !_known.isSpeedChanged));
+            if (_speed.state_ != ABSENT) {
+                _last.speed = _speed.value_;
+                _known.speed = _speed.value_;
+                _known.isSpeedChanged = true;
+            }
+            _last.isGearChanged = (_gear.state_ == CHANGED || (_gear.state_ == PRESENT && !_known.isGearChanged));
+            if (_gear.state_ != ABSENT) {
+                _last.gear = _gear.value_;
+                _known.gear = _gear.value_;
+                _known.isGearChanged = true;
+            }
+        }, [this](const TestBatch &_batch) { this->notifyListeners(_batch); });
+    }
+
+protected:
+    void onListenerAdded(const Listener &_listener, const Subscription _subscription) {
+        (void)_listener;
+        cache_.read([this, _subscription](const TestBatch &_batch) {
+            this->notifySpecificListener(_subscription, _batch);
+        });
+    }
+
+    void onLastListenerRemoved(const Listener &_listener) {
+        (void)_listener;
+        cache_.reset();
+    }
+
+private:
+    Batch::Cache<TestBatch> cache_;
+};
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class BatchTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+
+    TestBatchEvent batchEvent_;
+};
+
+/**
+* @test Changes outside of a batch are sent right away, changes within nested
+*       batches when the outermost batch is committed.
+*/
+TEST_F(BatchTest, SenderNesting) {
+    Batch::Sender sender;
+    std::lock_guard<std::mutex> itsLock(sender.getMutex());
+    EXPECT_TRUE(sender.change(1));
+    EXPECT_EQ(States({ ABSENT, CHANGED, ABSENT }), sender.take(3));
+
+    sender.begin();
+    EXPECT_FALSE(sender.change(2));
+    sender.begin();
+    EXPECT_FALSE(sender.change(0));
+    EXPECT_FALSE(sender.change(2));
+    EXPECT_FALSE(sender.commit());
+    EXPECT_TRUE(sender.commit());
+    EXPECT_EQ(States({ CHANGED, ABSENT, CHANGED }), sender.take(3));
+    EXPECT_EQ(States({ ABSENT, ABSENT, ABSENT }), sender.take(3));
+
+    sender.begin();
+    EXPECT_FALSE(sender.commit());
+}
+
+/**
+* @test After a subscription all attributes are sent, the changed ones are marked.
+*/
+TEST_F(BatchTest, SenderRefresh) {
+    Batch::Sender sender;
+    std::lock_guard<std::mutex> itsLock(sender.getMutex());
+    EXPECT_TRUE(sender.refresh());
+    EXPECT_EQ(States({ PRESENT, PRESENT }), sender.take(2));
+
+    sender.begin();
+    EXPECT_FALSE(sender.change(1));
+    EXPECT_FALSE(sender.refresh());
+    EXPECT_TRUE(sender.commit());
+    EXPECT_EQ(States({ PRESENT, CHANGED }), sender.take(2));
+
+    sender.begin();
+    EXPECT_FALSE(sender.refresh());
+    EXPECT_TRUE(sender.commit());
+    EXPECT_EQ(States({ PRESENT, PRESENT }), sender.take(2));
+}
+
+/**
+* @test An open batch does not block other threads, their changes are sent
+*       with the batch.
+*/
+TEST_F(BatchTest, SenderCollectsOtherThreads) {
+    Batch::Sender sender;
+    std::atomic<bool> isSentNow(true);
+    {
+        std::lock_guard<std::mutex> itsLock(sender.getMutex());
+        sender.begin();
+        sender.change(0);
+    }
+    std::thread itsThread([&sender, &isSentNow]() {
+        std::lock_guard<std::mutex> itsLock(sender.getMutex());
+        isSentNow = sender.change(1);
+    });
+    itsThread.join();
+    EXPECT_FALSE(isSentNow);
+
+    std::lock_guard<std::mutex> itsLock(sender.getMutex());
+    EXPECT_TRUE(sender.commit());
+    EXPECT_EQ(States({ CHANGED, CHANGED }), sender.take(2));
+}
+
+/**
+* @test A scope commits once when it is destroyed, a moved scope commits
+*       through its new owner.
+*/
+TEST_F(BatchTest, ScopeCommitsOnDestruction) {
+    unsigned commits(0);
+    {
+        Batch::Scope itsOuter([&commits]() { commits++; });
+        {
+            Batch::Scope itsInner([&commits]() { commits++; });
+            Batch::Scope itsMoved(std::move(itsInner));
+            EXPECT_EQ(0u, commits);
+        }
+        EXPECT_EQ(1u, commits);
+    }
+    EXPECT_EQ(2u, commits);
+}
+
+/**
+* @test Absent slots are sent as their state only, present and changed slots
+*       with their value. An unknown state fails the deserialization.
+*/
+TEST_F(BatchTest, SlotSerialization) {
+    typedef CommonAPI::Deployable<Batch::Slot<uint32_t>, CommonAPI::EmptyDeployment> DeployedSlot;
+    CommonAPI::SomeIP::Message message = CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+    {
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << DeployedSlot(Batch::Slot<uint32_t>(ABSENT, 7), nullptr);
+        outStream << DeployedSlot(Batch::Slot<uint32_t>(CHANGED, 8), nullptr);
+        outStream << DeployedSlot(Batch::Slot<uint32_t>(PRESENT, 9), nullptr);
+        EXPECT_FALSE(outStream.hasError());
+        outStream.flush();
+    }
+    EXPECT_EQ(1u + 5u + 5u, message.getBodyLength());
+    {
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        DeployedSlot itsAbsent(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+        DeployedSlot itsChanged(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+        DeployedSlot itsPresent(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+        inStream >> itsAbsent >> itsChanged >> itsPresent;
+        EXPECT_FALSE(inStream.hasError());
+        EXPECT_EQ(ABSENT, itsAbsent.getValue().state_);
+        EXPECT_EQ(0u, itsAbsent.getValue().value_);
+        EXPECT_EQ(CHANGED, itsChanged.getValue().state_);
+        EXPECT_EQ(8u, itsChanged.getValue().value_);
+        EXPECT_EQ(PRESENT, itsPresent.getValue().state_);
+        EXPECT_EQ(9u, itsPresent.getValue().value_);
+    }
+
+    message.getBodyData()[0] = 3;
+    CommonAPI::SomeIP::InputStream inStream(message, false);
+    DeployedSlot itsSlot(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+    inStream >> itsSlot;
+    EXPECT_TRUE(inStream.hasError());
+}
+
+/**
+* @test The attributes of a batch are notified if they are marked as changed or
+*       received for the first time.
+*/
+TEST_F(BatchTest, ChangedAttributesAreNotified) {
+    Batch::ChangedEvent<uint32_t, TestBatch> speedEvent(batchEvent_, &TestBatch::speed, &TestBatch::isSpeedChanged);
+    Batch::ChangedEvent<std::string, TestBatch> gearEvent(batchEvent_, &TestBatch::gear, &TestBatch::isGearChanged);
+    std::vector<uint32_t> speeds;
+    std::vector<std::string> gears;
+    speedEvent.subscribe([&speeds](const uint32_t &_speed) { speeds.push_back(_speed); });
+    gearEvent.subscribe([&gears](const std::string &_gear) { gears.push_back(_gear); });
+
+    // The field value cached by the middleware may lack attributes, the event
+    // that follows the subscription completes it
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 10), Batch::Slot<std::string>());
+    batchEvent_.receive(Batch::Slot<uint32_t>(PRESENT, 10), Batch::Slot<std::string>(PRESENT, "P"));
+    batchEvent_.receive(Batch::Slot<uint32_t>(), Batch::Slot<std::string>(CHANGED, "D"));
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 20), Batch::Slot<std::string>());
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 30), Batch::Slot<std::string>(CHANGED, "R"));
+
+    EXPECT_EQ(std::vector<uint32_t>({ 10, 20, 30 }), speeds);
+    EXPECT_EQ(std::vector<std::string>({ "P", "D", "R" }), gears);
+}
+
+/**
+* @test The batch keeps the last value of attributes that are not sent.
+*/
+TEST_F(BatchTest, UnchangedAttributesKeepTheirValue) {
+    std::vector<TestBatch> received;
+    batchEvent_.subscribe([&received](const TestBatch &_batch) { received.push_back(_batch); });
+
+    batchEvent_.receive(Batch::Slot<uint32_t>(PRESENT, 10), Batch::Slot<std::string>(PRESENT, "P"));
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 20), Batch::Slot<std::string>());
+
+    ASSERT_EQ(2u, received.size());
+    EXPECT_EQ(20u, received[1].speed);
+    EXPECT_TRUE(received[1].isSpeedChanged);
+    EXPECT_EQ("P", received[1].gear);
+    EXPECT_FALSE(received[1].isGearChanged);
+}
+
+/**
+* @test A listener that subscribes later receives the current value once.
+*/
+TEST_F(BatchTest, LateListener) {
+    Batch::ChangedEvent<uint32_t, TestBatch> speedEvent(batchEvent_, &TestBatch::speed, &TestBatch::isSpeedChanged);
+    std::vector<uint32_t> first, second;
+    CommonAPI::Event<TestBatch>::Subscription batchSubscription
+        = batchEvent_.subscribe([](const TestBatch &) {});
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 10), Batch::Slot<std::string>(CHANGED, "P"));
+    batchEvent_.receive(Batch::Slot<uint32_t>(), Batch::Slot<std::string>(CHANGED, "D"));
+
+    CommonAPI::Event<uint32_t>::Subscription itsSubscription
+        = speedEvent.subscribe([&first](const uint32_t &_speed) { first.push_back(_speed); });
+    EXPECT_EQ(std::vector<uint32_t>({ 10 }), first);
+
+    speedEvent.subscribe([&second](const uint32_t &_speed) { second.push_back(_speed); });
+    EXPECT_EQ(std::vector<uint32_t>({ 10 }), second);
+
+    batchEvent_.receive(Batch::Slot<uint32_t>(CHANGED, 20), Batch::Slot<std::string>());
+    EXPECT_EQ(std::vector<uint32_t>({ 10, 20 }), first);
+    EXPECT_EQ(std::vector<uint32_t>({ 10, 20 }), second);
+
+    speedEvent.unsubscribe(itsSubscription);
+    batchEvent_.unsubscribe(batchSubscription);
+}
+
+/**
+* @test The listeners of a batch see all values of one update together, only the
+*       changed attributes are sent.
+*/
+TEST_F(BatchTest, AtomicUpdate) {
+    Batch::Sender sender;
+    uint32_t speed(0);
+    std::string gear("P");
+    std::vector<std::pair<uint32_t, std::string>> received;
+    std::vector<States> sent;
+
+    batchEvent_.subscribe([&received](const TestBatch &_batch) {
+        received.push_back(std::make_pair(_batch.speed, _batch.gear));
+    });
+
+    // Stub adapter side: each change marks its position, the batch sends the changed
+    // attributes, the mutex of the sender is held
+    auto send = [&]() {
+        const States itsStates = sender.take(2);
+        sent.push_back(itsStates);
+        batchEvent_.receive(Batch::Slot<uint32_t>(itsStates[0], speed), Batch::Slot<std::string>(itsStates[1], gear));
+    };
+    auto fireSpeed = [&](uint32_t _value) {
+        std::lock_guard<std::mutex> itsLock(sender.getMutex());
+        speed = _value;
+        if (sender.change(0)) {
+            send();
+        }
+    };
+    auto fireGear = [&](const std::string &_value) {
+        std::lock_guard<std::mutex> itsLock(sender.getMutex());
+        gear = _value;
+        if (sender.change(1)) {
+            send();
+        }
+    };
+    auto begin = [&]() {
+        {
+            std::lock_guard<std::mutex> itsLock(sender.getMutex());
+            sender.begin();
+        }
+        return Batch::Scope([&]() {
+            std::lock_guard<std::mutex> itsLock(sender.getMutex());
+            if (sender.commit()) {
+                send();
+            }
+        });
+    };
+
+    {
+        Batch::Scope itsBatch = begin();
+        fireSpeed(5);
+        {
+            Batch::Scope itsNested = begin();
+            fireGear("D");
+        }
+        fireSpeed(7);
+        EXPECT_TRUE(received.empty());
+    }
+    fireGear("R");
+
+    ASSERT_EQ(2u, received.size());
+    EXPECT_EQ(std::make_pair(uint32_t(7), std::string("D")), received[0]);
+    EXPECT_EQ(std::make_pair(uint32_t(7), std::string("R")), received[1]);
+    EXPECT_EQ(States({ CHANGED, CHANGED }), sent[0]);
+    EXPECT_EQ(States({ ABSENT, CHANGED }), sent[1]);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,86 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBitPackingBenchmark
+*
+* Throughput benchmark of the generated bit packing functions for 10 and 12
+* bit samples, compared with masking and shifting every sample separately
+* into the output buffer.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceSomeIPBitPacking.hpp"
+
+namespace packing = v1_0::commonapi::someip::deploymenttest::TestInterface_;
+
+// element by element: every sample is masked and written bit group by bit group
+static void packElementwise(const std::vector<uint16_t> &_values, unsigned _bits, std::vector<uint8_t> &_out) {
+    _out.assign(packing::packedSize(_values.size(), _bits), 0);
+    std::size_t position(0);
+    for (auto value : _values) {
+        uint32_t masked = value & ((1u << _bits) - 1);
+        unsigned written(0);
+        while (written < _bits) {
+            const unsigned offset = unsigned(position % 8);
+            const unsigned chunk = std::min(8 - offset, _bits - written);
+            _out[position / 8] |= uint8_t(((masked >> written) & ((1u << chunk) - 1)) << offset);
+            written += chunk;
+            position += chunk;
+        }
+    }
+}
+
+template<typename _Function>
+static double measure(std::size_t _samples, std::size_t _iterations, _Function _function) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; i++) {
+        _function();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return double(_samples * _iterations) / elapsed.count() / 1.0e6;
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200);
+    const std::size_t samples = 1 << 16;
+
+    std::vector<uint16_t> values(samples);
+    for (std::size_t i = 0; i < samples; i++) {
+        values[i] = uint16_t((i * 2654435761u) >> 7);
+    }
+
+    std::cout << "bits,elementwise_msamples_s,pack_msamples_s,unpack_msamples_s" << std::endl;
+    for (unsigned bits : { 10u, 12u }) {
+        std::vector<uint16_t> masked(values);
+        for (auto &value : masked) {
+            value &= uint16_t((1u << bits) - 1);
+        }
+
+        std::vector<uint8_t> reference, packed(packing::packedSize(samples, bits));
+        std::vector<uint16_t> unpacked(samples);
+
+        double elementwise = measure(samples, iterations, [&]() { packElementwise(masked, bits, reference); });
+        double pack = measure(samples, iterations, [&]() {
+            packing::packBits(masked.data(), samples, bits, packed.data());
+        });
+        double unpack = measure(samples, iterations, [&]() {
+            packing::unpackBits(packed.data(), samples, bits, unpacked.data());
+        });
+
+        if (reference != packed || unpacked != masked) {
+            std::cerr << "bit packing mismatch for " << bits << " bits" << std::endl;
+            return 1;
+        }
+        std::cout << bits << "," << elementwise << "," << pack << "," << unpack << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,304 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBitPackingTest
+*/
+
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPBitPacking.hpp"
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPDeployment.hpp"
+
+namespace packing = v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@_;
+namespace types = v1_0::commonapi::someip::deploymenttest;
+
+typedef std::vector<uint8_t> Bytes;
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static Bytes getBody(CommonAPI::SomeIP::Message &_message) {
+    return Bytes(_message.getBodyData(), _message.getBodyData() + _message.getBodyLength());
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class BitPackingTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+
+    // packs bit by bit, least significant bit first
+    template<typename _Type>
+    std::vector<uint8_t> referencePack(const std::vector<_Type> &_values, unsigned _bits) {
+        std::vector<uint8_t> packed(packing::packedSize(_values.size(), _bits), 0);
+        std::size_t position(0);
+        for (auto value : _values) {
+            for (unsigned bit = 0; bit < _bits; bit++, position++) {
+                if ((uint64_t(value) >> bit) & 1) {
+                    packed[position / 8] |= uint8_t(1 << (position % 8));
+                }
+            }
+        }
+        return packed;
+    }
+
+    template<typename _Type>
+    std::vector<_Type> createValues(std::size_t _count, unsigned _bits) {
+        std::vector<_Type> values(_count);
+        for (auto &value : values) {
+            uint64_t raw = generator_();
+            if (_bits < 64) {
+                raw &= (uint64_t(1) << _bits) - 1;
+                // sign extend the generated value for signed types
+                if (std::is_signed<_Type>::value && (raw >> (_bits - 1)) & 1) {
+                    raw |= ~((uint64_t(1) << _bits) - 1);
+                }
+            }
+            value = _Type(raw);
+        }
+        return values;
+    }
+
+    /*
+     * Writes and reads the array with the packed deployment type of the generated
+     * typedef and with the plain array deployment of the runtime, which writes and
+     * reads every element with writeBitValue and readBitValue.
+     */
+    template<typename Array_, typename PackedDeployment_>
+    void checkStream(const Array_ &_values, unsigned _bits) {
+        typedef typename Array_::value_type Element;
+        typedef CommonAPI::SomeIP::IntegerDeployment<Element> ElementDeployment;
+        typedef CommonAPI::SomeIP::ArrayDeployment<ElementDeployment> RuntimeDeployment;
+
+        const ElementDeployment elementDepl(static_cast<uint8_t>(_bits));
+        const RuntimeDeployment runtimeDepl(&elementDepl, 0, 0, 4);
+        const PackedDeployment_ packedDepl(&elementDepl, 0, 0, 4);
+
+        CommonAPI::SomeIP::Message runtimeMessage = createMessage();
+        {
+            CommonAPI::SomeIP::OutputStream outStream(runtimeMessage, false);
+            outStream.writeValue(_values, &runtimeDepl);
+            EXPECT_FALSE(outStream.hasError());
+            outStream.flush();
+        }
+        CommonAPI::SomeIP::Message packedMessage = createMessage();
+        {
+            CommonAPI::Deployable<Array_, PackedDeployment_> deployedValues(_values, &packedDepl);
+            CommonAPI::SomeIP::OutputStream outStream(packedMessage, false);
+            outStream << deployedValues;
+            EXPECT_FALSE(outStream.hasError());
+            outStream.flush();
+        }
+        EXPECT_EQ(getBody(runtimeMessage), getBody(packedMessage)) << "count " << _values.size();
+        EXPECT_EQ(4 + packing::packedSize(_values.size(), _bits), packedMessage.getBodyLength());
+
+        {
+            CommonAPI::Deployable<Array_, PackedDeployment_> deployedValues(&packedDepl);
+            CommonAPI::SomeIP::InputStream inStream(runtimeMessage, false);
+            inStream >> deployedValues;
+            EXPECT_FALSE(inStream.hasError());
+            // Padding bits of narrow elements are received as trailing zero values
+            Array_ expected(_values);
+            expected.resize((8 * packing::packedSize(_values.size(), _bits)) / _bits, Element(0));
+            EXPECT_EQ(expected, deployedValues.getValue());
+        }
+        {
+            Array_ values;
+            CommonAPI::SomeIP::InputStream inStream(packedMessage, false);
+            inStream.readValue(values, &runtimeDepl);
+            EXPECT_FALSE(inStream.hasError());
+            values.resize(_values.size());
+            EXPECT_EQ(_values, values);
+        }
+    }
+
+    std::mt19937_64 generator_;
+};
+
+/**
+* @test Pack and unpack unsigned values for every bit width from 1 to 64.
+*/
+TEST_F(BitPackingTest, UnsignedRoundTrip) {
+    for (unsigned bits = 1; bits <= 64; bits++) {
+        for (std::size_t count : { 0, 1, 7, 8, 9, 63, 64, 65, 1000 }) {
+            std::vector<uint64_t> values = createValues<uint64_t>(count, bits);
+
+            std::vector<uint8_t> packed(packing::packedSize(count, bits));
+            packing::packBits(values.data(), count, bits, packed.data());
+            EXPECT_EQ(referencePack(values, bits), packed) << "bits " << bits << " count " << count;
+
+            std::vector<uint64_t> unpacked(count);
+            packing::unpackBits(packed.data(), count, bits, unpacked.data());
+            EXPECT_EQ(values, unpacked) << "bits " << bits << " count " << count;
+        }
+    }
+}
+
+/**
+* @test Pack and unpack signed values for every bit width from 1 to 64.
+*/
+TEST_F(BitPackingTest, SignedRoundTrip) {
+    for (unsigned bits = 1; bits <= 64; bits++) {
+        for (std::size_t count : { 0, 1, 7, 8, 9, 63, 64, 65, 1000 }) {
+            std::vector<int64_t> values = createValues<int64_t>(count, bits);
+
+            std::vector<uint8_t> packed(packing::packedSize(count, bits));
+            packing::packBits(values.data(), count, bits, packed.data());
+            EXPECT_EQ(referencePack(values, bits), packed) << "bits " << bits << " count " << count;
+
+            std::vector<int64_t> unpacked(count);
+            packing::unpackBits(packed.data(), count, bits, unpacked.data());
+            EXPECT_EQ(values, unpacked) << "bits " << bits << " count " << count;
+        }
+    }
+}
+
+/**
+* @test Use the generated functions of an array with SomeIpIntegerBitWidth = 12.
+*/
+TEST_F(BitPackingTest, UInt16Array12Bit) {
+    EXPECT_EQ(12u, packing::u16b12ArrayBitWidth);
+
+    v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@::u16b12Array samples
+        = createValues<uint16_t>(101, 12);
+    std::vector<uint8_t> packed;
+    packing::packU16b12Array(samples, packed);
+    EXPECT_EQ(std::size_t(152), packed.size());
+
+    v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@::u16b12Array result;
+    EXPECT_TRUE(packing::unpackU16b12Array(packed, samples.size(), result));
+    EXPECT_EQ(samples, result);
+
+    // too few bytes for the requested number of elements
+    packed.pop_back();
+    EXPECT_FALSE(packing::unpackU16b12Array(packed, samples.size(), result));
+}
+
+/**
+* @test Use the generated functions of an array with SomeIpIntegerBitWidth = 10.
+*/
+TEST_F(BitPackingTest, Int16Array10Bit) {
+    EXPECT_EQ(10u, packing::i16b10ArrayBitWidth);
+
+    v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@::i16b10Array samples
+        = { -512, -1, 0, 1, 511, -300, 300 };
+    std::vector<uint8_t> packed;
+    packing::packI16b10Array(samples, packed);
+    EXPECT_EQ(std::size_t(9), packed.size());
+
+    v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@::i16b10Array result;
+    EXPECT_TRUE(packing::unpackI16b10Array(packed, samples.size(), result));
+    EXPECT_EQ(samples, result);
+}
+
+/**
+* @test The generated typedef of a packed array type selects the packing stream operators.
+*/
+TEST_F(BitPackingTest, PackedDeploymentType) {
+    EXPECT_TRUE((std::is_base_of<CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<uint16_t>>,
+                                 packing::u16b12ArrayDeployment_t>::value));
+    EXPECT_TRUE((std::is_same<CommonAPI::SomeIP::PackedArray::Deployment<
+                                  CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<uint16_t>>, 12>,
+                              packing::u16b12ArrayDeployment_t>::value));
+    EXPECT_TRUE((std::is_same<CommonAPI::SomeIP::PackedArray::Deployment<
+                                  CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<int16_t>>, 10>,
+                              packing::i16b10ArrayDeployment_t>::value));
+}
+
+/**
+* @test Packed arrays of the deployment test model are serialized like the runtime serializes
+* bit width deployed elements, for all array sizes around the vector group size.
+*/
+TEST_F(BitPackingTest, StreamMatchesRuntime) {
+    for (std::size_t count : { 0, 1, 7, 8, 9, 15, 16, 17, 33, 101, 1000 }) {
+        checkStream<types::@TYPE_COLLECTION_BASE_NAME@::u16b12Array, packing::u16b12ArrayDeployment_t>(
+            createValues<uint16_t>(count, 12), 12);
+        checkStream<types::@TYPE_COLLECTION_BASE_NAME@::i16b10Array, packing::i16b10ArrayDeployment_t>(
+            createValues<int16_t>(count, 10), 10);
+    }
+}
+
+/**
+* @test Other element types and bit widths, including widths below 8 bit and the widths
+* that are unpacked by the scalar code only.
+*/
+TEST_F(BitPackingTest, StreamAllWidths) {
+    typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<int32_t>> Int32Deployment;
+    typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<uint8_t>> UInt8Deployment;
+    for (std::size_t count : { 1, 8, 50 }) {
+        checkStream<std::vector<int32_t>, CommonAPI::SomeIP::PackedArray::Deployment<Int32Deployment, 3>>(
+            createValues<int32_t>(count, 3), 3);
+        checkStream<std::vector<int32_t>, CommonAPI::SomeIP::PackedArray::Deployment<Int32Deployment, 17>>(
+            createValues<int32_t>(count, 17), 17);
+        checkStream<std::vector<int32_t>, CommonAPI::SomeIP::PackedArray::Deployment<Int32Deployment, 24>>(
+            createValues<int32_t>(count, 24), 24);
+        checkStream<std::vector<int32_t>, CommonAPI::SomeIP::PackedArray::Deployment<Int32Deployment, 31>>(
+            createValues<int32_t>(count, 31), 31);
+        checkStream<std::vector<uint8_t>, CommonAPI::SomeIP::PackedArray::Deployment<UInt8Deployment, 5>>(
+            createValues<uint8_t>(count, 5), 5);
+    }
+}
+
+/**
+* @test A byte length that cannot hold a packed array sets the stream error.
+*/
+TEST_F(BitPackingTest, StreamInvalidLength) {
+    const CommonAPI::SomeIP::IntegerDeployment<uint16_t> elementDepl(12);
+    const packing::u16b12ArrayDeployment_t packedDepl(&elementDepl, 0, 0, 4);
+
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        // 4 bytes hold two 12 bit values and an unused byte
+        const CommonAPI::SomeIP::ByteBufferDeployment bytesDepl(0, 0, 4);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream.writeValue(Bytes{ 1, 2, 3, 4 }, &bytesDepl);
+        outStream.flush();
+    }
+    CommonAPI::Deployable<types::@TYPE_COLLECTION_BASE_NAME@::u16b12Array, packing::u16b12ArrayDeployment_t>
+        deployedValues(types::@TYPE_COLLECTION_BASE_NAME@::u16b12Array{ 1, 2, 3 }, &packedDepl);
+    CommonAPI::SomeIP::InputStream inStream(message, false);
+    inStream >> deployedValues;
+    EXPECT_TRUE(inStream.hasError());
+    EXPECT_TRUE(deployedValues.getValue().empty());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
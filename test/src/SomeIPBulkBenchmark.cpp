@@ -0,0 +1,138 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBulkBenchmark
+*
+* Benchmark of the bulk serialization of integer arrays. Serializes and
+* deserializes arrays of 16 to 65536 elements of 8, 16, 32 and 64 bit in big
+* and little endian byte order, element by element and in bulk. Checks that
+* both produce the same bytes and reports the throughput of either side in
+* MiB/s. If the byte order is the one of the host, the bulk mode copies the
+* array, otherwise it swaps the bytes.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPBulk.hpp"
+
+template<typename Element_>
+using ElementDeployment = CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<Element_>>;
+
+template<typename Element_, bool IsLittleEndian_>
+using BulkDeployment = CommonAPI::SomeIP::Bulk::Deployment<ElementDeployment<Element_>, IsLittleEndian_>;
+
+struct Result {
+    std::vector<uint8_t> bytes;
+    double serializeTime;
+    double deserializeTime;
+};
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static void checkStream(bool _hasError) {
+    if (_hasError) {
+        std::cerr << "serialization failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+template<typename Element_, typename Deployment_>
+static Result run(const std::vector<Element_> &_value, bool _isLittleEndian, std::size_t _iterations) {
+    Result result{ {}, 0.0, 0.0 };
+    for (std::size_t i = 0; i < _iterations; i++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::Deployable<std::vector<Element_>, Deployment_> deployedValue(_value, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, _isLittleEndian);
+            outStream << deployedValue;
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        {
+            CommonAPI::Deployable<std::vector<Element_>, Deployment_> deployedValue(static_cast<Deployment_ *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(message, _isLittleEndian);
+            inStream >> deployedValue;
+            checkStream(inStream.hasError());
+            if (deployedValue.getValue() != _value) {
+                std::cerr << "value differs" << std::endl;
+                std::exit(1);
+            }
+        }
+        std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+
+        result.bytes.assign(message.getBodyData(), message.getBodyData() + message.getBodyLength());
+        result.serializeTime += std::chrono::duration<double, std::micro>(sent - start).count();
+        result.deserializeTime += std::chrono::duration<double, std::micro>(received - sent).count();
+    }
+    result.serializeTime /= double(_iterations);
+    result.deserializeTime /= double(_iterations);
+    return result;
+}
+
+template<typename Element_, bool IsLittleEndian_>
+static void runWidth(std::size_t _iterations, std::mt19937_64 &_random) {
+    for (std::size_t length = 16; length <= (1 << 16); length *= 16) {
+        std::vector<Element_> value(length);
+        for (auto &itsElement : value) {
+            itsElement = Element_(_random());
+        }
+        // Large arrays are repeated less often
+        const std::size_t repeat = std::max<std::size_t>(1, _iterations * 1024 / (length * sizeof(Element_)));
+        const Result element = run<Element_, ElementDeployment<Element_>>(value, IsLittleEndian_, repeat);
+        const Result bulk = run<Element_, BulkDeployment<Element_, IsLittleEndian_>>(value, IsLittleEndian_, repeat);
+        if (element.bytes != bulk.bytes) {
+            std::cerr << "bulk serialization differs" << std::endl;
+            std::exit(1);
+        }
+        const double mebibytes = double(length * sizeof(Element_)) / double(1 << 20);
+        for (auto &itsResult : { std::make_pair("element", element), std::make_pair("bulk", bulk) }) {
+            std::cout << sizeof(Element_) * 8 << ","
+                      << (IsLittleEndian_ ? "le" : "be") << ","
+                      << length << ","
+                      << itsResult.first << ","
+                      << mebibytes / (itsResult.second.serializeTime / 1e6) << ","
+                      << mebibytes / (itsResult.second.deserializeTime / 1e6) << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200);
+
+    std::mt19937_64 random(4711);
+    std::cout << "bits,endianess,length,mode,serialize_mib_s,deserialize_mib_s" << std::endl;
+    runWidth<uint8_t, false>(iterations, random);
+    runWidth<uint8_t, true>(iterations, random);
+    runWidth<int16_t, false>(iterations, random);
+    runWidth<int16_t, true>(iterations, random);
+    runWidth<int32_t, false>(iterations, random);
+    runWidth<int32_t, true>(iterations, random);
+    runWidth<uint64_t, false>(iterations, random);
+    runWidth<uint64_t, true>(iterations, random);
+    return 0;
+}
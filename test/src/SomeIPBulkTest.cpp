@@ -0,0 +1,163 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPBulkTest
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPBulk.hpp"
+
+namespace Bulk = CommonAPI::SomeIP::Bulk;
+
+typedef std::vector<uint8_t> Bytes;
+
+template<typename Element_>
+using ElementDeployment = CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<Element_>>;
+
+template<typename Element_, bool IsLittleEndian_>
+using BulkDeployment = Bulk::Deployment<ElementDeployment<Element_>, IsLittleEndian_>;
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+// The elements in the given byte order, one by one
+template<typename Element_>
+static Bytes encode(const std::vector<Element_> &_value, bool _isLittleEndian) {
+    Bytes bytes;
+    for (const Element_ &itsElement : _value) {
+        uint8_t itsBytes[sizeof(Element_)];
+        std::memcpy(itsBytes, &itsElement, sizeof(Element_));
+        for (std::size_t b = 0; b < sizeof(Element_); b++) {
+            const bool isReversed = (_isLittleEndian != Bulk::HOST_IS_LITTLE_ENDIAN);
+            bytes.push_back(itsBytes[isReversed ? sizeof(Element_) - 1 - b : b]);
+        }
+    }
+    return bytes;
+}
+
+// Serializes and deserializes arrays of all lengths up to three blocks of 16 bytes
+template<typename Element_, bool IsLittleEndian_>
+static void testRoundTrip(std::mt19937_64 &_random) {
+    for (std::size_t length = 0; length <= 48 / sizeof(Element_) + 1; length++) {
+        std::vector<Element_> value(length);
+        for (auto &itsElement : value) {
+            const uint64_t itsBits = _random();
+            std::memcpy(&itsElement, &itsBits, sizeof(Element_));
+        }
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::Deployable<std::vector<Element_>, BulkDeployment<Element_, IsLittleEndian_>> deployedValue(value, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, IsLittleEndian_);
+            outStream << deployedValue;
+            EXPECT_FALSE(outStream.hasError());
+            outStream.flush();
+        }
+        // The elements follow the length field
+        const Bytes expected = encode(value, IsLittleEndian_);
+        ASSERT_LE(expected.size(), std::size_t(message.getBodyLength()));
+        const Bytes body(message.getBodyData(), message.getBodyData() + message.getBodyLength());
+        EXPECT_EQ(expected, Bytes(body.end() - long(expected.size()), body.end()))
+            << sizeof(Element_) << " bytes, length " << length;
+        {
+            CommonAPI::Deployable<std::vector<Element_>, BulkDeployment<Element_, IsLittleEndian_>> deployedValue(
+                static_cast<BulkDeployment<Element_, IsLittleEndian_> *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(message, IsLittleEndian_);
+            inStream >> deployedValue;
+            EXPECT_FALSE(inStream.hasError());
+            // Compared bitwise, random floating point values may be NaN
+            EXPECT_EQ(expected, encode(deployedValue.getValue(), IsLittleEndian_));
+        }
+    }
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class BulkTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test Arrays in the byte order of the host are copied.
+*/
+TEST_F(BulkTest, HostByteOrder) {
+    std::mt19937_64 random(4711);
+    testRoundTrip<uint8_t, Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<int16_t, Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<uint32_t, Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<int64_t, Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+}
+
+/**
+* @test Arrays in the other byte order are swapped, in blocks and for the remaining elements.
+*/
+TEST_F(BulkTest, SwappedByteOrder) {
+    std::mt19937_64 random(4712);
+    testRoundTrip<uint8_t, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<int16_t, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<uint16_t, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<int32_t, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<float, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<uint64_t, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+    testRoundTrip<double, !Bulk::HOST_IS_LITTLE_ENDIAN>(random);
+}
+
+/**
+* @test A byte length that is no multiple of the element size is a stream error.
+*/
+TEST_F(BulkTest, InvalidLength) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CommonAPI::SomeIP::ByteBufferDeployment> deployedBytes(Bytes(7, 0x11), nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedBytes;
+        outStream.flush();
+    }
+    CommonAPI::Deployable<std::vector<uint32_t>, BulkDeployment<uint32_t, false>> deployedValue(
+        static_cast<BulkDeployment<uint32_t, false> *>(nullptr));
+    CommonAPI::SomeIP::InputStream inStream(message, false);
+    inStream >> deployedValue;
+    EXPECT_TRUE(inStream.hasError());
+    EXPECT_TRUE(deployedValue.getValue().empty());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
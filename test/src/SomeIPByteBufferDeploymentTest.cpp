@@ -13,6 +13,7 @@
 #include <mutex>
 #include <thread>
 #include <fstream>
+#include <future>
 #include <numeric>
 #include <gtest/gtest.h>
 #include "CommonAPI/CommonAPI.hpp"
@@ -904,6 +905,76 @@ TEST_F(DeploymentTest, ByteBufferCutLongMessageAttr) {
         }
     }
 }
+/**
+* @test Verify that compressed attributes keep their values (SomeIpAttrCompressionThreshold)
+*/
+TEST_F(DeploymentTest, ByteBufferCompressedAttr) {
+    CommonAPI::CallStatus callStatus;
+    for (std::size_t size : { 0, 10, 255, 256, 100000 }) {
+        CommonAPI::ByteBuffer outByteBuffer(size);
+        for (std::size_t i = 0; i < size; i++) {
+            outByteBuffer[i] = uint8_t(i % 7);
+        }
+        CommonAPI::ByteBuffer inByteBuffer;
+
+        testProxy_->getABBCompressedAttribute().setValue(outByteBuffer, callStatus, inByteBuffer);
+        ASSERT_EQ(callStatus, CommonAPI::CallStatus::SUCCESS);
+        EXPECT_EQ(outByteBuffer, inByteBuffer);
+    }
+    {
+        std::string outString(1000, 'x');
+        std::string inString;
+
+        testProxy_->getAStringCompressedAttribute().setValue(outString, callStatus, inString);
+        ASSERT_EQ(callStatus, CommonAPI::CallStatus::SUCCESS);
+        EXPECT_EQ(outString, inString);
+    }
+}
+/**
+* @test Verify that large attribute values are passed in shared memory (SomeIpAttrSharedMemoryThreshold)
+*/
+TEST_F(DeploymentTest, ByteBufferSharedMemoryAttr) {
+    CommonAPI::CallStatus callStatus;
+    for (std::size_t size : { 0, 4095, 4096, 8 << 20 }) {
+        CommonAPI::ByteBuffer outByteBuffer(size);
+        std::iota(std::begin(outByteBuffer), std::end(outByteBuffer), 0);
+        CommonAPI::ByteBuffer inByteBuffer;
+
+        testProxy_->getABBSharedAttribute().setValue(outByteBuffer, callStatus, inByteBuffer);
+        ASSERT_EQ(callStatus, CommonAPI::CallStatus::SUCCESS);
+        EXPECT_EQ(outByteBuffer, inByteBuffer);
+    }
+    {
+        std::string outString(100000, 's');
+        std::string inString;
+
+        testProxy_->getAStringSharedAttribute().setValue(outString, callStatus, inString);
+        ASSERT_EQ(callStatus, CommonAPI::CallStatus::SUCCESS);
+        EXPECT_EQ(outString, inString);
+    }
+}
+/**
+* @test Verify that a large broadcast argument is passed in shared memory (SomeIpArgSharedMemoryThreshold)
+*/
+TEST_F(DeploymentTest, ByteBufferSharedMemoryBroadcast) {
+    CommonAPI::CallStatus callStatus;
+    std::promise<CommonAPI::ByteBuffer> p;
+    auto f = p.get_future();
+
+    uint32_t subscription = testProxy_->getBSharedEvent().subscribe([&](
+        const CommonAPI::ByteBuffer &y
+    ) {
+        p.set_value(y);
+    });
+
+    testProxy_->mBCastTrigger(v1_0::commonapi::someip::deploymenttest::TestInterface::tEnumTriggerType::T_SHARED, 4 << 20, callStatus);
+    std::future_status status = f.wait_for(std::chrono::seconds(7));
+    ASSERT_EQ(status, std::future_status::ready);
+    CommonAPI::ByteBuffer expected(4 << 20);
+    std::iota(std::begin(expected), std::end(expected), 0);
+    EXPECT_EQ(expected, f.get());
+    testProxy_->getBSharedEvent().unsubscribe(subscription);
+}
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     ::testing::AddGlobalTestEnvironment(new Environment());
@@ -0,0 +1,240 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPCaptureTest
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "SomeIPCapture.hpp"
+
+namespace Capture = CommonAPI::SomeIP::Capture;
+
+static Capture::MessageHeader makeHeader(uint16_t _method, uint16_t _session) {
+    Capture::MessageHeader itsHeader;
+    itsHeader.service = 0x1234;
+    itsHeader.method = _method;
+    itsHeader.client = 0x0101;
+    itsHeader.session = _session;
+    itsHeader.interfaceVersion = 1;
+    itsHeader.messageType = Capture::MT_REQUEST;
+    itsHeader.returnCode = Capture::RC_OK;
+    return itsHeader;
+}
+
+// Reads all records of all files of a capture
+static std::vector<Capture::Record> readAll(const std::string &_path) {
+    std::vector<Capture::Record> itsRecords;
+    for (auto &itsFile : Capture::Reader::getFiles(_path)) {
+        Capture::Reader itsReader;
+        EXPECT_TRUE(itsReader.open(itsFile));
+        Capture::Record itsRecord;
+        while (itsReader.next(itsRecord)) {
+            itsRecords.push_back(itsRecord);
+        }
+    }
+    return itsRecords;
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class CaptureTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        path_ = "SomeIPCaptureTest." + std::to_string(::getpid());
+        removeFiles();
+    }
+
+    void TearDown() {
+        removeFiles();
+    }
+
+    void removeFiles() {
+        for (auto &itsFile : Capture::Reader::getFiles(path_)) {
+            std::remove(itsFile.c_str());
+        }
+    }
+
+    std::string path_;
+};
+
+/**
+* @test Messages are read back with header, payload and timestamps.
+*/
+TEST_F(CaptureTest, WriteAndRead) {
+    Capture::Writer writer;
+    ASSERT_TRUE(writer.open(path_, 1024 * 1024, 2));
+    EXPECT_TRUE(writer.isEnabled());
+
+    const uint8_t payload[] = { 1, 2, 3, 4, 5 };
+    writer.write(Capture::Direction::REQUEST, 0x5678, makeHeader(0x0bb8, 1), payload, sizeof(payload));
+    writer.write(Capture::Direction::REPLY, 0x5678, makeHeader(0x0bb9, 2), nullptr, 0);
+    writer.close();
+    EXPECT_FALSE(writer.isEnabled());
+
+    std::vector<std::string> files = Capture::Reader::getFiles(path_);
+    ASSERT_EQ(1u, files.size());
+    Capture::Reader reader;
+    ASSERT_TRUE(reader.open(files[0]));
+    EXPECT_EQ(0u, reader.getInfo().sequence);
+    EXPECT_EQ(1024u * 1024u, reader.getInfo().capacity);
+
+    Capture::Record record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(Capture::Direction::REQUEST, record.direction);
+    EXPECT_EQ(0x5678, record.instance);
+    EXPECT_EQ(0x1234, record.header.service);
+    EXPECT_EQ(0x0bb8, record.header.method);
+    EXPECT_EQ(0x0101, record.header.client);
+    EXPECT_EQ(1, record.header.session);
+    EXPECT_EQ(std::vector<uint8_t>(payload, payload + sizeof(payload)), record.payload);
+    EXPECT_GE(record.timestamp, reader.getInfo().steadyNs);
+    const int64_t first = record.timestamp;
+
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(Capture::Direction::REPLY, record.direction);
+    EXPECT_EQ(0x0bb9, record.header.method);
+    EXPECT_TRUE(record.payload.empty());
+    EXPECT_GE(record.timestamp, first);
+
+    EXPECT_FALSE(reader.next(record));
+}
+
+/**
+* @test Full files are rotated and only the configured number of files is kept.
+*/
+TEST_F(CaptureTest, Rotation) {
+    Capture::Writer writer;
+    ASSERT_TRUE(writer.open(path_, 4096, 3));
+
+    std::vector<uint8_t> payload(100, 0x55);
+    for (uint16_t i = 0; i < 1000; i++) {
+        writer.write(Capture::Direction::REQUEST, 1, makeHeader(1, i), payload.data(), uint32_t(payload.size()));
+    }
+    writer.close();
+    EXPECT_EQ(0u, writer.getDropped());
+
+    std::vector<std::string> files = Capture::Reader::getFiles(path_);
+    ASSERT_EQ(3u, files.size());
+
+    // The last messages are kept without gaps
+    std::vector<Capture::Record> records = readAll(path_);
+    ASSERT_FALSE(records.empty());
+    EXPECT_LT(records.size(), 1000u);
+    for (std::size_t i = 0; i < records.size(); i++) {
+        EXPECT_EQ(1000 - records.size() + i, records[i].header.session);
+    }
+}
+
+/**
+* @test Messages that never fit into a file are dropped.
+*/
+TEST_F(CaptureTest, Dropped) {
+    Capture::Writer writer;
+    ASSERT_TRUE(writer.open(path_, 4096, 2));
+
+    std::vector<uint8_t> payload(8192);
+    writer.write(Capture::Direction::REQUEST, 1, makeHeader(1, 1), payload.data(), uint32_t(payload.size()));
+    writer.close();
+    EXPECT_EQ(1u, writer.getDropped());
+    EXPECT_TRUE(readAll(path_).empty());
+}
+
+/**
+* @test Messages written from many threads are all captured.
+*/
+TEST_F(CaptureTest, Threads) {
+    const std::size_t threads = 8;
+    const std::size_t messages = 10000;
+
+    Capture::Writer writer;
+    ASSERT_TRUE(writer.open(path_, 256 * 1024, 1000));
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&writer, t, messages]() {
+            uint8_t payload[16] = { uint8_t(t) };
+            for (std::size_t i = 0; i < messages; i++) {
+                writer.write(Capture::Direction::REQUEST, 1, makeHeader(uint16_t(t), uint16_t(i)),
+                             payload, sizeof(payload));
+            }
+        }));
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    writer.close();
+    EXPECT_EQ(0u, writer.getDropped());
+
+    std::vector<Capture::Record> records = readAll(path_);
+    ASSERT_EQ(threads * messages, records.size());
+    std::vector<std::size_t> counts(threads, 0);
+    for (auto &record : records) {
+        ASSERT_LT(record.header.method, threads);
+        EXPECT_EQ(record.header.method, record.payload[0]);
+        counts[record.header.method]++;
+    }
+    for (std::size_t t = 0; t < threads; t++) {
+        EXPECT_EQ(messages, counts[t]);
+    }
+}
+
+/**
+* @test Many messages fit into the files without loss. The time per message is only
+* reported, it depends on the machine.
+*/
+TEST_F(CaptureTest, ManyMessages) {
+    const std::size_t messages = 100000;
+
+    Capture::Writer writer;
+    ASSERT_TRUE(writer.open(path_, 4 * 1024 * 1024, 4));
+
+    std::vector<uint8_t> payload(64, 0xaa);
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < messages; i++) {
+        writer.write(Capture::Direction::REQUEST, 1, makeHeader(1, uint16_t(i)), payload.data(), uint32_t(payload.size()));
+    }
+    const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    writer.close();
+    EXPECT_EQ(0u, writer.getDropped());
+
+    std::cout << "capture: " << nanos / int64_t(messages) << " ns per message" << std::endl;
+    EXPECT_EQ(messages, readAll(path_).size());
+}
+
+/**
+* @test A writer that is not opened does not write anything.
+*/
+TEST_F(CaptureTest, Disabled) {
+    Capture::Writer writer;
+    EXPECT_FALSE(writer.isEnabled());
+    writer.write(Capture::Direction::REQUEST, 1, makeHeader(1, 1), nullptr, 0);
+    EXPECT_EQ(0u, writer.getDropped());
+    EXPECT_TRUE(Capture::Reader::getFiles(path_).empty());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
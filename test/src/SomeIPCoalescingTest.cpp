@@ -0,0 +1,197 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPCoalescingTest
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceProxy.hpp"
+#include "DeploymentTestStub.h"
+
+namespace deploymenttest = v1_0::commonapi::someip::deploymenttest;
+
+const std::string domain = "local";
+const std::string testAddress = "commonapi.someip.deploymenttest.TestInterface";
+const std::string connectionIdService = "service-sample";
+const std::string connectionIdClient = "client-sample";
+
+// Holds the getter of aString until the test opens it and counts its calls
+class CoalescingTestStub : public deploymenttest::DeploymentTestStub {
+public:
+    using deploymenttest::DeploymentTestStub::getAStringAttribute;
+
+    virtual const std::string &getAStringAttribute(const std::shared_ptr<CommonAPI::ClientId> _client) {
+        getterCalls_++;
+        std::unique_lock<std::mutex> itsLock(mutex_);
+        condition_.wait(itsLock, [this]() { return isOpen_; });
+        return deploymenttest::DeploymentTestStub::getAStringAttribute(_client);
+    }
+
+    void setOpen(bool _isOpen) {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        isOpen_ = _isOpen;
+        condition_.notify_all();
+    }
+
+    std::atomic<int> getterCalls_{ 0 };
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool isOpen_ = true;
+};
+
+// Status and value of an asynchronous getter call as seen by its callback and future
+struct Call {
+    std::shared_ptr<std::promise<std::pair<CommonAPI::CallStatus, std::string>>> reply_;
+    std::future<std::pair<CommonAPI::CallStatus, std::string>> replied_;
+    std::future<CommonAPI::CallStatus> status_;
+};
+
+static Call getValueAsync(deploymenttest::TestInterfaceProxy<> &_proxy, const CommonAPI::CallInfo *_info) {
+    Call itsCall;
+    itsCall.reply_ = std::make_shared<std::promise<std::pair<CommonAPI::CallStatus, std::string>>>();
+    itsCall.replied_ = itsCall.reply_->get_future();
+    auto itsReply = itsCall.reply_;
+    itsCall.status_ = _proxy.getAStringAttribute().getValueAsync(
+        [itsReply](const CommonAPI::CallStatus &_status, std::string _value) {
+            itsReply->set_value(std::make_pair(_status, _value));
+        }, _info);
+    return itsCall;
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class CoalescingTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        runtime_ = CommonAPI::Runtime::get();
+        ASSERT_TRUE((bool)runtime_);
+
+        stub_ = std::make_shared<CoalescingTestStub>();
+        stub_->setAStringAttribute("coalesced");
+        ASSERT_TRUE(runtime_->registerService(domain, testAddress, stub_, connectionIdService));
+
+        proxy_ = runtime_->buildProxy<deploymenttest::TestInterfaceProxy>(domain, testAddress, connectionIdClient);
+        ASSERT_TRUE((bool)proxy_);
+        int i = 0;
+        while (!proxy_->isAvailable() && i++ < 100) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_TRUE(proxy_->isAvailable());
+    }
+
+    void TearDown() {
+        stub_->setOpen(true);
+        ASSERT_TRUE(runtime_->unregisterService(domain, CoalescingTestStub::StubInterface::getInterface(), testAddress));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    std::shared_ptr<CommonAPI::Runtime> runtime_;
+    std::shared_ptr<CoalescingTestStub> stub_;
+    std::shared_ptr<deploymenttest::TestInterfaceProxy<>> proxy_;
+};
+
+/**
+* @test Concurrent getter calls from several threads share one request and all get the value
+*/
+TEST_F(CoalescingTest, FanOutValue) {
+    static const std::size_t THREADS = 8;
+    static const std::size_t CALLS = 4;
+
+    stub_->setOpen(false);
+    std::vector<Call> calls(THREADS * CALLS);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREADS; t++) {
+        threads.push_back(std::thread([this, t, &calls]() {
+            for (std::size_t i = 0; i < CALLS; i++) {
+                calls[t * CALLS + i] = getValueAsync(*proxy_, nullptr);
+            }
+        }));
+    }
+    for (auto &itsThread : threads) {
+        itsThread.join();
+    }
+    stub_->setOpen(true);
+
+    for (auto &itsCall : calls) {
+        ASSERT_EQ(std::future_status::ready, itsCall.replied_.wait_for(std::chrono::seconds(5)));
+        const auto itsReply = itsCall.replied_.get();
+        EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, itsReply.first);
+        EXPECT_EQ("coalesced", itsReply.second);
+        EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, itsCall.status_.get());
+    }
+    EXPECT_EQ(1, stub_->getterCalls_.load());
+
+    // A call after the reply sends a new request
+    Call itsLater = getValueAsync(*proxy_, nullptr);
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, itsLater.status_.get());
+    EXPECT_EQ(2, stub_->getterCalls_.load());
+}
+
+/**
+* @test A failing request passes its call status to all calls that joined it
+*/
+TEST_F(CoalescingTest, FanOutStatus) {
+    stub_->setOpen(false);
+    CommonAPI::CallInfo info(200);
+    std::vector<Call> calls;
+    for (std::size_t i = 0; i < 5; i++) {
+        calls.push_back(getValueAsync(*proxy_, &info));
+    }
+
+    for (auto &itsCall : calls) {
+        ASSERT_EQ(std::future_status::ready, itsCall.replied_.wait_for(std::chrono::seconds(5)));
+        EXPECT_EQ(CommonAPI::CallStatus::REMOTE_ERROR, itsCall.replied_.get().first);
+        EXPECT_EQ(CommonAPI::CallStatus::REMOTE_ERROR, itsCall.status_.get());
+    }
+    stub_->setOpen(true);
+    EXPECT_EQ(1, stub_->getterCalls_.load());
+}
+
+/**
+* @test Calls with different timeouts do not join the same request
+*/
+TEST_F(CoalescingTest, SeparateTimeouts) {
+    stub_->setOpen(false);
+    CommonAPI::CallInfo info(3000);
+    Call first = getValueAsync(*proxy_, nullptr);
+    Call second = getValueAsync(*proxy_, &info);
+    Call third = getValueAsync(*proxy_, &info);
+    stub_->setOpen(true);
+
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, first.status_.get());
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, second.status_.get());
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, third.status_.get());
+    EXPECT_EQ(2, stub_->getterCalls_.load());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPCompressionBenchmark
+*
+* Benchmark of compressed ByteBuffer elements (SomeIpArgCompressionThreshold).
+* Serializes and deserializes values of 256 bytes to 1 MiB with and without
+* compression, for text like data (log lines), sensor like data (slowly changing
+* 16 bit samples) and random data. Reports the bytes on the wire, the ratio to
+* the plain size and the time per value of either side.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPCompression.hpp"
+
+typedef CommonAPI::SomeIP::ByteBufferDeployment PlainDeployment;
+typedef CommonAPI::SomeIP::Compression::Deployment<CommonAPI::SomeIP::ByteBufferDeployment, 256> CompressedDeployment;
+
+struct Result {
+    std::size_t bytes;
+    double serializeTime;
+    double deserializeTime;
+};
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static void checkStream(bool _hasError) {
+    if (_hasError) {
+        std::cerr << "serialization failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+static CommonAPI::ByteBuffer createText(std::size_t _size, std::mt19937 &_random) {
+    static const std::string levels[] = { "INFO", "DEBUG", "WARN" };
+    static const std::string sources[] = { "door", "window", "seat", "mirror" };
+    CommonAPI::ByteBuffer value;
+    uint32_t time(1000);
+    while (value.size() < _size) {
+        time += uint32_t(_random() % 50);
+        const std::string line = std::to_string(time) + " " + levels[_random() % 3] + " "
+                + sources[_random() % 4] + ": position " + std::to_string(_random() % 100) + "\n";
+        value.insert(value.end(), line.begin(), line.end());
+    }
+    value.resize(_size);
+    return value;
+}
+
+static CommonAPI::ByteBuffer createSensor(std::size_t _size, std::mt19937 &_random) {
+    CommonAPI::ByteBuffer value(_size);
+    int sample(2000);
+    for (std::size_t i = 0; i + 1 < _size; i += 2) {
+        sample += int(_random() % 5) - 2;
+        value[i] = uint8_t(sample);
+        value[i + 1] = uint8_t(sample >> 8);
+    }
+    return value;
+}
+
+static CommonAPI::ByteBuffer createRandom(std::size_t _size, std::mt19937 &_random) {
+    CommonAPI::ByteBuffer value(_size);
+    for (auto &itsByte : value) {
+        itsByte = uint8_t(_random());
+    }
+    return value;
+}
+
+template<typename Deployment_>
+static Result run(const CommonAPI::ByteBuffer &_value, std::size_t _iterations) {
+    Result result{ 0, 0.0, 0.0 };
+    for (std::size_t i = 0; i < _iterations; i++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::Deployable<CommonAPI::ByteBuffer, Deployment_> deployedValue(_value, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream << deployedValue;
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        {
+            CommonAPI::Deployable<CommonAPI::ByteBuffer, Deployment_> deployedValue(static_cast<Deployment_ *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(message, false);
+            inStream >> deployedValue;
+            checkStream(inStream.hasError());
+            if (deployedValue.getValue() != _value) {
+                std::cerr << "value differs" << std::endl;
+                std::exit(1);
+            }
+        }
+        std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+
+        result.bytes = message.getBodyLength();
+        result.serializeTime += std::chrono::duration<double, std::micro>(sent - start).count();
+        result.deserializeTime += std::chrono::duration<double, std::micro>(received - sent).count();
+    }
+    result.serializeTime /= double(_iterations);
+    result.deserializeTime /= double(_iterations);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200);
+
+    std::mt19937 random(4711);
+    typedef CommonAPI::ByteBuffer (*Generator)(std::size_t, std::mt19937 &);
+    const std::pair<const char *, Generator> kinds[] = {
+        { "text", &createText }, { "sensor", &createSensor }, { "random", &createRandom }
+    };
+
+    std::cout << "data,size,mode,wire_bytes,ratio,serialize_us,deserialize_us" << std::endl;
+    for (const auto &itsKind : kinds) {
+        for (std::size_t size = 256; size <= (1 << 20); size *= 4) {
+            const CommonAPI::ByteBuffer value = itsKind.second(size, random);
+            // Large values are repeated less often
+            const std::size_t repeat = std::max<std::size_t>(1, iterations * 256 / size);
+            const Result plain = run<PlainDeployment>(value, repeat);
+            const Result compressed = run<CompressedDeployment>(value, repeat);
+            for (auto &itsResult : { std::make_pair("plain", plain), std::make_pair("compressed", compressed) }) {
+                std::cout << itsKind.first << ","
+                          << size << ","
+                          << itsResult.first << ","
+                          << itsResult.second.bytes << ","
+                          << double(itsResult.second.bytes) / double(plain.bytes) << ","
+                          << itsResult.second.serializeTime << ","
+                          << itsResult.second.deserializeTime << std::endl;
+            }
+        }
+    }
+    return 0;
+}
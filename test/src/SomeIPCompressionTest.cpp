@@ -0,0 +1,236 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPCompressionTest
+*/
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPCompression.hpp"
+
+namespace Compression = CommonAPI::SomeIP::Compression;
+
+typedef std::vector<uint8_t> Bytes;
+
+typedef Compression::Deployment<CommonAPI::SomeIP::ByteBufferDeployment, 64> CompressedByteBufferDeployment;
+typedef Compression::Deployment<CommonAPI::SomeIP::StringDeployment, 64> CompressedStringDeployment;
+
+static Bytes encode(const Bytes &_value, uint32_t _threshold) {
+    Bytes frame;
+    Compression::encode(_value.data(), _value.size(), _threshold, frame);
+    return frame;
+}
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class CompressionTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        random_.seed(4711);
+    }
+
+    void TearDown() {
+    }
+
+    // Text like data: words from a small vocabulary
+    Bytes createText(std::size_t _size) {
+        static const char *words[] = { "speed ", "position ", "status ", "door ", "open ", "closed ", "0.25 ", "\n" };
+        Bytes value;
+        while (value.size() < _size) {
+            const char *word = words[random_() % 8];
+            value.insert(value.end(), word, word + std::char_traits<char>::length(word));
+        }
+        value.resize(_size);
+        return value;
+    }
+
+    Bytes createRandom(std::size_t _size) {
+        Bytes value(_size);
+        for (auto &itsByte : value) {
+            itsByte = uint8_t(random_());
+        }
+        return value;
+    }
+
+    std::mt19937 random_;
+};
+
+/**
+* @test Values of all sizes and kinds survive compression and decompression.
+*/
+TEST_F(CompressionTest, RoundTrip) {
+    std::vector<Bytes> values;
+    for (std::size_t i = 0; i <= 20; i++) {
+        values.push_back(createText(i));
+    }
+    values.push_back(Bytes(100000, 'x'));
+    values.push_back(createText(4096));
+    values.push_back(createRandom(4096));
+    values.push_back(createText(1 << 20));
+    Bytes mixed = createText(3000);
+    Bytes noise = createRandom(3000);
+    mixed.insert(mixed.begin() + 1000, noise.begin(), noise.end());
+    values.push_back(mixed);
+
+    for (const auto &itsValue : values) {
+        const Bytes frame = encode(itsValue, 0);
+        Bytes decoded;
+        ASSERT_TRUE(Compression::decode(frame, decoded)) << itsValue.size();
+        EXPECT_EQ(itsValue, decoded);
+
+        std::string decodedString;
+        ASSERT_TRUE(Compression::decode(frame, decodedString));
+        EXPECT_EQ(std::string(itsValue.begin(), itsValue.end()), decodedString);
+    }
+}
+
+/**
+* @test Values below the threshold and incompressible values are stored.
+*/
+TEST_F(CompressionTest, CodecSelection) {
+    const Bytes text = createText(1000);
+
+    Bytes frame = encode(text, 1001);
+    EXPECT_EQ(Compression::CODEC_STORED, frame[0]);
+    EXPECT_EQ(text.size() + 1, frame.size());
+
+    frame = encode(text, 1000);
+    EXPECT_EQ(Compression::CODEC_LZ4, frame[0]);
+    EXPECT_LT(frame.size(), text.size() / 2);
+
+    const Bytes noise = createRandom(1000);
+    frame = encode(noise, 0);
+    EXPECT_EQ(Compression::CODEC_STORED, frame[0]);
+    EXPECT_EQ(noise.size() + 1, frame.size());
+
+    frame = encode(Bytes(), 0);
+    ASSERT_EQ(1u, frame.size());
+    EXPECT_EQ(Compression::CODEC_STORED, frame[0]);
+}
+
+/**
+* @test Corrupt frames are rejected without reading or writing out of bounds.
+*/
+TEST_F(CompressionTest, CorruptFrames) {
+    Bytes decoded;
+    EXPECT_FALSE(Compression::decode(Bytes(), decoded));
+    EXPECT_FALSE(Compression::decode(Bytes{ 7, 1, 2, 3 }, decoded));
+    EXPECT_FALSE(Compression::decode(Bytes{ Compression::CODEC_LZ4, 0, 0, 0, 0, 0 }, decoded));
+    EXPECT_FALSE(Compression::decode(Bytes{ Compression::CODEC_LZ4, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0 }, decoded));
+
+    const Bytes text = createText(2000);
+    const Bytes frame = encode(text, 0);
+    ASSERT_EQ(Compression::CODEC_LZ4, frame[0]);
+    for (std::size_t i = 1; i < frame.size(); i++) {
+        EXPECT_FALSE(Compression::decode(Bytes(frame.begin(), frame.begin() + long(i)), decoded));
+    }
+
+    // Random damage must be detected or give a value of the announced size
+    for (int i = 0; i < 20000; i++) {
+        Bytes damaged = frame;
+        for (int j = 0; j < 3; j++) {
+            damaged[1 + random_() % (damaged.size() - 1)] = uint8_t(random_());
+        }
+        if (Compression::decode(damaged, decoded)) {
+            std::size_t size(0);
+            for (std::size_t k = 0; k < 4; k++) {
+                size |= std::size_t(damaged[1 + k]) << (8 * k);
+            }
+            EXPECT_EQ(size, decoded.size());
+        }
+    }
+}
+
+/**
+* @test Compressed elements are sent as frames and read back through the streams.
+*/
+TEST_F(CompressionTest, StreamRoundTrip) {
+    const Bytes buffer = createText(5000);
+    const std::string text(50, 'a');
+    const std::string shortText("short");
+
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CompressedByteBufferDeployment> deployedBuffer(buffer, nullptr);
+        CommonAPI::Deployable<std::string, CompressedStringDeployment> deployedText(text, nullptr);
+        CommonAPI::Deployable<std::string, CompressedStringDeployment> deployedShortText(shortText, nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedBuffer << deployedText << deployedShortText;
+        EXPECT_FALSE(outStream.hasError());
+        outStream.flush();
+    }
+    EXPECT_LT(message.getBodyLength(), buffer.size() / 2);
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CompressedByteBufferDeployment> deployedBuffer(static_cast<CompressedByteBufferDeployment *>(nullptr));
+        CommonAPI::Deployable<std::string, CompressedStringDeployment> deployedText(static_cast<CompressedStringDeployment *>(nullptr));
+        CommonAPI::Deployable<std::string, CompressedStringDeployment> deployedShortText(static_cast<CompressedStringDeployment *>(nullptr));
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> deployedBuffer >> deployedText >> deployedShortText;
+        EXPECT_FALSE(inStream.hasError());
+        EXPECT_EQ(buffer, deployedBuffer.getValue());
+        EXPECT_EQ(text, deployedText.getValue());
+        EXPECT_EQ(shortText, deployedShortText.getValue());
+    }
+}
+
+/**
+* @test A corrupt frame gives an empty value and fails the stream, so that the call or
+* event is dropped.
+*/
+TEST_F(CompressionTest, StreamCorruptFrame) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CommonAPI::SomeIP::ByteBufferDeployment> deployedFrame(
+            Bytes{ Compression::CODEC_LZ4, 100, 0, 0, 0, 0xF0 }, nullptr);
+        CommonAPI::Deployable<uint32_t, CommonAPI::EmptyDeployment> deployedValue(4711, nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedFrame << deployedValue;
+        outStream.flush();
+    }
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CompressedByteBufferDeployment> deployedBuffer(static_cast<CompressedByteBufferDeployment *>(nullptr));
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> deployedBuffer;
+        EXPECT_TRUE(inStream.hasError());
+        EXPECT_TRUE(deployedBuffer.getValue().empty());
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,283 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPDeadlineTest
+*/
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "SomeIPDeadline.hpp"
+#include "SomeIPExecution.hpp"
+
+namespace Deadline = CommonAPI::SomeIP::Deadline;
+namespace Execution = CommonAPI::SomeIP::Execution;
+
+typedef std::chrono::steady_clock Clock;
+typedef std::function<void(const CommonAPI::CallStatus &, const int32_t &, const std::string &)> Callback;
+typedef Deadline::Call<Callback, int32_t, std::string> Call;
+
+static const uint16_t METHOD = 0x1234;
+static const std::chrono::milliseconds DEADLINE(50);
+static const std::chrono::milliseconds WORK(2);
+static const std::size_t BURST = 250;
+
+// Records the completions of a call
+struct Completions {
+    Callback callback() {
+        return [this](const CommonAPI::CallStatus &_status, const int32_t &_value, const std::string &_text) {
+            calls_++;
+            status_ = _status;
+            value_ = _value;
+            text_ = _text;
+        };
+    }
+
+    int calls_ = 0;
+    CommonAPI::CallStatus status_ = CommonAPI::CallStatus::SUCCESS;
+    int32_t value_ = 0;
+    std::string text_;
+};
+
+/**
+ * Overloads a dispatch thread with a burst of requests that take WORK each, far
+ * more than can be served within DEADLINE. Then probes the service every 5ms
+ * until a probe is answered before its deadline and returns the time from the
+ * end of the burst until then.
+ */
+static std::chrono::milliseconds recover(bool _isShedding, Deadline::Shedder &_shedder) {
+    Execution::DedicatedThread thread;
+    auto post = [&](const std::shared_ptr<std::atomic<bool>> &_isServed) {
+        const Clock::time_point itsSent(Clock::now());
+        Deadline::Shedder::Task itsTask = [itsSent, _isServed]() {
+            std::this_thread::sleep_for(WORK);
+            if (_isServed && Clock::now() - itsSent <= DEADLINE)
+                *_isServed = true;
+        };
+        thread.post(_isShedding ? _shedder.guard(METHOD, DEADLINE, itsTask) : itsTask);
+    };
+
+    for (std::size_t i = 0; i < BURST; i++)
+        post(nullptr);
+    const Clock::time_point itsEnd(Clock::now());
+
+    std::vector<std::shared_ptr<std::atomic<bool>>> itsProbes;
+    while (Clock::now() - itsEnd < std::chrono::seconds(10)) {
+        itsProbes.push_back(std::make_shared<std::atomic<bool>>(false));
+        post(itsProbes.back());
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        for (const auto &itsProbe : itsProbes) {
+            if (*itsProbe)
+                return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - itsEnd);
+        }
+    }
+    return std::chrono::seconds(10);
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class DeadlineTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test An overloaded service recovers much faster when expired requests are dropped.
+*/
+TEST_F(DeadlineTest, OverloadRecovery) {
+    Deadline::Shedder withoutShedding;
+    const std::chrono::milliseconds slow = recover(false, withoutShedding);
+    Deadline::Shedder shedder;
+    const std::chrono::milliseconds fast = recover(true, shedder);
+
+    std::cout << "recovery without shedding: " << slow.count() << "ms, "
+              << "with shedding: " << fast.count() << "ms, "
+              << "dropped: " << shedder.getDropped() << std::endl;
+
+    // Without shedding every request of the burst is worked off
+    EXPECT_GE(slow, WORK * (BURST / 2));
+    EXPECT_EQ(0u, withoutShedding.getDropped());
+    EXPECT_LT(fast * 2, slow);
+    EXPECT_GT(shedder.getDropped(), BURST / 2);
+    EXPECT_EQ(shedder.getDropped(), shedder.getDropped(METHOD));
+    EXPECT_EQ(0u, shedder.getDropped(METHOD + 1));
+}
+
+/**
+* @test A request is dispatched before its deadline and dropped after it.
+*/
+TEST_F(DeadlineTest, DropExpired) {
+    Deadline::Shedder shedder;
+    int runs = 0;
+    Deadline::Shedder::Task task = shedder.guard(METHOD, std::chrono::milliseconds(1000), [&runs]() { runs++; });
+    Deadline::Shedder::Task expired = shedder.guard(METHOD, std::chrono::milliseconds(0), [&runs]() { runs++; });
+
+    task();
+    expired();
+    EXPECT_EQ(1, runs);
+    EXPECT_EQ(1u, shedder.getDropped());
+    EXPECT_EQ(1u, shedder.getDropped(METHOD));
+    EXPECT_EQ(std::chrono::milliseconds(CommonAPI::CallInfo().timeout_), Deadline::Shedder::getDefaultDeadline());
+}
+
+/**
+* @test Cancelling a token completes its pending calls with CANCELLED and drops their replies.
+*/
+TEST_F(DeadlineTest, CancelPendingCall) {
+    Deadline::Token token;
+    Completions completions;
+    std::shared_ptr<Call> call;
+    {
+        Deadline::Scope scope(token);
+        call = Call::create(completions.callback());
+    }
+    std::future<CommonAPI::CallStatus> future = call->getFuture();
+    EXPECT_FALSE(call->isDone());
+
+    token.cancel();
+    EXPECT_TRUE(call->isDone());
+    EXPECT_TRUE(call->isCancelled());
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(Deadline::CANCELLED, future.get());
+    EXPECT_EQ(1, completions.calls_);
+    EXPECT_EQ(Deadline::CANCELLED, completions.status_);
+    EXPECT_EQ(0, completions.value_);
+    EXPECT_EQ("", completions.text_);
+
+    call->complete(CommonAPI::CallStatus::SUCCESS, 42, std::string("late"));
+    EXPECT_EQ(1, completions.calls_);
+    EXPECT_EQ(Deadline::CANCELLED, completions.status_);
+}
+
+/**
+* @test A reply completes the call, a later cancellation does not change it.
+*/
+TEST_F(DeadlineTest, ReplyBeforeCancel) {
+    Deadline::Token token;
+    Completions completions;
+    std::shared_ptr<Call> call;
+    {
+        Deadline::Scope scope(token);
+        call = Call::create(completions.callback());
+    }
+    std::future<CommonAPI::CallStatus> future = call->getFuture();
+
+    call->complete(CommonAPI::CallStatus::SUCCESS, 42, std::string("reply"));
+    token.cancel();
+    EXPECT_FALSE(call->isCancelled());
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, future.get());
+    EXPECT_EQ(1, completions.calls_);
+    EXPECT_EQ(42, completions.value_);
+    EXPECT_EQ("reply", completions.text_);
+}
+
+/**
+* @test A reply with the status of cancelled calls is told apart by isCancelled().
+*/
+TEST_F(DeadlineTest, UnknownReply) {
+    Deadline::Token token;
+    Completions completions;
+    std::shared_ptr<Call> call;
+    {
+        Deadline::Scope scope(token);
+        call = Call::create(completions.callback());
+    }
+    call->complete(CommonAPI::CallStatus::UNKNOWN, 42, std::string("reply"));
+    EXPECT_EQ(Deadline::CANCELLED, completions.status_);
+    EXPECT_FALSE(call->isCancelled());
+    EXPECT_FALSE(token.isCancelled());
+    EXPECT_EQ(42, completions.value_);
+}
+
+/**
+* @test Calls made with a cancelled token are cancelled at once, calls outside of scopes are not affected.
+*/
+TEST_F(DeadlineTest, Scopes) {
+    Deadline::Token outer;
+    Deadline::Token inner;
+    Completions completions;
+    std::shared_ptr<Call> outerCall, innerCall, unscopedCall;
+    {
+        Deadline::Scope outerScope(outer);
+        {
+            Deadline::Scope innerScope(inner);
+            EXPECT_NE(nullptr, Deadline::Token::getCurrent());
+            innerCall = Call::create(Callback());
+        }
+        outerCall = Call::create(Callback());
+    }
+    EXPECT_EQ(nullptr, Deadline::Token::getCurrent());
+    unscopedCall = Call::create(Callback());
+
+    inner.cancel();
+    EXPECT_TRUE(innerCall->isDone());
+    EXPECT_FALSE(outerCall->isDone());
+    EXPECT_FALSE(unscopedCall->isDone());
+
+    {
+        Deadline::Scope scope(inner);
+        std::shared_ptr<Call> lateCall = Call::create(completions.callback());
+        EXPECT_TRUE(lateCall->isDone());
+        EXPECT_EQ(Deadline::CANCELLED, lateCall->getFuture().get());
+    }
+    EXPECT_EQ(1, completions.calls_);
+}
+
+/**
+* @test Concurrent replies and cancellations complete every call exactly once.
+*/
+TEST_F(DeadlineTest, ConcurrentCancel) {
+    const std::size_t calls = 1000;
+    Deadline::Token token;
+    std::atomic<std::size_t> completed(0);
+    std::vector<std::shared_ptr<Call>> pending;
+    {
+        Deadline::Scope scope(token);
+        for (std::size_t i = 0; i < calls; i++) {
+            pending.push_back(Call::create([&completed](const CommonAPI::CallStatus &, const int32_t &, const std::string &) {
+                completed++;
+            }));
+        }
+    }
+
+    std::thread replies([&pending]() {
+        for (auto &itsCall : pending)
+            itsCall->complete(CommonAPI::CallStatus::SUCCESS, 1, std::string());
+    });
+    token.cancel();
+    replies.join();
+
+    EXPECT_EQ(calls, completed.load());
+    for (auto &itsCall : pending)
+        EXPECT_TRUE(itsCall->isDone());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPDeltaBenchmark
+*
+* Benchmark of delta notifications (SomeIpNotifierDeltaID) for a map attribute
+* with 10,000 entries of which one changes per update. Compares the full value
+* on the notifier with the changes on the delta event. The stub side computes
+* the changes and serializes the event, the proxy side deserializes it and
+* updates its copy of the attribute. Reports the payload size and the time per
+* update of either side.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPDelta.hpp"
+
+namespace Delta = CommonAPI::SomeIP::Delta;
+
+typedef std::unordered_map<uint32_t, std::string> StringMap;
+typedef std::vector<uint32_t> Keys;
+
+typedef CommonAPI::SomeIP::IntegerDeployment<uint32_t> SequenceDeployment;
+typedef CommonAPI::SomeIP::MapDeployment<CommonAPI::SomeIP::IntegerDeployment<uint32_t>, CommonAPI::SomeIP::StringDeployment> MapDeployment;
+typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::SomeIP::IntegerDeployment<uint32_t>> KeysDeployment;
+
+struct Result {
+    std::size_t bytes;
+    double stubTime;
+    double proxyTime;
+};
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static void checkStream(bool _hasError) {
+    if (_hasError) {
+        std::cerr << "serialization failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+// Sends the full value on every update, as the notifier of the attribute does
+static Result runFull(StringMap _value, std::size_t _updates) {
+    Result result{ 0, 0.0, 0.0 };
+    StringMap copy;
+    for (std::size_t i = 0; i < _updates; i++) {
+        _value[uint32_t(i % _value.size())] = "changed_" + std::to_string(i);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::Deployable<StringMap, MapDeployment> deployedValue(_value, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream << deployedValue;
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        {
+            CommonAPI::Deployable<StringMap, MapDeployment> deployedValue(static_cast<MapDeployment *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(message, false);
+            inStream >> deployedValue;
+            checkStream(inStream.hasError());
+            copy = std::move(deployedValue.getValue());
+        }
+        std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+
+        result.bytes += message.getBodyLength();
+        result.stubTime += std::chrono::duration<double, std::micro>(sent - start).count();
+        result.proxyTime += std::chrono::duration<double, std::micro>(received - sent).count();
+    }
+    if (copy != _value) {
+        std::cerr << "full: copy differs" << std::endl;
+        std::exit(1);
+    }
+    return result;
+}
+
+// Sends the changes on the delta event, like the fire method of a delta attribute
+static Result runDelta(StringMap _value, std::size_t _updates) {
+    Result result{ 0, 0.0, 0.0 };
+    Delta::MapSender<StringMap> sender;
+    Delta::MapReplica<StringMap> replica;
+    std::size_t notifications(0);
+    const Delta::Replica<StringMap>::Handler handler = [&notifications](const StringMap &) { notifications++; };
+
+    // The keyframe of the first subscription is not measured
+    Delta::Sequence sequence;
+    StringMap upserts;
+    Keys removed;
+    sender.update(_value, sequence, upserts, removed);
+    replica.receive(sequence, true, _value, removed, handler);
+
+    for (std::size_t i = 0; i < _updates; i++) {
+        _value[uint32_t(i % _value.size())] = "changed_" + std::to_string(i);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            const bool isFull = sender.update(_value, sequence, upserts, removed);
+            CommonAPI::Deployable<uint32_t, SequenceDeployment> deployedSequence(sequence, nullptr);
+            CommonAPI::Deployable<bool, CommonAPI::EmptyDeployment> deployedIsFull(isFull, nullptr);
+            CommonAPI::Deployable<StringMap, MapDeployment> deployedUpserts(isFull ? _value : upserts, nullptr);
+            CommonAPI::Deployable<Keys, KeysDeployment> deployedRemoved(removed, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream << deployedSequence << deployedIsFull << deployedUpserts << deployedRemoved;
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        {
+            CommonAPI::Deployable<uint32_t, SequenceDeployment> deployedSequence(static_cast<SequenceDeployment *>(nullptr));
+            CommonAPI::Deployable<bool, CommonAPI::EmptyDeployment> deployedIsFull(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+            CommonAPI::Deployable<StringMap, MapDeployment> deployedUpserts(static_cast<MapDeployment *>(nullptr));
+            CommonAPI::Deployable<Keys, KeysDeployment> deployedRemoved(static_cast<KeysDeployment *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(message, false);
+            inStream >> deployedSequence >> deployedIsFull >> deployedUpserts >> deployedRemoved;
+            checkStream(inStream.hasError());
+            if (replica.receive(deployedSequence.getValue(), deployedIsFull.getValue(),
+                    deployedUpserts.getValue(), deployedRemoved.getValue(), handler) != Delta::Result::APPLIED) {
+                std::cerr << "delta: update not applied" << std::endl;
+                std::exit(1);
+            }
+        }
+        std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+
+        result.bytes += message.getBodyLength();
+        result.stubTime += std::chrono::duration<double, std::micro>(sent - start).count();
+        result.proxyTime += std::chrono::duration<double, std::micro>(received - sent).count();
+    }
+    bool isEqual(false);
+    replica.read([&isEqual, &_value](const StringMap &_copy) { isEqual = (_copy == _value); });
+    if (!isEqual || notifications != _updates + 1) {
+        std::cerr << "delta: copy differs" << std::endl;
+        std::exit(1);
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t updates = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500);
+    std::size_t entries = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000);
+
+    StringMap value;
+    for (uint32_t i = 0; i < entries; i++) {
+        value[i] = "value_" + std::to_string(i);
+    }
+
+    std::cout << "mode,entries,bytes_per_update,stub_us_per_update,proxy_us_per_update" << std::endl;
+    const Result full = runFull(value, updates);
+    const Result delta = runDelta(value, updates);
+    for (auto &itsResult : { std::make_pair("full", full), std::make_pair("delta", delta) }) {
+        std::cout << itsResult.first << ","
+                  << entries << ","
+                  << itsResult.second.bytes / updates << ","
+                  << itsResult.second.stubTime / double(updates) << ","
+                  << itsResult.second.proxyTime / double(updates) << std::endl;
+    }
+    return 0;
+}
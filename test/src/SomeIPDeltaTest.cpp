@@ -0,0 +1,454 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPDeltaTest
+*/
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "SomeIPDelta.hpp"
+
+namespace Delta = CommonAPI::SomeIP::Delta;
+
+typedef std::unordered_map<uint32_t, std::string> StringMap;
+typedef std::vector<int32_t> IntArray;
+
+// An update of a map attribute as it is sent on the delta event, or the reply of
+// the resync request if isResync is set
+struct MapUpdate {
+    Delta::Sequence sequence;
+    bool isFull = false;
+    bool isResync = false;
+    StringMap upserts;
+    std::vector<uint32_t> removed;
+};
+
+// An update of an array attribute as it is sent on the delta event, or the reply of
+// the resync request if isResync is set
+struct ArrayUpdate {
+    Delta::Sequence sequence;
+    bool isFull = false;
+    bool isResync = false;
+    uint32_t length;
+    std::vector<uint32_t> indexes;
+    IntArray values;
+};
+
+// Inserts, updates and removes some entries
+static void changeMap(StringMap &_value, std::mt19937 &_random) {
+    std::uniform_int_distribution<uint32_t> key(0, 999);
+    std::uniform_int_distribution<int> operation(0, 2);
+    for (int i = 0; i < 3; i++) {
+        switch (operation(_random)) {
+        case 0:
+            _value.erase(key(_random));
+            break;
+        default:
+            _value[key(_random)] = "value " + std::to_string(_random());
+            break;
+        }
+    }
+}
+
+// Changes some elements, and grows or shrinks the array now and then
+static void changeArray(IntArray &_value, std::mt19937 &_random) {
+    std::uniform_int_distribution<int> operation(0, 9);
+    switch (operation(_random)) {
+    case 0:
+        _value.push_back(int32_t(_random() >> 1));
+        break;
+    case 1:
+        if (!_value.empty()) {
+            _value.pop_back();
+        }
+        break;
+    default:
+        if (!_value.empty()) {
+            _value[_random() % _value.size()] = int32_t(_random() >> 1);
+        }
+        break;
+    }
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class DeltaTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        random_.seed(4711);
+    }
+
+    void TearDown() {
+    }
+
+    std::mt19937 random_;
+};
+
+/**
+* @test Applying the changes between two maps to the old map results in the new map.
+*/
+TEST_F(DeltaTest, MapDiffApply) {
+    StringMap oldValue;
+    for (uint32_t i = 0; i < 1000; i++) {
+        oldValue[i] = "value " + std::to_string(i);
+    }
+    for (int i = 0; i < 100; i++) {
+        StringMap newValue(oldValue);
+        changeMap(newValue, random_);
+
+        StringMap upserts;
+        std::vector<uint32_t> removed;
+        Delta::diff(oldValue, newValue, upserts, removed);
+        EXPECT_LE(upserts.size() + removed.size(), 3u);
+
+        Delta::apply(oldValue, upserts, removed);
+        EXPECT_EQ(newValue, oldValue);
+    }
+}
+
+/**
+* @test Applying the changes between two arrays to the old array results in the new array.
+*/
+TEST_F(DeltaTest, ArrayDiffApply) {
+    IntArray oldValue(1000);
+    for (int i = 0; i < 200; i++) {
+        IntArray newValue(oldValue);
+        changeArray(newValue, random_);
+
+        std::vector<uint32_t> indexes;
+        IntArray values;
+        Delta::diff(oldValue, newValue, indexes, values);
+        EXPECT_LE(indexes.size(), 1u);
+
+        ASSERT_TRUE(Delta::apply(oldValue, uint32_t(newValue.size()), indexes, values));
+        EXPECT_EQ(newValue, oldValue);
+    }
+}
+
+/**
+* @test Changes that do not fit the length of an array are rejected.
+*/
+TEST_F(DeltaTest, ArrayApplyRejectsInvalidChanges) {
+    IntArray value(10);
+    EXPECT_FALSE(Delta::apply(value, 10, { 10 }, IntArray{ 1 }));
+    EXPECT_FALSE(Delta::apply(value, 10, { 1, 2 }, IntArray{ 1 }));
+    EXPECT_EQ(IntArray(10), value);
+}
+
+/**
+* @test The first value and large changes are sent as keyframe, small changes as delta.
+*/
+TEST_F(DeltaTest, SenderSendsKeyframes) {
+    Delta::MapSender<StringMap> sender;
+    Delta::Sequence sequence;
+    StringMap upserts;
+    std::vector<uint32_t> removed;
+
+    StringMap value;
+    for (uint32_t i = 0; i < 100; i++) {
+        value[i] = "value";
+    }
+    EXPECT_TRUE(sender.update(value, sequence, upserts, removed));
+    EXPECT_EQ(1u, sequence);
+
+    value[5] = "changed";
+    value.erase(6);
+    EXPECT_FALSE(sender.update(value, sequence, upserts, removed));
+    EXPECT_EQ(2u, sequence);
+    EXPECT_EQ(StringMap({ { 5, "changed" } }), upserts);
+    EXPECT_EQ(std::vector<uint32_t>({ 6 }), removed);
+
+    for (uint32_t i = 0; i < 60; i++) {
+        value[i] = "changed again";
+    }
+    EXPECT_TRUE(sender.update(value, sequence, upserts, removed));
+    EXPECT_EQ(3u, sequence);
+    EXPECT_TRUE(upserts.empty());
+    EXPECT_TRUE(removed.empty());
+
+    const StringMap *keyframe = sender.getKeyframe(sequence);
+    ASSERT_NE(nullptr, keyframe);
+    EXPECT_EQ(3u, sequence);
+    EXPECT_EQ(value, *keyframe);
+}
+
+/**
+* @test The resync request returns the current value as base of the changes if nothing was sent yet.
+*/
+TEST_F(DeltaTest, SenderKeyframeBeforeFirstUpdate) {
+    Delta::ArraySender<IntArray> sender;
+    Delta::Sequence sequence(42);
+    EXPECT_EQ(nullptr, sender.getKeyframe(sequence));
+
+    const IntArray current(100, 7);
+    EXPECT_EQ(current, sender.getKeyframe(current, sequence));
+    EXPECT_EQ(0u, sequence);
+
+    IntArray value(current);
+    value[3] = 8;
+    std::vector<uint32_t> indexes;
+    IntArray values;
+    EXPECT_FALSE(sender.update(value, sequence, indexes, values));
+    EXPECT_EQ(1u, sequence);
+    EXPECT_EQ(std::vector<uint32_t>({ 3 }), indexes);
+
+    Delta::ArrayReplica<IntArray> replica;
+    IntArray notified;
+    auto handler = [&notified](const IntArray &_value) { notified = _value; };
+    EXPECT_EQ(Delta::Result::APPLIED, replica.resync(0, current, handler));
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(sequence, false, uint32_t(value.size()), indexes, values, handler));
+    EXPECT_EQ(value, notified);
+}
+
+/**
+* @test The value returned by the resync request is discarded if newer changes were applied
+* meanwhile, otherwise it replaces the copy.
+*/
+TEST_F(DeltaTest, ReplicaResync) {
+    Delta::MapReplica<StringMap> replica;
+    StringMap notified;
+    auto handler = [&notified](const StringMap &_value) { notified = _value; };
+
+    EXPECT_EQ(Delta::Result::APPLIED, replica.resync(10, { { 1, "one" } }, handler));
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(11, false, { { 2, "two" } }, {}, handler));
+    EXPECT_EQ(Delta::Result::DISCARDED, replica.resync(10, { { 1, "one" } }, handler));
+    EXPECT_EQ(Delta::Result::DISCARDED, replica.resync(11, { { 1, "one" }, { 2, "two" } }, handler));
+    EXPECT_EQ(StringMap({ { 1, "one" }, { 2, "two" } }), notified);
+
+    EXPECT_EQ(Delta::Result::APPLIED, replica.resync(15, { { 5, "five" } }, handler));
+    EXPECT_EQ(StringMap({ { 5, "five" } }), notified);
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(16, false, {}, { 5 }, handler));
+    EXPECT_TRUE(notified.empty());
+
+    // A restarted sender is followed after its changes desynchronized the copy
+    EXPECT_EQ(Delta::Result::RESYNC, replica.receive(1, false, { { 1, "one" } }, {}, handler));
+    EXPECT_EQ(Delta::Result::APPLIED, replica.resync(1, { { 1, "one" } }, handler));
+    EXPECT_EQ(StringMap({ { 1, "one" } }), notified);
+}
+
+/**
+* @test Changes are applied in order only; a gap requests a keyframe and a repeated
+* keyframe is discarded.
+*/
+TEST_F(DeltaTest, ReceiverDetectsGaps) {
+    Delta::Receiver receiver;
+    EXPECT_EQ(Delta::Result::RESYNC, receiver.onChanges(1));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onKeyframe(1));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onChanges(2));
+    EXPECT_EQ(Delta::Result::DISCARDED, receiver.onChanges(2));
+    EXPECT_EQ(Delta::Result::RESYNC, receiver.onChanges(4));
+    EXPECT_FALSE(receiver.isSynchronized());
+    EXPECT_EQ(Delta::Result::RESYNC, receiver.onChanges(5));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onKeyframe(5));
+    EXPECT_EQ(Delta::Result::DISCARDED, receiver.onKeyframe(5));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onChanges(6));
+    EXPECT_TRUE(receiver.isSynchronized());
+}
+
+/**
+* @test The sequence number wraps around.
+*/
+TEST_F(DeltaTest, ReceiverWrapsAround) {
+    Delta::Receiver receiver;
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onKeyframe(std::numeric_limits<Delta::Sequence>::max()));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onChanges(0));
+    EXPECT_EQ(Delta::Result::APPLIED, receiver.onChanges(1));
+}
+
+/**
+* @test A restarted sender starts with a keyframe that replaces the copy.
+*/
+TEST_F(DeltaTest, ReplicaFollowsRestartedSender) {
+    Delta::MapReplica<StringMap> replica;
+    StringMap notified;
+    auto handler = [&notified](const StringMap &_value) { notified = _value; };
+
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(1000, true, { { 1, "one" } }, {}, handler));
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(1001, false, { { 2, "two" } }, {}, handler));
+    EXPECT_EQ(StringMap({ { 1, "one" }, { 2, "two" } }), notified);
+
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(1, true, { { 3, "three" } }, {}, handler));
+    EXPECT_EQ(StringMap({ { 3, "three" } }), notified);
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(2, false, {}, { 3 }, handler));
+    EXPECT_TRUE(notified.empty());
+}
+
+/**
+* @test A map copy recovers from lost updates. Every tenth update is lost; on a gap
+* the receiver sends the resync request, which returns the last sent value and its sequence.
+* Every notified value equals a value the sender had, and the copy finally equals
+* the last value.
+*/
+TEST_F(DeltaTest, MapGapRecovery) {
+    Delta::MapSender<StringMap> sender;
+    Delta::MapReplica<StringMap> replica;
+    std::map<Delta::Sequence, StringMap> sent;
+    std::deque<MapUpdate> channel;
+
+    StringMap value;
+    for (uint32_t i = 0; i < 1000; i++) {
+        value[i] = "value " + std::to_string(i);
+    }
+
+    std::size_t keyframes(0), resyncs(0), notifications(0), deltas(0);
+    Delta::Sequence notifiedSequence(0);
+    StringMap notified;
+    for (int i = 0; i < 1000; i++) {
+        MapUpdate update;
+        update.isFull = sender.update(value, update.sequence, update.upserts, update.removed);
+        if (update.isFull) {
+            update.upserts = value;
+        } else {
+            deltas++;
+        }
+        sent[update.sequence] = value;
+        if (i % 10 != 9) {
+            channel.push_back(update);
+        }
+
+        while (!channel.empty()) {
+            MapUpdate received(channel.front());
+            channel.pop_front();
+            auto handler = [&](const StringMap &_value) {
+                notifications++;
+                notifiedSequence = received.sequence;
+                notified = _value;
+            };
+            Delta::Result result = (received.isResync
+                ? replica.resync(received.sequence, received.upserts, handler)
+                : replica.receive(received.sequence, received.isFull, received.upserts, received.removed, handler));
+            if (result == Delta::Result::APPLIED) {
+                EXPECT_EQ(sent[notifiedSequence], notified);
+                if (received.isResync) {
+                    keyframes++;
+                }
+            } else if (result == Delta::Result::RESYNC) {
+                resyncs++;
+                MapUpdate reply;
+                reply.isResync = true;
+                reply.upserts = sender.getKeyframe(value, reply.sequence);
+                channel.push_back(reply);
+            }
+        }
+        changeMap(value, random_);
+    }
+
+    EXPECT_GT(deltas, 900u);
+    EXPECT_GT(resyncs, 90u);
+    EXPECT_EQ(keyframes, resyncs);
+    EXPECT_GE(notifications, 900u);
+
+    // The last update was lost, the next one triggers the keyframe
+    MapUpdate update;
+    update.isFull = sender.update(value, update.sequence, update.upserts, update.removed);
+    auto ignore = [](const StringMap &) {};
+    EXPECT_EQ(Delta::Result::RESYNC, replica.receive(update.sequence, update.isFull, update.upserts, update.removed, ignore));
+    EXPECT_FALSE(replica.read(ignore));
+    update.isFull = true;
+    update.upserts = *sender.getKeyframe(update.sequence);
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(update.sequence, update.isFull, update.upserts, {}, ignore));
+    EXPECT_TRUE(replica.read([&value](const StringMap &_value) { EXPECT_EQ(value, _value); }));
+}
+
+/**
+* @test An array copy recovers from lost and reordered updates.
+*/
+TEST_F(DeltaTest, ArrayGapRecovery) {
+    Delta::ArraySender<IntArray> sender;
+    Delta::ArrayReplica<IntArray> replica;
+    std::map<Delta::Sequence, IntArray> sent;
+    std::deque<ArrayUpdate> channel;
+
+    IntArray value(500);
+    std::size_t resyncs(0);
+    auto deliver = [&](const ArrayUpdate &_update) {
+        channel.push_back(_update);
+        while (!channel.empty()) {
+            ArrayUpdate received(channel.front());
+            channel.pop_front();
+            auto handler = [&](const IntArray &_value) { EXPECT_EQ(sent[received.sequence], _value); };
+            Delta::Result result = (received.isResync
+                ? replica.resync(received.sequence, received.values, handler)
+                : replica.receive(received.sequence, received.isFull, received.length,
+                                  received.indexes, received.values, handler));
+            if (result == Delta::Result::RESYNC) {
+                resyncs++;
+                ArrayUpdate reply;
+                reply.isResync = true;
+                reply.values = sender.getKeyframe(value, reply.sequence);
+                channel.push_back(reply);
+            }
+        }
+    };
+
+    std::vector<ArrayUpdate> delayed;
+    for (int i = 0; i < 2000; i++) {
+        ArrayUpdate update;
+        update.length = uint32_t(value.size());
+        update.isFull = sender.update(value, update.sequence, update.indexes, update.values);
+        if (update.isFull) {
+            update.values = value;
+        }
+        sent[update.sequence] = value;
+        if (i % 17 == 16) {
+            // arrives after the next update
+            delayed.push_back(update);
+        } else if (i % 13 != 12) {
+            deliver(update);
+            for (auto &itsUpdate : delayed) {
+                deliver(itsUpdate);
+            }
+            delayed.clear();
+        }
+        changeArray(value, random_);
+    }
+    EXPECT_GT(resyncs, 100u);
+
+    ArrayUpdate update;
+    update.length = uint32_t(value.size());
+    update.isFull = sender.update(value, update.sequence, update.indexes, update.values);
+    replica.receive(update.sequence, update.isFull, update.length, update.indexes,
+        (update.isFull ? value : update.values), [](const IntArray &) {});
+    EXPECT_TRUE(replica.read([&value](const IntArray &_value) { EXPECT_EQ(value, _value); }));
+}
+
+/**
+* @test A reset copy is not read until the next keyframe.
+*/
+TEST_F(DeltaTest, ReplicaReset) {
+    Delta::ArrayReplica<IntArray> replica;
+    auto ignore = [](const IntArray &) {};
+    EXPECT_FALSE(replica.read(ignore));
+    EXPECT_EQ(Delta::Result::APPLIED, replica.receive(1, true, 3, {}, { 1, 2, 3 }, ignore));
+    EXPECT_TRUE(replica.read(ignore));
+    replica.reset();
+    EXPECT_FALSE(replica.read(ignore));
+    EXPECT_EQ(Delta::Result::RESYNC, replica.receive(2, false, 3, { 0 }, { 4 }, ignore));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,195 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPExecutionBenchmark
+*
+* Benchmark of the method executions (SomeIpMethodExecution). A dispatcher thread
+* receives the requests of a service in order, like the dispatcher of vsomeip.
+* Clients keep the slow method saturated with a fixed number of outstanding
+* requests while a fast method is called periodically. The slow method is run
+* inline, on the shared pool or on a dedicated thread, the fast method is always
+* run inline. Reports the latency percentiles of the fast method and the
+* throughput of the slow method.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SomeIPExecution.hpp"
+
+namespace Execution = CommonAPI::SomeIP::Execution;
+
+typedef std::chrono::steady_clock Clock;
+
+enum class Mode { INLINE, POOL, DEDICATED };
+
+struct Request {
+    bool isSlow;
+    Clock::time_point sent;
+};
+
+// Dispatches the requests of one service in the order they were received
+class Dispatcher {
+public:
+    Dispatcher(std::function<void (const Request &)> _handler)
+        : handler_(_handler), isStopped_(false) {
+        thread_ = std::thread(&Dispatcher::run, this);
+    }
+
+    ~Dispatcher() {
+        {
+            std::lock_guard<std::mutex> itsLock(mutex_);
+            isStopped_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+    }
+
+    void receive(const Request &_request) {
+        {
+            std::lock_guard<std::mutex> itsLock(mutex_);
+            requests_.push_back(_request);
+        }
+        condition_.notify_one();
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> itsLock(mutex_);
+        for (;;) {
+            condition_.wait(itsLock, [this]() { return !requests_.empty() || isStopped_; });
+            if (isStopped_) {
+                return;
+            }
+            Request itsRequest(requests_.front());
+            requests_.pop_front();
+            itsLock.unlock();
+            handler_(itsRequest);
+            itsLock.lock();
+        }
+    }
+
+    std::function<void (const Request &)> handler_;
+    std::deque<Request> requests_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool isStopped_;
+    std::thread thread_;
+};
+
+struct Result {
+    std::vector<double> fastLatencies;
+    std::size_t slowCalls;
+};
+
+static double percentile(std::vector<double> &_values, double _percentile) {
+    if (_values.empty()) {
+        return 0.0;
+    }
+    std::size_t index = std::size_t(_percentile * double(_values.size() - 1));
+    std::nth_element(_values.begin(), _values.begin() + long(index), _values.end());
+    return _values[index];
+}
+
+static Result runBenchmark(Mode _mode, std::chrono::milliseconds _duration,
+                           std::chrono::microseconds _slowTime, std::size_t _outstanding) {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t pending(0);
+    Result result;
+    result.slowCalls = 0;
+
+    // Called by the executing thread when the stub method sends its reply
+    auto reply = [&](const Request &_request) {
+        std::lock_guard<std::mutex> itsLock(mutex);
+        if (_request.isSlow) {
+            result.slowCalls++;
+            pending--;
+            condition.notify_one();
+        } else {
+            std::chrono::duration<double, std::micro> latency = Clock::now() - _request.sent;
+            result.fastLatencies.push_back(latency.count());
+        }
+    };
+    auto slowMethod = [&reply, _slowTime](const Request &_request) {
+        std::this_thread::sleep_for(_slowTime);
+        reply(_request);
+    };
+
+    Execution::DedicatedThread dedicated;
+    {
+        Dispatcher dispatcher([&](const Request &_request) {
+            if (!_request.isSlow) {
+                reply(_request);
+            } else if (_mode == Mode::POOL) {
+                Execution::Pool::get().post([&slowMethod, _request]() { slowMethod(_request); });
+            } else if (_mode == Mode::DEDICATED) {
+                dedicated.post([&slowMethod, _request]() { slowMethod(_request); });
+            } else {
+                slowMethod(_request);
+            }
+        });
+
+        // Clients of the slow method send the next request as soon as a reply arrives
+        std::atomic<bool> isRunning(true);
+        std::thread slowClients([&]() {
+            std::unique_lock<std::mutex> itsLock(mutex);
+            while (isRunning) {
+                while (pending < _outstanding) {
+                    pending++;
+                    dispatcher.receive(Request{ true, Clock::now() });
+                }
+                condition.wait_for(itsLock, std::chrono::milliseconds(10));
+            }
+        });
+
+        const Clock::time_point end = Clock::now() + _duration;
+        while (Clock::now() < end) {
+            dispatcher.receive(Request{ false, Clock::now() });
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        isRunning = false;
+        condition.notify_one();
+        slowClients.join();
+
+        // Waits for the outstanding requests before the dispatcher is destroyed
+        std::unique_lock<std::mutex> itsLock(mutex);
+        condition.wait(itsLock, [&pending]() { return pending == 0; });
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::chrono::milliseconds duration(argc > 1 ? std::strtol(argv[1], nullptr, 10) : 2000);
+    std::chrono::microseconds slowTime(argc > 2 ? std::strtol(argv[2], nullptr, 10) : 2000);
+    std::size_t outstanding(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 8);
+
+    std::cout << "mode,fast_calls,fast_p50_us,fast_p99_us,fast_max_us,slow_calls_per_s" << std::endl;
+    const std::pair<Mode, std::string> modes[] = {
+        { Mode::INLINE, "inline" }, { Mode::POOL, "pool" }, { Mode::DEDICATED, "dedicated" }
+    };
+    for (auto &itsMode : modes) {
+        Result result = runBenchmark(itsMode.first, duration, slowTime, outstanding);
+        std::vector<double> &latencies = result.fastLatencies;
+        std::cout << itsMode.second << ","
+                  << latencies.size() << ","
+                  << percentile(latencies, 0.5) << ","
+                  << percentile(latencies, 0.99) << ","
+                  << percentile(latencies, 1.0) << ","
+                  << double(result.slowCalls) * 1000.0 / double(duration.count()) << std::endl;
+    }
+    return 0;
+}
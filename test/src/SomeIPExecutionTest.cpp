@@ -0,0 +1,215 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPExecutionTest
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "SomeIPExecution.hpp"
+
+namespace Execution = CommonAPI::SomeIP::Execution;
+
+// Counts finished tasks and waits until the expected number is reached
+class Completion {
+public:
+    explicit Completion(std::size_t _expected)
+        : expected_(_expected), done_(0) {
+    }
+
+    void done() {
+        std::lock_guard<std::mutex> itsLock(mutex_);
+        if (++done_ >= expected_) {
+            condition_.notify_all();
+        }
+    }
+
+    bool wait() {
+        std::unique_lock<std::mutex> itsLock(mutex_);
+        return condition_.wait_for(itsLock, std::chrono::seconds(10),
+                [this]() { return done_ >= expected_; });
+    }
+
+private:
+    std::size_t expected_;
+    std::size_t done_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class ExecutionTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test The pool runs every posted task once.
+*/
+TEST_F(ExecutionTest, PoolRunsAllTasks) {
+    Execution::Pool pool(4);
+    EXPECT_EQ(4u, pool.getThreads());
+
+    const std::size_t tasks = 10000;
+    std::atomic<std::size_t> runs(0);
+    Completion completion(tasks);
+    for (std::size_t i = 0; i < tasks; i++) {
+        pool.post([&runs, &completion]() {
+            runs++;
+            completion.done();
+        });
+    }
+    ASSERT_TRUE(completion.wait());
+    EXPECT_EQ(tasks, runs.load());
+}
+
+/**
+* @test Tasks of the pool run concurrently: four tasks that wait for each other finish.
+*/
+TEST_F(ExecutionTest, PoolRunsTasksConcurrently) {
+    Execution::Pool pool(4);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t arrived(0);
+    Completion completion(4);
+    for (int i = 0; i < 4; i++) {
+        pool.post([&]() {
+            std::unique_lock<std::mutex> itsLock(mutex);
+            arrived++;
+            condition.notify_all();
+            condition.wait_for(itsLock, std::chrono::seconds(10), [&arrived]() { return arrived == 4; });
+            completion.done();
+        });
+    }
+    ASSERT_TRUE(completion.wait());
+    EXPECT_EQ(4u, arrived);
+}
+
+/**
+* @test Tasks posted by a blocked worker to its own queue are stolen by the other workers.
+*/
+TEST_F(ExecutionTest, PoolStealsTasks) {
+    Execution::Pool pool(2);
+
+    const std::size_t tasks = 100;
+    Completion inner(tasks);
+    Completion outer(1);
+    std::atomic<bool> finished(false);
+    pool.post([&]() {
+        for (std::size_t i = 0; i < tasks; i++) {
+            pool.post([&inner]() { inner.done(); });
+        }
+        // Blocks this worker until the other one has run all tasks of its queue
+        finished = inner.wait();
+        outer.done();
+    });
+    ASSERT_TRUE(outer.wait());
+    EXPECT_TRUE(finished);
+}
+
+/**
+* @test A dedicated thread runs the tasks in the order they were posted on one thread.
+*/
+TEST_F(ExecutionTest, DedicatedThreadKeepsOrder) {
+    Execution::DedicatedThread thread;
+
+    const std::size_t tasks = 10000;
+    std::vector<std::size_t> order;
+    std::set<std::thread::id> threads;
+    Completion completion(tasks);
+    for (std::size_t i = 0; i < tasks; i++) {
+        thread.post([i, &order, &threads, &completion]() {
+            order.push_back(i);
+            threads.insert(std::this_thread::get_id());
+            completion.done();
+        });
+    }
+    ASSERT_TRUE(completion.wait());
+    ASSERT_EQ(tasks, order.size());
+    for (std::size_t i = 0; i < tasks; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+    EXPECT_EQ(1u, threads.size());
+    EXPECT_EQ(0u, threads.count(std::this_thread::get_id()));
+}
+
+/**
+* @test A dedicated thread can be destroyed by one of its own tasks, as done by the
+* last reference to a stub adapter.
+*/
+TEST_F(ExecutionTest, DedicatedThreadDestroyedByOwnTask) {
+    Execution::DedicatedThread *thread = new Execution::DedicatedThread();
+    // The task holds the only reference
+    std::shared_ptr<std::shared_ptr<Execution::DedicatedThread>> owner
+        = std::make_shared<std::shared_ptr<Execution::DedicatedThread>>(thread);
+    Completion completion(1);
+    thread->post([owner, &completion]() {
+        owner->reset();
+        completion.done();
+    });
+    owner.reset();
+    ASSERT_TRUE(completion.wait());
+}
+
+/**
+* @test A slow task on a dedicated thread does not delay tasks of the pool.
+*/
+TEST_F(ExecutionTest, SlowDedicatedTaskDoesNotBlockPool) {
+    Execution::Pool pool(2);
+    Execution::DedicatedThread thread;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool released(false);
+    Completion slow(1);
+    thread.post([&]() {
+        std::unique_lock<std::mutex> itsLock(mutex);
+        condition.wait_for(itsLock, std::chrono::seconds(10), [&released]() { return released; });
+        slow.done();
+    });
+
+    Completion fast(100);
+    for (int i = 0; i < 100; i++) {
+        pool.post([&fast]() { fast.done(); });
+    }
+    EXPECT_TRUE(fast.wait());
+    {
+        std::lock_guard<std::mutex> itsLock(mutex);
+        released = true;
+    }
+    condition.notify_all();
+    EXPECT_TRUE(slow.wait());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPLazyMembersBenchmark
+*
+* Benchmark of lazy proxy members (generator option -lm) for an interface of 300
+* UInt32 attributes. LargeEager is generated without, LargeLazy with the option.
+* Reports per proxy the time to build it, the heap bytes it holds after building,
+* the time to access every attribute once and the heap bytes it holds after
+* that. Only allocations of the benchmark thread are counted, the dispatching
+* threads of CommonAPI are not.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#include "LargeInterfaceAttributes.hpp"
+#include "v1/commonapi/someip/lazytest/LargeEagerProxy.hpp"
+#include "v1/commonapi/someip/lazytest/LargeLazyProxy.hpp"
+
+static const std::size_t ALLOCATION_HEADER = 16;   // keeps the alignment of malloc
+
+static thread_local long long liveBytes = 0;
+
+void *operator new(std::size_t _size) {
+    void *itsBlock = std::malloc(_size + ALLOCATION_HEADER);
+    if (!itsBlock)
+        throw std::bad_alloc();
+    *static_cast<std::size_t *>(itsBlock) = _size;
+    liveBytes += static_cast<long long>(_size);
+    return static_cast<char *>(itsBlock) + ALLOCATION_HEADER;
+}
+
+void *operator new(std::size_t _size, const std::nothrow_t &) noexcept {
+    try {
+        return ::operator new(_size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *_pointer) noexcept {
+    if (_pointer) {
+        void *itsBlock = static_cast<char *>(_pointer) - ALLOCATION_HEADER;
+        liveBytes -= static_cast<long long>(*static_cast<std::size_t *>(itsBlock));
+        std::free(itsBlock);
+    }
+}
+
+void operator delete(void *_pointer, const std::nothrow_t &) noexcept {
+    ::operator delete(_pointer);
+}
+
+struct Result {
+    double construct;
+    double access;
+    long long bytes;
+    long long bytesAfterAccess;
+};
+
+template<typename Proxy_>
+static void accessAttributes(Proxy_ &_proxy) {
+#define ACCESS_ATTRIBUTE(N) (void)&_proxy.get##N##Attribute();
+    LARGE_ATTRIBUTES(ACCESS_ATTRIBUTE)
+#undef ACCESS_ATTRIBUTE
+}
+
+template<template<typename ...> class Proxy_>
+static Result run(const std::string &_instance, std::size_t _proxies) {
+    std::shared_ptr<CommonAPI::Runtime> runtime = CommonAPI::Runtime::get();
+    std::vector<std::shared_ptr<Proxy_<>>> proxies;
+    proxies.reserve(_proxies);
+
+    // The first proxy creates the connection, which is shared by the others
+    std::shared_ptr<Proxy_<>> first = runtime->buildProxy<Proxy_>("local", _instance, "lazy-members-benchmark");
+    if (!first) {
+        std::cerr << "building " << _instance << " failed" << std::endl;
+        std::exit(1);
+    }
+
+    Result result{ 0.0, 0.0, 0, 0 };
+    long long startBytes = liveBytes;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _proxies; i++) {
+        proxies.push_back(runtime->buildProxy<Proxy_>("local", _instance, "lazy-members-benchmark"));
+    }
+    result.construct = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    result.bytes = liveBytes - startBytes;
+
+    start = std::chrono::steady_clock::now();
+    for (auto &itsProxy : proxies) {
+        accessAttributes(*itsProxy);
+    }
+    result.access = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    result.bytesAfterAccess = liveBytes - startBytes;
+
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t proxies = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100);
+
+    const Result eager = run<v1_0::commonapi::someip::lazytest::LargeEagerProxy>(
+        "commonapi.someip.lazytest.LargeEager", proxies);
+    const Result lazy = run<v1_0::commonapi::someip::lazytest::LargeLazyProxy>(
+        "commonapi.someip.lazytest.LargeLazy", proxies);
+
+    std::cout << "mode,attributes,us_per_construct,bytes_per_proxy,us_per_first_access_of_all,bytes_per_proxy_after_access" << std::endl;
+    for (auto &itsResult : { std::make_pair("eager", eager), std::make_pair("lazy", lazy) }) {
+        std::cout << itsResult.first << ","
+                  << LARGE_ATTRIBUTE_COUNT << ","
+                  << itsResult.second.construct / double(proxies) << ","
+                  << double(itsResult.second.bytes) / double(proxies) << ","
+                  << itsResult.second.access / double(proxies) << ","
+                  << double(itsResult.second.bytesAfterAccess) / double(proxies) << std::endl;
+    }
+    return 0;
+}
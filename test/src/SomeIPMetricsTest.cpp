@@ -0,0 +1,336 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPMetricsTest
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceProxy.hpp"
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceSomeIPMetrics.hpp"
+#include "DeploymentTestStub.h"
+
+namespace deploymenttest = v1_0::commonapi::someip::deploymenttest;
+typedef deploymenttest::TestInterfaceSomeIPMetrics Metrics;
+
+const std::string domain = "local";
+const std::string testAddress = "commonapi.someip.deploymenttest.TestInterface";
+const std::string connectionIdService = "service-sample";
+const std::string connectionIdClient = "client-sample";
+
+// aUint8 is deployed with SomeIpGetterID = 3000, SomeIpSetterID = 3001 and SomeIpNotifierID = 33000
+static const CommonAPI::SomeIP::method_id_t GETTER_ID = 3000;
+static const CommonAPI::SomeIP::method_id_t SETTER_ID = 3001;
+static const CommonAPI::SomeIP::event_id_t NOTIFIER_ID = 33000;
+
+// mArrayi8_io is deployed with SomeIpMethodID = 516, bArrayi8 with SomeIpEventID = 34000
+static const CommonAPI::SomeIP::method_id_t ARRAY_METHOD_ID = 516;
+static const CommonAPI::SomeIP::event_id_t ARRAY_EVENT_ID = 34000;
+
+// The stub side finishes its metric after it has sent the reply, the caller may see
+// the reply before. Waits until the condition holds.
+static bool waitFor(std::function<bool()> _condition) {
+    for (int i = 0; i < 100 && !_condition(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return _condition();
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class MetricsTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        Metrics::reset();
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test A call is in flight between start and finished and counted afterwards.
+*/
+TEST_F(MetricsTest, CallsAndInFlight) {
+    Metrics::Metric &metric = Metrics::method(Metrics::Side::STUB, GETTER_ID);
+
+    Metrics::Metric::TimePoint start = metric.start();
+    Metrics::Snapshot snapshot = metric.snapshot();
+    EXPECT_EQ(1u, snapshot.calls);
+    EXPECT_EQ(1u, snapshot.inFlight);
+    EXPECT_EQ(0u, snapshot.duration.count);
+
+    metric.sent(start);
+    metric.finished(start, true);
+    snapshot = metric.snapshot();
+    EXPECT_EQ(1u, snapshot.calls);
+    EXPECT_EQ(0u, snapshot.inFlight);
+    EXPECT_EQ(0u, snapshot.errors);
+    EXPECT_EQ(1u, snapshot.send.count);
+    EXPECT_EQ(1u, snapshot.duration.count);
+    EXPECT_GE(snapshot.duration.totalNs, snapshot.send.totalNs);
+
+    metric.finished(metric.start(), false);
+    snapshot = metric.snapshot();
+    EXPECT_EQ(2u, snapshot.calls);
+    EXPECT_EQ(1u, snapshot.errors);
+}
+
+/**
+* @test Proxy and stub side, methods and events are counted separately.
+*/
+TEST_F(MetricsTest, Separation) {
+    EXPECT_NE(&Metrics::method(Metrics::Side::PROXY, GETTER_ID), &Metrics::method(Metrics::Side::STUB, GETTER_ID));
+    EXPECT_NE(&Metrics::method(Metrics::Side::STUB, GETTER_ID), &Metrics::method(Metrics::Side::STUB, SETTER_ID));
+
+    Metrics::Metric &event = Metrics::event(Metrics::Side::STUB, NOTIFIER_ID);
+    event.finished(event.start(), true);
+    EXPECT_EQ(1u, Metrics::event(Metrics::Side::STUB, NOTIFIER_ID).snapshot().calls);
+    EXPECT_EQ(0u, Metrics::event(Metrics::Side::PROXY, NOTIFIER_ID).snapshot().calls);
+    EXPECT_EQ(0u, Metrics::method(Metrics::Side::STUB, GETTER_ID).snapshot().calls);
+    EXPECT_EQ(0u, Metrics::method(Metrics::Side::PROXY, GETTER_ID).snapshot().calls);
+}
+
+/**
+* @test Unknown method IDs share one metric.
+*/
+TEST_F(MetricsTest, UnknownIds) {
+    Metrics::Metric &unknown = Metrics::method(Metrics::Side::STUB, CommonAPI::SomeIP::method_id_t(0x7ffe));
+    EXPECT_EQ(&unknown, &Metrics::method(Metrics::Side::STUB, CommonAPI::SomeIP::method_id_t(0x7fff)));
+    EXPECT_NE(&unknown, &Metrics::method(Metrics::Side::STUB, GETTER_ID));
+}
+
+/**
+* @test Calls from many threads are all counted and end up in the histogram.
+*/
+TEST_F(MetricsTest, Threads) {
+    const std::size_t threads = 8;
+    const std::size_t calls = 10000;
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.push_back(std::thread([calls]() {
+            for (std::size_t i = 0; i < calls; i++) {
+                Metrics::Metric &metric = Metrics::method(Metrics::Side::PROXY, GETTER_ID);
+                metric.finished(metric.start(), i % 10 != 0);
+            }
+        }));
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    Metrics::Snapshot snapshot = Metrics::method(Metrics::Side::PROXY, GETTER_ID).snapshot();
+    EXPECT_EQ(threads * calls, snapshot.calls);
+    EXPECT_EQ(threads * calls / 10, snapshot.errors);
+    EXPECT_EQ(0u, snapshot.inFlight);
+    EXPECT_EQ(threads * calls, snapshot.duration.count);
+
+    uint64_t histogram(0);
+    for (std::size_t i = 0; i < Metrics::BUCKETS; i++) {
+        histogram += snapshot.duration.histogram[i];
+    }
+    EXPECT_EQ(snapshot.duration.count, histogram);
+    EXPECT_LE(snapshot.duration.percentileNs(50), snapshot.duration.percentileNs(99));
+    EXPECT_GT(snapshot.duration.percentileNs(100), 0u);
+}
+
+/**
+* @test The visitors report the names and IDs of the deployment.
+*/
+TEST_F(MetricsTest, Visitors) {
+    Metrics::Metric &metric = Metrics::method(Metrics::Side::STUB, SETTER_ID);
+    metric.finished(metric.start(), true);
+
+    bool found(false);
+    Metrics::forEachMethod([&found](Metrics::Side _side, CommonAPI::SomeIP::method_id_t _method,
+                                    const char *_name, const Metrics::Snapshot &_snapshot) {
+        if (_side == Metrics::Side::STUB && _method == SETTER_ID) {
+            EXPECT_EQ(std::string("setAUint8"), _name);
+            EXPECT_EQ(1u, _snapshot.calls);
+            found = true;
+        }
+    });
+    EXPECT_TRUE(found);
+
+    found = false;
+    Metrics::forEachEvent([&found](Metrics::Side _side, CommonAPI::SomeIP::event_id_t _event,
+                                   const char *_name, const Metrics::Snapshot &) {
+        if (_side == Metrics::Side::PROXY && _event == NOTIFIER_ID) {
+            EXPECT_EQ(std::string("aUint8"), _name);
+            found = true;
+        }
+    });
+    EXPECT_TRUE(found);
+}
+
+/**
+* @test Reset clears all counters.
+*/
+TEST_F(MetricsTest, Reset) {
+    Metrics::Metric &metric = Metrics::method(Metrics::Side::STUB, GETTER_ID);
+    metric.finished(metric.start(), false);
+    Metrics::reset();
+
+    Metrics::Snapshot snapshot = metric.snapshot();
+    EXPECT_EQ(0u, snapshot.calls);
+    EXPECT_EQ(0u, snapshot.errors);
+    EXPECT_EQ(0u, snapshot.duration.count);
+    EXPECT_EQ(0u, snapshot.duration.totalNs);
+}
+
+class MetricsCallTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        runtime_ = CommonAPI::Runtime::get();
+        ASSERT_TRUE((bool)runtime_);
+
+        stub_ = std::make_shared<deploymenttest::DeploymentTestStub>();
+        ASSERT_TRUE(runtime_->registerService(domain, testAddress, stub_, connectionIdService));
+
+        proxy_ = runtime_->buildProxy<deploymenttest::TestInterfaceProxy>(domain, testAddress, connectionIdClient);
+        int i = 0;
+        while (!proxy_->isAvailable() && i++ < 100) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_TRUE(proxy_->isAvailable());
+        Metrics::reset();
+    }
+
+    void TearDown() {
+        ASSERT_TRUE(runtime_->unregisterService(domain, deploymenttest::DeploymentTestStub::StubInterface::getInterface(), testAddress));
+    }
+
+    std::shared_ptr<CommonAPI::Runtime> runtime_;
+    std::shared_ptr<deploymenttest::DeploymentTestStub> stub_;
+    std::shared_ptr<deploymenttest::TestInterfaceProxy<>> proxy_;
+};
+
+/**
+* @test A synchronous call is counted on both sides, the stub side times deserialization,
+* the stub method and the serialization of the reply separately.
+*/
+TEST_F(MetricsCallTest, SyncCall) {
+    CommonAPI::CallStatus callStatus;
+    std::vector<int8_t> outArg;
+    proxy_->mArrayi8_io(std::vector<int8_t>{ 10, 1, 2, 3, 4 }, callStatus, outArg);
+    ASSERT_EQ(CommonAPI::CallStatus::SUCCESS, callStatus);
+    EXPECT_EQ(10u, outArg.size());
+
+    Metrics::Snapshot proxy = Metrics::method(Metrics::Side::PROXY, ARRAY_METHOD_ID).snapshot();
+    EXPECT_EQ(1u, proxy.calls);
+    EXPECT_EQ(0u, proxy.inFlight);
+    EXPECT_EQ(0u, proxy.errors);
+    EXPECT_EQ(1u, proxy.duration.count);
+
+    Metrics::Metric &metric = Metrics::method(Metrics::Side::STUB, ARRAY_METHOD_ID);
+    ASSERT_TRUE(waitFor([&metric]() { return metric.snapshot().duration.count == 1; }));
+    Metrics::Snapshot stub = metric.snapshot();
+    EXPECT_EQ(1u, stub.calls);
+    EXPECT_EQ(0u, stub.inFlight);
+    EXPECT_EQ(0u, stub.errors);
+    EXPECT_EQ(1u, stub.deserialization.count);
+    EXPECT_EQ(1u, stub.handler.count);
+    EXPECT_EQ(1u, stub.serialization.count);
+    EXPECT_GE(stub.duration.totalNs, stub.deserialization.totalNs + stub.serialization.totalNs);
+}
+
+/**
+* @test An asynchronous call counts the sending of the request and the callback.
+*/
+TEST_F(MetricsCallTest, AsyncCall) {
+    std::promise<CommonAPI::CallStatus> done;
+    proxy_->mArrayi8_ioAsync(std::vector<int8_t>{ 10, 1, 2, 3, 4 },
+        [&done](const CommonAPI::CallStatus &_status, const std::vector<int8_t> &) {
+            done.set_value(_status);
+        });
+    std::future<CommonAPI::CallStatus> status = done.get_future();
+    ASSERT_EQ(std::future_status::ready, status.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, status.get());
+
+    Metrics::Metric &metric = Metrics::method(Metrics::Side::PROXY, ARRAY_METHOD_ID);
+    ASSERT_TRUE(waitFor([&metric]() { return metric.snapshot().handler.count == 1; }));
+    Metrics::Snapshot proxy = metric.snapshot();
+    EXPECT_EQ(1u, proxy.calls);
+    EXPECT_EQ(1u, proxy.send.count);
+    EXPECT_EQ(1u, proxy.duration.count);
+}
+
+/**
+* @test Attribute getters and setters of the proxy are counted with their method IDs.
+*/
+TEST_F(MetricsCallTest, Attribute) {
+    CommonAPI::CallStatus callStatus;
+    uint8_t value(0);
+    proxy_->getAUint8Attribute().getValue(callStatus, value);
+    ASSERT_EQ(CommonAPI::CallStatus::SUCCESS, callStatus);
+
+    std::promise<CommonAPI::CallStatus> done;
+    proxy_->getAUint8Attribute().setValueAsync(uint8_t(value + 1),
+        [&done](const CommonAPI::CallStatus &_status, uint8_t) {
+            done.set_value(_status);
+        });
+    std::future<CommonAPI::CallStatus> status = done.get_future();
+    ASSERT_EQ(std::future_status::ready, status.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, status.get());
+
+    Metrics::Snapshot getter = Metrics::method(Metrics::Side::PROXY, GETTER_ID).snapshot();
+    EXPECT_EQ(1u, getter.calls);
+    EXPECT_EQ(1u, getter.duration.count);
+
+    Metrics::Metric &setter = Metrics::method(Metrics::Side::PROXY, SETTER_ID);
+    ASSERT_TRUE(waitFor([&setter]() { return setter.snapshot().handler.count == 1; }));
+    EXPECT_EQ(1u, setter.snapshot().calls);
+    EXPECT_EQ(0u, setter.snapshot().inFlight);
+}
+
+/**
+* @test A broadcast is counted when the stub sends it and when the proxy receives it.
+*/
+TEST_F(MetricsCallTest, Broadcast) {
+    std::promise<std::size_t> received;
+    uint32_t subscription = proxy_->getBArrayi8Event().subscribe([&received](const std::vector<int8_t> &_value) {
+        received.set_value(_value.size());
+    });
+
+    CommonAPI::CallStatus callStatus;
+    proxy_->mBCastTrigger(deploymenttest::TestInterface::tEnumTriggerType::T_ARRAY, 10, callStatus);
+    ASSERT_EQ(CommonAPI::CallStatus::SUCCESS, callStatus);
+    std::future<std::size_t> size = received.get_future();
+    ASSERT_EQ(std::future_status::ready, size.wait_for(std::chrono::seconds(7)));
+    EXPECT_EQ(10u, size.get());
+    proxy_->getBArrayi8Event().unsubscribe(subscription);
+
+    EXPECT_EQ(1u, Metrics::event(Metrics::Side::STUB, ARRAY_EVENT_ID).snapshot().calls);
+    Metrics::Metric &event = Metrics::event(Metrics::Side::PROXY, ARRAY_EVENT_ID);
+    ASSERT_TRUE(waitFor([&event]() { return event.snapshot().duration.count == 1; }));
+    EXPECT_EQ(1u, event.snapshot().calls);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,297 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPPolymorphBenchmark
+*
+* Benchmark of the pooled decoding of arrays of polymorphic structs. Decodes an
+* array of 100000 elements of a hierarchy of three structs, with the elements in
+* random order and in runs of the same type, through the factory of the runtime
+* and through the type table into pooled blocks. Checks that both decode the
+* same values and reports the time to decode the array and to release it again.
+*
+* The hierarchy is written like the structs the CommonAPI code generator writes
+* for a polymorphic struct and two structs that extend it.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPPolymorph.hpp"
+
+struct Shape : CommonAPI::PolymorphicStruct {
+    static const CommonAPI::Serial SERIAL = 0x5a3e0001;
+
+    static std::shared_ptr<Shape> create(CommonAPI::Serial _serial);
+
+    Shape() : id_(0) {}
+    virtual ~Shape() {}
+
+    virtual CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_, class Deployment_>
+    void readValue(CommonAPI::InputStream<Input_> &_input, const Deployment_ *_depl);
+
+    template<class Output_, class Deployment_>
+    void writeValue(CommonAPI::OutputStream<Output_> &_output, const Deployment_ *_depl) const;
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        _input >> id_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        _output << id_;
+    }
+
+    bool operator==(const Shape &_other) const {
+        return getSerial() == _other.getSerial() && id_ == _other.id_;
+    }
+
+    uint32_t id_;
+};
+
+struct Circle : Shape {
+    static const CommonAPI::Serial SERIAL = 0x0c1e0002;
+
+    Circle() : radius_(0.0) {}
+
+    CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        Shape::readFields(_input);
+        _input >> radius_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        Shape::writeFields(_output);
+        _output << radius_;
+    }
+
+    double radius_;
+};
+
+struct Rectangle : Shape {
+    static const CommonAPI::Serial SERIAL = 0x7ec70003;
+
+    Rectangle() : width_(0), height_(0), isFilled_(false) {}
+
+    CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        Shape::readFields(_input);
+        _input >> width_ >> height_ >> isFilled_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        Shape::writeFields(_output);
+        _output << width_ << height_ << isFilled_;
+    }
+
+    int32_t width_;
+    int32_t height_;
+    bool isFilled_;
+};
+
+std::shared_ptr<Shape> Shape::create(CommonAPI::Serial _serial) {
+    switch (_serial) {
+    case Shape::SERIAL:
+        return std::make_shared<Shape>();
+    case Circle::SERIAL:
+        return std::make_shared<Circle>();
+    case Rectangle::SERIAL:
+        return std::make_shared<Rectangle>();
+    default:
+        return std::shared_ptr<Shape>();
+    }
+}
+
+template<class Input_, class Deployment_>
+void Shape::readValue(CommonAPI::InputStream<Input_> &_input, const Deployment_ *) {
+    switch (getSerial()) {
+    case Circle::SERIAL:
+        static_cast<Circle *>(this)->readFields(_input);
+        break;
+    case Rectangle::SERIAL:
+        static_cast<Rectangle *>(this)->readFields(_input);
+        break;
+    default:
+        readFields(_input);
+        break;
+    }
+}
+
+template<class Output_, class Deployment_>
+void Shape::writeValue(CommonAPI::OutputStream<Output_> &_output, const Deployment_ *) const {
+    switch (getSerial()) {
+    case Circle::SERIAL:
+        static_cast<const Circle *>(this)->writeFields(_output);
+        break;
+    case Rectangle::SERIAL:
+        static_cast<const Rectangle *>(this)->writeFields(_output);
+        break;
+    default:
+        writeFields(_output);
+        break;
+    }
+}
+
+typedef std::vector<std::shared_ptr<Shape>> Shapes;
+typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::EmptyDeployment> ShapesDeployment;
+// Serial and id of the struct are the lower bound of the serialized size
+typedef CommonAPI::SomeIP::Polymorph::Deployment<ShapesDeployment, 8, Shape, Shape, Circle, Rectangle> PooledShapesDeployment;
+
+struct Result {
+    Shapes value;
+    double decodeTime;
+    double releaseTime;
+};
+
+static void checkStream(bool _hasError) {
+    if (_hasError) {
+        std::cerr << "serialization failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool isEqual(const Shape &_left, const Shape &_right) {
+    if (!(_left == _right))
+        return false;
+    if (_left.getSerial() == Circle::SERIAL)
+        return static_cast<const Circle &>(_left).radius_ == static_cast<const Circle &>(_right).radius_;
+    if (_left.getSerial() == Rectangle::SERIAL) {
+        const Rectangle &itsLeft = static_cast<const Rectangle &>(_left);
+        const Rectangle &itsRight = static_cast<const Rectangle &>(_right);
+        return itsLeft.width_ == itsRight.width_ && itsLeft.height_ == itsRight.height_ &&
+               itsLeft.isFilled_ == itsRight.isFilled_;
+    }
+    return true;
+}
+
+static Shapes createShapes(std::size_t _length, bool _isSorted, std::mt19937_64 &_random) {
+    Shapes shapes;
+    shapes.reserve(_length);
+    for (std::size_t i = 0; i < _length; i++) {
+        // 60% circles, 30% rectangles, 10% shapes
+        const std::size_t kind = (_isSorted ? i * 10 / _length : std::size_t(_random() % 10));
+        if (kind < 6) {
+            std::shared_ptr<Circle> circle = std::make_shared<Circle>();
+            circle->radius_ = double(_random() % 1000) / 10.0;
+            shapes.push_back(circle);
+        } else if (kind < 9) {
+            std::shared_ptr<Rectangle> rectangle = std::make_shared<Rectangle>();
+            rectangle->width_ = int32_t(_random() % 1000);
+            rectangle->height_ = int32_t(_random() % 1000);
+            rectangle->isFilled_ = (_random() % 2 == 0);
+            shapes.push_back(rectangle);
+        } else {
+            shapes.push_back(std::make_shared<Shape>());
+        }
+        shapes.back()->id_ = uint32_t(i);
+    }
+    return shapes;
+}
+
+template<typename Deployment_>
+static Result run(const CommonAPI::SomeIP::Message &_message, std::size_t _iterations) {
+    Result result{ Shapes(), 0.0, 0.0 };
+    for (std::size_t i = 0; i < _iterations; i++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Shapes value;
+        {
+            CommonAPI::Deployable<Shapes, Deployment_> deployedValue(static_cast<Deployment_ *>(nullptr));
+            CommonAPI::SomeIP::InputStream inStream(_message, false);
+            inStream >> deployedValue;
+            checkStream(inStream.hasError());
+            value = std::move(deployedValue.getValue());
+        }
+        std::chrono::steady_clock::time_point decoded = std::chrono::steady_clock::now();
+        if (i + 1 < _iterations)
+            value.clear();
+        else
+            result.value = std::move(value);
+        std::chrono::steady_clock::time_point released = std::chrono::steady_clock::now();
+
+        result.decodeTime += std::chrono::duration<double, std::milli>(decoded - start).count();
+        result.releaseTime += std::chrono::duration<double, std::milli>(released - decoded).count();
+    }
+    result.decodeTime /= double(_iterations);
+    result.releaseTime /= double(_iterations - 1);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t length = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000);
+    std::size_t iterations = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20);
+    if (iterations < 2)
+        iterations = 2;
+
+    std::mt19937_64 random(4711);
+    std::cout << "order,mode,elements,decode_ms,release_ms,melements_per_s" << std::endl;
+    for (bool isSorted : { false, true }) {
+        const Shapes shapes = createShapes(length, isSorted, random);
+        CommonAPI::SomeIP::Message message = CommonAPI::SomeIP::Message::createMethodCall(
+            CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+        {
+            CommonAPI::Deployable<Shapes, ShapesDeployment> deployedValue(shapes, nullptr);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream << deployedValue;
+            checkStream(outStream.hasError());
+            outStream.flush();
+        }
+
+        const Result factory = run<ShapesDeployment>(message, iterations);
+        const Result pooled = run<PooledShapesDeployment>(message, iterations);
+        for (const Result *itsResult : { &factory, &pooled }) {
+            if (itsResult->value.size() != shapes.size()) {
+                std::cerr << "decoded " << itsResult->value.size() << " of " << shapes.size() << " elements" << std::endl;
+                return 1;
+            }
+            for (std::size_t i = 0; i < shapes.size(); i++) {
+                if (!isEqual(*shapes[i], *itsResult->value[i])) {
+                    std::cerr << "element " << i << " differs" << std::endl;
+                    return 1;
+                }
+            }
+        }
+
+        for (auto &itsResult : { std::make_pair("factory", &factory), std::make_pair("pooled", &pooled) }) {
+            std::cout << (isSorted ? "runs" : "random") << ","
+                      << itsResult.first << ","
+                      << length << ","
+                      << itsResult.second->decodeTime << ","
+                      << itsResult.second->releaseTime << ","
+                      << double(length) / (itsResult.second->decodeTime * 1000.0) << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,453 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPPolymorphTest
+*
+* The hierarchy is written like the structs the CommonAPI code generator writes
+* for a polymorphic struct and two structs that extend it.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPPolymorph.hpp"
+
+// Largest block requested without exception, the next requests fail if set
+static std::size_t largestAllocation(0);
+static bool isAllocationFailing(false);
+
+void *operator new(std::size_t _size, const std::nothrow_t &) noexcept {
+    if (isAllocationFailing)
+        return nullptr;
+    if (_size > largestAllocation)
+        largestAllocation = _size;
+    try {
+        return ::operator new(_size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+struct Shape : CommonAPI::PolymorphicStruct {
+    static const CommonAPI::Serial SERIAL = 0x5a3e0001;
+
+    static std::shared_ptr<Shape> create(CommonAPI::Serial _serial);
+
+    Shape() : id_(0) {}
+    virtual ~Shape() {
+        destroyed_++;
+    }
+
+    virtual CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_, class Deployment_>
+    void readValue(CommonAPI::InputStream<Input_> &_input, const Deployment_ *_depl);
+
+    template<class Output_, class Deployment_>
+    void writeValue(CommonAPI::OutputStream<Output_> &_output, const Deployment_ *_depl) const;
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        _input >> id_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        _output << id_;
+    }
+
+    bool operator==(const Shape &_other) const {
+        return getSerial() == _other.getSerial() && id_ == _other.id_;
+    }
+
+    uint32_t id_;
+
+    static std::size_t destroyed_;
+};
+
+std::size_t Shape::destroyed_(0);
+
+struct Circle : Shape {
+    static const CommonAPI::Serial SERIAL = 0x0c1e0002;
+
+    Circle() : radius_(0.0) {}
+
+    CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        Shape::readFields(_input);
+        _input >> radius_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        Shape::writeFields(_output);
+        _output << radius_;
+    }
+
+    double radius_;
+};
+
+struct Rectangle : Shape {
+    static const CommonAPI::Serial SERIAL = 0x7ec70003;
+
+    Rectangle() : width_(0), height_(0), isFilled_(false) {}
+
+    CommonAPI::Serial getSerial() const {
+        return SERIAL;
+    }
+
+    template<class Input_>
+    void readFields(CommonAPI::InputStream<Input_> &_input) {
+        Shape::readFields(_input);
+        _input >> width_ >> height_ >> isFilled_;
+    }
+
+    template<class Output_>
+    void writeFields(CommonAPI::OutputStream<Output_> &_output) const {
+        Shape::writeFields(_output);
+        _output << width_ << height_ << isFilled_;
+    }
+
+    int32_t width_;
+    int32_t height_;
+    bool isFilled_;
+};
+
+std::shared_ptr<Shape> Shape::create(CommonAPI::Serial _serial) {
+    switch (_serial) {
+    case Shape::SERIAL:
+        return std::make_shared<Shape>();
+    case Circle::SERIAL:
+        return std::make_shared<Circle>();
+    case Rectangle::SERIAL:
+        return std::make_shared<Rectangle>();
+    default:
+        return std::shared_ptr<Shape>();
+    }
+}
+
+template<class Input_, class Deployment_>
+void Shape::readValue(CommonAPI::InputStream<Input_> &_input, const Deployment_ *) {
+    switch (getSerial()) {
+    case Circle::SERIAL:
+        static_cast<Circle *>(this)->readFields(_input);
+        break;
+    case Rectangle::SERIAL:
+        static_cast<Rectangle *>(this)->readFields(_input);
+        break;
+    default:
+        readFields(_input);
+        break;
+    }
+}
+
+template<class Output_, class Deployment_>
+void Shape::writeValue(CommonAPI::OutputStream<Output_> &_output, const Deployment_ *) const {
+    switch (getSerial()) {
+    case Circle::SERIAL:
+        static_cast<const Circle *>(this)->writeFields(_output);
+        break;
+    case Rectangle::SERIAL:
+        static_cast<const Rectangle *>(this)->writeFields(_output);
+        break;
+    default:
+        writeFields(_output);
+        break;
+    }
+}
+
+typedef std::vector<std::shared_ptr<Shape>> Shapes;
+typedef CommonAPI::SomeIP::ArrayDeployment<CommonAPI::EmptyDeployment> ShapesDeployment;
+typedef CommonAPI::SomeIP::Polymorph::Deployment<ShapesDeployment, 8, Shape, Shape, Circle, Rectangle> PooledShapesDeployment;
+// Rectangles are not part of the table
+typedef CommonAPI::SomeIP::Polymorph::Deployment<ShapesDeployment, 8, Shape, Shape, Circle> PartialShapesDeployment;
+typedef CommonAPI::SomeIP::Polymorph::Table<Shape, Shape, Circle, Rectangle> ShapesTable;
+
+// Size of the block of an array with the given number of slots
+static std::size_t getBlockSize(std::size_t _capacity) {
+    return _capacity * (ShapesTable::STRIDE + sizeof(Shape *));
+}
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static bool isEqual(const Shape &_left, const Shape &_right) {
+    if (!(_left == _right))
+        return false;
+    if (_left.getSerial() == Circle::SERIAL)
+        return static_cast<const Circle &>(_left).radius_ == static_cast<const Circle &>(_right).radius_;
+    if (_left.getSerial() == Rectangle::SERIAL) {
+        const Rectangle &itsLeft = static_cast<const Rectangle &>(_left);
+        const Rectangle &itsRight = static_cast<const Rectangle &>(_right);
+        return itsLeft.width_ == itsRight.width_ && itsLeft.height_ == itsRight.height_ &&
+               itsLeft.isFilled_ == itsRight.isFilled_;
+    }
+    return true;
+}
+
+static void expectEqual(const Shapes &_expected, const Shapes &_value) {
+    ASSERT_EQ(_expected.size(), _value.size());
+    for (std::size_t i = 0; i < _expected.size(); i++)
+        EXPECT_TRUE(isEqual(*_expected[i], *_value[i])) << "element " << i;
+}
+
+// Circles, rectangles and shapes in turn
+static Shapes createShapes(std::size_t _length) {
+    Shapes shapes;
+    for (std::size_t i = 0; i < _length; i++) {
+        if (i % 3 == 0) {
+            std::shared_ptr<Circle> circle = std::make_shared<Circle>();
+            circle->radius_ = double(i) / 4.0;
+            shapes.push_back(circle);
+        } else if (i % 3 == 1) {
+            std::shared_ptr<Rectangle> rectangle = std::make_shared<Rectangle>();
+            rectangle->width_ = int32_t(i);
+            rectangle->height_ = -int32_t(i);
+            rectangle->isFilled_ = (i % 2 == 0);
+            shapes.push_back(rectangle);
+        } else {
+            shapes.push_back(std::make_shared<Shape>());
+        }
+        shapes.back()->id_ = uint32_t(i);
+    }
+    return shapes;
+}
+
+static CommonAPI::SomeIP::Message encode(const Shapes &_shapes, const ShapesDeployment *_depl) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    CommonAPI::Deployable<Shapes, ShapesDeployment> deployedValue(_shapes, _depl);
+    CommonAPI::SomeIP::OutputStream outStream(message, false);
+    outStream << deployedValue;
+    outStream.flush();
+    return message;
+}
+
+template<typename Deployment_>
+static Shapes decode(const CommonAPI::SomeIP::Message &_message, const Deployment_ *_depl, bool &_hasError) {
+    CommonAPI::Deployable<Shapes, Deployment_> deployedValue(_depl);
+    CommonAPI::SomeIP::InputStream inStream(_message, false);
+    inStream >> deployedValue;
+    _hasError = inStream.hasError();
+    return deployedValue.getValue();
+}
+
+// Writes a circle as the runtime does: serial, then the fields
+static void writeCircle(CommonAPI::SomeIP::OutputStream &_output, uint32_t _id, double _radius) {
+    _output << CommonAPI::Serial(Circle::SERIAL) << _id << _radius;
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class PolymorphTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        largestAllocation = 0;
+        isAllocationFailing = false;
+    }
+
+    void TearDown() {
+        isAllocationFailing = false;
+    }
+};
+
+/**
+* @test Arrays encoded by the runtime decode to the same values as through the factory.
+*/
+TEST_F(PolymorphTest, RoundTrip) {
+    // Enough elements for three blocks
+    const Shapes shapes = createShapes(5000);
+    CommonAPI::SomeIP::Message message = encode(shapes, nullptr);
+
+    bool hasError(true);
+    const Shapes factory = decode<ShapesDeployment>(message, nullptr, hasError);
+    EXPECT_FALSE(hasError);
+    expectEqual(shapes, factory);
+
+    const Shapes pooled = decode<PooledShapesDeployment>(message, nullptr, hasError);
+    EXPECT_FALSE(hasError);
+    expectEqual(shapes, pooled);
+
+    // A length field of two bytes
+    const ShapesDeployment depl(nullptr, 0, 100, 2);
+    const PooledShapesDeployment pooledDepl(nullptr, 0, 100, 2);
+    const Shapes fewShapes = createShapes(100);
+    CommonAPI::SomeIP::Message fewMessage = encode(fewShapes, &depl);
+    expectEqual(fewShapes, decode<PooledShapesDeployment>(fewMessage, &pooledDepl, hasError));
+    EXPECT_FALSE(hasError);
+
+    const Shapes empty;
+    CommonAPI::SomeIP::Message emptyMessage = encode(empty, nullptr);
+    EXPECT_TRUE(decode<PooledShapesDeployment>(emptyMessage, nullptr, hasError).empty());
+    EXPECT_FALSE(hasError);
+}
+
+/**
+* @test An unknown serial drops the array, the rest of the array is skipped.
+*/
+TEST_F(PolymorphTest, UnknownSerial) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        // Two circles of 16 bytes and an unknown struct of 8 bytes between them
+        outStream << uint32_t(40);
+        writeCircle(outStream, 1, 1.5);
+        outStream << CommonAPI::Serial(0xdeadbeef) << uint32_t(0);
+        writeCircle(outStream, 2, 2.5);
+        outStream << uint32_t(4711);
+        outStream.flush();
+    }
+
+    CommonAPI::Deployable<Shapes, PooledShapesDeployment> deployedValue(static_cast<PooledShapesDeployment *>(nullptr));
+    deployedValue.getValue() = createShapes(3);
+    CommonAPI::SomeIP::InputStream inStream(message, false);
+    inStream >> deployedValue;
+    EXPECT_FALSE(inStream.hasError());
+    EXPECT_TRUE(deployedValue.getValue().empty());
+
+    uint32_t marker(0);
+    inStream >> marker;
+    EXPECT_FALSE(inStream.hasError());
+    EXPECT_EQ(4711u, marker);
+}
+
+/**
+* @test A length field beyond the message fails without reserving memory for its length.
+*/
+TEST_F(PolymorphTest, HostileLength) {
+    const std::size_t circles = 3000;
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << uint32_t(0xfffffff0);
+        for (std::size_t i = 0; i < circles; i++)
+            writeCircle(outStream, uint32_t(i), 0.5);
+        outStream.flush();
+    }
+
+    bool hasError(false);
+    Shapes value = decode<PooledShapesDeployment>(message, nullptr, hasError);
+    EXPECT_TRUE(hasError);
+    EXPECT_LE(value.size(), circles);
+    // The blocks grow from 1024 elements and at most double the elements read
+    EXPECT_GT(largestAllocation, 0u);
+    EXPECT_LE(largestAllocation, getBlockSize(2 * 1024));
+    value.clear();
+
+    // The maximum length of the deployment bounds the first block as well
+    largestAllocation = 0;
+    const PooledShapesDeployment depl(nullptr, 0, 16, 4);
+    value = decode<PooledShapesDeployment>(message, &depl, hasError);
+    EXPECT_TRUE(hasError);
+    EXPECT_GT(largestAllocation, 0u);
+    EXPECT_LE(largestAllocation, getBlockSize(16));
+}
+
+/**
+* @test An array that ends within an element fails.
+*/
+TEST_F(PolymorphTest, Truncated) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        // The second circle lacks its radius
+        outStream << uint32_t(32);
+        writeCircle(outStream, 1, 1.5);
+        outStream << CommonAPI::Serial(Circle::SERIAL) << uint32_t(2);
+        outStream.flush();
+    }
+
+    bool hasError(false);
+    const Shapes value = decode<PooledShapesDeployment>(message, nullptr, hasError);
+    EXPECT_TRUE(hasError);
+    EXPECT_LE(value.size(), 1u);
+}
+
+/**
+* @test Types outside the table and elements without block are created by the factory of the root.
+*/
+TEST_F(PolymorphTest, Factory) {
+    const Shapes shapes = createShapes(30);
+    CommonAPI::SomeIP::Message message = encode(shapes, nullptr);
+
+    bool hasError(true);
+    Shapes value = decode<PartialShapesDeployment>(message, nullptr, hasError);
+    EXPECT_FALSE(hasError);
+    expectEqual(shapes, value);
+    for (std::size_t i = 0; i < value.size(); i++) {
+        // Pooled elements share the reference count of their block
+        if (value[i]->getSerial() == Rectangle::SERIAL)
+            EXPECT_EQ(1, value[i].use_count()) << "element " << i;
+        else
+            EXPECT_EQ(20, value[i].use_count()) << "element " << i;
+    }
+
+    isAllocationFailing = true;
+    value = decode<PooledShapesDeployment>(message, nullptr, hasError);
+    isAllocationFailing = false;
+    EXPECT_FALSE(hasError);
+    expectEqual(shapes, value);
+    for (std::size_t i = 0; i < value.size(); i++)
+        EXPECT_EQ(1, value[i].use_count()) << "element " << i;
+}
+
+/**
+* @test An element that is kept keeps the other elements of its block until it is released.
+*/
+TEST_F(PolymorphTest, BlockLifetime) {
+    const Shapes shapes = createShapes(10);
+    CommonAPI::SomeIP::Message message = encode(shapes, nullptr);
+
+    bool hasError(true);
+    Shapes value = decode<PooledShapesDeployment>(message, nullptr, hasError);
+    EXPECT_FALSE(hasError);
+    ASSERT_EQ(10u, value.size());
+
+    std::shared_ptr<Shape> kept = value[3];
+    const std::size_t destroyed = Shape::destroyed_;
+    value.clear();
+    EXPECT_EQ(destroyed, Shape::destroyed_);
+    EXPECT_TRUE(isEqual(*shapes[3], *kept));
+
+    kept.reset();
+    EXPECT_EQ(destroyed + 10, Shape::destroyed_);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPSerializedSizeBenchmark
+*
+* Benchmark of the generated <Type>SerializedSize functions: a map argument is
+* serialized either into a growing output buffer or into a buffer that was
+* reserved with the generated size upfront. Reports the number of heap
+* allocations and the time per serialization as well as the cost of the
+* size computation itself.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceSomeIPSerializedSize.hpp"
+
+static std::atomic<std::size_t> allocations(0);
+
+void *operator new(std::size_t _size) {
+    allocations++;
+    void *p = std::malloc(_size ? _size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *_p) noexcept {
+    std::free(_p);
+}
+
+void operator delete(void *_p, std::size_t) noexcept {
+    std::free(_p);
+}
+
+typedef v1_0::commonapi::someip::deploymenttest::TestInterface::tMapString StringMap;
+typedef CommonAPI::SomeIP::MapDeployment<CommonAPI::EmptyDeployment, CommonAPI::SomeIP::StringDeployment> MapDeployment;
+
+// default deployment of tMapString
+static const CommonAPI::SomeIP::StringDeployment stringDeployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF8);
+static const MapDeployment mapDeployment(nullptr, &stringDeployment, 0, 0, 4);
+
+template<bool _reserve>
+static void runBenchmark(const StringMap &_map, std::size_t _iterations) {
+    std::size_t bodyLength(0);
+    std::size_t before = allocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; i++) {
+        CommonAPI::SomeIP::Message message = CommonAPI::SomeIP::Message::createMethodCall(
+            CommonAPI::SomeIP::Address(0, 0, 0, 0), 515, false);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        if (_reserve) {
+            outStream.reserveMemory(
+                v1_0::commonapi::someip::deploymenttest::TestInterface_::tMapStringSerializedSize(_map));
+        }
+        outStream.writeValue(_map, &mapDeployment);
+        outStream.flush();
+        if (outStream.hasError()) {
+            std::cerr << "serialization failed" << std::endl;
+            std::exit(1);
+        }
+        bodyLength = message.getBodyLength();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "," << double(allocations - before) / double(_iterations)
+              << "," << elapsed.count() / double(_iterations);
+    if (bodyLength != v1_0::commonapi::someip::deploymenttest::TestInterface_::tMapStringSerializedSize(_map)) {
+        std::cerr << "serialized size " << bodyLength << " does not match computed size" << std::endl;
+        std::exit(1);
+    }
+}
+
+static double runSizeBenchmark(const StringMap &_map, std::size_t _iterations) {
+    std::size_t checksum(0);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; i++) {
+        checksum += v1_0::commonapi::someip::deploymenttest::TestInterface_::tMapStringSerializedSize(_map);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    if (checksum == 0) {
+        std::cerr << "empty payload" << std::endl;
+    }
+    return elapsed.count() / double(_iterations);
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200);
+
+    std::cout << "entries,bytes,grow_allocs,grow_us,reserve_allocs,reserve_us,size_us" << std::endl;
+    for (uint32_t entries = 16; entries <= 65536; entries *= 4) {
+        StringMap map;
+        for (uint32_t i = 0; i < entries; i++) {
+            map[i] = "commonapi.someip.deploymenttest.value_" + std::to_string(i);
+        }
+        std::cout << entries << ","
+                  << v1_0::commonapi::someip::deploymenttest::TestInterface_::tMapStringSerializedSize(map);
+        runBenchmark<false>(map, iterations);
+        runBenchmark<true>(map, iterations);
+        std::cout << "," << runSizeBenchmark(map, iterations) << std::endl;
+    }
+    return 0;
+}
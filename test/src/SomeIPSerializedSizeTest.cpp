@@ -0,0 +1,185 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPSerializedSizeTest
+*/
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Deployment.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPDeployment.hpp"
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPSerializedSize.hpp"
+
+namespace sizes = v1_0::commonapi::someip::deploymenttest::@TYPE_COLLECTION_BASE_NAME@_;
+namespace types = v1_0::commonapi::someip::deploymenttest;
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class SerializedSizeTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+
+    // Serializes the value with the given deployment and returns the length of the payload
+    template<typename Type_, typename Deployment_>
+    std::size_t getEncodedLength(const Type_ &_value, const Deployment_ *_depl) {
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            CommonAPI::Deployable<Type_, Deployment_> deployedValue(_value, _depl);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream << deployedValue;
+            EXPECT_FALSE(outStream.hasError());
+            outStream.flush();
+        }
+        return message.getBodyLength();
+    }
+
+    types::@TYPE_COLLECTION_BASE_NAME@::tStruct_field_depls createStructFieldDepls(
+            const types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field &_unionMember) {
+        types::@TYPE_COLLECTION_BASE_NAME@::tStruct_field_depls value;
+
+        types::@TYPE_COLLECTION_BASE_NAME@::tStruct_field structMember;
+        std::vector<uint8_t> a(8);
+        std::iota(std::begin(a), std::end(a), 0);
+        structMember.setUint8Member(a);
+        value.setStructMember(structMember);
+
+        value.setEnumMember(types::@TYPE_COLLECTION_BASE_NAME@::tEnum::V2);
+        value.setIntMember(0x0FFF);
+        value.setUnionMember(_unionMember);
+
+        std::vector<int8_t> arrayMember(8);
+        std::iota(std::begin(arrayMember), std::end(arrayMember), 0);
+        value.setArrayMember(arrayMember);
+        return value;
+    }
+};
+
+/**
+* @test The size of a struct with element overwrites equals its encoded length.
+*/
+TEST_F(SerializedSizeTest, StructFieldDeployments) {
+    for (auto unionMember : { types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(uint8_t(7)),
+                              types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(int16_t(-7)),
+                              types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(std::string("str")) }) {
+        types::@TYPE_COLLECTION_BASE_NAME@::tStruct_field_depls value = createStructFieldDepls(unionMember);
+
+        std::size_t length = getEncodedLength(value, &sizes::tStruct_field_deplsDeployment);
+        EXPECT_EQ(length, sizes::tStruct_field_deplsSerializedSize(value));
+        EXPECT_EQ(length, sizes::tStruct_field_deplsSerializedSize(value, &sizes::tStruct_field_deplsDeployment));
+    }
+}
+
+/**
+* @test The size of every union alternative equals its encoded length.
+*/
+TEST_F(SerializedSizeTest, Union) {
+    typedef sizes::tUnion_fieldDeployment_t UnionDeployment;
+    for (auto value : { types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(uint8_t(7)),
+                        types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(int16_t(-7)),
+                        types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(std::string("")),
+                        types::@TYPE_COLLECTION_BASE_NAME@::tUnion_field(std::string("a longer string")) }) {
+        std::size_t length = getEncodedLength(value, static_cast<const UnionDeployment *>(nullptr));
+        EXPECT_EQ(length, sizes::tUnion_fieldSerializedSize(value));
+        EXPECT_EQ(length, sizes::tUnion_fieldSerializedSize(value, static_cast<const UnionDeployment *>(nullptr)));
+    }
+}
+
+/**
+* @test The size of an enumeration equals its encoded length with and without deployment.
+*/
+TEST_F(SerializedSizeTest, Enumeration) {
+    types::@TYPE_COLLECTION_BASE_NAME@::tEnum value(types::@TYPE_COLLECTION_BASE_NAME@::tEnum::V3);
+    std::size_t length = getEncodedLength(value, static_cast<const sizes::tEnumDeployment_t *>(nullptr));
+    EXPECT_EQ(length, sizes::tEnumSerializedSize(value));
+    EXPECT_EQ(length, sizes::tEnumSerializedSize(value, static_cast<const sizes::tEnumDeployment_t *>(nullptr)));
+
+    types::@TYPE_COLLECTION_BASE_NAME@::tEnum4_16 deployed(types::@TYPE_COLLECTION_BASE_NAME@::tEnum4_16::V4);
+    length = getEncodedLength(deployed, &sizes::tEnum4_16Deployment);
+    EXPECT_EQ(length, sizes::tEnum4_16SerializedSize(deployed));
+    EXPECT_EQ(length, sizes::tEnum4_16SerializedSize(deployed, &sizes::tEnum4_16Deployment));
+}
+
+/**
+* @test The size of arrays, structs with length field and maps equals their encoded length.
+*/
+TEST_F(SerializedSizeTest, Containers) {
+    for (std::size_t count : { 5, 17, 200 }) {
+        types::@TYPE_COLLECTION_BASE_NAME@::i8Array array(count);
+        std::iota(std::begin(array), std::end(array), 0);
+        std::size_t length = getEncodedLength(array, &sizes::i8ArrayDeployment);
+        EXPECT_EQ(length, sizes::i8ArraySerializedSize(array));
+        EXPECT_EQ(length, sizes::i8ArraySerializedSize(array, &sizes::i8ArrayDeployment));
+
+        types::@TYPE_COLLECTION_BASE_NAME@::tStruct_w1 structure;
+        structure.setBooleanMember(true);
+        structure.setArrayMember(types::@TYPE_COLLECTION_BASE_NAME@::i8BigArray(array.begin(), array.end()));
+        length = getEncodedLength(structure, &sizes::tStruct_w1Deployment);
+        EXPECT_EQ(length, sizes::tStruct_w1SerializedSize(structure));
+        EXPECT_EQ(length, sizes::tStruct_w1SerializedSize(structure, &sizes::tStruct_w1Deployment));
+    }
+
+    // default deployment of tMapString
+    const CommonAPI::SomeIP::StringDeployment stringDeployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF8);
+    const sizes::tMapStringDeployment_t mapDeployment(nullptr, &stringDeployment, 0, 0, 4);
+    types::@TYPE_COLLECTION_BASE_NAME@::tMapString map;
+    for (uint32_t key = 0; key < 10; key++) {
+        map[key] = std::string(key * 3, 'x');
+    }
+    std::size_t length = getEncodedLength(map, &mapDeployment);
+    EXPECT_EQ(length, sizes::tMapStringSerializedSize(map));
+    EXPECT_EQ(length, sizes::tMapStringSerializedSize(map, &mapDeployment));
+}
+
+/**
+* @test The size of a packed array equals its encoded length.
+*/
+TEST_F(SerializedSizeTest, PackedArray) {
+    for (std::size_t count : { 0, 1, 2, 3, 101 }) {
+        types::@TYPE_COLLECTION_BASE_NAME@::u16b12Array array(count, 0x0ABC);
+        std::size_t length = getEncodedLength(array, &sizes::u16b12ArrayDeployment);
+        EXPECT_EQ(length, sizes::u16b12ArraySerializedSize(array)) << "count " << count;
+        EXPECT_EQ(length, sizes::u16b12ArraySerializedSize(array, &sizes::u16b12ArrayDeployment)) << "count " << count;
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
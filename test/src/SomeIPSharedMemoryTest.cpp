@@ -0,0 +1,483 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPSharedMemoryTest
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPSharedMemory.hpp"
+
+namespace SharedMemory = CommonAPI::SomeIP::SharedMemory;
+
+typedef std::vector<uint8_t> Bytes;
+
+typedef SharedMemory::Deployment<CommonAPI::SomeIP::ByteBufferDeployment, 1024> SharedByteBufferDeployment;
+typedef SharedMemory::Deployment<CommonAPI::SomeIP::StringDeployment, 1024> SharedStringDeployment;
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static Bytes createValue(std::size_t _size, uint8_t _seed) {
+    Bytes value(_size);
+    for (std::size_t i = 0; i < _size; i++) {
+        value[i] = uint8_t(i * 31 + _seed);
+    }
+    return value;
+}
+
+static std::string getName(const Bytes &_frame) {
+    return std::string(_frame.begin() + SharedMemory::HANDLE_SIZE, _frame.end());
+}
+
+// References that the readers of a handle have not released yet
+static uint32_t getReferences(const Bytes &_frame) {
+    int fd = shm_open((getName(_frame) + SharedMemory::COUNTERS_SUFFIX).c_str(), O_RDWR, 0);
+    EXPECT_LE(0, fd);
+    if (fd < 0) {
+        return 0;
+    }
+    void *data = mmap(nullptr, SharedMemory::SEGMENT_HEADER_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    EXPECT_NE(MAP_FAILED, data);
+    if (data == MAP_FAILED) {
+        return 0;
+    }
+    const uint32_t references = static_cast<SharedMemory::SegmentHeader *>(data)->references_.load();
+    munmap(data, SharedMemory::SEGMENT_HEADER_SIZE);
+    return references;
+}
+
+static mode_t getMode(const std::string &_name) {
+    int fd = shm_open(_name.c_str(), O_RDONLY, 0);
+    EXPECT_LE(0, fd);
+    struct stat status;
+    status.st_mode = 0;
+    if (fd >= 0) {
+        EXPECT_EQ(0, fstat(fd, &status));
+        close(fd);
+    }
+    return status.st_mode & 0777;
+}
+
+// Permissions of the mappings of this process that contain the name
+static std::vector<std::string> getMappings(const std::string &_name) {
+    std::vector<std::string> permissions;
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        if (line.size() > _name.size() && line.compare(line.size() - _name.size(), _name.size(), _name) == 0) {
+            permissions.push_back(line.substr(line.find(' ') + 1, 4));
+        }
+    }
+    return permissions;
+}
+
+static CommonAPI::SomeIP::sec_client_t createClient(vsomeip_client_type_e _type) {
+    CommonAPI::SomeIP::sec_client_t client;
+    client.client_type = _type;
+    return client;
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class SharedMemoryTest: public ::testing::Test {
+protected:
+    void SetUp() {
+        SharedMemory::Writer::get().setLimits(16);
+    }
+
+    void TearDown() {
+        SharedMemory::Writer::get().setLimits(16);
+        SharedMemory::Writer::get().setMode(0600);
+    }
+};
+
+/**
+* @test Large values for local receivers are sent as handle and read back from shared memory, small values inline.
+*/
+TEST_F(SharedMemoryTest, StreamRoundTrip) {
+    const Bytes small = createValue(1023, 1);
+    const Bytes large = createValue(8 << 20, 2);
+    const std::string text(5000, 't');
+
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedSmall(small, nullptr);
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedLarge(large, nullptr);
+        CommonAPI::Deployable<std::string, SharedStringDeployment> deployedText(text, nullptr);
+        SharedMemory::Destination destination(1);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedSmall << deployedLarge << deployedText;
+        EXPECT_FALSE(outStream.hasError());
+        outStream.flush();
+        EXPECT_EQ(2u, destination.getFrames().size());
+    }
+    // The small value and two handles
+    EXPECT_GT(message.getBodyLength(), small.size());
+    EXPECT_LT(message.getBodyLength(), small.size() + 200);
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedSmall(static_cast<SharedByteBufferDeployment *>(nullptr));
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedLarge(static_cast<SharedByteBufferDeployment *>(nullptr));
+        CommonAPI::Deployable<std::string, SharedStringDeployment> deployedText(static_cast<SharedStringDeployment *>(nullptr));
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> deployedSmall >> deployedLarge >> deployedText;
+        EXPECT_FALSE(inStream.hasError());
+        EXPECT_EQ(small, deployedSmall.getValue());
+        EXPECT_EQ(large, deployedLarge.getValue());
+        EXPECT_EQ(text, deployedText.getValue());
+    }
+}
+
+/**
+* @test Without local receivers all values are sent inline.
+*/
+TEST_F(SharedMemoryTest, StreamInline) {
+    const Bytes large = createValue(100000, 7);
+
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedLarge(large, nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedLarge;
+        outStream.flush();
+    }
+    {
+        // A remote subscriber, no readers
+        SharedMemory::Destination destination(0);
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedLarge(large, nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedLarge;
+        outStream.flush();
+        EXPECT_TRUE(destination.getFrames().empty());
+    }
+    EXPECT_GT(message.getBodyLength(), 2 * large.size());
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> first(static_cast<SharedByteBufferDeployment *>(nullptr));
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> second(static_cast<SharedByteBufferDeployment *>(nullptr));
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> first >> second;
+        EXPECT_FALSE(inStream.hasError());
+        EXPECT_EQ(large, first.getValue());
+        EXPECT_EQ(large, second.getValue());
+    }
+}
+
+/**
+* @test A segment is reused once all readers released the value; all segments in use means inline.
+*/
+TEST_F(SharedMemoryTest, ReadersKeepSegments) {
+    SharedMemory::Writer &writer = SharedMemory::Writer::get();
+    const Bytes first = createValue(100000, 3);
+    const Bytes second = createValue(200000, 4);
+    Bytes secondFrame, value;
+
+    std::vector<Bytes> frames;
+    for (std::size_t i = 0; i < 16; i++) {
+        Bytes frame;
+        ASSERT_TRUE(writer.publish(first.data(), first.size(), 2, frame));
+        EXPECT_EQ(2u, getReferences(frame));
+        frames.push_back(frame);
+    }
+    EXPECT_FALSE(writer.publish(second.data(), second.size(), 1, secondFrame));
+
+    // A process releases its reference once, however often it reads the value
+    for (const auto &itsFrame : frames) {
+        ASSERT_TRUE(SharedMemory::Reader::get().read(itsFrame, value));
+        ASSERT_TRUE(SharedMemory::Reader::get().read(itsFrame, value));
+        EXPECT_EQ(first, value);
+        EXPECT_EQ(1u, getReferences(itsFrame));
+    }
+    EXPECT_FALSE(writer.publish(second.data(), second.size(), 1, secondFrame));
+
+    // The second reader of the sixth value
+    writer.retain(frames[5]);
+    writer.release(frames[5]);
+    writer.release(frames[5]);
+    EXPECT_EQ(0u, getReferences(frames[5]));
+    ASSERT_TRUE(writer.publish(second.data(), second.size(), 1, secondFrame));
+    EXPECT_EQ(getName(frames[5]), getName(secondFrame));
+    ASSERT_TRUE(SharedMemory::Reader::get().read(secondFrame, value));
+    EXPECT_EQ(second, value);
+    EXPECT_EQ(0u, getReferences(secondFrame));
+
+    // Releases of an old value do not touch the new one
+    writer.release(frames[5]);
+    EXPECT_FALSE(writer.retain(frames[5]));
+
+    for (std::size_t i = 0; i < frames.size(); i++) {
+        if (i != 5) {
+            writer.release(frames[i]);
+            EXPECT_EQ(0u, getReferences(frames[i]));
+        }
+    }
+}
+
+/**
+* @test The reader maps segments read only, the segments have the configured mode.
+*/
+TEST_F(SharedMemoryTest, Permissions) {
+    SharedMemory::Writer &writer = SharedMemory::Writer::get();
+    const Bytes value = createValue(5000, 5);
+    Bytes frame, readValue;
+
+    ASSERT_TRUE(writer.publish(value.data(), value.size(), 1, frame));
+    EXPECT_EQ(0600u, getMode(getName(frame)));
+    EXPECT_EQ(0600u, getMode(getName(frame) + SharedMemory::COUNTERS_SUFFIX));
+    ASSERT_TRUE(SharedMemory::Reader::get().read(frame, readValue));
+
+    // The writer maps the segment writable, the reader read only
+    const std::vector<std::string> mappings = getMappings(getName(frame));
+    ASSERT_EQ(2u, mappings.size());
+    EXPECT_EQ(1, std::count(mappings.begin(), mappings.end(), "rw-s"));
+    EXPECT_EQ(1, std::count(mappings.begin(), mappings.end(), "r--s"));
+
+    // A new segment, all others are in use
+    std::vector<Bytes> frames;
+    while (writer.publish(value.data(), value.size(), 1, frame)) {
+        frames.push_back(frame);
+        ASSERT_GE(16u, frames.size());
+    }
+    writer.setMode(0640);
+    writer.setLimits(17);
+    ASSERT_TRUE(writer.publish(value.data(), value.size(), 1, frame));
+    EXPECT_EQ(0640u, getMode(getName(frame)));
+    frames.push_back(frame);
+    for (const auto &itsFrame : frames) {
+        writer.release(itsFrame);
+    }
+}
+
+/**
+* @test The last value of a field keeps its segment until the next value is sent.
+*/
+TEST_F(SharedMemoryTest, Field) {
+    const Bytes value = createValue(5000, 8);
+    Bytes frame, readValue;
+    CommonAPI::SomeIP::Message message = createMessage();
+    SharedMemory::Field field;
+    EXPECT_FALSE(field.isShared());
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedValue(value, nullptr);
+        // One local subscriber and the field
+        SharedMemory::Destination destination(2);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedValue;
+        outStream.flush();
+        ASSERT_EQ(1u, destination.getFrames().size());
+        frame = destination.getFrames().front();
+        field.update(destination.getFrames());
+    }
+    ASSERT_TRUE(field.isShared());
+    EXPECT_EQ(2u, getReferences(frame));
+    ASSERT_TRUE(SharedMemory::Reader::get().read(frame, readValue));
+    EXPECT_EQ(1u, getReferences(frame));
+
+    // A new subscriber gets the value from the middleware
+    field.retain();
+    EXPECT_EQ(2u, getReferences(frame));
+    SharedMemory::Writer::get().release(frame);
+
+    std::vector<Bytes> none;
+    field.update(none);
+    EXPECT_FALSE(field.isShared());
+    EXPECT_EQ(0u, getReferences(frame));
+}
+
+/**
+* @test Events have readers only if all subscribers of their event groups are local.
+*/
+TEST_F(SharedMemoryTest, Subscribers) {
+    SharedMemory::Subscribers subscribers;
+    const CommonAPI::SomeIP::sec_client_t local = createClient(VSOMEIP_CLIENT_UDS);
+    const CommonAPI::SomeIP::sec_client_t remote = createClient(VSOMEIP_CLIENT_TCP);
+    EXPECT_EQ(0u, subscribers.getReaders({ 1 }));
+
+    EXPECT_TRUE(subscribers.update(1, 0x10, &local, true));
+    EXPECT_TRUE(subscribers.update(2, 0x10, &local, true));
+    EXPECT_TRUE(subscribers.update(2, 0x11, &local, true));
+    EXPECT_EQ(1u, subscribers.getReaders({ 1 }));
+    EXPECT_EQ(2u, subscribers.getReaders({ 1, 2 }));
+
+    EXPECT_FALSE(subscribers.update(2, 0x20, &remote, true));
+    EXPECT_FALSE(subscribers.update(2, 0x21, nullptr, true));
+    EXPECT_EQ(1u, subscribers.getReaders({ 1 }));
+    EXPECT_EQ(0u, subscribers.getReaders({ 1, 2 }));
+
+    subscribers.update(2, 0x20, &remote, false);
+    subscribers.update(2, 0x21, nullptr, false);
+    subscribers.update(2, 0x11, &local, false);
+    EXPECT_EQ(1u, subscribers.getReaders({ 1, 2 }));
+}
+
+/**
+* @test Handles of other processes are read by all local readers, each in its own process.
+*/
+TEST_F(SharedMemoryTest, CrossProcess) {
+    SharedMemory::Writer &writer = SharedMemory::Writer::get();
+    const std::size_t readers = 3;
+    const std::size_t values = 5;
+
+    std::vector<int> pipes;
+    std::vector<pid_t> children;
+    for (std::size_t i = 0; i < readers; i++) {
+        int fds[2];
+        ASSERT_EQ(0, pipe(fds));
+        pid_t child = fork();
+        ASSERT_LE(0, child);
+        if (child == 0) {
+            // The reader: gets handles through the pipe and compares the values
+            close(fds[1]);
+            int result(0);
+            for (std::size_t j = 0; j < values; j++) {
+                uint32_t size(0);
+                Bytes frame;
+                if (read(fds[0], &size, sizeof(size)) != sizeof(size)) {
+                    _exit(10);
+                }
+                frame.resize(size);
+                std::size_t done(0);
+                while (done < size) {
+                    ssize_t received = read(fds[0], &frame[done], size - done);
+                    if (received <= 0) {
+                        _exit(11);
+                    }
+                    done += std::size_t(received);
+                }
+                Bytes value;
+                if (!SharedMemory::Reader::get().read(frame, value)) {
+                    result = 1;
+                } else if (value != createValue((j + 1) << 20, uint8_t(j))) {
+                    result = 2;
+                }
+            }
+            _exit(result);
+        }
+        close(fds[0]);
+        pipes.push_back(fds[1]);
+        children.push_back(child);
+    }
+
+    std::vector<Bytes> frames;
+    for (std::size_t j = 0; j < values; j++) {
+        const Bytes value = createValue((j + 1) << 20, uint8_t(j));
+        Bytes frame;
+        ASSERT_TRUE(writer.publish(value.data(), value.size(), uint32_t(readers), frame));
+        EXPECT_LT(frame.size(), 100u);
+        frames.push_back(frame);
+        const uint32_t size = uint32_t(frame.size());
+        for (int fd : pipes) {
+            ASSERT_EQ(ssize_t(sizeof(size)), write(fd, &size, sizeof(size)));
+            ASSERT_EQ(ssize_t(size), write(fd, frame.data(), size));
+        }
+    }
+    for (std::size_t i = 0; i < readers; i++) {
+        close(pipes[i]);
+        int status(0);
+        ASSERT_EQ(children[i], waitpid(children[i], &status, 0));
+        ASSERT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(0, WEXITSTATUS(status)) << "reader " << i;
+    }
+    for (const auto &itsFrame : frames) {
+        EXPECT_EQ(0u, getReferences(itsFrame));
+    }
+}
+
+/**
+* @test Damaged and foreign handles are rejected.
+*/
+TEST_F(SharedMemoryTest, InvalidHandles) {
+    const Bytes value = createValue(4096, 6);
+    Bytes frame, readValue;
+    ASSERT_TRUE(SharedMemory::Writer::get().publish(value.data(), value.size(), 1, frame));
+
+    EXPECT_FALSE(SharedMemory::Reader::get().read(Bytes(), readValue));
+    EXPECT_FALSE(SharedMemory::Reader::get().read(Bytes(frame.begin(), frame.begin() + SharedMemory::HANDLE_SIZE), readValue));
+
+    Bytes damaged(frame);
+    damaged[5] ^= 0x55;
+    EXPECT_FALSE(SharedMemory::Reader::get().read(damaged, readValue));
+
+    // Larger than the segment
+    damaged = frame;
+    damaged[4] = 0x7F;
+    EXPECT_FALSE(SharedMemory::Reader::get().read(damaged, readValue));
+
+    for (const std::string &itsName : { std::string("/other"), std::string("/commonapi-someip-x/y"),
+                                        std::string(SharedMemory::NAME_PREFIX) + "missing" }) {
+        damaged.assign(frame.begin(), frame.begin() + SharedMemory::HANDLE_SIZE);
+        damaged.insert(damaged.end(), itsName.begin(), itsName.end());
+        EXPECT_FALSE(SharedMemory::Reader::get().read(damaged, readValue)) << itsName;
+    }
+
+    EXPECT_TRUE(SharedMemory::Reader::get().read(frame, readValue));
+    EXPECT_EQ(value, readValue);
+}
+
+/**
+* @test A handle that cannot be read gives an empty value, the following elements are read.
+*/
+TEST_F(SharedMemoryTest, StreamLostValue) {
+    CommonAPI::SomeIP::Message message = createMessage();
+    {
+        Bytes frame{ SharedMemory::MODE_SHARED, 0, 16, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0 };
+        const std::string name = std::string(SharedMemory::NAME_PREFIX) + "missing";
+        frame.insert(frame.end(), name.begin(), name.end());
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, CommonAPI::SomeIP::ByteBufferDeployment> deployedFrame(frame, nullptr);
+        CommonAPI::Deployable<uint32_t, CommonAPI::EmptyDeployment> deployedValue(4711, nullptr);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedFrame << deployedValue;
+        outStream.flush();
+    }
+    {
+        CommonAPI::Deployable<CommonAPI::ByteBuffer, SharedByteBufferDeployment> deployedBuffer(static_cast<SharedByteBufferDeployment *>(nullptr));
+        CommonAPI::Deployable<uint32_t, CommonAPI::EmptyDeployment> deployedValue(static_cast<CommonAPI::EmptyDeployment *>(nullptr));
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> deployedBuffer >> deployedValue;
+        EXPECT_FALSE(inStream.hasError());
+        EXPECT_TRUE(deployedBuffer.getValue().empty());
+        EXPECT_EQ(4711u, deployedValue.getValue());
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPStringTranscodeBenchmark
+*
+* Throughput benchmark of UTF-16 deployed strings from 16 B to 1 MB of UTF-8
+* input. Measures the UTF-16 counting kernel of SomeIPUtf16.hpp (SSE2/AVX2
+* selected at runtime) against its scalar reference, and writing and reading an
+* UTF-16LE string with the transcoding of the runtime and with the generated
+* transcoding of SomeIPUtf16.hpp.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceSomeIPSerializedSize.hpp"
+#include "SomeIPUtf16.hpp"
+
+namespace sizes = v1_0::commonapi::someip::deploymenttest::TestInterface_;
+
+static const CommonAPI::SomeIP::StringDeployment utf16Deployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF16LE);
+typedef CommonAPI::SomeIP::Utf16::Deployment<CommonAPI::SomeIP::StringDeployment> Utf16StringDeployment;
+static const Utf16StringDeployment generatedDeployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF16LE);
+
+static std::size_t scalarUtf16Units(const std::string &_value) {
+    std::size_t units(0);
+    for (std::string::const_iterator it = _value.begin(); it != _value.end(); ++it) {
+        const unsigned char c = static_cast<unsigned char>(*it);
+        if ((c & 0xC0) != 0x80)
+            units += (c >= 0xF0 ? 2 : 1);
+    }
+    return units;
+}
+
+// ASCII text mixed with two, three and four byte sequences
+static std::string createText(std::size_t _size) {
+    static const char *pattern[] = { "commonapi.", "\xc3\xa4", "someip", "\xe2\x82\xac", "\xf0\x9f\x9a\x97" };
+    std::string text;
+    for (std::size_t i = 0; text.size() < _size; i++) {
+        const std::string next(pattern[i % 5]);
+        if (text.size() + next.size() > _size) {
+            text.append(_size - text.size(), 'x');
+        } else {
+            text += next;
+        }
+    }
+    return text;
+}
+
+template<typename _Function>
+static double measure(std::size_t _bytes, std::size_t _iterations, _Function _function) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; i++) {
+        _function();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return double(_bytes * _iterations) / elapsed.count() / (1024.0 * 1024.0);
+}
+
+int main(int argc, char** argv) {
+    std::size_t volume = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64) * 1024 * 1024;
+
+    std::cout << "bytes,scalar_size_mb_s,vector_size_mb_s,runtime_write_mb_s,runtime_read_mb_s,"
+              << "generated_write_mb_s,generated_read_mb_s" << std::endl;
+    for (std::size_t bytes = 16; bytes <= 1024 * 1024; bytes *= 4) {
+        const std::string text = createText(bytes);
+        const std::size_t iterations = volume / bytes + 1;
+        volatile std::size_t sink(0);
+
+        if (scalarUtf16Units(text) != CommonAPI::SomeIP::Utf16::countUnits(text.data(), text.size())) {
+            std::cerr << "UTF-16 sizing mismatch at " << bytes << " bytes" << std::endl;
+            return 1;
+        }
+
+        double scalar = measure(bytes, iterations, [&]() { sink = sink + scalarUtf16Units(text); });
+        double vector = measure(bytes, iterations, [&]() {
+            sink = sink + CommonAPI::SomeIP::Utf16::countUnits(text.data(), text.size());
+        });
+
+        CommonAPI::SomeIP::Message message;
+        double write = measure(bytes, iterations, [&]() {
+            message = CommonAPI::SomeIP::Message::createMethodCall(
+                CommonAPI::SomeIP::Address(0, 0, 0, 0), 515, false);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream.writeValue(text, &utf16Deployment);
+            outStream.flush();
+        });
+        if (message.getBodyLength() != sizes::serializedStringSize(text, 4, 0, true)) {
+            std::cerr << "UTF-16 serialized size mismatch at " << bytes << " bytes" << std::endl;
+            return 1;
+        }
+
+        std::string result;
+        double read = measure(bytes, iterations, [&]() {
+            CommonAPI::SomeIP::InputStream inStream(message, false);
+            inStream.readValue(result, &utf16Deployment);
+        });
+        if (result != text) {
+            std::cerr << "UTF-16 round trip failed at " << bytes << " bytes" << std::endl;
+            return 1;
+        }
+
+        CommonAPI::SomeIP::Message generatedMessage;
+        double generatedWrite = measure(bytes, iterations, [&]() {
+            generatedMessage = CommonAPI::SomeIP::Message::createMethodCall(
+                CommonAPI::SomeIP::Address(0, 0, 0, 0), 515, false);
+            CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedText(text, &generatedDeployment);
+            CommonAPI::SomeIP::OutputStream outStream(generatedMessage, false);
+            outStream << deployedText;
+            outStream.flush();
+        });
+        if (generatedMessage.getBodyLength() != message.getBodyLength()
+                || !std::equal(message.getBodyData(), message.getBodyData() + message.getBodyLength(),
+                               generatedMessage.getBodyData())) {
+            std::cerr << "UTF-16 generated encoding differs from the runtime at " << bytes << " bytes" << std::endl;
+            return 1;
+        }
+
+        CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedResult(&generatedDeployment);
+        double generatedRead = measure(bytes, iterations, [&]() {
+            CommonAPI::SomeIP::InputStream inStream(generatedMessage, false);
+            inStream >> deployedResult;
+        });
+        if (deployedResult.getValue() != text) {
+            std::cerr << "UTF-16 generated round trip failed at " << bytes << " bytes" << std::endl;
+            return 1;
+        }
+
+        std::cout << bytes << "," << scalar << "," << vector << "," << write << "," << read << ","
+                  << generatedWrite << "," << generatedRead << std::endl;
+    }
+    return 0;
+}
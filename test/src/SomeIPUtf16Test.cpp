@@ -0,0 +1,235 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPUtf16Test
+*/
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "SomeIPUtf16.hpp"
+
+namespace Utf16 = CommonAPI::SomeIP::Utf16;
+
+typedef std::vector<uint8_t> Bytes;
+typedef Utf16::Deployment<CommonAPI::SomeIP::StringDeployment> Utf16StringDeployment;
+
+static CommonAPI::SomeIP::Message createMessage() {
+    return CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 0x8001, false);
+}
+
+static Bytes getBody(CommonAPI::SomeIP::Message &_message) {
+    return Bytes(_message.getBodyData(), _message.getBodyData() + _message.getBodyLength());
+}
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class Utf16Test: public ::testing::Test {
+protected:
+    void SetUp() {
+        random_.seed(4711);
+    }
+
+    void TearDown() {
+    }
+
+    // ASCII runs of random length mixed with two, three and four byte sequences
+    std::string createText(std::size_t _size) {
+        static const char *sequences[] = { "\xc3\xa4", "\xe2\x82\xac", "\xef\xbf\xbd", "\xf0\x9f\x9a\x97", "\xf4\x8f\xbf\xbf" };
+        std::string text;
+        while (text.size() < _size) {
+            text.append(random_() % 40, char('a' + random_() % 26));
+            text += sequences[random_() % 5];
+        }
+        return text;
+    }
+
+    // Bytes the runtime writes for the string
+    Bytes writeRuntime(const std::string &_value, const CommonAPI::SomeIP::StringDeployment &_depl) {
+        CommonAPI::SomeIP::Message message = createMessage();
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream.writeValue(_value, &_depl);
+        EXPECT_FALSE(outStream.hasError());
+        outStream.flush();
+        return getBody(message);
+    }
+
+    Bytes writeDeployed(const std::string &_value, const Utf16StringDeployment &_depl) {
+        CommonAPI::SomeIP::Message message = createMessage();
+        CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedValue(_value, &_depl);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedValue;
+        EXPECT_FALSE(outStream.hasError());
+        outStream.flush();
+        return getBody(message);
+    }
+
+    std::mt19937 random_;
+};
+
+/**
+* @test The scalar and vector kernels give the same result for all sizes and byte orders.
+*/
+TEST_F(Utf16Test, KernelsMatchScalar) {
+    for (std::size_t size = 0; size < 300; size += 7) {
+        const std::string text = createText(size);
+        const std::string ascii(size, 'x');
+        for (bool isBigEndian : { false, true }) {
+            for (const std::string &itsValue : { text, ascii }) {
+                Bytes vector, scalar;
+                ASSERT_TRUE(Utf16::encode<Utf16::widenAscii>(itsValue, isBigEndian, vector));
+                ASSERT_TRUE(Utf16::encode<Utf16::widenAsciiScalar>(itsValue, isBigEndian, scalar));
+                EXPECT_EQ(scalar, vector);
+
+                std::string decoded, decodedScalar;
+                ASSERT_TRUE(Utf16::decode<Utf16::narrowAscii>(vector, isBigEndian, decoded));
+                ASSERT_TRUE(Utf16::decode<Utf16::narrowAsciiScalar>(vector, isBigEndian, decodedScalar));
+                EXPECT_EQ(itsValue, decoded);
+                EXPECT_EQ(itsValue, decodedScalar);
+            }
+        }
+    }
+}
+
+/**
+* @test The runtime selected counting kernel gives the number of code units of the encoder.
+*/
+TEST_F(Utf16Test, CountUnits) {
+    for (std::size_t size = 0; size < 300; size += 7) {
+        for (const std::string &itsValue : { createText(size), std::string(size, 'x') }) {
+            Bytes encoded;
+            ASSERT_TRUE(Utf16::encode<Utf16::widenAsciiScalar>(itsValue, false, encoded));
+            const std::size_t itsUnits = (encoded.size() - Utf16::BOM_SIZE - Utf16::TERMINATOR_SIZE) / 2;
+            EXPECT_EQ(itsUnits, Utf16::countUnitsScalar(reinterpret_cast<const uint8_t *>(itsValue.data()), itsValue.size()));
+            EXPECT_EQ(itsUnits, Utf16::countUnits(itsValue.data(), itsValue.size()));
+        }
+    }
+}
+
+/**
+* @test Deployed strings are written with the bytes of the runtime and read back.
+*/
+TEST_F(Utf16Test, StreamMatchesRuntime) {
+    const std::vector<std::string> values = {
+        "", "abcdef\xe2\x82\xac", std::string(1000, 'a'), createText(5000), "\xf0\x9f\x9a\x97"
+    };
+    for (auto encoding : { CommonAPI::SomeIP::StringEncoding::UTF16LE, CommonAPI::SomeIP::StringEncoding::UTF16BE }) {
+        for (uint8_t lengthWidth : { 1, 2, 4 }) {
+            const CommonAPI::SomeIP::StringDeployment runtimeDepl(0, lengthWidth, encoding);
+            const Utf16StringDeployment depl(0, lengthWidth, encoding);
+            for (const auto &itsValue : values) {
+                if (lengthWidth == 1 && itsValue.size() > 100)
+                    continue;
+                EXPECT_EQ(writeRuntime(itsValue, runtimeDepl), writeDeployed(itsValue, depl));
+
+                CommonAPI::SomeIP::Message message = createMessage();
+                {
+                    CommonAPI::SomeIP::OutputStream outStream(message, false);
+                    outStream.writeValue(itsValue, &runtimeDepl);
+                    outStream.flush();
+                }
+                CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedValue(&depl);
+                CommonAPI::SomeIP::InputStream inStream(message, false);
+                inStream >> deployedValue;
+                EXPECT_FALSE(inStream.hasError());
+                EXPECT_EQ(itsValue, deployedValue.getValue());
+            }
+        }
+    }
+}
+
+/**
+* @test Invalid UTF-8 is rejected by the encoder and fails the output stream.
+*/
+TEST_F(Utf16Test, InvalidUtf8) {
+    const std::vector<std::string> invalid = {
+        "\x80", "a\xc3", "\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf0\x80\x80\xaf",
+        "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xe2\x82" "a", std::string(40, 'a') + "\xff"
+    };
+    const Utf16StringDeployment depl(0, 4, CommonAPI::SomeIP::StringEncoding::UTF16LE);
+    for (const auto &itsValue : invalid) {
+        Bytes buffer;
+        EXPECT_FALSE(Utf16::encode<Utf16::widenAscii>(itsValue, false, buffer)) << itsValue;
+
+        CommonAPI::SomeIP::Message message = createMessage();
+        CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedValue(itsValue, &depl);
+        CommonAPI::SomeIP::OutputStream outStream(message, false);
+        outStream << deployedValue;
+        EXPECT_TRUE(outStream.hasError()) << itsValue;
+    }
+}
+
+/**
+* @test Received strings with wrong byte order mark, missing terminator or unpaired
+* surrogates set the stream error and give an empty value.
+*/
+TEST_F(Utf16Test, InvalidUtf16) {
+    const Utf16StringDeployment depl(0, 2, CommonAPI::SomeIP::StringEncoding::UTF16LE);
+    const std::vector<Bytes> invalid = {
+        { 0xFE, 0xFF, 0x00, 0x61, 0x00, 0x00 },         // big endian byte order mark
+        { 0xFF, 0xFE, 0x61, 0x00 },                     // no terminator
+        { 0xFF, 0xFE, 0x61, 0x00, 0x00 },               // odd length
+        { 0xFF, 0xFE, 0x00, 0xD8, 0x00, 0x00 },         // high surrogate at the end
+        { 0xFF, 0xFE, 0x00, 0xD8, 0x61, 0x00, 0x00, 0x00 },
+        { 0xFF, 0xFE, 0x00, 0xDC, 0x00, 0xD8, 0x00, 0x00 }
+    };
+    for (const auto &itsBuffer : invalid) {
+        CommonAPI::SomeIP::Message message = createMessage();
+        {
+            const CommonAPI::SomeIP::ByteBufferDeployment bufferDepl(0, 0, 2);
+            CommonAPI::SomeIP::OutputStream outStream(message, false);
+            outStream.writeValue(itsBuffer, &bufferDepl);
+            outStream.flush();
+        }
+        CommonAPI::Deployable<std::string, Utf16StringDeployment> deployedValue(std::string("old"), &depl);
+        CommonAPI::SomeIP::InputStream inStream(message, false);
+        inStream >> deployedValue;
+        EXPECT_TRUE(inStream.hasError());
+        EXPECT_TRUE(deployedValue.getValue().empty());
+    }
+}
+
+/**
+* @test Strings with fixed length or UTF-8 encoding are left to the runtime.
+*/
+TEST_F(Utf16Test, RuntimeFallback) {
+    const std::string value("abcdef\xe2\x82\xac");
+    const CommonAPI::SomeIP::StringDeployment fixed(20, 0, CommonAPI::SomeIP::StringEncoding::UTF16BE);
+    const CommonAPI::SomeIP::StringDeployment utf8(0, 4, CommonAPI::SomeIP::StringEncoding::UTF8);
+    EXPECT_EQ(writeRuntime(value, fixed), writeDeployed(value, Utf16StringDeployment(20, 0, CommonAPI::SomeIP::StringEncoding::UTF16BE)));
+    EXPECT_EQ(writeRuntime(value, utf8), writeDeployed(value, Utf16StringDeployment(0, 4, CommonAPI::SomeIP::StringEncoding::UTF8)));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
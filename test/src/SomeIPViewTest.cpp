@@ -0,0 +1,205 @@
+/* Copyright (C) 2026 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+/**
+* @file SomeIPViewTest
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "CommonAPI/CommonAPI.hpp"
+
+#ifndef COMMONAPI_INTERNAL_COMPILATION
+#define COMMONAPI_INTERNAL_COMPILATION
+#endif
+#include <CommonAPI/SomeIP/Address.hpp>
+#include <CommonAPI/SomeIP/Message.hpp>
+#include <CommonAPI/SomeIP/OutputStream.hpp>
+#include <CommonAPI/SomeIP/InputStream.hpp>
+#include <CommonAPI/SomeIP/Types.hpp>
+
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceProxy.hpp"
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPDeployment.hpp"
+#include "v1/commonapi/someip/deploymenttest/@TYPE_COLLECTION_BASE_NAME@SomeIPViews.hpp"
+#include "v1/commonapi/someip/deploymenttest/TestInterfaceSomeIPStubAdapter.hpp"
+#include "DeploymentTestStub.h"
+
+namespace deploymenttest = v1_0::commonapi::someip::deploymenttest;
+namespace views = deploymenttest::@TYPE_COLLECTION_BASE_NAME@_;
+typedef @TYPE_COLLECTION_FULL_NAME@ Types;
+
+const std::string domain = "local";
+const std::string testAddress = "commonapi.someip.deploymenttest.TestInterface";
+const std::string connectionIdService = "service-sample";
+const std::string connectionIdClient = "client-sample";
+
+static Types::tStruct_field_type_depls createValue() {
+    Types::i16Array array = { 1, 2, 3, 4, 5, -6 };
+    Types::tUnion_d3 element = std::string("abc");
+    Types::tStruct_w1 inner(true, Types::i8BigArray{ 7, 8, 9 });
+    return Types::tStruct_field_type_depls(array, element, inner);
+}
+
+static CommonAPI::SomeIP::Message createMessage(const Types::tStruct_field_type_depls &_value,
+                                                const Types::tUnion_d2 &_union) {
+    CommonAPI::SomeIP::Message message = CommonAPI::SomeIP::Message::createMethodCall(
+        CommonAPI::SomeIP::Address(0, 0, 0, 0), 536, false);
+    CommonAPI::SomeIP::OutputStream outStream(message, false);
+    outStream.writeValue(_value, &views::tStruct_field_type_deplsDeployment);
+    outStream.writeValue(_union, &views::tUnion_d2Deployment);
+    EXPECT_FALSE(outStream.hasError());
+    outStream.flush();
+    return message;
+}
+
+// Answers mView_io from the views and counts the calls that were dispatched to them
+class ViewTestStub
+    : public deploymenttest::DeploymentTestStub,
+      public deploymenttest::TestInterfaceSomeIPViewStub {
+public:
+    using deploymenttest::DeploymentTestStub::mView_io;
+
+    virtual void mView_io(const std::shared_ptr<CommonAPI::ClientId> _client,
+                          const views::tStruct_field_type_deplsView &_inArg,
+                          const views::tUnion_d2View &_unionArg,
+                          mView_ioReply_t _reply) {
+        (void)_client;
+        viewCalls_++;
+        _reply(_inArg.materialize(), _unionArg.getSelector());
+    }
+
+    std::atomic<int> viewCalls_{ 0 };
+};
+
+class Environment: public ::testing::Environment {
+public:
+    virtual ~Environment() {
+    }
+
+    virtual void SetUp() {
+    }
+
+    virtual void TearDown() {
+    }
+};
+
+class ViewTest: public ::testing::Test {
+protected:
+    void SetUp() {
+    }
+
+    void TearDown() {
+    }
+};
+
+/**
+* @test A struct view decodes the fields of the serialized struct and materializes the value
+*/
+TEST_F(ViewTest, StructView) {
+    const Types::tStruct_field_type_depls value = createValue();
+    CommonAPI::SomeIP::Message message = createMessage(value, Types::tUnion_d2(uint8_t(42)));
+
+    views::tStruct_field_type_deplsView view(message.getBodyData(), message.getBodyLength(), false);
+    ASSERT_TRUE(view.isValid());
+
+    auto array = view.getArrayMember();
+    ASSERT_EQ(value.getArrayMember().size(), array.size());
+    for (std::size_t i = 0; i < array.size(); i++) {
+        EXPECT_EQ(value.getArrayMember()[i], array[i]);
+    }
+    auto element = view.getUnionMember();
+    EXPECT_TRUE(element.isStr());
+    EXPECT_EQ(std::string("abc"), element.getStr().str());
+    auto inner = view.getStructMember();
+    EXPECT_TRUE(inner.getBooleanMember());
+    EXPECT_EQ(3u, inner.getArrayMember().size());
+
+    EXPECT_EQ(value, view.materialize());
+}
+
+/**
+* @test A union view reports the contained element and decodes only that one
+*/
+TEST_F(ViewTest, UnionView) {
+    CommonAPI::SomeIP::Message message = createMessage(createValue(), Types::tUnion_d2(int16_t(-300)));
+
+    CommonAPI::SomeIP::View::Reader reader(message.getBodyData(), message.getBodyLength(), false);
+    ASSERT_TRUE(views::tStruct_field_type_deplsView::skip(reader));
+    views::tUnion_d2View view;
+    ASSERT_TRUE(views::tUnion_d2View::read(reader, view));
+    EXPECT_EQ(0u, reader.getRemaining());
+
+    EXPECT_EQ(2u, view.getSelector());
+    EXPECT_FALSE(view.isM_byte());
+    EXPECT_TRUE(view.isM_word());
+    EXPECT_EQ(-300, view.getM_word());
+    EXPECT_EQ(Types::tUnion_d2(int16_t(-300)), view.materialize());
+}
+
+/**
+* @test Views over truncated or corrupted data are invalid instead of reading beyond the data
+*/
+TEST_F(ViewTest, MalformedData) {
+    CommonAPI::SomeIP::Message message = createMessage(createValue(), Types::tUnion_d2(uint8_t(42)));
+    std::vector<uint8_t> data(message.getBodyData(), message.getBodyData() + message.getBodyLength());
+
+    for (std::size_t size = 0; size < data.size(); size++) {
+        CommonAPI::SomeIP::View::Reader reader(data.data(), size, false);
+        views::tStruct_field_type_deplsView structView;
+        views::tUnion_d2View unionView;
+        EXPECT_FALSE(views::tStruct_field_type_deplsView::read(reader, structView)
+                     && views::tUnion_d2View::read(reader, unionView));
+    }
+
+    // the array length of i16Array claims more bytes than there are
+    data[0] = 0xFF;
+    data[1] = 0xFF;
+    views::tStruct_field_type_deplsView view(data.data(), data.size(), false);
+    EXPECT_FALSE(view.isValid());
+}
+
+/**
+* @test A stub that implements the view stub receives the call as views
+*/
+TEST_F(ViewTest, DispatchToViewStub) {
+    std::shared_ptr<CommonAPI::Runtime> runtime = CommonAPI::Runtime::get();
+    ASSERT_TRUE((bool)runtime);
+
+    std::shared_ptr<ViewTestStub> stub = std::make_shared<ViewTestStub>();
+    ASSERT_TRUE(runtime->registerService(domain, testAddress, stub, connectionIdService));
+
+    std::shared_ptr<deploymenttest::TestInterfaceProxy<>> proxy
+        = runtime->buildProxy<deploymenttest::TestInterfaceProxy>(domain, testAddress, connectionIdClient);
+    int i = 0;
+    while (!proxy->isAvailable() && i++ < 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(proxy->isAvailable());
+
+    const Types::tStruct_field_type_depls value = createValue();
+    CommonAPI::CallStatus callStatus;
+    Types::tStruct_field_type_depls outArg;
+    uint32_t selector = 0;
+    proxy->mView_io(value, Types::tUnion_d2(std::string("view")), callStatus, outArg, selector);
+
+    EXPECT_EQ(CommonAPI::CallStatus::SUCCESS, callStatus);
+    EXPECT_EQ(value, outArg);
+    EXPECT_EQ(3u, selector);
+    EXPECT_EQ(1, stub->viewCalls_.load());
+
+    ASSERT_TRUE(runtime->unregisterService(domain, ViewTestStub::StubInterface::getInterface(), testAddress));
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new Environment());
+    return RUN_ALL_TESTS();
+}
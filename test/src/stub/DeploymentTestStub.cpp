@@ -228,6 +228,13 @@ void DeploymentTestStub::mBCastTrigger(const std::shared_ptr<CommonAPI::ClientId
             fireBArray_anonEvent(outArray);
         }
         break;
+    case TestInterface::tEnumTriggerType::T_SHARED:
+        {
+            CommonAPI::ByteBuffer outBuffer(_parameter);
+            std::iota (std::begin(outBuffer), std::end(outBuffer), 0);
+            fireBSharedEvent(outBuffer);
+        }
+        break;
     default:
         break;
     }